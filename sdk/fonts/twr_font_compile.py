@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+#
+# Compile font saved by LCD Image Converter (XML) into packed font
+#
+# Rows of glyph are packed to bit stream without any padding, set bit is drawn pixel.
+# Glyphs are sorted by code of ISO-8859-2 encoding and indexed by direct index table.
+#
+# Usage: twr_font_compile.py [--name NAME] [--subset CHARACTERS] FONT.xml OUTPUT.c
+#
+
+import argparse
+import base64
+import re
+import struct
+import sys
+import zlib
+from xml.etree import ElementTree
+
+# Must match TWR_FONT_GLYPH_MAX in twr_font_common.h
+GLYPH_MAX = 40
+
+INDEX_NONE = 0xff
+
+
+def png_decode(data):
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('not PNG image')
+
+    position = 8
+    idat = b''
+
+    while position < len(data):
+        length, kind = struct.unpack('>I4s', data[position:position + 8])
+        chunk = data[position + 8:position + 8 + length]
+        position += 12 + length
+
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'IDAT':
+            idat += chunk
+
+    channels = {0: 1, 2: 3, 4: 2, 6: 4}.get(color)
+
+    if depth != 8 or channels is None or interlace != 0:
+        raise ValueError('unsupported PNG format')
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows = []
+    previous = bytearray(stride)
+
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+
+        for x in range(stride):
+            a = line[x - channels] if x >= channels else 0
+            b = previous[x]
+            c = previous[x - channels] if x >= channels else 0
+
+            if kind == 1:
+                line[x] = (line[x] + a) & 0xff
+            elif kind == 2:
+                line[x] = (line[x] + b) & 0xff
+            elif kind == 3:
+                line[x] = (line[x] + (a + b) // 2) & 0xff
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                predictor = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[x] = (line[x] + predictor) & 0xff
+
+        rows.append(line)
+        previous = line
+
+    pixels = []
+
+    for line in rows:
+        row = []
+
+        for x in range(width):
+            pixel = line[x * channels:(x + 1) * channels]
+            gray = sum(pixel[:3]) // 3 if channels >= 3 else pixel[0]
+            alpha = pixel[-1] if channels in (2, 4) else 255
+            row.append(alpha >= 128 and gray < 128)
+
+        pixels.append(row)
+
+    return width, height, pixels
+
+
+def load_font(path, subset):
+    root = ElementTree.parse(path).getroot()
+    glyphs = {}
+
+    for char in root.iter('char'):
+        character = chr(int(char.get('code'), 16))
+
+        if subset is not None and character not in subset:
+            continue
+
+        try:
+            code = character.encode('iso8859-2')[0]
+        except UnicodeEncodeError:
+            sys.exit('%s: character %r is not in ISO-8859-2' % (path, character))
+
+        picture = char.find('picture')
+
+        glyphs[code] = png_decode(base64.b64decode(picture.text))
+
+    return root.get('name'), glyphs
+
+
+def compile_font(name, glyphs, source):
+    codes = sorted(glyphs)
+
+    if not codes:
+        sys.exit('no characters selected')
+
+    if len(codes) >= INDEX_NONE:
+        sys.exit('too many characters for index table')
+
+    bits = []
+    table = []
+
+    for code in codes:
+        width, height, pixels = glyphs[code]
+
+        if width > GLYPH_MAX or height > GLYPH_MAX:
+            sys.exit('character 0x%02x is larger than %d pixels' % (code, GLYPH_MAX))
+
+        table.append((code, width, height, len(bits)))
+
+        for row in pixels:
+            bits.extend(row)
+
+    bitmaps = []
+
+    for i in range(0, len(bits), 8):
+        byte = 0
+
+        for bit, value in enumerate(bits[i:i + 8]):
+            if value:
+                byte |= 0x80 >> bit
+
+        bitmaps.append(byte)
+
+    # Decoder reads two bytes at once
+    bitmaps.append(0)
+
+    first = codes[0]
+    index = [INDEX_NONE] * (codes[-1] - first + 1)
+
+    for position, code in enumerate(codes):
+        index[code - first] = position
+
+    def rows(values, per_row, fmt):
+        return ',\n'.join('    ' + ', '.join(fmt % value for value in values[i:i + per_row]) for i in range(0, len(values), per_row))
+
+    out = []
+    out.append('// Generated by twr_font_compile.py from %s, do not edit' % source)
+    out.append('')
+    out.append('#include <twr_font_common.h>')
+    out.append('')
+    out.append('static const uint8_t %s_bitmaps[%d] = {' % (name, len(bitmaps)))
+    out.append(rows(bitmaps, 16, '0x%02x'))
+    out.append('};')
+    out.append('')
+    out.append('static const twr_font_glyph_t %s_glyphs[%d] = {' % (name, len(table)))
+    out.append(',\n'.join('    {0x%02x, %d, %d, %d}' % glyph for glyph in table))
+    out.append('};')
+    out.append('')
+    out.append('static const uint8_t %s_index[%d] = {' % (name, len(index)))
+    out.append(rows(index, 16, '0x%02x'))
+    out.append('};')
+    out.append('')
+    out.append('const twr_font_t %s = { %d, NULL, 0x%02x, %d, %s_index, %s_glyphs, %s_bitmaps };' %
+               (name, len(table), first, len(index), name, name, name))
+    out.append('')
+
+    return '\n'.join(out), len(bitmaps) + len(table) * 8 + len(index)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compile LCD Image Converter font into packed font')
+    parser.add_argument('--name', help='C name of font (default is name from XML)')
+    parser.add_argument('--subset', help='compile only given characters, for example digits of large font')
+    parser.add_argument('input', help='font XML file')
+    parser.add_argument('output', help='output C file')
+    args = parser.parse_args()
+
+    name, glyphs = load_font(args.input, args.subset)
+
+    source, size = compile_font(args.name or name, glyphs, re.sub(r'.*/', '', args.input))
+
+    with open(args.output, 'w') as f:
+        f.write(source)
+
+    print('%s: %d characters, %d bytes' % (args.output, len(glyphs), size))
+
+
+if __name__ == '__main__':
+    main()
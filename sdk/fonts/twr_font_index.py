@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+#
+# Add direct index table to font generated by LCD Image Converter
+#
+# Usage: twr_font_index.py twr_font_ubuntu_13.c [...]
+#
+
+import re
+import sys
+
+INDEX_NONE = 0xff
+
+CHAR_PATTERN = re.compile(r'^  \{0x([0-9a-fA-F]+),', re.M)
+DEF_PATTERN = re.compile(r'^const twr_font_t (\w+) = \{ (\d+), (\w+)_array[^}]*\};\n', re.M)
+INDEX_PATTERN = re.compile(r'^static const uint8_t \w+_index\[\d+\] = \{\n.*?^\};\n\n', re.M | re.S)
+
+
+def index_font(path):
+    with open(path) as f:
+        source = f.read()
+
+    # Characters of "#if ... #else" variants are listed twice, only the first one is emitted by preprocessor
+    codes = []
+
+    for match in CHAR_PATTERN.finditer(source):
+        code = int(match.group(1), 16)
+
+        if not codes or codes[-1] != code:
+            codes.append(code)
+
+    if codes != sorted(set(codes)):
+        sys.exit('%s: characters are not sorted by code' % path)
+
+    if len(codes) >= INDEX_NONE:
+        sys.exit('%s: too many characters for index table' % path)
+
+    definition = DEF_PATTERN.search(source)
+
+    if definition is None:
+        sys.exit('%s: font definition not found' % path)
+
+    name = definition.group(1)
+    first = codes[0]
+    length = codes[-1] - first + 1
+
+    index = [INDEX_NONE] * length
+
+    for position, code in enumerate(codes):
+        index[code - first] = position
+
+    lines = []
+
+    for row in range(0, length, 16):
+        lines.append('    ' + ', '.join('0x%02x' % entry for entry in index[row:row + 16]))
+
+    table = 'static const uint8_t %s_index[%d] = {\n%s\n};\n\n' % (name, length, ',\n'.join(lines))
+
+    font = 'const twr_font_t %s = { %d, %s_array, 0x%02x, %d, %s_index };\n' % (name, len(codes), name, first, length, name)
+
+    source = INDEX_PATTERN.sub('', source)
+
+    definition = DEF_PATTERN.search(source)
+
+    source = source[:definition.start()] + table + font + source[definition.end():]
+
+    with open(path, 'w') as f:
+        f.write(source)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        sys.exit('usage: %s FONT.c [FONT.c ...]' % sys.argv[0])
+
+    for path in sys.argv[1:]:
+        index_font(path)
@@ -58,6 +58,14 @@ if(DEFINED SCHEDULER_INTERVAL)
     add_definitions("-DTWR_SCHEDULER_INTERVAL_MS=${SCHEDULER_INTERVAL}")
 endif()
 
+if(DEFINED SCHEDULER_TICKLESS)
+    add_definitions("-DTWR_SCHEDULER_TICKLESS=${SCHEDULER_TICKLESS}")
+endif()
+
+if(DEFINED SCHEDULER_PROFILER)
+    add_definitions("-DTWR_SCHEDULER_PROFILER=${SCHEDULER_PROFILER}")
+endif()
+
 add_definitions("-DBAND=868")
 
 # Setup utils
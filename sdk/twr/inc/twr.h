@@ -96,6 +96,7 @@
 #include <twr_flood_detector.h>
 #include <twr_font_common.h>
 #include <twr_gfx.h>
+#include <twr_gfx_chart.h>
 #include <twr_image.h>
 #include <twr_onewire_ds2484.h>
 #include <twr_onewire_gpio.h>
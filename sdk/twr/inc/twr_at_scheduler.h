@@ -0,0 +1,20 @@
+#ifndef _TWR_AT_SCHEDULER_H
+#define _TWR_AT_SCHEDULER_H
+
+#include <twr_common.h>
+#include <twr_atci.h>
+#include <twr_scheduler.h>
+
+//! @addtogroup twr_at_scheduler twr_at_scheduler
+//! @brief AT commands for scheduler diagnostics (available only with TWR_SCHEDULER_PROFILER)
+//! @{
+
+#define TWR_AT_SCHEDULER_COMMANDS {"$SCHED", twr_at_scheduler_profile, NULL, NULL, NULL, "Show task profile sorted by total time, event queue statistics and reset counters"}
+
+//! @brief Print task profile table and reset counters
+
+bool twr_at_scheduler_profile(void);
+
+//! @}
+
+#endif // _TWR_AT_SCHEDULER_H
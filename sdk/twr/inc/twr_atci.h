@@ -136,7 +136,7 @@ bool twr_atci_is_comma(twr_atci_param_t *param);
 
 bool twr_atci_is_quotation_mark(twr_atci_param_t *param);
 
-//! @brief @brief Set callback function for scan if uart is active. Used for low-power when USB is disconnected (default callback: twr_system_get_vbus_sense, scan_interval: 200)
+//! @brief @brief Set callback function for scan if uart is active. Used for low-power when USB is disconnected (by default twr_system_get_vbus_sense is called on EXTI of VBUS sense pin PA12 without scanning)
 //! @param[in] callback Callback function address
 //! @param[in] scan_interval Desired scan interval in ticks
 
@@ -69,6 +69,7 @@ struct twr_button_t
     twr_tick_t _tick_hold_threshold;
     int _state;
     bool _hold_signalized;
+    bool _scan_on_demand;
     twr_scheduler_task_id_t _task_id;
 };
 
@@ -121,6 +122,17 @@ void twr_button_set_click_timeout(twr_button_t *self, twr_tick_t click_timeout);
 
 void twr_button_set_hold_time(twr_button_t *self, twr_tick_t hold_time);
 
+//! @brief Set scanning on demand (released button is not scanned until twr_button_scan is called, typically from EXTI of the input)
+//! @param[in] self Instance
+//! @param[in] on_demand true to stop scanning once button is released, false to scan periodically
+
+void twr_button_set_scan_on_demand(twr_button_t *self, bool on_demand);
+
+//! @brief Scan input now, button scanned on demand keeps scanning until it is released
+//! @param[in] self Instance
+
+void twr_button_scan(twr_button_t *self);
+
 //! @}
 
 #endif // _TWR_BUTTON_H
@@ -11,10 +11,10 @@
 
 #define TWR_DATA_STREAM_FLOAT_BUFFER(NAME, NUMBER_OF_SAMPLES) \
     float NAME##_feed[NUMBER_OF_SAMPLES]; \
-    float NAME##_sort[NUMBER_OF_SAMPLES]; \
+    float NAME##_sorted[NUMBER_OF_SAMPLES]; \
     twr_data_stream_buffer_t NAME = { \
             .feed = NAME##_feed, \
-            .sort = NAME##_sort, \
+            .sorted = NAME##_sorted, \
             .number_of_samples = NUMBER_OF_SAMPLES, \
             .type=TWR_DATA_STREAM_TYPE_FLOAT \
     };
@@ -23,19 +23,32 @@
 
 #define TWR_DATA_STREAM_INT_BUFFER(NAME, NUMBER_OF_SAMPLES) \
     int NAME##_feed[NUMBER_OF_SAMPLES]; \
-    int NAME##_sort[NUMBER_OF_SAMPLES]; \
+    int NAME##_sorted[NUMBER_OF_SAMPLES]; \
     twr_data_stream_buffer_t NAME = { \
             .feed = NAME##_feed, \
-            .sort = NAME##_sort, \
+            .sorted = NAME##_sorted, \
             .number_of_samples = NUMBER_OF_SAMPLES, \
             .type=TWR_DATA_STREAM_TYPE_INT \
     };
 
+//! @brief Macro for int16 fixed-point data stream buffer declaration (values are fed and returned multiplied by SCALE)
+
+#define TWR_DATA_STREAM_INT16_BUFFER(NAME, NUMBER_OF_SAMPLES, SCALE) \
+    int16_t NAME##_feed[NUMBER_OF_SAMPLES]; \
+    int16_t NAME##_sorted[NUMBER_OF_SAMPLES]; \
+    twr_data_stream_buffer_t NAME = { \
+            .feed = NAME##_feed, \
+            .sorted = NAME##_sorted, \
+            .number_of_samples = NUMBER_OF_SAMPLES, \
+            .type=TWR_DATA_STREAM_TYPE_INT16, \
+            .scale = SCALE \
+    };
+
 //! @brief Macro for float data stream array declaration
 
 #define TWR_DATA_STREAM_FLOAT_ARRAY(NAME, COUNT, NUMBER_OF_SAMPLES) \
     static float NAME##_feed[(COUNT)][(NUMBER_OF_SAMPLES)]; \
-    static float NAME##_sort[(NUMBER_OF_SAMPLES)]; \
+    static float NAME##_sorted[(COUNT)][(NUMBER_OF_SAMPLES)]; \
     static twr_data_stream_buffer_t NAME##_buffer[(COUNT)]; \
     static twr_data_stream_t NAME[(COUNT)];
 
@@ -45,18 +58,32 @@
     for (size_t i = 0; i < (COUNT); i++) \
     { \
         NAME##_buffer[i].feed = NAME##_feed[i]; \
-        NAME##_buffer[i].sort = NAME##_sort; \
+        NAME##_buffer[i].sorted = NAME##_sorted[i]; \
         NAME##_buffer[i].number_of_samples = (sizeof(NAME##_feed[i]) / sizeof(float)); \
         NAME##_buffer[i].type=TWR_DATA_STREAM_TYPE_FLOAT; \
         twr_data_stream_init(&NAME[i], (MIN_NUMBER_OF_SAMPLES), &NAME##_buffer[i]); \
     }
 
+//! @brief Macro for rollup level declaration
+//! @param[in] NAME Level name
+//! @param[in] FOLD Number of values (first level) or records of previous level folded into one record
+//! @param[in] NUMBER_OF_RECORDS Number of records kept by level
+
+#define TWR_DATA_STREAM_ROLLUP_LEVEL(NAME, FOLD, NUMBER_OF_RECORDS) \
+    twr_data_stream_rollup_record_t NAME##_records[NUMBER_OF_RECORDS]; \
+    twr_data_stream_rollup_level_t NAME = { \
+            .records = NAME##_records, \
+            .number_of_records = NUMBER_OF_RECORDS, \
+            .fold = FOLD \
+    };
+
 //! @brief Data stream type
 
 typedef enum
 {
     TWR_DATA_STREAM_TYPE_FLOAT = 0,
-    TWR_DATA_STREAM_TYPE_INT = 1
+    TWR_DATA_STREAM_TYPE_INT = 1,
+    TWR_DATA_STREAM_TYPE_INT16 = 2
 
 } twr_data_stream_type_t;
 
@@ -65,13 +92,50 @@ typedef enum
 typedef struct
 {
     void *feed;
-    void *sort;
+
+    // Samples of window kept in ascending order across feeds, so unlike the former scratch buffer it must not be
+    // shared between streams (field was renamed from sort to break such code at compile time), every feed moves
+    // up to number_of_samples elements of it
+    void *sorted;
     int number_of_samples;
     twr_data_stream_type_t type;
 
+    // Fixed-point scale of TWR_DATA_STREAM_TYPE_INT16 samples
+    int scale;
+
 } twr_data_stream_buffer_t;
 
 
+//! @brief Summary statistics of data stream (fixed-point values are converted by scale)
+
+typedef struct
+{
+    //! @brief Number of samples in window
+    int count;
+
+    //! @brief Mean value
+    float mean;
+
+    //! @brief Population variance
+    float variance;
+
+    //! @brief Minimal value
+    float min;
+
+    //! @brief Maximal value
+    float max;
+
+    //! @brief Median value
+    float median;
+
+    //! @brief First (oldest) value
+    float first;
+
+    //! @brief Last (newest) value
+    float last;
+
+} twr_data_stream_summary_t;
+
 //! @brief Data stream instance
 
 typedef struct twr_data_stream_t twr_data_stream_t;
@@ -84,6 +148,68 @@ struct twr_data_stream_t
     int _counter;
     int _min_number_of_samples;
     int _feed_head;
+
+    // Running sum of samples in window, float streams use compensated (Kahan) summation
+    union
+    {
+        int64_t _int;
+
+        struct
+        {
+            float _value;
+            float _compensation;
+
+        } _float;
+
+    } _sum;
+};
+
+//! @endcond
+
+//! @brief Rollup record summarizing values of one period
+
+typedef struct
+{
+    //! @brief Minimal value
+    float min;
+
+    //! @brief Average value
+    float average;
+
+    //! @brief Maximal value
+    float max;
+
+} twr_data_stream_rollup_record_t;
+
+//! @brief Rollup level holding records of one resolution
+
+typedef struct
+{
+    twr_data_stream_rollup_record_t *records;
+    int number_of_records;
+    int fold;
+
+    //! @cond
+
+    twr_data_stream_rollup_record_t _pending;
+    int _pending_count;
+    int _head;
+    int _length;
+
+    //! @endcond
+
+} twr_data_stream_rollup_level_t;
+
+//! @brief Rollup instance
+
+typedef struct twr_data_stream_rollup_t twr_data_stream_rollup_t;
+
+//! @cond
+
+struct twr_data_stream_rollup_t
+{
+    twr_data_stream_rollup_level_t **_levels;
+    int _number_of_levels;
 };
 
 //! @endcond
@@ -96,7 +222,7 @@ struct twr_data_stream_t
 
 void twr_data_stream_init(twr_data_stream_t *self, int min_number_of_samples, twr_data_stream_buffer_t *buffer);
 
-//! @brief Feed data into stream instance
+//! @brief Feed data into stream instance, the sorted window is updated by insertion in O(number_of_samples)
 //! @param[in] self Instance
 //! @param[in] data Input data to be fed into data stream
 
@@ -123,7 +249,11 @@ twr_data_stream_type_t twr_data_stream_get_type(twr_data_stream_t *self);
 
 int twr_data_stream_get_number_of_samples(twr_data_stream_t *self);
 
-//! @brief Get average value of data stream
+//! @brief Get fixed-point scale (real value is stored value divided by scale, 1 for non fixed-point streams)
+
+int twr_data_stream_get_scale(twr_data_stream_t *self);
+
+//! @brief Get average value of data stream (int average is truncated, int16 average is rounded to nearest)
 //! @param[in] self Instance
 //! @param[out] self Pointer to buffer where result will be stored
 //! @return true On success (desired value is available)
@@ -164,7 +294,7 @@ bool twr_data_stream_get_last(twr_data_stream_t *self, void *result);
 
 bool twr_data_stream_get_nth(twr_data_stream_t *self, int n, void *result);
 
-//! @brief Get max value
+//! @brief Get max value (read from sorted window in constant time)
 //! @param[in] self Instance
 //! @param[out] self Pointer to buffer where result will be stored
 //! @return true On success (desired value is available)
@@ -172,7 +302,7 @@ bool twr_data_stream_get_nth(twr_data_stream_t *self, int n, void *result);
 
 bool twr_data_stream_get_max(twr_data_stream_t *self, void *result);
 
-//! @brief Get min value
+//! @brief Get min value (read from sorted window in constant time)
 //! @param[in] self Instance
 //! @param[out] self Pointer to buffer where result will be stored
 //! @return true On success (desired value is available)
@@ -180,6 +310,58 @@ bool twr_data_stream_get_max(twr_data_stream_t *self, void *result);
 
 bool twr_data_stream_get_min(twr_data_stream_t *self, void *result);
 
+//! @brief Get summary statistics of data stream in single pass over buffer
+//! @param[in] self Instance
+//! @param[out] summary Pointer to summary where result will be stored
+//! @return true On success (desired value is available)
+//! @return false On failure (desired value is not available)
+
+bool twr_data_stream_get_summary(twr_data_stream_t *self, twr_data_stream_summary_t *summary);
+
+//! @brief Initialize rollup instance
+//! @param[in] self Instance
+//! @param[in] levels Levels ordered from the finest resolution, every level folds records of the previous one
+//! @param[in] number_of_levels Number of levels
+
+void twr_data_stream_rollup_init(twr_data_stream_rollup_t *self, twr_data_stream_rollup_level_t **levels, int number_of_levels);
+
+//! @brief Feed value into rollup instance, NaN and infinite values are ignored
+//! @param[in] self Instance
+//! @param[in] value Input value
+
+void twr_data_stream_rollup_feed(twr_data_stream_rollup_t *self, float value);
+
+//! @brief Reset all levels of rollup instance
+//! @param[in] self Instance
+
+void twr_data_stream_rollup_reset(twr_data_stream_rollup_t *self);
+
+//! @brief Get number of complete records of level
+//! @param[in] self Instance
+//! @param[in] level Level index (0 is the finest resolution)
+//! @return Number of records
+
+int twr_data_stream_rollup_get_length(twr_data_stream_rollup_t *self, int level);
+
+//! @brief Get complete record of level
+//! @param[in] self Instance
+//! @param[in] level Level index (0 is the finest resolution)
+//! @param[in] n Position from the newest record (0 is the newest)
+//! @param[out] record Pointer to record where result will be stored
+//! @return true On success (desired record is available)
+//! @return false On failure (desired record is not available)
+
+bool twr_data_stream_rollup_get_record(twr_data_stream_rollup_t *self, int level, int n, twr_data_stream_rollup_record_t *record);
+
+//! @brief Get record summarizing all complete records of level
+//! @param[in] self Instance
+//! @param[in] level Level index (0 is the finest resolution)
+//! @param[out] record Pointer to record where result will be stored
+//! @return true On success (level has at least one record)
+//! @return false On failure (level has no record yet)
+
+bool twr_data_stream_rollup_get_total(twr_data_stream_rollup_t *self, int level, twr_data_stream_rollup_record_t *record);
+
 //! @}
 
 #endif // _TWR_DATA_STREAM_H
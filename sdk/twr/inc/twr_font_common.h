@@ -17,9 +17,31 @@ typedef struct  {
     const twr_font_image_t *image;
 } twr_font_char_t;
 
+// Glyph of packed font, its rows are stored in bitmaps without padding starting at bit offset, set bit is drawn
+typedef struct  {
+    uint16_t code;
+    uint8_t width;
+    uint8_t height;
+    uint32_t offset;
+} twr_font_glyph_t;
+
+// Entry of index table for code without glyph
+#define TWR_FONT_INDEX_NONE 0xff
+
+// Largest width and height of glyph of packed font (column of glyph drawn rotated is built on stack)
+#define TWR_FONT_GLYPH_MAX 40
+
 typedef struct  {
     uint16_t length;
+    // Characters sorted by code, NULL for packed font
     const twr_font_char_t *chars;
+    // Optional direct index table, entry for code (index_first + n) is position in chars or TWR_FONT_INDEX_NONE
+    uint16_t index_first;
+    uint16_t index_length;
+    const uint8_t *index;
+    // Packed font generated by fonts/twr_font_compile.py, glyphs are sorted by code
+    const twr_font_glyph_t *glyphs;
+    const uint8_t *bitmaps;
 } twr_font_t;
 
 //
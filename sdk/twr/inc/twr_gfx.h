@@ -17,6 +17,30 @@ typedef struct
 
 } twr_gfx_caps_t;
 
+//! @brief Bitmap of 1-bpp rows, first pixel of row is MSB of its byte and rows may start at any bit
+
+typedef struct
+{
+    //! @brief Bits of rows
+    const uint8_t *data;
+
+    //! @brief Bit of data with the first pixel
+    uint32_t offset;
+
+    //! @brief Bits from start of row to start of the next one
+    uint32_t stride;
+
+    //! @brief Width in pixels
+    int width;
+
+    //! @brief Height in pixels
+    int height;
+
+    //! @brief Pixels of cleared bits are drawn (font image format) if true, pixels of set bits (packed font) if false
+    bool inverted;
+
+} twr_gfx_bitmap_t;
+
 //! @brief Display driver interface
 
 typedef struct
@@ -39,6 +63,19 @@ typedef struct
     //! @brief Callback for get capabilities
     twr_gfx_caps_t (*get_caps)(void *self);
 
+    //! @brief Callback for draw bitmap lying fully within display (optional, can be NULL)
+    //! @param[in] mirror Bitmap is rotated by 180 degrees, its first pixel is drawn to right bottom corner
+    void (*draw_bitmap)(void *self, int left, int top, const twr_gfx_bitmap_t *bitmap, bool mirror, uint32_t color);
+
+    //! @brief Callback for fill rectangle given by inclusive corners within display, also used for spans (optional, can be NULL)
+    void (*fill_rectangle)(void *self, int x0, int y0, int x1, int y1, uint32_t color);
+
+    //! @brief Callback for scroll of rectangle given by inclusive corners within display by dx or dy pixels (optional, can be NULL)
+    //! @param[in] dx Pixels to move right (negative to left), dy is zero then
+    //! @param[in] dy Pixels to move down (negative up), dx is zero then
+    //! Pixels vacated by scroll keep their previous state
+    void (*scroll)(void *self, int x0, int y0, int x1, int y1, int dx, int dy);
+
 } twr_gfx_driver_t;
 
 //! @brief Rotation
@@ -75,9 +112,39 @@ typedef enum
 
 } twr_gfx_round_corner_t;
 
-//! @brief Instance
+//! @brief Horizontal alignment of string to anchor
+
+typedef enum
+{
+    //! @brief String starts at anchor
+    TWR_GFX_ALIGN_LEFT = 0,
+
+    //! @brief String is centered on anchor
+    TWR_GFX_ALIGN_CENTER = 1,
+
+    //! @brief String ends at anchor
+    TWR_GFX_ALIGN_RIGHT = 2
+
+} twr_gfx_align_t;
+
+//! @brief Bounding box
 
 typedef struct
+{
+    int left;
+    int top;
+    int width;
+    int height;
+
+} twr_gfx_box_t;
+
+//! @brief Instance
+
+typedef struct twr_gfx_t twr_gfx_t;
+
+//! @cond
+
+struct twr_gfx_t
 {
     void *_display;
     const twr_gfx_driver_t *_driver;
@@ -85,7 +152,11 @@ typedef struct
     const twr_font_t *_font;
     twr_gfx_caps_t _caps;
 
-} twr_gfx_t;
+    // Pixel function of current rotation, coordinates have to be within display
+    void (*_pixel)(twr_gfx_t *self, int x, int y, uint32_t color);
+};
+
+//! @endcond
 
 //! @brief Initialize button
 //! @param[in] self Instance
@@ -151,6 +222,12 @@ int twr_gfx_draw_char(twr_gfx_t *self, int left, int top, uint8_t ch, uint32_t c
 
 int twr_gfx_calc_char_width(twr_gfx_t *self, uint8_t ch);
 
+//! @brief Calc height character
+//! @param[in] self Instance
+//! @return Height of printed character
+
+int twr_gfx_calc_char_height(twr_gfx_t *self, uint8_t ch);
+
 //! @brief Display draw string
 //! @param[in] self Instance
 //! @param[in] left Pixels from left edge
@@ -168,6 +245,29 @@ int twr_gfx_draw_string(twr_gfx_t *self, int left, int top, char *str, uint32_t
 
 int twr_gfx_calc_string_width(twr_gfx_t *self,  char *str);
 
+//! @brief Display draw string aligned to anchor, glyphs are looked up only once for measuring and drawing
+//! @param[in] self Instance
+//! @param[in] x Pixels from left edge to anchor
+//! @param[in] top Pixels from top edge
+//! @param[in] *str String to be printed
+//! @param[in] align Alignment of string to anchor
+//! @param[in] color
+//! @param[out] box Bounding box of printed string (can be NULL)
+//! @return Pixels from left edge behind printed string
+
+int twr_gfx_draw_string_aligned(twr_gfx_t *self, int x, int top, char *str, twr_gfx_align_t align, uint32_t color, twr_gfx_box_t *box);
+
+//! @brief Calc bounding box of string aligned to anchor without drawing it
+//! @param[in] self Instance
+//! @param[in] x Pixels from left edge to anchor
+//! @param[in] top Pixels from top edge
+//! @param[in] *str String to be measured
+//! @param[in] align Alignment of string to anchor
+//! @param[out] box Bounding box the string would have when printed by twr_gfx_draw_string_aligned
+//! @return Pixels from left edge behind string
+
+int twr_gfx_calc_string_box(twr_gfx_t *self, int x, int top, char *str, twr_gfx_align_t align, twr_gfx_box_t *box);
+
 //! @brief Display string
 //! @param[in] self Instance
 //! @param[in] left Pixels from left edge
@@ -257,6 +357,18 @@ void twr_gfx_draw_round_corner(twr_gfx_t *self, int x0, int y0, int radius, twr_
 
 void twr_gfx_draw_fill_round_corner(twr_gfx_t *self, int x0, int y0, int radius, twr_gfx_round_corner_t corner, uint32_t color);
 
+//! @brief Display scroll rectangle given by inclusive corners horizontally, pixels vacated by scroll keep their previous state
+//! @param[in] self Instance
+//! @param[in] x0 Pixels from left edge of the first corner
+//! @param[in] y0 Pixels from top edge of the first corner
+//! @param[in] x1 Pixels from left edge of the opposite corner
+//! @param[in] y1 Pixels from top edge of the opposite corner
+//! @param[in] dx Pixels to move right (negative to left)
+//! @return true On success
+//! @return false If driver cannot scroll or rectangle is not fully on display, nothing is moved then
+
+bool twr_gfx_scroll(twr_gfx_t *self, int x0, int y0, int x1, int y1, int dx);
+
 //! @brief Display update, send data
 //! @param[in] self Instance
 //! @return true On success
@@ -0,0 +1,63 @@
+#ifndef _TWR_GFX_CHART_H
+#define _TWR_GFX_CHART_H
+
+#include <twr_gfx.h>
+#include <twr_data_stream.h>
+
+//! @addtogroup twr_gfx_chart twr_gfx_chart
+//! @brief Chart of data stream samples drawn by graphics library, each sample is one column and the newest one is rightmost
+//! @{
+
+//! @brief Multiplier converting samples of float data stream to integers drawn by chart
+
+#ifndef TWR_GFX_CHART_FLOAT_SCALE
+#define TWR_GFX_CHART_FLOAT_SCALE 100
+#endif
+
+//! @brief Instance
+
+typedef struct
+{
+    //! @cond
+
+    twr_gfx_box_t _box;
+
+    // Stream counter at last draw, negative if whole chart has to be drawn
+    int _counter;
+
+    // Stream range at last draw, columns are scaled to it
+    int32_t _min;
+    int32_t _max;
+
+    //! @endcond
+
+} twr_gfx_chart_t;
+
+//! @brief Initialize chart
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] width Chart width, it is also maximal number of samples drawn
+//! @param[in] height Chart height
+
+void twr_gfx_chart_init(twr_gfx_chart_t *self, int left, int top, int width, int height);
+
+//! @brief Force next draw of chart to draw it whole, for example after its area was drawn over
+//! @param[in] self Instance
+
+void twr_gfx_chart_invalidate(twr_gfx_chart_t *self);
+
+//! @brief Draw chart of data stream samples scaled to stream minimum and maximum
+//!
+//! Each column is vertical span from previous sample to its sample. If range of stream did not change
+//! since last draw, the chart is scrolled and only columns of new samples are drawn.
+//! @param[in] self Instance
+//! @param[in] gfx Graphics instance
+//! @param[in] stream Data stream
+//! @param[in] color
+
+void twr_gfx_chart_draw(twr_gfx_chart_t *self, twr_gfx_t *gfx, twr_data_stream_t *stream, uint32_t color);
+
+//! @}
+
+#endif // _TWR_GFX_CHART_H
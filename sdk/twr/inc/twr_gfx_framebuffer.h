@@ -0,0 +1,172 @@
+#ifndef _TWR_GFX_FRAMEBUFFER_H
+#define _TWR_GFX_FRAMEBUFFER_H
+
+#include <twr_gfx.h>
+
+//! @addtogroup twr_gfx_framebuffer twr_gfx_framebuffer
+//! @brief Display driver drawing into memory only, for rendering checks and measurements without display (host builds only)
+//! @{
+
+//! @brief Macro for framebuffer declaration
+
+#define TWR_GFX_FRAMEBUFFER(NAME, WIDTH, HEIGHT) \
+    uint8_t NAME##_buffer[((WIDTH) + 7) / 8 * (HEIGHT)]; \
+    uint8_t NAME##_dirty[((HEIGHT) + 7) / 8]; \
+    twr_gfx_framebuffer_buffer_t NAME = { \
+            .buffer = NAME##_buffer, \
+            .dirty = NAME##_dirty, \
+            .width = WIDTH, \
+            .height = HEIGHT \
+    };
+
+//! @brief Framebuffer memory, rows of pixels are padded to whole byte, the first pixel is MSB and set bit is black
+
+typedef struct
+{
+    uint8_t *buffer;
+
+    // Bit per line changed since last update
+    uint8_t *dirty;
+    int width;
+    int height;
+
+} twr_gfx_framebuffer_buffer_t;
+
+//! @brief Statistics of operations
+
+typedef struct
+{
+    //! @brief Number of draw pixel calls
+    uint32_t pixels;
+
+    //! @brief Number of draw bitmap calls
+    uint32_t bitmaps;
+
+    //! @brief Number of fill rectangle calls
+    uint32_t fills;
+
+    //! @brief Number of scroll calls
+    uint32_t scrolls;
+
+    //! @brief Number of updates
+    uint32_t updates;
+
+    //! @brief Number of lines changed at updates
+    uint32_t lines;
+
+    //! @brief Number of bytes sending runs of changed lines to LS013B7DH03 over SPI would take
+    uint32_t spi_bytes;
+
+} twr_gfx_framebuffer_stats_t;
+
+//! @brief Instance
+
+typedef struct
+{
+    const twr_gfx_framebuffer_buffer_t *_buffer;
+    twr_gfx_framebuffer_stats_t _stats;
+
+} twr_gfx_framebuffer_t;
+
+//! @brief Initialize framebuffer driver, framebuffer is cleared
+//! @param[in] self Instance
+//! @param[in] buffer Framebuffer memory declared by TWR_GFX_FRAMEBUFFER
+
+void twr_gfx_framebuffer_init(twr_gfx_framebuffer_t *self, const twr_gfx_framebuffer_buffer_t *buffer);
+
+//! @brief Get capabilities
+//! @param[in] self Instance
+
+twr_gfx_caps_t twr_gfx_framebuffer_get_caps(twr_gfx_framebuffer_t *self);
+
+//! @brief Check if framebuffer is ready for commands (always true)
+//! @param[in] self Instance
+//! @return true If ready
+//! @return false If not ready
+
+bool twr_gfx_framebuffer_is_ready(twr_gfx_framebuffer_t *self);
+
+//! @brief Clear
+//! @param[in] self Instance
+
+void twr_gfx_framebuffer_clear(twr_gfx_framebuffer_t *self);
+
+//! @brief Draw pixel
+//! @param[in] self Instance
+//! @param[in] x Pixels from left edge
+//! @param[in] y Pixels from top edge
+//! @param[in] color Pixels state
+
+void twr_gfx_framebuffer_draw_pixel(twr_gfx_framebuffer_t *self, int x, int y, uint32_t color);
+
+//! @brief Get pixel
+//! @param[in] self Instance
+//! @param[in] x Pixels from left edge
+//! @param[in] y Pixels from top edge
+
+uint32_t twr_gfx_framebuffer_get_pixel(twr_gfx_framebuffer_t *self, int x, int y);
+
+//! @brief Draw bitmap lying fully within framebuffer
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] bitmap Bitmap
+//! @param[in] mirror Bitmap is rotated by 180 degrees
+//! @param[in] color Pixels color
+
+void twr_gfx_framebuffer_draw_bitmap(twr_gfx_framebuffer_t *self, int left, int top, const twr_gfx_bitmap_t *bitmap, bool mirror, uint32_t color);
+
+//! @brief Fill rectangle
+//! @param[in] self Instance
+//! @param[in] x0 Pixels from left edge of the first corner
+//! @param[in] y0 Pixels from top edge of the first corner
+//! @param[in] x1 Pixels from left edge of the opposite corner (inclusive)
+//! @param[in] y1 Pixels from top edge of the opposite corner (inclusive)
+//! @param[in] color Pixels color
+
+void twr_gfx_framebuffer_fill_rectangle(twr_gfx_framebuffer_t *self, int x0, int y0, int x1, int y1, uint32_t color);
+
+//! @brief Scroll rectangle, pixels vacated by scroll keep their previous state
+//! @param[in] self Instance
+//! @param[in] x0 Pixels from left edge of the first corner
+//! @param[in] y0 Pixels from top edge of the first corner
+//! @param[in] x1 Pixels from left edge of the opposite corner (inclusive)
+//! @param[in] y1 Pixels from top edge of the opposite corner (inclusive)
+//! @param[in] dx Pixels to move right (negative to left), dy has to be zero then
+//! @param[in] dy Pixels to move down (negative up), dx has to be zero then
+
+void twr_gfx_framebuffer_scroll(twr_gfx_framebuffer_t *self, int x0, int y0, int x1, int y1, int dx, int dy);
+
+//! @brief Update, account changed lines to statistics
+//! @param[in] self Instance
+//! @return true On success
+//! @return false On failure
+
+bool twr_gfx_framebuffer_update(twr_gfx_framebuffer_t *self);
+
+//! @brief Get statistics of operations
+//! @param[in] self Instance
+//! @param[out] stats Statistics
+
+void twr_gfx_framebuffer_get_stats(twr_gfx_framebuffer_t *self, twr_gfx_framebuffer_stats_t *stats);
+
+//! @brief Reset statistics of operations
+//! @param[in] self Instance
+
+void twr_gfx_framebuffer_reset_stats(twr_gfx_framebuffer_t *self);
+
+//! @brief Export framebuffer as binary PBM image
+//! @param[in] self Instance
+//! @param[out] image Buffer where image will be stored
+//! @param[in] size Size of buffer
+//! @return Length of image or 0 if buffer is too small
+
+size_t twr_gfx_framebuffer_get_pbm(twr_gfx_framebuffer_t *self, uint8_t *image, size_t size);
+
+//! @brief Get framebuffer driver
+
+const twr_gfx_driver_t *twr_gfx_framebuffer_get_driver(void);
+
+//! @}
+
+#endif // _TWR_GFX_FRAMEBUFFER_H
@@ -0,0 +1,60 @@
+#ifndef _TWR_GFX_LINE_H
+#define _TWR_GFX_LINE_H
+
+#include <twr_gfx.h>
+
+//! @addtogroup twr_gfx_line twr_gfx_line
+//! @brief Operations on lines of 1-bpp framebuffers shared by display drivers, the first pixel of line is MSB of its first byte
+//! @{
+
+//! @brief Reverse order of bits in byte
+//! @param[in] b Byte
+//! @return Byte with MSB and LSB swapped and so on
+
+uint8_t twr_gfx_line_reverse(uint8_t b);
+
+//! @brief Set or clear pixels of mask in line
+//! @param[in] line Line
+//! @param[in] bytes Length of line in bytes
+//! @param[in] x Pixel of mask MSB, it may be left of line start (bits outside of line are dropped)
+//! @param[in] mask Pixels to change, MSB first
+//! @param[in] set Pixels are set if true, cleared if false
+//! @return true If line changed
+
+bool twr_gfx_line_draw_mask(uint8_t *line, int bytes, int x, uint8_t mask, bool set);
+
+//! @brief Set or clear span of pixels given by inclusive ends within line
+//! @param[in] line Line
+//! @param[in] x0 First pixel
+//! @param[in] x1 Last pixel
+//! @param[in] set Pixels are set if true, cleared if false
+//! @return true If line changed
+
+bool twr_gfx_line_fill(uint8_t *line, int x0, int x1, bool set);
+
+//! @brief Copy span of pixels given by inclusive ends from source line, source pixels are dx pixels to the left
+//! @param[in] line Line
+//! @param[in] source Source line, it can be the line itself
+//! @param[in] bytes Length of lines in bytes
+//! @param[in] x0 First pixel
+//! @param[in] x1 Last pixel
+//! @param[in] dx Shift of pixels to the right (negative to the left), pixels shifted in from outside of line are cleared
+//! @return true If line changed
+
+bool twr_gfx_line_copy(uint8_t *line, const uint8_t *source, int bytes, int x0, int x1, int dx);
+
+//! @brief Draw row of bitmap
+//! @param[in] line Line
+//! @param[in] bytes Length of line in bytes
+//! @param[in] left Pixel of first bitmap pixel, or of the last one if mirrored
+//! @param[in] bitmap Bitmap
+//! @param[in] row Row of bitmap
+//! @param[in] mirror Row is drawn from right to left
+//! @param[in] set Pixels are set if true, cleared if false
+//! @return true If line changed
+
+bool twr_gfx_line_draw_bitmap_row(uint8_t *line, int bytes, int left, const twr_gfx_bitmap_t *bitmap, int row, bool mirror, bool set);
+
+//! @}
+
+#endif // _TWR_GFX_LINE_H
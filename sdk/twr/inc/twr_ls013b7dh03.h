@@ -31,6 +31,16 @@
 typedef struct
 {
     uint8_t _framebuffer[TWR_LS013B7DH03_FRAMEBUFFER_SIZE];
+    uint32_t _dirty[(TWR_LS013B7DH03_HEIGHT + 31) / 32];
+
+    // Lines of update in progress and next of them to send
+    uint32_t _send[(TWR_LS013B7DH03_HEIGHT + 31) / 32];
+    int _update_line;
+
+    // Optional second framebuffer lines are sent from, drawing can continue during transfer then
+    uint8_t *_transfer;
+    bool _transfer_busy;
+    bool _update_pending;
     uint8_t _vcom;
     twr_scheduler_task_id_t _task_id;
     bool (*_pin_cs_set)(bool state);
@@ -42,12 +52,18 @@ typedef struct
 
 void twr_ls013b7dh03_init(twr_ls013b7dh03_t *self, bool (*pin_cs_set)(bool state));
 
+//! @brief Set second framebuffer, lines are copied to it at update and sent from it so that drawing can continue during transfer
+//! @param[in] self Instance
+//! @param[in] buffer Buffer of TWR_LS013B7DH03_FRAMEBUFFER_SIZE bytes or NULL to send directly from framebuffer
+
+void twr_ls013b7dh03_set_transfer_buffer(twr_ls013b7dh03_t *self, uint8_t *buffer);
+
 //! @brief Get capabilities
 //! @param[in] self Instance
 
 twr_gfx_caps_t twr_ls013b7dh03_get_caps(twr_ls013b7dh03_t *self);
 
-//! @brief Check if lcd is ready for commands
+//! @brief Check if lcd is ready for commands, with second framebuffer it is ready for drawing during transfer too
 //! @param[in] self Instance
 //! @return true If ready
 //! @return false If not ready
@@ -75,7 +91,40 @@ void twr_ls013b7dh03_draw_pixel(twr_ls013b7dh03_t *self, int x, int y, uint32_t
 
 uint32_t twr_ls013b7dh03_get_pixel(twr_ls013b7dh03_t *self, int x, int y);
 
-//! @brief Lcd update, send data
+//! @brief Lcd fill rectangle
+//! @param[in] self Instance
+//! @param[in] x0 Pixels from left edge of the first corner
+//! @param[in] y0 Pixels from top edge of the first corner
+//! @param[in] x1 Pixels from left edge of the opposite corner (inclusive)
+//! @param[in] y1 Pixels from top edge of the opposite corner (inclusive)
+//! @param[in] color Pixels color
+
+void twr_ls013b7dh03_fill_rectangle(twr_ls013b7dh03_t *self, int x0, int y0, int x1, int y1, uint32_t color);
+
+//! @brief Lcd draw bitmap lying fully within display
+//! @param[in] self Instance
+//! @param[in] left Pixels from left edge
+//! @param[in] top Pixels from top edge
+//! @param[in] bitmap Bitmap
+//! @param[in] mirror Bitmap is rotated by 180 degrees
+//! @param[in] color Pixels color
+
+void twr_ls013b7dh03_draw_bitmap(twr_ls013b7dh03_t *self, int left, int top, const twr_gfx_bitmap_t *bitmap, bool mirror, uint32_t color);
+
+//! @brief Lcd scroll rectangle, pixels vacated by scroll keep their previous state
+//! @param[in] self Instance
+//! @param[in] x0 Pixels from left edge of the first corner
+//! @param[in] y0 Pixels from top edge of the first corner
+//! @param[in] x1 Pixels from left edge of the opposite corner (inclusive)
+//! @param[in] y1 Pixels from top edge of the opposite corner (inclusive)
+//! @param[in] dx Pixels to move right (negative to left), dy has to be zero then
+//! @param[in] dy Pixels to move down (negative up), dx has to be zero then
+
+void twr_ls013b7dh03_scroll(twr_ls013b7dh03_t *self, int x0, int y0, int x1, int y1, int dx, int dy);
+
+//! @brief Lcd update, send lines changed since last update
+//!
+//! With second framebuffer, update requested during transfer is started right after it.
 //! @param[in] self Instance
 //! @return true On success
 //! @return false On failure
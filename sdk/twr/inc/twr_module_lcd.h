@@ -12,6 +12,12 @@
 //! @brief Driver for lcd
 //! @{
 
+//! @brief Delay in milliseconds between first invalidation and render, invalidations within it share one render
+
+#ifndef TWR_MODULE_LCD_INVALIDATE_DELAY
+#define TWR_MODULE_LCD_INVALIDATE_DELAY 20
+#endif
+
 //! @brief Callback events
 
 typedef enum
@@ -178,6 +184,21 @@ void twr_module_lcd_draw_image(int left, int top, const twr_image_t *img);
 
 bool twr_module_lcd_update(void);
 
+//! @brief Lcd set transfer buffer, frame is sent from it and the next one can be drawn meanwhile
+//! @param[in] buffer Buffer of TWR_LS013B7DH03_FRAMEBUFFER_SIZE bytes or NULL to send directly from framebuffer
+
+void twr_module_lcd_set_transfer_buffer(uint8_t *buffer);
+
+//! @brief Lcd set render handler called by deferred redraw
+//! @param[in] render_handler Function drawing content through gfx, display update follows it
+//! @param[in] render_param Render parameter
+
+void twr_module_lcd_set_render_handler(void (*render_handler)(void *), void *render_param);
+
+//! @brief Lcd request deferred redraw, all requests until render is done result in single render and update
+
+void twr_module_lcd_invalidate(void);
+
 //! @brief Lcd set font
 //! @param[in] *font Font
 
@@ -7,7 +7,7 @@
 //! @brief Task scheduler
 //! @{
 
-//! @brief Maximum number of tasks
+//! @brief Maximum number of tasks (at most 254)
 
 #ifndef TWR_SCHEDULER_MAX_TASKS
 #define TWR_SCHEDULER_MAX_TASKS 32
@@ -17,10 +17,81 @@
 #define TWR_SCHEDULER_INTERVAL_MS 10
 #endif
 
+//! @brief Sleep until the earliest planned task instead of waking up every scheduler interval
+
+#ifndef TWR_SCHEDULER_TICKLESS
+#define TWR_SCHEDULER_TICKLESS 0
+#endif
+
+//! @brief Record execution statistics of every task (execution time is taken from twr_system_get_microseconds)
+
+#ifndef TWR_SCHEDULER_PROFILER
+#define TWR_SCHEDULER_PROFILER 0
+#endif
+
+//! @brief Slack granted to periodic sensor updates so that their wake-ups coalesce
+
+#ifndef TWR_SCHEDULER_UPDATE_SLACK
+#define TWR_SCHEDULER_UPDATE_SLACK(interval) ((interval) / 8)
+#endif
+
+//! @brief Number of interrupt events the scheduler queue holds (must be power of two)
+
+#ifndef TWR_SCHEDULER_EVENT_QUEUE_LENGTH
+#define TWR_SCHEDULER_EVENT_QUEUE_LENGTH 32
+#endif
+
 //! @brief Task ID assigned by scheduler
 
 typedef size_t twr_scheduler_task_id_t;
 
+//! @brief Task ID reported while no task is executing (plan_current functions are ignored meanwhile)
+
+#define TWR_SCHEDULER_TASK_ID_NONE ((twr_scheduler_task_id_t) SIZE_MAX)
+
+#if TWR_SCHEDULER_PROFILER
+
+//! @brief Task execution statistics
+
+typedef struct
+{
+    //! @brief Task function address
+    void (*task)(void *);
+
+    //! @brief Number of task invocations
+    uint32_t invocations;
+
+    //! @brief Total execution time in microseconds
+    uint64_t time_total;
+
+    //! @brief Longest execution time in microseconds
+    uint32_t time_max;
+
+    //! @brief Total lateness of planned execution in ticks
+    uint64_t lateness_total;
+
+    //! @brief Largest lateness of planned execution in ticks
+    uint32_t lateness_max;
+
+} twr_scheduler_profile_t;
+
+#endif
+
+//! @brief Interrupt event queue statistics
+
+typedef struct
+{
+    //! @brief Number of events posted
+    uint32_t posted;
+
+    //! @brief Number of events dropped because queue was full
+    uint32_t dropped;
+
+    //! @brief Largest number of events waiting in queue
+    uint32_t peak;
+
+} twr_scheduler_event_stats_t;
+
 //! @brief Initialize task scheduler
 
 void twr_scheduler_init(void);
@@ -44,6 +115,7 @@ void twr_scheduler_unregister(twr_scheduler_task_id_t task_id);
 
 //! @brief Get task ID of currently executing task
 //! @return Task ID
+//! @return TWR_SCHEDULER_TASK_ID_NONE If called from handler of posted event
 
 twr_scheduler_task_id_t twr_scheduler_get_current_task_id(void);
 
@@ -52,6 +124,46 @@ twr_scheduler_task_id_t twr_scheduler_get_current_task_id(void);
 
 twr_tick_t twr_scheduler_get_spin_tick(void);
 
+//! @brief Get tick of the earliest planned task
+//! @return Tick of the earliest planned task or TWR_TICK_INFINITY if no task is planned
+
+twr_tick_t twr_scheduler_get_next_tick(void);
+
+//! @brief Get number of task IDs
+//! @return Number of task IDs
+
+size_t twr_scheduler_get_task_count(void);
+
+#if TWR_SCHEDULER_PROFILER
+
+//! @brief Get execution statistics of task (available only with TWR_SCHEDULER_PROFILER)
+//! @param[in] task_id Task ID
+//! @param[out] profile Execution statistics
+//! @return true If task is registered
+//! @return false If task is not registered
+
+bool twr_scheduler_get_profile(twr_scheduler_task_id_t task_id, twr_scheduler_profile_t *profile);
+
+//! @brief Reset execution statistics of all tasks (available only with TWR_SCHEDULER_PROFILER)
+
+void twr_scheduler_reset_profile(void);
+
+#endif
+
+//! @brief Post event from interrupt handler, handlers are called by scheduler in posting order before tasks of the next spin
+//! @param[in] handler Function called with parameter and event outside of any task (plan_current functions have no effect in it, tasks must be planned by their ID)
+//! @param[in] param Optional parameter which is passed to handler (can be NULL)
+//! @param[in] event Event value which is passed to handler
+//! @return true If event has been queued
+//! @return false If queue is full and event has been dropped
+
+bool twr_scheduler_post_event_irq(void (*handler)(void *, uint32_t), void *param, uint32_t event);
+
+//! @brief Get statistics of interrupt event queue
+//! @param[out] stats Event queue statistics
+
+void twr_scheduler_get_event_stats(twr_scheduler_event_stats_t *stats);
+
 //! @brief Disable sleep mode, implemented as semaphore
 
 void twr_scheduler_disable_sleep(void);
@@ -83,6 +195,13 @@ void twr_scheduler_plan_relative(twr_scheduler_task_id_t task_id, twr_tick_t tic
 
 void twr_scheduler_plan_from_now(twr_scheduler_task_id_t task_id, twr_tick_t tick);
 
+//! @brief Schedule specified task to tick relative from current spin with tolerated delay
+//! @param[in] task_id Task ID to be scheduled
+//! @param[in] tick Earliest tick at which the task will be run as a relative value from current spin
+//! @param[in] slack Number of ticks the task may be delayed to share wake-up with other tasks
+
+void twr_scheduler_plan_relative_with_slack(twr_scheduler_task_id_t task_id, twr_tick_t tick, twr_tick_t slack);
+
 //! @brief Schedule current task for immediate execution
 
 void twr_scheduler_plan_current_now(void);
@@ -102,6 +221,24 @@ void twr_scheduler_plan_current_relative(twr_tick_t tick);
 
 void twr_scheduler_plan_current_from_now(twr_tick_t tick);
 
+//! @brief Schedule current task to tick relative from current spin with tolerated delay
+//! @param[in] tick Earliest tick at which the task will be run as a relative value from current spin
+//! @param[in] slack Number of ticks the task may be delayed to share wake-up with other tasks
+
+void twr_scheduler_plan_current_relative_with_slack(twr_tick_t tick, twr_tick_t slack);
+
+//! @brief Get tick from window shared by tasks planned with slack
+//!
+//! End of the window is rounded down to the coarsest power-of-two boundary that is still within the window. Tasks
+//! whose windows contain the same coarsest boundary share a wake-up, overlapping windows alone are not guaranteed to
+//! (windows [5, 7] and [7, 9] give ticks 6 and 8).
+//!
+//! @param[in] tick Earliest absolute tick
+//! @param[in] slack Number of ticks the execution may be delayed
+//! @return Absolute tick within the window
+
+twr_tick_t twr_scheduler_get_coalesced_tick(twr_tick_t tick, twr_tick_t slack);
+
 //! @}
 
 #endif // _TWR_SCHEDULER_H
@@ -3,6 +3,7 @@
 
 #include <stm32l0xx.h>
 #include <twr_common.h>
+#include <twr_tick.h>
 
 typedef enum
 {
@@ -64,4 +65,18 @@ void twr_system_reset(void);
 
 bool twr_system_get_vbus_sense(void);
 
+//! @brief Get microseconds counted by SysTick millisecond interrupt and its counter (stops in sleep, wraps after 71 minutes)
+//! @return Microseconds since system initialization (must be called with interrupts enabled)
+
+uint32_t twr_system_get_microseconds(void);
+
+//! @brief Arm RTC wake-up timer for tickless sleep (available only with TWR_SCHEDULER_TICKLESS)
+//! @param[in] timeout Ticks until the earliest planned task, 0 keeps the periodic tick
+
+void twr_system_tickless_set(twr_tick_t timeout);
+
+//! @brief Add time slept to the tick counter after an early wake-up (available only with TWR_SCHEDULER_TICKLESS)
+
+void twr_system_tickless_sync(void);
+
 #endif // _TWR_SYSTEM_H
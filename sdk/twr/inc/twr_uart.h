@@ -8,6 +8,12 @@
 //! @brief Driver for UART (universal asynchronous receiver/transmitter)
 //! @{
 
+//! @brief Period of completion check of async write, it only matters when the interrupt event could not be posted
+
+#ifndef TWR_UART_ASYNC_WRITE_CHECK_PERIOD
+#define TWR_UART_ASYNC_WRITE_CHECK_PERIOD 100
+#endif
+
 //! @brief UART channels
 
 typedef enum
@@ -0,0 +1,77 @@
+#include <twr_at_scheduler.h>
+
+#if TWR_SCHEDULER_PROFILER
+
+bool twr_at_scheduler_profile(void)
+{
+    size_t task_count = twr_scheduler_get_task_count();
+
+    twr_scheduler_profile_t profile;
+    twr_scheduler_profile_t profile_max;
+
+    twr_scheduler_task_id_t task_id_max;
+
+    // Snapshot upper bound, rows are selected in descending order of total execution time
+    uint64_t time_total_bound = UINT64_MAX;
+    twr_scheduler_task_id_t task_id_bound = 0;
+    bool first = true;
+
+    twr_atci_printfln("$SCHED: \"ID\",\"Task\",\"Count\",\"Total ms\",\"Max us\",\"Avg late ms\",\"Max late ms\"");
+
+    while (true)
+    {
+        bool found = false;
+
+        for (twr_scheduler_task_id_t i = 0; i < task_count; i++)
+        {
+            if (!twr_scheduler_get_profile(i, &profile))
+            {
+                continue;
+            }
+
+            // Skip rows already printed, ties are broken by ascending task ID
+            if (!first && (profile.time_total > time_total_bound ||
+                          (profile.time_total == time_total_bound && i <= task_id_bound)))
+            {
+                continue;
+            }
+
+            if (!found || profile.time_total > profile_max.time_total)
+            {
+                profile_max = profile;
+                task_id_max = i;
+                found = true;
+            }
+        }
+
+        if (!found)
+        {
+            break;
+        }
+
+        uint32_t lateness_avg = profile_max.invocations != 0 ? profile_max.lateness_total / profile_max.invocations : 0;
+
+        twr_atci_printfln("$SCHED: %u,0x%08x,%lu,%lu,%lu,%lu,%lu",
+                          (unsigned int) task_id_max, (unsigned int) (uintptr_t) profile_max.task,
+                          (unsigned long) profile_max.invocations, (unsigned long) (profile_max.time_total / 1000),
+                          (unsigned long) profile_max.time_max, (unsigned long) lateness_avg,
+                          (unsigned long) profile_max.lateness_max);
+
+        time_total_bound = profile_max.time_total;
+        task_id_bound = task_id_max;
+        first = false;
+    }
+
+    twr_scheduler_event_stats_t stats;
+
+    twr_scheduler_get_event_stats(&stats);
+
+    twr_atci_printfln("$SCHED: \"Events\",%lu,%lu,%lu", (unsigned long) stats.posted,
+                      (unsigned long) stats.dropped, (unsigned long) stats.peak);
+
+    twr_scheduler_reset_profile();
+
+    return true;
+}
+
+#endif
@@ -1,10 +1,12 @@
 #include <twr_atci.h>
 #include <twr_scheduler.h>
 #include <twr_system.h>
+#include <twr_exti.h>
 
 static void _twr_atci_uart_event_handler(twr_uart_channel_t channel, twr_uart_event_t event, void  *event_param);
 static void _twr_atci_uart_active_test(void);
 static void _twr_atci_uart_active_test_task(void  *param);
+static void _twr_atci_vbus_sense_exti_handler(twr_exti_line_t line, void *param);
 
 static struct
 {
@@ -17,6 +19,7 @@ static struct
     uint8_t read_fifo_buffer[128];
     twr_fifo_t read_fifo;
     twr_scheduler_task_id_t vbus_sense_test_task_id;
+    bool vbus_sense_exti;
     bool ready;
     bool (*uart_active_callback)(void);
     twr_tick_t scan_interval;
@@ -40,7 +43,14 @@ void twr_atci_init(const twr_atci_command_t *commands, int length)
 
     twr_fifo_init(&_twr_atci.read_fifo, _twr_atci.read_fifo_buffer, sizeof(_twr_atci.read_fifo_buffer));
 
-    twr_atci_set_uart_active_callback(twr_system_get_vbus_sense, 200);
+    // Edges of USB power sense pin trigger the test, nothing is polled while USB is disconnected
+    _twr_atci.uart_active_callback = twr_system_get_vbus_sense;
+
+    _twr_atci_uart_active_test();
+
+    twr_exti_register_deferred(TWR_EXTI_LINE_PA12, TWR_EXTI_EDGE_RISING_AND_FALLING, _twr_atci_vbus_sense_exti_handler, NULL);
+
+    _twr_atci.vbus_sense_exti = true;
 }
 
 size_t twr_atci_print(const char *message)
@@ -463,6 +473,13 @@ bool twr_atci_is_quotation_mark(twr_atci_param_t *param)
 
 void twr_atci_set_uart_active_callback(bool(*callback)(void), twr_tick_t scan_interval)
 {
+    if (_twr_atci.vbus_sense_exti)
+    {
+        twr_exti_unregister(TWR_EXTI_LINE_PA12);
+
+        _twr_atci.vbus_sense_exti = false;
+    }
+
     _twr_atci.uart_active_callback = callback;
     _twr_atci.scan_interval = scan_interval;
 
@@ -524,3 +541,11 @@ static void _twr_atci_uart_active_test_task(void *param)
 
     twr_scheduler_plan_current_relative(_twr_atci.scan_interval);
 }
+
+static void _twr_atci_vbus_sense_exti_handler(twr_exti_line_t line, void *param)
+{
+    (void) line;
+    (void) param;
+
+    _twr_atci_uart_active_test();
+}
@@ -100,6 +100,21 @@ void twr_button_set_hold_time(twr_button_t *self, twr_tick_t hold_time)
     self->_hold_time = hold_time;
 }
 
+void twr_button_set_scan_on_demand(twr_button_t *self, bool on_demand)
+{
+    self->_scan_on_demand = on_demand;
+
+    twr_button_scan(self);
+}
+
+void twr_button_scan(twr_button_t *self)
+{
+    if (self->_event_handler != NULL)
+    {
+        twr_scheduler_plan_now(self->_task_id);
+    }
+}
+
 static void _twr_button_task(void *param)
 {
     twr_button_t *self = param;
@@ -182,6 +197,12 @@ static void _twr_button_task(void *param)
         }
     }
 
+    // Released button without pending debounce waits for twr_button_scan
+    if (self->_scan_on_demand && self->_state == 0 && self->_tick_debounce == TWR_TICK_INFINITY)
+    {
+        return;
+    }
+
     twr_scheduler_plan_current_relative(self->_scan_interval);
 }
 
@@ -1,7 +1,14 @@
 #include <twr_data_stream.h>
 
-static int _twr_data_stream_compare_float(const void * a, const void * b);
-static int _twr_data_stream_compare_int(const void * a, const void * b);
+static void _twr_data_stream_sort_float(float *sort, int length, int position, float value);
+static void _twr_data_stream_sort_int(int *sort, int length, int position, int value);
+static void _twr_data_stream_sort_int16(int16_t *sort, int length, int position, int16_t value);
+static int _twr_data_stream_sort_find_float(float *sort, int length, float value);
+static int _twr_data_stream_sort_find_int(int *sort, int length, int value);
+static int _twr_data_stream_sort_find_int16(int16_t *sort, int length, int16_t value);
+static void _twr_data_stream_sum_add_float(twr_data_stream_t *self, float value);
+static void _twr_data_stream_sum_update(twr_data_stream_t *self);
+static void _twr_data_stream_rollup_fold(twr_data_stream_rollup_record_t *pending, int count, twr_data_stream_rollup_record_t *record);
 //
 void twr_data_stream_init(twr_data_stream_t *self, int min_number_of_samples, twr_data_stream_buffer_t *buffer)
 {
@@ -25,6 +32,10 @@ void twr_data_stream_feed(twr_data_stream_t *self, void *data)
        self->_feed_head = 0;
     }
 
+    bool is_full = self->_counter >= self->_buffer->number_of_samples;
+
+    int length = is_full ? self->_buffer->number_of_samples : self->_counter + 1;
+
     switch (self->_buffer->type)
     {
         case TWR_DATA_STREAM_TYPE_FLOAT:
@@ -36,13 +47,67 @@ void twr_data_stream_feed(twr_data_stream_t *self, void *data)
                 return;
             }
 
-            *((float *) self->_buffer->feed + self->_feed_head) = *(float *) data;
+            float *sample = (float *) self->_buffer->feed + self->_feed_head;
+
+            // Slot in sorted window which is reused by the new sample
+            int position = length - 1;
+
+            if (is_full)
+            {
+                _twr_data_stream_sum_add_float(self, -*sample);
+
+                position = _twr_data_stream_sort_find_float(self->_buffer->sorted, length, *sample);
+            }
+
+            *sample = *(float *) data;
+
+            _twr_data_stream_sort_float(self->_buffer->sorted, length, position, *sample);
+
+            _twr_data_stream_sum_add_float(self, *sample);
 
             break;
         }
         case TWR_DATA_STREAM_TYPE_INT:
         {
-            *((int *) self->_buffer->feed + self->_feed_head) = *(int *) data;
+            int *sample = (int *) self->_buffer->feed + self->_feed_head;
+
+            // Slot in sorted window which is reused by the new sample
+            int position = length - 1;
+
+            if (is_full)
+            {
+                self->_sum._int -= *sample;
+
+                position = _twr_data_stream_sort_find_int(self->_buffer->sorted, length, *sample);
+            }
+
+            *sample = *(int *) data;
+
+            _twr_data_stream_sort_int(self->_buffer->sorted, length, position, *sample);
+
+            self->_sum._int += *sample;
+
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        {
+            int16_t *sample = (int16_t *) self->_buffer->feed + self->_feed_head;
+
+            // Slot in sorted window which is reused by the new sample
+            int position = length - 1;
+
+            if (is_full)
+            {
+                self->_sum._int -= *sample;
+
+                position = _twr_data_stream_sort_find_int16(self->_buffer->sorted, length, *sample);
+            }
+
+            *sample = *(int16_t *) data;
+
+            _twr_data_stream_sort_int16(self->_buffer->sorted, length, position, *sample);
+
+            self->_sum._int += *sample;
 
             break;
         }
@@ -53,12 +118,20 @@ void twr_data_stream_feed(twr_data_stream_t *self, void *data)
     }
 
     self->_counter++;
+
+    // Buffer holds the whole window in feed order once per its turn
+    if (self->_feed_head == self->_buffer->number_of_samples - 1)
+    {
+        _twr_data_stream_sum_update(self);
+    }
 }
 
 void twr_data_stream_reset(twr_data_stream_t *self)
 {
     self->_counter = 0;
     self->_feed_head = self->_buffer->number_of_samples - 1;
+
+    memset(&self->_sum, 0, sizeof(self->_sum));
 }
 
 int twr_data_stream_get_counter(twr_data_stream_t *self)
@@ -81,6 +154,11 @@ int twr_data_stream_get_number_of_samples(twr_data_stream_t *self)
     return self->_buffer->number_of_samples;
 }
 
+int twr_data_stream_get_scale(twr_data_stream_t *self)
+{
+    return self->_buffer->scale != 0 ? self->_buffer->scale : 1;
+}
+
 bool twr_data_stream_get_average(twr_data_stream_t *self, void *result)
 {
     if (self->_counter < self->_min_number_of_samples)
@@ -94,29 +172,25 @@ bool twr_data_stream_get_average(twr_data_stream_t *self, void *result)
     {
         case TWR_DATA_STREAM_TYPE_FLOAT:
         {
-            float sum = 0;
-            float *buffer = (float *) self->_buffer->feed;
-
-
-            for (int i = 0; i < length; i ++)
-            {
-                sum += buffer[i];
-            }
-
-            *(float *) result = sum / length;
+            *(float *) result = self->_sum._float._value / length;
             break;
         }
         case TWR_DATA_STREAM_TYPE_INT:
         {
-            int64_t sum = 0;
-            int *buffer = (int *) self->_buffer->feed;
-
-            for (int i = 0; i < length; i ++)
+            *(int *) result = self->_sum._int / length;
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        {
+            // Rounded to nearest, truncation would bias fixed-point averages by half of the scale resolution
+            if (self->_sum._int < 0)
             {
-                sum += buffer[i];
+                *(int16_t *) result = (self->_sum._int - length / 2) / length;
+            }
+            else
+            {
+                *(int16_t *) result = (self->_sum._int + length / 2) / length;
             }
-
-            *(int *) result = sum / length;
             break;
         }
         default:
@@ -141,10 +215,7 @@ bool twr_data_stream_get_median(twr_data_stream_t *self, void *result)
     {
         case TWR_DATA_STREAM_TYPE_FLOAT:
         {
-            memcpy(self->_buffer->sort, self->_buffer->feed, length * sizeof(float));
-            qsort(self->_buffer->sort, length, sizeof(float), _twr_data_stream_compare_float);
-
-            float *buffer = (float *) self->_buffer->sort;
+            float *buffer = (float *) self->_buffer->sorted;
 
             if (length % 2 == 0)
             {
@@ -158,10 +229,7 @@ bool twr_data_stream_get_median(twr_data_stream_t *self, void *result)
         }
         case TWR_DATA_STREAM_TYPE_INT:
         {
-            memcpy(self->_buffer->sort, self->_buffer->feed, length * sizeof(int));
-            qsort(self->_buffer->sort, length, sizeof(int), _twr_data_stream_compare_int);
-
-            int *buffer = (int *) self->_buffer->sort;
+            int *buffer = (int *) self->_buffer->sorted;
 
             if (length % 2 == 0)
             {
@@ -173,6 +241,20 @@ bool twr_data_stream_get_median(twr_data_stream_t *self, void *result)
             }
             break;
         }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        {
+            int16_t *buffer = (int16_t *) self->_buffer->sorted;
+
+            if (length % 2 == 0)
+            {
+                *(int16_t *) result = (buffer[(length - 2) / 2] + buffer[length / 2]) / 2;
+            }
+            else
+            {
+                *(int16_t *) result = buffer[(length - 1) / 2];
+            }
+            break;
+        }
         default:
         {
             return false;
@@ -208,6 +290,11 @@ bool twr_data_stream_get_first(twr_data_stream_t *self, void *result)
             *(int *) result = *((int *) self->_buffer->feed + position);
             break;
         }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        {
+            *(int16_t *) result = *((int16_t *) self->_buffer->feed + position);
+            break;
+        }
         default:
         {
             return false;
@@ -236,6 +323,11 @@ bool twr_data_stream_get_last(twr_data_stream_t *self, void *result)
             *(int *) result = *((int *) self->_buffer->feed + self->_feed_head);
             break;
         }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        {
+            *(int16_t *) result = *((int16_t *) self->_buffer->feed + self->_feed_head);
+            break;
+        }
         default:
         {
             return false;
@@ -292,6 +384,11 @@ bool twr_data_stream_get_nth(twr_data_stream_t *self, int n, void *result)
             *(int *) result = *((int *) self->_buffer->feed + position);
             break;
         }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        {
+            *(int16_t *) result = *((int16_t *) self->_buffer->feed + position);
+            break;
+        }
         default:
         {
             return false;
@@ -303,48 +400,66 @@ bool twr_data_stream_get_nth(twr_data_stream_t *self, int n, void *result)
 
 bool twr_data_stream_get_max(twr_data_stream_t *self, void *result)
 {
-    if (self->_counter < self->_min_number_of_samples)
+    int length = twr_data_stream_get_length(self);
+
+    if (self->_counter < self->_min_number_of_samples || length == 0)
     {
         return false;
     }
 
-    int length = twr_data_stream_get_length(self);
-
     switch (self->_buffer->type)
     {
         case TWR_DATA_STREAM_TYPE_FLOAT:
         {
-            float *buffer = (float *) self->_buffer->feed;
-
-            float max = buffer[0];
+            *(float *) result = *((float *) self->_buffer->sorted + length - 1);
 
-            for (int i = 1; i < length; i ++)
-            {
-                if (buffer[i] > max)
-                {
-                    max = buffer[i];
-                }
-            }
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT:
+        {
+            *(int *) result = *((int *) self->_buffer->sorted + length - 1);
 
-            *(float *) result = max;
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        {
+            *(int16_t *) result = *((int16_t *) self->_buffer->sorted + length - 1);
 
             break;
         }
-        case TWR_DATA_STREAM_TYPE_INT:
+        default:
         {
-            int *buffer = (int *) self->_buffer->feed;
+            return false;
+        }
+    }
 
-            int max = buffer[0];
+    return true;
+}
 
-            for (int i = 1; i < length; i ++)
-            {
-                if (buffer[i] > max)
-                {
-                    max = buffer[i];
-                }
-            }
+bool twr_data_stream_get_min(twr_data_stream_t *self, void *result)
+{
+    if (self->_counter < self->_min_number_of_samples || twr_data_stream_get_length(self) == 0)
+    {
+        return false;
+    }
+
+    switch (self->_buffer->type)
+    {
+        case TWR_DATA_STREAM_TYPE_FLOAT:
+        {
+            *(float *) result = *(float *) self->_buffer->sorted;
+
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT:
+        {
+            *(int *) result = *(int *) self->_buffer->sorted;
 
-            *(int *) result = max;
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        {
+            *(int16_t *) result = *(int16_t *) self->_buffer->sorted;
 
             break;
         }
@@ -357,50 +472,109 @@ bool twr_data_stream_get_max(twr_data_stream_t *self, void *result)
     return true;
 }
 
-bool twr_data_stream_get_min(twr_data_stream_t *self, void *result)
+bool twr_data_stream_get_summary(twr_data_stream_t *self, twr_data_stream_summary_t *summary)
 {
-    if (self->_counter < self->_min_number_of_samples)
+    if (self->_counter < self->_min_number_of_samples || self->_counter == 0)
     {
         return false;
     }
 
     int length = twr_data_stream_get_length(self);
 
+    summary->count = length;
+
+    // Mean, median, min, max, first and last are maintained by feed, only variance needs the pass over buffer
     switch (self->_buffer->type)
     {
         case TWR_DATA_STREAM_TYPE_FLOAT:
         {
             float *buffer = (float *) self->_buffer->feed;
 
-            float min = buffer[0];
+            twr_data_stream_get_average(self, &summary->mean);
+            twr_data_stream_get_median(self, &summary->median);
+            twr_data_stream_get_min(self, &summary->min);
+            twr_data_stream_get_max(self, &summary->max);
+            twr_data_stream_get_first(self, &summary->first);
+            twr_data_stream_get_last(self, &summary->last);
 
-            for (int i = 1; i < length; i ++)
+            float sum = 0;
+
+            for (int i = 0; i < length; i++)
             {
-                if (buffer[i] < min)
-                {
-                    min = buffer[i];
-                }
+                float deviation = buffer[i] - summary->mean;
+
+                sum += deviation * deviation;
             }
 
-            *(float *) result = min;
+            summary->variance = sum / length;
 
             break;
         }
         case TWR_DATA_STREAM_TYPE_INT:
         {
             int *buffer = (int *) self->_buffer->feed;
+            int *sort = (int *) self->_buffer->sorted;
+            int value;
+
+            summary->mean = (float) self->_sum._int / length;
+
+            // Median of even window is not truncated to integer as by twr_data_stream_get_median
+            summary->median = ((float) sort[(length - 1) / 2] + sort[length / 2]) / 2;
+
+            twr_data_stream_get_min(self, &value);
+            summary->min = value;
+            twr_data_stream_get_max(self, &value);
+            summary->max = value;
+            twr_data_stream_get_first(self, &value);
+            summary->first = value;
+            twr_data_stream_get_last(self, &value);
+            summary->last = value;
+
+            float sum = 0;
+
+            for (int i = 0; i < length; i++)
+            {
+                float deviation = buffer[i] - summary->mean;
+
+                sum += deviation * deviation;
+            }
+
+            summary->variance = sum / length;
+
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        {
+            int16_t *buffer = (int16_t *) self->_buffer->feed;
+            int16_t *sort = (int16_t *) self->_buffer->sorted;
+            int16_t value;
+            float scale = twr_data_stream_get_scale(self);
+
+            summary->mean = (float) self->_sum._int / length / scale;
+
+            // Median of even window is not truncated to integer as by twr_data_stream_get_median
+            summary->median = ((float) sort[(length - 1) / 2] + sort[length / 2]) / 2 / scale;
 
-            int min = buffer[0];
+            twr_data_stream_get_min(self, &value);
+            summary->min = value / scale;
+            twr_data_stream_get_max(self, &value);
+            summary->max = value / scale;
+            twr_data_stream_get_first(self, &value);
+            summary->first = value / scale;
+            twr_data_stream_get_last(self, &value);
+            summary->last = value / scale;
 
-            for (int i = 1; i < length; i ++)
+            // Integer sum of squares is exact, n * sum(x^2) - sum(x)^2 fits int64 for any int16 window
+            int64_t sum_squares = 0;
+
+            for (int i = 0; i < length; i++)
             {
-                if (buffer[i] < min)
-                {
-                    min = buffer[i];
-                }
+                sum_squares += (int32_t) buffer[i] * buffer[i];
             }
 
-            *(int *) result = min;
+            int64_t numerator = sum_squares * length - self->_sum._int * self->_sum._int;
+
+            summary->variance = (float) numerator / ((float) length * length) / (scale * scale);
 
             break;
         }
@@ -413,12 +587,320 @@ bool twr_data_stream_get_min(twr_data_stream_t *self, void *result)
     return true;
 }
 
-static int _twr_data_stream_compare_float(const void *a, const void *b)
+void twr_data_stream_rollup_init(twr_data_stream_rollup_t *self, twr_data_stream_rollup_level_t **levels, int number_of_levels)
+{
+    memset(self, 0, sizeof(*self));
+    self->_levels = levels;
+    self->_number_of_levels = number_of_levels;
+
+    twr_data_stream_rollup_reset(self);
+}
+
+void twr_data_stream_rollup_feed(twr_data_stream_rollup_t *self, float value)
+{
+    if (isnan(value) || isinf(value))
+    {
+        return;
+    }
+
+    twr_data_stream_rollup_record_t record = { .min = value, .average = value, .max = value };
+
+    // Completed record of one level is folded into the next one
+    for (int i = 0; i < self->_number_of_levels; i++)
+    {
+        twr_data_stream_rollup_level_t *level = self->_levels[i];
+
+        _twr_data_stream_rollup_fold(&level->_pending, level->_pending_count, &record);
+
+        if (++level->_pending_count < level->fold)
+        {
+            return;
+        }
+
+        record = level->_pending;
+        record.average /= level->fold;
+
+        level->_pending_count = 0;
+
+        if (++level->_head == level->number_of_records)
+        {
+            level->_head = 0;
+        }
+
+        level->records[level->_head] = record;
+
+        if (level->_length < level->number_of_records)
+        {
+            level->_length++;
+        }
+    }
+}
+
+void twr_data_stream_rollup_reset(twr_data_stream_rollup_t *self)
+{
+    for (int i = 0; i < self->_number_of_levels; i++)
+    {
+        twr_data_stream_rollup_level_t *level = self->_levels[i];
+
+        level->_pending_count = 0;
+        level->_head = level->number_of_records - 1;
+        level->_length = 0;
+    }
+}
+
+int twr_data_stream_rollup_get_length(twr_data_stream_rollup_t *self, int level)
+{
+    if (level < 0 || level >= self->_number_of_levels)
+    {
+        return 0;
+    }
+
+    return self->_levels[level]->_length;
+}
+
+bool twr_data_stream_rollup_get_record(twr_data_stream_rollup_t *self, int level, int n, twr_data_stream_rollup_record_t *record)
+{
+    if (n < 0 || n >= twr_data_stream_rollup_get_length(self, level))
+    {
+        return false;
+    }
+
+    twr_data_stream_rollup_level_t *l = self->_levels[level];
+
+    int position = l->_head - n;
+
+    if (position < 0)
+    {
+        position += l->number_of_records;
+    }
+
+    *record = l->records[position];
+
+    return true;
+}
+
+bool twr_data_stream_rollup_get_total(twr_data_stream_rollup_t *self, int level, twr_data_stream_rollup_record_t *record)
+{
+    int length = twr_data_stream_rollup_get_length(self, level);
+
+    if (length == 0)
+    {
+        return false;
+    }
+
+    twr_data_stream_rollup_record_t *records = self->_levels[level]->records;
+
+    twr_data_stream_rollup_record_t total;
+
+    for (int i = 0; i < length; i++)
+    {
+        _twr_data_stream_rollup_fold(&total, i, &records[i]);
+    }
+
+    total.average /= length;
+
+    *record = total;
+
+    return true;
+}
+
+static void _twr_data_stream_rollup_fold(twr_data_stream_rollup_record_t *pending, int count, twr_data_stream_rollup_record_t *record)
+{
+    // Pending record keeps sum of averages until it is complete, folded records cover equal periods
+    if (count == 0)
+    {
+        *pending = *record;
+
+        return;
+    }
+
+    if (record->min < pending->min)
+    {
+        pending->min = record->min;
+    }
+
+    if (record->max > pending->max)
+    {
+        pending->max = record->max;
+    }
+
+    pending->average += record->average;
+}
+
+static void _twr_data_stream_sort_float(float *sort, int length, int position, float value)
+{
+    // Move the free slot towards the place of the new value, only samples in between are shifted
+    while (position > 0 && sort[position - 1] > value)
+    {
+        sort[position] = sort[position - 1];
+        position--;
+    }
+
+    while (position < length - 1 && sort[position + 1] < value)
+    {
+        sort[position] = sort[position + 1];
+        position++;
+    }
+
+    sort[position] = value;
+}
+
+static void _twr_data_stream_sort_int(int *sort, int length, int position, int value)
+{
+    // Move the free slot towards the place of the new value, only samples in between are shifted
+    while (position > 0 && sort[position - 1] > value)
+    {
+        sort[position] = sort[position - 1];
+        position--;
+    }
+
+    while (position < length - 1 && sort[position + 1] < value)
+    {
+        sort[position] = sort[position + 1];
+        position++;
+    }
+
+    sort[position] = value;
+}
+
+static void _twr_data_stream_sort_int16(int16_t *sort, int length, int position, int16_t value)
 {
-    return *(float *) a - *(float *) b;
+    // Move the free slot towards the place of the new value, only samples in between are shifted
+    while (position > 0 && sort[position - 1] > value)
+    {
+        sort[position] = sort[position - 1];
+        position--;
+    }
+
+    while (position < length - 1 && sort[position + 1] < value)
+    {
+        sort[position] = sort[position + 1];
+        position++;
+    }
+
+    sort[position] = value;
 }
 
-static int _twr_data_stream_compare_int(const void *a, const void *b)
+static int _twr_data_stream_sort_find_float(float *sort, int length, float value)
 {
-    return *(int *) a - *(int *) b;
+    int low = 0;
+    int high = length - 1;
+
+    while (low < high)
+    {
+        int middle = low + (high - low) / 2;
+
+        if (sort[middle] < value)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+static int _twr_data_stream_sort_find_int(int *sort, int length, int value)
+{
+    int low = 0;
+    int high = length - 1;
+
+    while (low < high)
+    {
+        int middle = low + (high - low) / 2;
+
+        if (sort[middle] < value)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+static int _twr_data_stream_sort_find_int16(int16_t *sort, int length, int16_t value)
+{
+    int low = 0;
+    int high = length - 1;
+
+    while (low < high)
+    {
+        int middle = low + (high - low) / 2;
+
+        if (sort[middle] < value)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+static void _twr_data_stream_sum_add_float(twr_data_stream_t *self, float value)
+{
+    float y = value - self->_sum._float._compensation;
+    float t = self->_sum._float._value + y;
+
+    self->_sum._float._compensation = (t - self->_sum._float._value) - y;
+    self->_sum._float._value = t;
+}
+
+static void _twr_data_stream_sum_update(twr_data_stream_t *self)
+{
+    // Recompute the sum from scratch so that rounding errors of removed samples do not accumulate
+    int length = self->_buffer->number_of_samples;
+
+    memset(&self->_sum, 0, sizeof(self->_sum));
+
+    switch (self->_buffer->type)
+    {
+        case TWR_DATA_STREAM_TYPE_FLOAT:
+        {
+            float *buffer = (float *) self->_buffer->feed;
+
+            for (int i = 0; i < length; i++)
+            {
+                _twr_data_stream_sum_add_float(self, buffer[i]);
+            }
+
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT:
+        {
+            int *buffer = (int *) self->_buffer->feed;
+
+            for (int i = 0; i < length; i++)
+            {
+                self->_sum._int += buffer[i];
+            }
+
+            break;
+        }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        {
+            int16_t *buffer = (int16_t *) self->_buffer->feed;
+
+            for (int i = 0; i < length; i++)
+            {
+                self->_sum._int += buffer[i];
+            }
+
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
 }
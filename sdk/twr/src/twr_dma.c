@@ -1,7 +1,6 @@
 #include <twr_dma.h>
 #include <twr_irq.h>
 #include <twr_scheduler.h>
-#include <twr_fifo.h>
 #include <stm32l0xx.h>
 
 #define _TWR_DMA_CHECK_IRQ_OF_CHANNEL_(__CHANNEL) \
@@ -23,15 +22,6 @@
         } \
     }
 
-typedef struct
-{
-    uint8_t channel : 4;
-    uint8_t event : 4;
-
-} twr_dma_pending_event_t;
-
-static twr_dma_pending_event_t _twr_dma_pending_event_buffer[2 * 7 * sizeof(twr_dma_pending_event_t)];
-
 static struct
 {
     bool is_initialized;
@@ -44,12 +34,9 @@ static struct
 
     } channel[7];
 
-    twr_fifo_t fifo_pending;
-    twr_scheduler_task_id_t task_id;
-
 } _twr_dma;
 
-static void _twr_dma_task(void *param);
+static void _twr_dma_event(void *param, uint32_t event);
 
 static void _twr_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event);
 
@@ -69,10 +56,6 @@ void twr_dma_init(void)
     _twr_dma.channel[TWR_DMA_CHANNEL_6].instance = DMA1_Channel6;
     _twr_dma.channel[TWR_DMA_CHANNEL_7].instance = DMA1_Channel7;
 
-    twr_fifo_init(&_twr_dma.fifo_pending, _twr_dma_pending_event_buffer, sizeof(_twr_dma_pending_event_buffer));
-
-    _twr_dma.task_id = twr_scheduler_register(_twr_dma_task, NULL, TWR_TICK_INFINITY);
-
     // Enable DMA1
     RCC->AHBENR |= RCC_AHBENR_DMA1EN;
 
@@ -191,18 +174,13 @@ size_t twr_dma_channel_get_length(twr_dma_channel_t channel)
     return (size_t) _twr_dma.channel[channel].instance->CNDTR;
 }
 
-void _twr_dma_task(void *param)
+static void _twr_dma_event(void *param, uint32_t event)
 {
-    (void) param;
-
-    twr_dma_pending_event_t pending_event;
+    twr_dma_channel_t channel = (twr_dma_channel_t) param;
 
-    while (twr_fifo_read(&_twr_dma.fifo_pending, &pending_event, sizeof(twr_dma_pending_event_t)) != 0)
+    if (_twr_dma.channel[channel].event_handler != NULL)
     {
-        if (_twr_dma.channel[pending_event.channel].event_handler != NULL)
-        {
-            _twr_dma.channel[pending_event.channel].event_handler(pending_event.channel, pending_event.event, _twr_dma.channel[pending_event.channel].event_param);
-        }
+        _twr_dma.channel[channel].event_handler(channel, (twr_dma_event_t) event, _twr_dma.channel[channel].event_param);
     }
 }
 
@@ -213,11 +191,7 @@ void _twr_dma_irq_handler(twr_dma_channel_t channel, twr_dma_event_t event)
         twr_dma_channel_stop(channel);
     }
 
-    twr_dma_pending_event_t pending_event = { channel, event };
-
-    twr_fifo_irq_write(&_twr_dma.fifo_pending, &pending_event, sizeof(twr_dma_pending_event_t));
-
-    twr_scheduler_plan_now(_twr_dma.task_id);
+    twr_scheduler_post_event_irq(_twr_dma_event, (void *) channel, event);
 }
 
 void DMA1_Channel1_IRQHandler(void)
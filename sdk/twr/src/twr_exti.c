@@ -1,5 +1,6 @@
 #include <twr_exti.h>
 #include <twr_irq.h>
+#include <twr_scheduler.h>
 #include <stm32l0xx.h>
 
 static bool _twr_exti_initialized = false;
@@ -9,12 +10,54 @@ static struct
     twr_exti_line_t line;
     void (*callback)(twr_exti_line_t, void *);
     void *param;
+    bool deferred;
 
 } _twr_exti[16];
 
+static void _twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param, bool deferred);
+
+static void _twr_exti_event(void *param, uint32_t pin);
+
+static inline void _twr_exti_call(uint8_t pin);
+
 static inline void _twr_exti_irq_handler(void);
 
 void twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param)
+{
+    _twr_exti_register(line, edge, callback, param, false);
+}
+
+void twr_exti_register_deferred(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param)
+{
+    _twr_exti_register(line, edge, callback, param, true);
+}
+
+void twr_exti_unregister(twr_exti_line_t line)
+{
+    // Extract pin number
+    uint8_t pin = (uint8_t) line & 15;
+
+    // Extract mask
+    uint16_t mask = 1 << pin;
+
+    // Disable interrupts
+    twr_irq_disable();
+
+    // If line identifier matches record...
+    if (line == _twr_exti[pin].line)
+    {
+        // Mask interrupt request
+        EXTI->IMR &= ~mask;
+
+        // Clear pending interrupt
+        EXTI->PR = mask;
+    }
+
+    // Enable interrupts
+    twr_irq_enable();
+}
+
+static void _twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param, bool deferred)
 {
     // Extract port number
     uint8_t port = ((uint8_t) line >> 4) & 7;
@@ -37,6 +80,9 @@ void twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callba
     // Store callback parameter
     _twr_exti[pin].param = param;
 
+    // Store whether callback is called from scheduler
+    _twr_exti[pin].deferred = deferred;
+
     // If this is the first call...
     if (!_twr_exti_initialized)
     {
@@ -87,50 +133,50 @@ void twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callba
     twr_irq_enable();
 }
 
-void twr_exti_unregister(twr_exti_line_t line)
+static void _twr_exti_event(void *param, uint32_t pin)
 {
-    // Extract pin number
-    uint8_t pin = (uint8_t) line & 15;
+    (void) param;
 
-    // Extract mask
-    uint16_t mask = 1 << pin;
+    // Skip event of line unregistered meanwhile
+    if ((EXTI->IMR & (1 << pin)) == 0)
+    {
+        return;
+    }
 
-    // Disable interrupts
-    twr_irq_disable();
+    _twr_exti[pin].callback(_twr_exti[pin].line, _twr_exti[pin].param);
+}
 
-    // If line identifier matches record...
-    if (line == _twr_exti[pin].line)
+static inline void _twr_exti_call(uint8_t pin)
+{
+    if (_twr_exti[pin].deferred)
     {
-        // Mask interrupt request
-        EXTI->IMR &= ~mask;
-
-        // Clear pending interrupt
-        EXTI->PR = mask;
+        twr_scheduler_post_event_irq(_twr_exti_event, NULL, pin);
+    }
+    else
+    {
+        _twr_exti[pin].callback(_twr_exti[pin].line, _twr_exti[pin].param);
     }
-
-    // Enable interrupts
-    twr_irq_enable();
 }
 
 static inline void _twr_exti_irq_handler(void)
 {
     // Determine source of interrupt and call appropriate callback
-    if ((EXTI->PR & 0x0001) != 0) { EXTI->PR = 0x0001; _twr_exti[0].callback(_twr_exti[0].line, _twr_exti[0].param); return; }
-    if ((EXTI->PR & 0x0002) != 0) { EXTI->PR = 0x0002; _twr_exti[1].callback(_twr_exti[1].line, _twr_exti[1].param); return; }
-    if ((EXTI->PR & 0x0004) != 0) { EXTI->PR = 0x0004; _twr_exti[2].callback(_twr_exti[2].line, _twr_exti[2].param); return; }
-    if ((EXTI->PR & 0x0008) != 0) { EXTI->PR = 0x0008; _twr_exti[3].callback(_twr_exti[3].line, _twr_exti[3].param); return; }
-    if ((EXTI->PR & 0x0010) != 0) { EXTI->PR = 0x0010; _twr_exti[4].callback(_twr_exti[4].line, _twr_exti[4].param); return; }
-    if ((EXTI->PR & 0x0020) != 0) { EXTI->PR = 0x0020; _twr_exti[5].callback(_twr_exti[5].line, _twr_exti[5].param); return; }
-    if ((EXTI->PR & 0x0040) != 0) { EXTI->PR = 0x0040; _twr_exti[6].callback(_twr_exti[6].line, _twr_exti[6].param); return; }
-    if ((EXTI->PR & 0x0080) != 0) { EXTI->PR = 0x0080; _twr_exti[7].callback(_twr_exti[7].line, _twr_exti[7].param); return; }
-    if ((EXTI->PR & 0x0100) != 0) { EXTI->PR = 0x0100; _twr_exti[8].callback(_twr_exti[8].line, _twr_exti[8].param); return; }
-    if ((EXTI->PR & 0x0200) != 0) { EXTI->PR = 0x0200; _twr_exti[9].callback(_twr_exti[9].line, _twr_exti[9].param); return; }
-    if ((EXTI->PR & 0x0400) != 0) { EXTI->PR = 0x0400; _twr_exti[10].callback(_twr_exti[10].line, _twr_exti[10].param); return; }
-    if ((EXTI->PR & 0x0800) != 0) { EXTI->PR = 0x0800; _twr_exti[11].callback(_twr_exti[11].line, _twr_exti[11].param); return; }
-    if ((EXTI->PR & 0x1000) != 0) { EXTI->PR = 0x1000; _twr_exti[12].callback(_twr_exti[12].line, _twr_exti[12].param); return; }
-    if ((EXTI->PR & 0x2000) != 0) { EXTI->PR = 0x2000; _twr_exti[13].callback(_twr_exti[13].line, _twr_exti[13].param); return; }
-    if ((EXTI->PR & 0x4000) != 0) { EXTI->PR = 0x4000; _twr_exti[14].callback(_twr_exti[14].line, _twr_exti[14].param); return; }
-    if ((EXTI->PR & 0x8000) != 0) { EXTI->PR = 0x8000; _twr_exti[15].callback(_twr_exti[15].line, _twr_exti[15].param); return; }
+    if ((EXTI->PR & 0x0001) != 0) { EXTI->PR = 0x0001; _twr_exti_call(0); return; }
+    if ((EXTI->PR & 0x0002) != 0) { EXTI->PR = 0x0002; _twr_exti_call(1); return; }
+    if ((EXTI->PR & 0x0004) != 0) { EXTI->PR = 0x0004; _twr_exti_call(2); return; }
+    if ((EXTI->PR & 0x0008) != 0) { EXTI->PR = 0x0008; _twr_exti_call(3); return; }
+    if ((EXTI->PR & 0x0010) != 0) { EXTI->PR = 0x0010; _twr_exti_call(4); return; }
+    if ((EXTI->PR & 0x0020) != 0) { EXTI->PR = 0x0020; _twr_exti_call(5); return; }
+    if ((EXTI->PR & 0x0040) != 0) { EXTI->PR = 0x0040; _twr_exti_call(6); return; }
+    if ((EXTI->PR & 0x0080) != 0) { EXTI->PR = 0x0080; _twr_exti_call(7); return; }
+    if ((EXTI->PR & 0x0100) != 0) { EXTI->PR = 0x0100; _twr_exti_call(8); return; }
+    if ((EXTI->PR & 0x0200) != 0) { EXTI->PR = 0x0200; _twr_exti_call(9); return; }
+    if ((EXTI->PR & 0x0400) != 0) { EXTI->PR = 0x0400; _twr_exti_call(10); return; }
+    if ((EXTI->PR & 0x0800) != 0) { EXTI->PR = 0x0800; _twr_exti_call(11); return; }
+    if ((EXTI->PR & 0x1000) != 0) { EXTI->PR = 0x1000; _twr_exti_call(12); return; }
+    if ((EXTI->PR & 0x2000) != 0) { EXTI->PR = 0x2000; _twr_exti_call(13); return; }
+    if ((EXTI->PR & 0x4000) != 0) { EXTI->PR = 0x4000; _twr_exti_call(14); return; }
+    if ((EXTI->PR & 0x8000) != 0) { EXTI->PR = 0x8000; _twr_exti_call(15); return; }
 }
 
 void EXTI0_1_IRQHandler(void)
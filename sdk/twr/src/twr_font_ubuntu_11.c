@@ -1,2899 +1,180 @@
-
-/*******************************************************************************
-* font
-* filename: C:/Users/mhubacek/Documents/Dev/BigClown/github/bc-lcd-fonts/sdk/fonts/twr_font_ubuntu11.xml
-* name: twr_font_ubuntu_11
-* family: Ubuntu
-* size: 8
-* style: Normal
-* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~°ěščřžýáíéúůťďň
-* antialiasing: no
-* type: proportional
-* encoding: ISO-8859-2
-* unicode bom: no
-*
-* preset name: HARDWARIO LCD Module
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Diffuse Dither 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
+// Generated by twr_font_compile.py from bc_font_ubuntu11.xml, do not edit
 
 #include <twr_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x20[11] = {
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x20 = { image_data_twr_font_ubuntu_11_0x20,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x21[11] = {
-    0xc0,
-    0xc0,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0xc0,
-    0x80,
-    0xc0,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x21 = { image_data_twr_font_ubuntu_11_0x21,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x22[11] = {
-    0xe0,
-    0xe0,
-    0x80,
-    0x80,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x22 = { image_data_twr_font_ubuntu_11_0x22,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x23[11] = {
-    0xf8,
-    0xf8,
-    0xb0,
-    0x00,
-    0xb0,
-    0x68,
-    0x00,
-    0x68,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x23 = { image_data_twr_font_ubuntu_11_0x23,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x24[11] = {
-    0xf8,
-    0xf8,
-    0xe8,
-    0xc0,
-    0xb8,
-    0xc8,
-    0xf0,
-    0x88,
-    0xe8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x24 = { image_data_twr_font_ubuntu_11_0x24,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x25[11] = {
-    0xfe,
-    0xfe,
-    0xda,
-    0xa6,
-    0xd6,
-    0xea,
-    0xe4,
-    0xda,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x25 = { image_data_twr_font_ubuntu_11_0x25,
-    7, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x26[11] = {
-    0xf8,
-    0xf8,
-    0xd8,
-    0xa8,
-    0x98,
-    0x90,
-    0xa0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x26 = { image_data_twr_font_ubuntu_11_0x26,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x27[11] = {
-    0xc0,
-    0xc0,
-    0x80,
-    0x80,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x27 = { image_data_twr_font_ubuntu_11_0x27,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x28[11] = {
-    0xe0,
-    0xe0,
-    0xc0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x28 = { image_data_twr_font_ubuntu_11_0x28,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x29[11] = {
-    0xe0,
-    0xe0,
-    0x60,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x29 = { image_data_twr_font_ubuntu_11_0x29,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2a[11] = {
-    0xf0,
-    0xf0,
-    0xd0,
-    0x80,
-    0xa0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2a = { image_data_twr_font_ubuntu_11_0x2a,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2b[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xd8,
-    0xd8,
-    0x00,
-    0xd8,
-    0xd8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2b = { image_data_twr_font_ubuntu_11_0x2b,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2c[11] = {
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0x80,
-    0x40,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2c = { image_data_twr_font_ubuntu_11_0x2c,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2d[11] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x80,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2d = { image_data_twr_font_ubuntu_11_0x2d,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2e[11] = {
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2e = { image_data_twr_font_ubuntu_11_0x2e,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x2f[11] = {
-    0xe0,
-    0xe0,
-    0xc0,
-    0xc0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0x60,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x2f = { image_data_twr_font_ubuntu_11_0x2f,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x30[11] = {
-    0xf8,
-    0xf8,
-    0xc8,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xc8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x30 = { image_data_twr_font_ubuntu_11_0x30,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x31[11] = {
-    0xf8,
-    0xf8,
-    0xe8,
-    0xc8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x31 = { image_data_twr_font_ubuntu_11_0x31,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x32[11] = {
-    0xf8,
-    0xf8,
-    0xc8,
-    0xb0,
-    0xf0,
-    0xe8,
-    0xd8,
-    0x80,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x32 = { image_data_twr_font_ubuntu_11_0x32,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x33[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xf0,
-    0xc8,
-    0xf0,
-    0xf0,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x33 = { image_data_twr_font_ubuntu_11_0x33,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x34[11] = {
-    0xf8,
-    0xf8,
-    0xe8,
-    0xc8,
-    0xa8,
-    0x80,
-    0xe8,
-    0xe8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x34 = { image_data_twr_font_ubuntu_11_0x34,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x35[11] = {
-    0xf8,
-    0xf8,
-    0xc0,
-    0xd8,
-    0xc8,
-    0xf0,
-    0xf0,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x35 = { image_data_twr_font_ubuntu_11_0x35,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x36[11] = {
-    0xf8,
-    0xf8,
-    0xe0,
-    0xd8,
-    0x88,
-    0xb0,
-    0xb0,
-    0xc8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x36 = { image_data_twr_font_ubuntu_11_0x36,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x37[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xe8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x37 = { image_data_twr_font_ubuntu_11_0x37,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x38[11] = {
-    0xf8,
-    0xf8,
-    0xc8,
-    0xb0,
-    0xc8,
-    0xb0,
-    0xb0,
-    0xc8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x38 = { image_data_twr_font_ubuntu_11_0x38,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x39[11] = {
-    0xf8,
-    0xf8,
-    0xc8,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xe8,
-    0x98,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x39 = { image_data_twr_font_ubuntu_11_0x39,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3a[11] = {
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3a = { image_data_twr_font_ubuntu_11_0x3a,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3b[11] = {
-    0xc0,
-    0xc0,
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0xc0,
-    0x80,
-    0x40,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3b = { image_data_twr_font_ubuntu_11_0x3b,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3c[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x88,
-    0x78,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3c = { image_data_twr_font_ubuntu_11_0x3c,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3d[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x80,
-    0xf8,
-    0x80,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3d = { image_data_twr_font_ubuntu_11_0x3d,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3e[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x98,
-    0xe8,
-    0x98,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3e = { image_data_twr_font_ubuntu_11_0x3e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x3f[11] = {
-    0xe0,
-    0xe0,
-    0x80,
-    0xc0,
-    0xc0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x3f = { image_data_twr_font_ubuntu_11_0x3f,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x40[11] = {
-    0xff,
-    0xff,
-    0xe3,
-    0xdd,
-    0xb2,
-    0xaa,
-    0xaa,
-    0xa5,
-    0xdf,
-    0xe3,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x40 = { image_data_twr_font_ubuntu_11_0x40,
-    8, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x41[11] = {
-    0xfc,
-    0xfc,
-    0xec,
-    0xd4,
-    0xd4,
-    0xd4,
-    0x80,
-    0xb8,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x41 = { image_data_twr_font_ubuntu_11_0x41,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x42[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xb0,
-    0x88,
-    0xb0,
-    0xb0,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x42 = { image_data_twr_font_ubuntu_11_0x42,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x43[11] = {
-    0xf8,
-    0xf8,
-    0xc0,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x43 = { image_data_twr_font_ubuntu_11_0x43,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x44[11] = {
-    0xfc,
-    0xfc,
-    0x84,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0x84,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x44 = { image_data_twr_font_ubuntu_11_0x44,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x45[11] = {
-    0xf8,
-    0xf8,
-    0x80,
-    0xb8,
-    0x88,
-    0xb8,
-    0xb8,
-    0x80,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x45 = { image_data_twr_font_ubuntu_11_0x45,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x46[11] = {
-    0xf0,
-    0xf0,
-    0x80,
-    0xb0,
-    0x90,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x46 = { image_data_twr_font_ubuntu_11_0x46,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x47[11] = {
-    0xf8,
-    0xf8,
-    0xc0,
-    0xb8,
-    0xb8,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x47 = { image_data_twr_font_ubuntu_11_0x47,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x48[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0xb8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x48 = { image_data_twr_font_ubuntu_11_0x48,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x49[11] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x49 = { image_data_twr_font_ubuntu_11_0x49,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x4a[11] = {
-    0xf0,
-    0xf0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x90,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x4a = { image_data_twr_font_ubuntu_11_0x4a,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x4b[11] = {
-    0xf8,
-    0xf8,
-    0xb0,
-    0xa8,
-    0x98,
-    0x98,
-    0xa8,
-    0xb0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x4b = { image_data_twr_font_ubuntu_11_0x4b,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x4c[11] = {
-    0xf0,
-    0xf0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0x80,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x4c = { image_data_twr_font_ubuntu_11_0x4c,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x4d[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0x90,
-    0x90,
-    0xa8,
-    0xa8,
-    0xb8,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x4d = { image_data_twr_font_ubuntu_11_0x4d,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x4e[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0x88,
-    0x88,
-    0x88,
-    0x88,
-    0xa8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x4e = { image_data_twr_font_ubuntu_11_0x4e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x4f[11] = {
-    0xfc,
-    0xfc,
-    0xc4,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x4f = { image_data_twr_font_ubuntu_11_0x4f,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x50[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xb0,
-    0xb0,
-    0x88,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x50 = { image_data_twr_font_ubuntu_11_0x50,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x51[11] = {
-    0xfc,
-    0xfc,
-    0xc4,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xc4,
-    0xec,
-    0xf4,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x51 = { image_data_twr_font_ubuntu_11_0x51,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x52[11] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xb0,
-    0xb0,
-    0x88,
-    0xa8,
-    0xb0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x52 = { image_data_twr_font_ubuntu_11_0x52,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x53[11] = {
-    0xf0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xe0,
-    0x90,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x53 = { image_data_twr_font_ubuntu_11_0x53,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x54[11] = {
-    0xf0,
-    0xf0,
-    0x80,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x54 = { image_data_twr_font_ubuntu_11_0x54,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x55[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x55 = { image_data_twr_font_ubuntu_11_0x55,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x56[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0xb8,
-    0xd4,
-    0xd4,
-    0xd4,
-    0xec,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x56 = { image_data_twr_font_ubuntu_11_0x56,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x57[11] = {
-    0xff,
-    0xff,
-    0xbe,
-    0xb6,
-    0xaa,
-    0xaa,
-    0xaa,
-    0xdd,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x57 = { image_data_twr_font_ubuntu_11_0x57,
-    8, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x58[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0xd4,
-    0xec,
-    0xec,
-    0xd4,
-    0xb8,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x58 = { image_data_twr_font_ubuntu_11_0x58,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x59[11] = {
-    0xfc,
-    0xfc,
-    0xb8,
-    0xd4,
-    0xd4,
-    0xec,
-    0xec,
-    0xec,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x59 = { image_data_twr_font_ubuntu_11_0x59,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5a[11] = {
-    0xf8,
-    0xf8,
-    0x80,
-    0xf0,
-    0xe8,
-    0xd8,
-    0xb8,
-    0x80,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5a = { image_data_twr_font_ubuntu_11_0x5a,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5b[11] = {
-    0xe0,
-    0xe0,
-    0x80,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x80,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5b = { image_data_twr_font_ubuntu_11_0x5b,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5c[11] = {
-    0xe0,
-    0xe0,
-    0x60,
-    0x60,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xc0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5c = { image_data_twr_font_ubuntu_11_0x5c,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5d[11] = {
-    0xe0,
-    0xe0,
-    0x20,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x20,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5d = { image_data_twr_font_ubuntu_11_0x5d,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5e[11] = {
-    0xf8,
-    0xf8,
-    0xd8,
-    0xa8,
-    0xa8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5e = { image_data_twr_font_ubuntu_11_0x5e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x5f[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0x00,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x5f = { image_data_twr_font_ubuntu_11_0x5f,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x60[11] = {
-    0xe0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x60 = { image_data_twr_font_ubuntu_11_0x60,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x61[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0x90,
-    0xe0,
-    0xc0,
-    0x80,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x61 = { image_data_twr_font_ubuntu_11_0x61,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x62[11] = {
-    0xf8,
-    0xf8,
-    0xb8,
-    0xb8,
-    0x88,
-    0xb0,
-    0xb0,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x62 = { image_data_twr_font_ubuntu_11_0x62,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x63[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x63 = { image_data_twr_font_ubuntu_11_0x63,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x64[11] = {
-    0xf8,
-    0xf8,
-    0xf0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x64 = { image_data_twr_font_ubuntu_11_0x64,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x65[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0x80,
-    0x80,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x65 = { image_data_twr_font_ubuntu_11_0x65,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x66[11] = {
-    0xe0,
-    0xe0,
-    0xc0,
-    0xa0,
-    0x80,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x66 = { image_data_twr_font_ubuntu_11_0x66,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x67[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xc0,
-    0xb0,
-    0xc0,
-    0xf0,
-    0x88,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x67 = { image_data_twr_font_ubuntu_11_0x67,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x68[11] = {
-    0xf8,
-    0xf8,
-    0xb8,
-    0xb8,
-    0x88,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x68 = { image_data_twr_font_ubuntu_11_0x68,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x69[11] = {
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0xc0,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x69 = { image_data_twr_font_ubuntu_11_0x69,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6a[11] = {
-    0xc0,
-    0xc0,
-    0x80,
-    0xc0,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0x40,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6a = { image_data_twr_font_ubuntu_11_0x6a,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6b[11] = {
-    0xf0,
-    0xf0,
-    0xb0,
-    0xb0,
-    0xa0,
-    0x90,
-    0x90,
-    0xa0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6b = { image_data_twr_font_ubuntu_11_0x6b,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6c[11] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6c = { image_data_twr_font_ubuntu_11_0x6c,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6d[22] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0x89, 0x80,
-    0xb6, 0x80,
-    0xb6, 0x80,
-    0xb6, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6d = { image_data_twr_font_ubuntu_11_0x6d,
-    9, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6e[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x88,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6e = { image_data_twr_font_ubuntu_11_0x6e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x6f[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xc8,
-    0xb0,
-    0xb0,
-    0xc8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x6f = { image_data_twr_font_ubuntu_11_0x6f,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x70[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x88,
-    0xb0,
-    0xb0,
-    0x88,
-    0xb8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x70 = { image_data_twr_font_ubuntu_11_0x70,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x71[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xc0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x71 = { image_data_twr_font_ubuntu_11_0x71,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x72[11] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x80,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x72 = { image_data_twr_font_ubuntu_11_0x72,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x73[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xc0,
-    0x90,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x73 = { image_data_twr_font_ubuntu_11_0x73,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x74[11] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0x80,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x74 = { image_data_twr_font_ubuntu_11_0x74,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x75[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x75 = { image_data_twr_font_ubuntu_11_0x75,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x76[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xa0,
-    0xa0,
-    0xd0,
-    0xd0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x76 = { image_data_twr_font_ubuntu_11_0x76,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x77[11] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xa8,
-    0xa8,
-    0xa8,
-    0xd4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x77 = { image_data_twr_font_ubuntu_11_0x77,
-    6, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x78[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xa0,
-    0xd0,
-    0xd0,
-    0xa0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x78 = { image_data_twr_font_ubuntu_11_0x78,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x79[11] = {
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xa0,
-    0xa0,
-    0xd0,
-    0xd0,
-    0xb0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x79 = { image_data_twr_font_ubuntu_11_0x79,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x7a[11] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x80,
-    0xc0,
-    0xa0,
-    0x80,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x7a = { image_data_twr_font_ubuntu_11_0x7a,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x7b[11] = {
-    0xe0,
-    0xe0,
-    0xc0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x7b = { image_data_twr_font_ubuntu_11_0x7b,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x7c[11] = {
-    0xc0,
-    0xc0,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0x80,
-    0xc0,
-    0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x7c = { image_data_twr_font_ubuntu_11_0x7c,
-    2, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x7d[11] = {
-    0xe0,
-    0xe0,
-    0x60,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x7d = { image_data_twr_font_ubuntu_11_0x7d,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0x7e[11] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xa8,
-    0x58,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0x7e = { image_data_twr_font_ubuntu_11_0x7e,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xb0[11] = {
-    0xe0,
-    0x80,
-    0x80,
-    0x80,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xb0 = { image_data_twr_font_ubuntu_11_0xb0,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xb9[11] = {
-    0xf0,
-    0xa0,
-    0xd0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xc0,
-    0x90,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xb9 = { image_data_twr_font_ubuntu_11_0xb9,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xbb[11] = {
-    0xf0,
-    0xe0,
-    0xe0,
-    0xb0,
-    0x90,
-    0xb0,
-    0xb0,
-    0xd0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xbb = { image_data_twr_font_ubuntu_11_0xbb,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xbe[11] = {
-    0xe0,
-    0x40,
-    0xa0,
-    0xe0,
-    0x80,
-    0xc0,
-    0xa0,
-    0x80,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xbe = { image_data_twr_font_ubuntu_11_0xbe,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xe1[11] = {
-    0xf0,
-    0xe0,
-    0xd0,
-    0xf0,
-    0x90,
-    0xe0,
-    0xc0,
-    0x80,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xe1 = { image_data_twr_font_ubuntu_11_0xe1,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xe8[11] = {
-    0xf0,
-    0xa0,
-    0xd0,
-    0xf0,
-    0xc0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xe8 = { image_data_twr_font_ubuntu_11_0xe8,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xe9[11] = {
-    0xf0,
-    0xe0,
-    0xd0,
-    0xf0,
-    0x80,
-    0x80,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xe9 = { image_data_twr_font_ubuntu_11_0xe9,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xec[11] = {
-    0xa0,
-    0xd0,
-    0xf0,
-    0xf0,
-    0x80,
-    0x80,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xec = { image_data_twr_font_ubuntu_11_0xec,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xed[11] = {
-    0xe0,
-    0xc0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xed = { image_data_twr_font_ubuntu_11_0xed,
-    3, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xef[11] = {
-    0xfe,
-    0xfe,
-    0xf4,
-    0xf4,
-    0xc6,
-    0xb6,
-    0xb6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xef = { image_data_twr_font_ubuntu_11_0xef,
-    7, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xf2[11] = {
-    0xf8,
-    0xd0,
-    0xe8,
-    0xf8,
-    0x88,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xf2 = { image_data_twr_font_ubuntu_11_0xf2,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xf8[11] = {
-    0xf0,
-    0xa0,
-    0xd0,
-    0xf0,
-    0x90,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xf8 = { image_data_twr_font_ubuntu_11_0xf8,
-    4, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xf9[11] = {
-    0xe8,
-    0xd0,
-    0xe8,
-    0xf8,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xf9 = { image_data_twr_font_ubuntu_11_0xf9,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xfa[11] = {
-    0xf8,
-    0xe8,
-    0xd8,
-    0xf8,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xfa = { image_data_twr_font_ubuntu_11_0xfa,
-    5, 11/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_11_0xfd[11] = {
-    0xf0,
-    0xe0,
-    0xd0,
-    0xf0,
-    0xa0,
-    0xa0,
-    0xd0,
-    0xd0,
-    0xb0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_11_0xfd = { image_data_twr_font_ubuntu_11_0xfd,
-    4, 11/*, 8*/};
-#endif
-
-
-static const twr_font_char_t twr_font_ubuntu_11_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &twr_font_ubuntu_11_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &twr_font_ubuntu_11_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &twr_font_ubuntu_11_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &twr_font_ubuntu_11_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &twr_font_ubuntu_11_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &twr_font_ubuntu_11_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &twr_font_ubuntu_11_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &twr_font_ubuntu_11_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &twr_font_ubuntu_11_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &twr_font_ubuntu_11_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &twr_font_ubuntu_11_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &twr_font_ubuntu_11_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &twr_font_ubuntu_11_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &twr_font_ubuntu_11_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &twr_font_ubuntu_11_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &twr_font_ubuntu_11_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &twr_font_ubuntu_11_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &twr_font_ubuntu_11_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &twr_font_ubuntu_11_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &twr_font_ubuntu_11_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &twr_font_ubuntu_11_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &twr_font_ubuntu_11_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &twr_font_ubuntu_11_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &twr_font_ubuntu_11_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &twr_font_ubuntu_11_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &twr_font_ubuntu_11_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &twr_font_ubuntu_11_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &twr_font_ubuntu_11_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &twr_font_ubuntu_11_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &twr_font_ubuntu_11_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &twr_font_ubuntu_11_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &twr_font_ubuntu_11_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &twr_font_ubuntu_11_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &twr_font_ubuntu_11_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &twr_font_ubuntu_11_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &twr_font_ubuntu_11_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &twr_font_ubuntu_11_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &twr_font_ubuntu_11_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &twr_font_ubuntu_11_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &twr_font_ubuntu_11_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &twr_font_ubuntu_11_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &twr_font_ubuntu_11_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &twr_font_ubuntu_11_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &twr_font_ubuntu_11_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &twr_font_ubuntu_11_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &twr_font_ubuntu_11_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &twr_font_ubuntu_11_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &twr_font_ubuntu_11_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &twr_font_ubuntu_11_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &twr_font_ubuntu_11_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &twr_font_ubuntu_11_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &twr_font_ubuntu_11_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &twr_font_ubuntu_11_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &twr_font_ubuntu_11_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &twr_font_ubuntu_11_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &twr_font_ubuntu_11_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &twr_font_ubuntu_11_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &twr_font_ubuntu_11_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &twr_font_ubuntu_11_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &twr_font_ubuntu_11_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &twr_font_ubuntu_11_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &twr_font_ubuntu_11_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &twr_font_ubuntu_11_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &twr_font_ubuntu_11_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &twr_font_ubuntu_11_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &twr_font_ubuntu_11_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &twr_font_ubuntu_11_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &twr_font_ubuntu_11_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &twr_font_ubuntu_11_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &twr_font_ubuntu_11_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &twr_font_ubuntu_11_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &twr_font_ubuntu_11_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &twr_font_ubuntu_11_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &twr_font_ubuntu_11_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &twr_font_ubuntu_11_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &twr_font_ubuntu_11_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &twr_font_ubuntu_11_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &twr_font_ubuntu_11_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &twr_font_ubuntu_11_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &twr_font_ubuntu_11_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &twr_font_ubuntu_11_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &twr_font_ubuntu_11_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &twr_font_ubuntu_11_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &twr_font_ubuntu_11_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &twr_font_ubuntu_11_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &twr_font_ubuntu_11_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &twr_font_ubuntu_11_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &twr_font_ubuntu_11_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &twr_font_ubuntu_11_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &twr_font_ubuntu_11_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &twr_font_ubuntu_11_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &twr_font_ubuntu_11_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &twr_font_ubuntu_11_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &twr_font_ubuntu_11_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &twr_font_ubuntu_11_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &twr_font_ubuntu_11_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &twr_font_ubuntu_11_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &twr_font_ubuntu_11_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &twr_font_ubuntu_11_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &twr_font_ubuntu_11_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &twr_font_ubuntu_11_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &twr_font_ubuntu_11_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &twr_font_ubuntu_11_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &twr_font_ubuntu_11_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &twr_font_ubuntu_11_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &twr_font_ubuntu_11_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &twr_font_ubuntu_11_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &twr_font_ubuntu_11_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &twr_font_ubuntu_11_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &twr_font_ubuntu_11_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &twr_font_ubuntu_11_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &twr_font_ubuntu_11_0x}
-#endif
-
-};
-
-
-const twr_font_t twr_font_ubuntu_11 = { 110, twr_font_ubuntu_11_array };
+static const uint8_t twr_font_ubuntu_11_bitmaps[661] = {
+    0x00, 0x00, 0x00, 0x15, 0x44, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xa6, 0x5f, 0x90, 0x00,
+    0x00, 0x00, 0x47, 0x41, 0x82, 0xe1, 0x00, 0x00, 0x00, 0x12, 0x58, 0x50, 0x50, 0xd2, 0x40, 0x00,
+    0x00, 0x00, 0x08, 0xa6, 0x35, 0x67, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x24, 0x91, 0x00, 0x08,
+    0x92, 0x4a, 0x00, 0x00, 0x4e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x90, 0x80, 0x00, 0x00,
+    0x00, 0x60, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x80, 0x01, 0x29, 0x29, 0x00, 0x00, 0x0c, 0x94,
+    0xa5, 0x26, 0x00, 0x00, 0x00, 0x08, 0xc2, 0x10, 0x84, 0x00, 0x00, 0x00, 0x32, 0x42, 0x22, 0x3c,
+    0x00, 0x00, 0x00, 0xe0, 0x98, 0x21, 0x70, 0x00, 0x00, 0x00, 0x46, 0x53, 0xc4, 0x20, 0x00, 0x00,
+    0x01, 0xc8, 0x60, 0x85, 0xc0, 0x00, 0x00, 0x01, 0x91, 0xc9, 0x49, 0x80, 0x00, 0x00, 0x0e, 0x10,
+    0x88, 0x42, 0x00, 0x00, 0x00, 0x0c, 0x93, 0x25, 0x26, 0x00, 0x00, 0x00, 0x19, 0x29, 0x38, 0x98,
+    0x00, 0x00, 0x01, 0x04, 0x00, 0x04, 0x18, 0x00, 0x00, 0x01, 0xd0, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x80, 0x00, 0x00, 0x03, 0x25, 0x04, 0x00,
+    0x00, 0x00, 0x1c, 0x22, 0x4d, 0x55, 0x55, 0x5a, 0x20, 0x1c, 0x00, 0x00, 0x01, 0x0a, 0x28, 0xa7,
+    0xd1, 0x00, 0x00, 0x00, 0x07, 0x25, 0xc9, 0x4b, 0x80, 0x00, 0x00, 0x07, 0x42, 0x10, 0x83, 0x80,
+    0x00, 0x00, 0x07, 0x91, 0x45, 0x14, 0x5e, 0x00, 0x00, 0x00, 0x07, 0xa1, 0xc8, 0x43, 0xc0, 0x00,
+    0x00, 0x3a, 0x32, 0x22, 0x00, 0x00, 0x00, 0x74, 0x21, 0x29, 0x38, 0x00, 0x00, 0x00, 0x45, 0x17,
+    0xd1, 0x45, 0x10, 0x00, 0x00, 0x04, 0x92, 0x48, 0x00, 0x00, 0x22, 0x22, 0x2c, 0x00, 0x00, 0x02,
+    0x54, 0xc6, 0x29, 0x20, 0x00, 0x00, 0x11, 0x11, 0x11, 0xc0, 0x00, 0x00, 0x11, 0x6d, 0xb5, 0x55,
+    0x44, 0x00, 0x00, 0x00, 0x1c, 0xe7, 0x39, 0xca, 0x00, 0x00, 0x00, 0x07, 0x22, 0x8a, 0x28, 0x9c,
+    0x00, 0x00, 0x00, 0x0e, 0x4a, 0x5c, 0x84, 0x00, 0x00, 0x00, 0x03, 0x91, 0x45, 0x14, 0x4e, 0x10,
+    0x20, 0x00, 0x07, 0x25, 0x2e, 0x52, 0x40, 0x00, 0x00, 0x1a, 0x21, 0x8b, 0x00, 0x00, 0x03, 0x91,
+    0x11, 0x10, 0x00, 0x00, 0x02, 0x28, 0xa2, 0x8a, 0x27, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x25, 0x14,
+    0x50, 0x80, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x4a, 0xaa, 0xaa, 0xa9, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x50, 0x82, 0x14, 0x88, 0x00, 0x00, 0x00, 0x08, 0x94, 0x50, 0x82, 0x08, 0x00, 0x00, 0x00,
+    0x0f, 0x08, 0x88, 0x87, 0x80, 0x00, 0x01, 0xa4, 0x92, 0x60, 0x01, 0x22, 0x48, 0x90, 0x00, 0xc9,
+    0x24, 0xb0, 0x00, 0x01, 0x14, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x6e, 0x00, 0x00, 0x02, 0x10, 0xe4, 0xa5, 0xc0, 0x00, 0x00,
+    0x00, 0x0d, 0x10, 0xc0, 0x00, 0x00, 0x08, 0x4e, 0x94, 0x9c, 0x00, 0x00, 0x00, 0x03, 0xba, 0x18,
+    0x00, 0x00, 0x53, 0x49, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x38, 0x5c, 0x00, 0x00, 0x08, 0x43, 0x92,
+    0x94, 0x80, 0x00, 0x04, 0x55, 0x00, 0x11, 0x56, 0x00, 0x04, 0x45, 0x66, 0x50, 0x00, 0x01, 0x24,
+    0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb1, 0x24, 0x92, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x72, 0x52, 0x90, 0x00, 0x00, 0x00, 0x00, 0x64, 0xa4, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xc9,
+    0x4b, 0x90, 0x00, 0x00, 0x00, 0x01, 0xd2, 0x93, 0x84, 0x00, 0x00, 0x06, 0x92, 0x00, 0x00, 0x00,
+    0x1a, 0x1b, 0x00, 0x00, 0x01, 0x34, 0x88, 0x00, 0x00, 0x00, 0x12, 0x94, 0x9c, 0x00, 0x00, 0x00,
+    0x02, 0xa9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xaa, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x44,
+    0xa0, 0x00, 0x00, 0x00, 0xaa, 0x44, 0x80, 0x00, 0x00, 0xca, 0x60, 0x00, 0x0a, 0x51, 0x22, 0x00,
+    0x2a, 0xaa, 0x00, 0x44, 0x8a, 0x50, 0x00, 0x00, 0x00, 0x02, 0xa8, 0x00, 0x00, 0x01, 0xb6, 0x00,
+    0x00, 0x00, 0x52, 0x03, 0x43, 0x60, 0x00, 0x01, 0x14, 0x64, 0x42, 0x00, 0x01, 0x50, 0x65, 0x30,
+    0x00, 0x09, 0x03, 0x09, 0xb8, 0x00, 0x02, 0x90, 0x1a, 0x21, 0x80, 0x00, 0x09, 0x03, 0xba, 0x18,
+    0x00, 0x29, 0x00, 0x3b, 0xa1, 0x80, 0x00, 0x28, 0x24, 0x90, 0x00, 0x00, 0x00, 0xa1, 0x4e, 0x24,
+    0x48, 0x70, 0x00, 0x00, 0x00, 0x28, 0x80, 0xe4, 0xa5, 0x20, 0x00, 0x01, 0x48, 0x19, 0x11, 0x00,
+    0x00, 0x45, 0x10, 0x12, 0x94, 0x9c, 0x00, 0x00, 0x04, 0x40, 0x25, 0x29, 0x38, 0x00, 0x00, 0x12,
+    0x05, 0x52, 0x24, 0x00, 0x00
+};
+
+static const twr_font_glyph_t twr_font_ubuntu_11_glyphs[110] = {
+    {0x20, 2, 11, 0},
+    {0x21, 2, 11, 22},
+    {0x22, 3, 11, 44},
+    {0x23, 5, 11, 77},
+    {0x24, 5, 11, 132},
+    {0x25, 7, 11, 187},
+    {0x26, 5, 11, 264},
+    {0x27, 2, 11, 319},
+    {0x28, 3, 11, 341},
+    {0x29, 3, 11, 374},
+    {0x2a, 4, 11, 407},
+    {0x2b, 5, 11, 451},
+    {0x2c, 2, 11, 506},
+    {0x2d, 3, 11, 528},
+    {0x2e, 2, 11, 561},
+    {0x2f, 3, 11, 583},
+    {0x30, 5, 11, 616},
+    {0x31, 5, 11, 671},
+    {0x32, 5, 11, 726},
+    {0x33, 5, 11, 781},
+    {0x34, 5, 11, 836},
+    {0x35, 5, 11, 891},
+    {0x36, 5, 11, 946},
+    {0x37, 5, 11, 1001},
+    {0x38, 5, 11, 1056},
+    {0x39, 5, 11, 1111},
+    {0x3a, 2, 11, 1166},
+    {0x3b, 2, 11, 1188},
+    {0x3c, 5, 11, 1210},
+    {0x3d, 5, 11, 1265},
+    {0x3e, 5, 11, 1320},
+    {0x3f, 3, 11, 1375},
+    {0x40, 8, 11, 1408},
+    {0x41, 6, 11, 1496},
+    {0x42, 5, 11, 1562},
+    {0x43, 5, 11, 1617},
+    {0x44, 6, 11, 1672},
+    {0x45, 5, 11, 1738},
+    {0x46, 4, 11, 1793},
+    {0x47, 5, 11, 1837},
+    {0x48, 6, 11, 1892},
+    {0x49, 3, 11, 1958},
+    {0x4a, 4, 11, 1991},
+    {0x4b, 5, 11, 2035},
+    {0x4c, 4, 11, 2090},
+    {0x4d, 6, 11, 2134},
+    {0x4e, 5, 11, 2200},
+    {0x4f, 6, 11, 2255},
+    {0x50, 5, 11, 2321},
+    {0x51, 6, 11, 2376},
+    {0x52, 5, 11, 2442},
+    {0x53, 4, 11, 2497},
+    {0x54, 4, 11, 2541},
+    {0x55, 6, 11, 2585},
+    {0x56, 6, 11, 2651},
+    {0x57, 8, 11, 2717},
+    {0x58, 6, 11, 2805},
+    {0x59, 6, 11, 2871},
+    {0x5a, 5, 11, 2937},
+    {0x5b, 3, 11, 2992},
+    {0x5c, 3, 11, 3025},
+    {0x5d, 3, 11, 3058},
+    {0x5e, 5, 11, 3091},
+    {0x5f, 4, 11, 3146},
+    {0x60, 3, 11, 3190},
+    {0x61, 4, 11, 3223},
+    {0x62, 5, 11, 3267},
+    {0x63, 4, 11, 3322},
+    {0x64, 5, 11, 3366},
+    {0x65, 4, 11, 3421},
+    {0x66, 3, 11, 3465},
+    {0x67, 5, 11, 3498},
+    {0x68, 5, 11, 3553},
+    {0x69, 2, 11, 3608},
+    {0x6a, 2, 11, 3630},
+    {0x6b, 4, 11, 3652},
+    {0x6c, 3, 11, 3696},
+    {0x6d, 9, 11, 3729},
+    {0x6e, 5, 11, 3828},
+    {0x6f, 5, 11, 3883},
+    {0x70, 5, 11, 3938},
+    {0x71, 5, 11, 3993},
+    {0x72, 3, 11, 4048},
+    {0x73, 4, 11, 4081},
+    {0x74, 3, 11, 4125},
+    {0x75, 5, 11, 4158},
+    {0x76, 4, 11, 4213},
+    {0x77, 6, 11, 4257},
+    {0x78, 4, 11, 4323},
+    {0x79, 4, 11, 4367},
+    {0x7a, 3, 11, 4411},
+    {0x7b, 3, 11, 4444},
+    {0x7c, 2, 11, 4477},
+    {0x7d, 3, 11, 4499},
+    {0x7e, 5, 11, 4532},
+    {0xb0, 3, 11, 4587},
+    {0xb9, 4, 11, 4620},
+    {0xbb, 4, 11, 4664},
+    {0xbe, 3, 11, 4708},
+    {0xe1, 4, 11, 4741},
+    {0xe8, 4, 11, 4785},
+    {0xe9, 4, 11, 4829},
+    {0xec, 4, 11, 4873},
+    {0xed, 3, 11, 4917},
+    {0xef, 7, 11, 4950},
+    {0xf2, 5, 11, 5027},
+    {0xf8, 4, 11, 5082},
+    {0xf9, 5, 11, 5126},
+    {0xfa, 5, 11, 5181},
+    {0xfd, 4, 11, 5236}
+};
+
+static const uint8_t twr_font_ubuntu_11_index[222] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d
+};
+
+const twr_font_t twr_font_ubuntu_11 = { 110, NULL, 0x20, 222, twr_font_ubuntu_11_index, twr_font_ubuntu_11_glyphs, twr_font_ubuntu_11_bitmaps };
@@ -1,3119 +1,209 @@
-
-/*******************************************************************************
-* font
-* filename: C:/Users/mhubacek/Documents/Dev/BigClown/github/bc-lcd-fonts/sdk/fonts/twr_font_ubuntu13.xml
-* name: twr_font_ubuntu_13
-* family: Ubuntu
-* size: 12
-* style: Normal
-* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~°ěščřžýáíéúůťďň
-* antialiasing: no
-* type: proportional
-* encoding: ISO-8859-2
-* unicode bom: no
-*
-* preset name: HARDWARIO $1 Module
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Diffuse Dither 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
+// Generated by twr_font_compile.py from bc_font_ubuntu13.xml, do not edit
 
 #include <twr_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x20[13] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x20 = { image_data_twr_font_ubuntu_13_0x20,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x21[13] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x21 = { image_data_twr_font_ubuntu_13_0x21,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x22[13] = {
-    0xf8,
-    0xa8,
-    0xa8,
-    0xa8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x22 = { image_data_twr_font_ubuntu_13_0x22,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x23[13] = {
-    0xff,
-    0xff,
-    0xeb,
-    0xeb,
-    0x81,
-    0xeb,
-    0xd7,
-    0x81,
-    0xd7,
-    0xd7,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x23 = { image_data_twr_font_ubuntu_13_0x23,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x24[13] = {
-    0xee,
-    0xee,
-    0xc2,
-    0xbe,
-    0xbe,
-    0xce,
-    0xf6,
-    0xfa,
-    0xfa,
-    0x86,
-    0xee,
-    0xee,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x24 = { image_data_twr_font_ubuntu_13_0x24,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x25[26] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xce, 0xc0,
-    0xb5, 0xc0,
-    0xb3, 0xc0,
-    0xcb, 0xc0,
-    0xf4, 0xc0,
-    0xf3, 0x40,
-    0xeb, 0x40,
-    0xdc, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x25 = { image_data_twr_font_ubuntu_13_0x25,
-    10, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x26[13] = {
-    0xff,
-    0xff,
-    0xe7,
-    0xdb,
-    0xdb,
-    0xe7,
-    0xd5,
-    0xb9,
-    0xb9,
-    0xc5,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x26 = { image_data_twr_font_ubuntu_13_0x26,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x27[13] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x27 = { image_data_twr_font_ubuntu_13_0x27,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x28[13] = {
-    0xf0,
-    0xe0,
-    0xd0,
-    0xd0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xd0,
-    0xd0,
-    0xe0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x28 = { image_data_twr_font_ubuntu_13_0x28,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x29[13] = {
-    0xf0,
-    0x70,
-    0xb0,
-    0xb0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xb0,
-    0xb0,
-    0x70,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x29 = { image_data_twr_font_ubuntu_13_0x29,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2a[13] = {
-    0xfc,
-    0xfc,
-    0xec,
-    0xa8,
-    0xc4,
-    0xd4,
-    0xd4,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x2a = { image_data_twr_font_ubuntu_13_0x2a,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2b[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xee,
-    0xee,
-    0x82,
-    0xee,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x2b = { image_data_twr_font_ubuntu_13_0x2b,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2c[13] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x2c = { image_data_twr_font_ubuntu_13_0x2c,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2d[13] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x2d = { image_data_twr_font_ubuntu_13_0x2d,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2e[13] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x2e = { image_data_twr_font_ubuntu_13_0x2e,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x2f[13] = {
-    0xf8,
-    0xf0,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0x78,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x2f = { image_data_twr_font_ubuntu_13_0x2f,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x30[13] = {
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x30 = { image_data_twr_font_ubuntu_13_0x30,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x31[13] = {
-    0xfe,
-    0xfe,
-    0xee,
-    0xce,
-    0xae,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x31 = { image_data_twr_font_ubuntu_13_0x31,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x32[13] = {
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0xfa,
-    0xf6,
-    0xee,
-    0xde,
-    0xbe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x32 = { image_data_twr_font_ubuntu_13_0x32,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x33[13] = {
-    0xfe,
-    0xfe,
-    0x86,
-    0xfa,
-    0xfa,
-    0xc6,
-    0xfa,
-    0xfa,
-    0xfa,
-    0x86,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x33 = { image_data_twr_font_ubuntu_13_0x33,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x34[13] = {
-    0xfe,
-    0xfe,
-    0xf6,
-    0xe6,
-    0xd6,
-    0xd6,
-    0xb6,
-    0x82,
-    0xf6,
-    0xf6,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x34 = { image_data_twr_font_ubuntu_13_0x34,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x35[13] = {
-    0xfe,
-    0xfe,
-    0xc2,
-    0xde,
-    0xde,
-    0xc6,
-    0xfa,
-    0xfa,
-    0xfa,
-    0x86,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x35 = { image_data_twr_font_ubuntu_13_0x35,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x36[13] = {
-    0xfe,
-    0xfe,
-    0xe6,
-    0xde,
-    0xbe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x36 = { image_data_twr_font_ubuntu_13_0x36,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x37[13] = {
-    0xfe,
-    0xfe,
-    0x82,
-    0xfa,
-    0xf6,
-    0xee,
-    0xee,
-    0xee,
-    0xde,
-    0xde,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x37 = { image_data_twr_font_ubuntu_13_0x37,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x38[13] = {
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0xba,
-    0xc6,
-    0xba,
-    0xba,
-    0xba,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x38 = { image_data_twr_font_ubuntu_13_0x38,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x39[13] = {
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfa,
-    0xf6,
-    0xce,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x39 = { image_data_twr_font_ubuntu_13_0x39,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3a[13] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x3a = { image_data_twr_font_ubuntu_13_0x3a,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3b[13] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x3b = { image_data_twr_font_ubuntu_13_0x3b,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3c[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfa,
-    0xc6,
-    0xbe,
-    0xc6,
-    0xfa,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x3c = { image_data_twr_font_ubuntu_13_0x3c,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3d[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x82,
-    0xfe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x3d = { image_data_twr_font_ubuntu_13_0x3d,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3e[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xbe,
-    0xc6,
-    0xfa,
-    0xc6,
-    0xbe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x3e = { image_data_twr_font_ubuntu_13_0x3e,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x3f[13] = {
-    0xf8,
-    0xf8,
-    0x88,
-    0xf0,
-    0xf0,
-    0xe8,
-    0xd8,
-    0xf8,
-    0xd8,
-    0xd8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x3f = { image_data_twr_font_ubuntu_13_0x3f,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x40[26] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0xe0,
-    0xdf, 0x60,
-    0xb1, 0xa0,
-    0xad, 0xa0,
-    0xad, 0xa0,
-    0xad, 0xa0,
-    0xb2, 0x60,
-    0xdf, 0xe0,
-    0xe1, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x40 = { image_data_twr_font_ubuntu_13_0x40,
-    11, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x41[13] = {
-    0xfe,
-    0xfe,
-    0xee,
-    0xd6,
-    0xd6,
-    0xd6,
-    0xba,
-    0x82,
-    0xba,
-    0x7c,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x41 = { image_data_twr_font_ubuntu_13_0x41,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x42[13] = {
-    0xff,
-    0xff,
-    0x83,
-    0xbd,
-    0xbd,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0x83,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x42 = { image_data_twr_font_ubuntu_13_0x42,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x43[13] = {
-    0xff,
-    0xff,
-    0xe1,
-    0xdf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xdf,
-    0xe1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x43 = { image_data_twr_font_ubuntu_13_0x43,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x44[26] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x83, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbd, 0x80,
-    0x83, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x44 = { image_data_twr_font_ubuntu_13_0x44,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x45[13] = {
-    0xfe,
-    0xfe,
-    0x82,
-    0xbe,
-    0xbe,
-    0x86,
-    0xbe,
-    0xbe,
-    0xbe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x45 = { image_data_twr_font_ubuntu_13_0x45,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x46[13] = {
-    0xfc,
-    0xfc,
-    0x80,
-    0xbc,
-    0xbc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x46 = { image_data_twr_font_ubuntu_13_0x46,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x47[13] = {
-    0xff,
-    0xff,
-    0xe1,
-    0xdf,
-    0xbf,
-    0xbf,
-    0xbd,
-    0xbd,
-    0xdd,
-    0xe1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x47 = { image_data_twr_font_ubuntu_13_0x47,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x48[13] = {
-    0xff,
-    0xff,
-    0xbd,
-    0xbd,
-    0xbd,
-    0x81,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x48 = { image_data_twr_font_ubuntu_13_0x48,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x49[13] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x49 = { image_data_twr_font_ubuntu_13_0x49,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x4a[13] = {
-    0xfc,
-    0xfc,
-    0xf4,
-    0xf4,
-    0xf4,
-    0xf4,
-    0xf4,
-    0xf4,
-    0x74,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x4a = { image_data_twr_font_ubuntu_13_0x4a,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x4b[13] = {
-    0xff,
-    0xff,
-    0xbd,
-    0xbb,
-    0xb7,
-    0xaf,
-    0x9f,
-    0xa7,
-    0xbb,
-    0xbd,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x4b = { image_data_twr_font_ubuntu_13_0x4b,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x4c[13] = {
-    0xfc,
-    0xfc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0x80,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x4c = { image_data_twr_font_ubuntu_13_0x4c,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x4d[26] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xbf, 0xa0,
-    0x9f, 0x20,
-    0xae, 0xa0,
-    0xae, 0xa0,
-    0xb5, 0xa0,
-    0xb5, 0xa0,
-    0xbb, 0xa0,
-    0xbf, 0xa0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x4d = { image_data_twr_font_ubuntu_13_0x4d,
-    11, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x4e[26] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xbe, 0x80,
-    0x9e, 0x80,
-    0xae, 0x80,
-    0xb6, 0x80,
-    0xba, 0x80,
-    0xba, 0x80,
-    0xbc, 0x80,
-    0xbe, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x4e = { image_data_twr_font_ubuntu_13_0x4e,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x4f[26] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xdd, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xdd, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x4f = { image_data_twr_font_ubuntu_13_0x4f,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x50[13] = {
-    0xfe,
-    0xfe,
-    0x82,
-    0xbc,
-    0xbc,
-    0xbc,
-    0x82,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x50 = { image_data_twr_font_ubuntu_13_0x50,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x51[26] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xdd, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xdd, 0x80,
-    0xe3, 0x80,
-    0xf7, 0x80,
-    0xf9, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x51 = { image_data_twr_font_ubuntu_13_0x51,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x52[13] = {
-    0xff,
-    0xff,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0x83,
-    0xbb,
-    0xbd,
-    0xbe,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x52 = { image_data_twr_font_ubuntu_13_0x52,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x53[13] = {
-    0xfc,
-    0xfc,
-    0xc4,
-    0xbc,
-    0xbc,
-    0xcc,
-    0xf4,
-    0xf4,
-    0xf4,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x53 = { image_data_twr_font_ubuntu_13_0x53,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x54[13] = {
-    0xfe,
-    0xfe,
-    0x00,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x54 = { image_data_twr_font_ubuntu_13_0x54,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x55[13] = {
-    0xff,
-    0xff,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x55 = { image_data_twr_font_ubuntu_13_0x55,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x56[13] = {
-    0xfe,
-    0xfe,
-    0x7c,
-    0x7c,
-    0xba,
-    0xba,
-    0xd6,
-    0xd6,
-    0xd6,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x56 = { image_data_twr_font_ubuntu_13_0x56,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x57[26] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0x7f, 0xc0,
-    0x7b, 0xc0,
-    0x7b, 0xc0,
-    0xb5, 0xa0,
-    0xb5, 0xa0,
-    0xae, 0xa0,
-    0xae, 0xa0,
-    0xdf, 0x60,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x57 = { image_data_twr_font_ubuntu_13_0x57,
-    11, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x58[13] = {
-    0xfe,
-    0xfe,
-    0x7c,
-    0xba,
-    0xd6,
-    0xee,
-    0xee,
-    0xd6,
-    0xba,
-    0x7c,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x58 = { image_data_twr_font_ubuntu_13_0x58,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x59[13] = {
-    0xfe,
-    0xfe,
-    0x7c,
-    0xba,
-    0xba,
-    0xd6,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x59 = { image_data_twr_font_ubuntu_13_0x59,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5a[13] = {
-    0xfe,
-    0xfe,
-    0x82,
-    0xfa,
-    0xf6,
-    0xee,
-    0xde,
-    0xde,
-    0xbe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x5a = { image_data_twr_font_ubuntu_13_0x5a,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5b[13] = {
-    0xf0,
-    0x80,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0x80,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x5b = { image_data_twr_font_ubuntu_13_0x5b,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5c[13] = {
-    0xf8,
-    0x78,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xf0,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x5c = { image_data_twr_font_ubuntu_13_0x5c,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5d[13] = {
-    0xf0,
-    0x10,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0x10,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x5d = { image_data_twr_font_ubuntu_13_0x5d,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5e[13] = {
-    0xfe,
-    0xfe,
-    0xee,
-    0xd6,
-    0xd6,
-    0xd6,
-    0xba,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x5e = { image_data_twr_font_ubuntu_13_0x5e,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x5f[13] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x00,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x5f = { image_data_twr_font_ubuntu_13_0x5f,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x60[13] = {
-    0xf8,
-    0xb8,
-    0xd8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x60 = { image_data_twr_font_ubuntu_13_0x60,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x61[13] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x8c,
-    0xf4,
-    0xc4,
-    0xb4,
-    0xb4,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x61 = { image_data_twr_font_ubuntu_13_0x61,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x62[13] = {
-    0xfe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0x86,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x62 = { image_data_twr_font_ubuntu_13_0x62,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x63[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc2,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x63 = { image_data_twr_font_ubuntu_13_0x63,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x64[13] = {
-    0xfe,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xc2,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x64 = { image_data_twr_font_ubuntu_13_0x64,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x65[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0x82,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x65 = { image_data_twr_font_ubuntu_13_0x65,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x66[13] = {
-    0xf8,
-    0xc0,
-    0xb8,
-    0xb8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x66 = { image_data_twr_font_ubuntu_13_0x66,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x67[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc2,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfa,
-    0x86,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x67 = { image_data_twr_font_ubuntu_13_0x67,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x68[13] = {
-    0xfe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x68 = { image_data_twr_font_ubuntu_13_0x68,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x69[13] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x69 = { image_data_twr_font_ubuntu_13_0x69,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x6a[13] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x6a = { image_data_twr_font_ubuntu_13_0x6a,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x6b[13] = {
-    0xfc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xb4,
-    0xac,
-    0x9c,
-    0xac,
-    0xb4,
-    0xb8,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x6b = { image_data_twr_font_ubuntu_13_0x6b,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x6c[13] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xc0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x6c = { image_data_twr_font_ubuntu_13_0x6c,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x6d[26] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0x84, 0x60,
-    0xbb, 0xa0,
-    0xbb, 0xa0,
-    0xbb, 0xa0,
-    0xbb, 0xa0,
-    0xbb, 0xa0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x6d = { image_data_twr_font_ubuntu_13_0x6d,
-    11, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x6e[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x6e = { image_data_twr_font_ubuntu_13_0x6e,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x6f[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x6f = { image_data_twr_font_ubuntu_13_0x6f,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x70[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0x86,
-    0xbe,
-    0xbe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x70 = { image_data_twr_font_ubuntu_13_0x70,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x71[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc2,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfa,
-    0xfa,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x71 = { image_data_twr_font_ubuntu_13_0x71,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x72[13] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x72 = { image_data_twr_font_ubuntu_13_0x72,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x73[13] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xc4,
-    0xbc,
-    0x9c,
-    0xe4,
-    0xf4,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x73 = { image_data_twr_font_ubuntu_13_0x73,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x74[13] = {
-    0xfc,
-    0xfc,
-    0xbc,
-    0xbc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x74 = { image_data_twr_font_ubuntu_13_0x74,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x75[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x75 = { image_data_twr_font_ubuntu_13_0x75,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x76[13] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x70,
-    0x70,
-    0xa8,
-    0xa8,
-    0xa8,
-    0xd8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x76 = { image_data_twr_font_ubuntu_13_0x76,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x77[26] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0x77, 0x00,
-    0x77, 0x00,
-    0xaa, 0x80,
-    0xaa, 0x80,
-    0xaa, 0x80,
-    0xdd, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x77 = { image_data_twr_font_ubuntu_13_0x77,
-    9, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x78[13] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x78,
-    0xb4,
-    0xcc,
-    0xcc,
-    0xb4,
-    0x78,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x78 = { image_data_twr_font_ubuntu_13_0x78,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x79[13] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x70,
-    0x70,
-    0xa8,
-    0xa8,
-    0xa8,
-    0xd8,
-    0xd8,
-    0x38,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x79 = { image_data_twr_font_ubuntu_13_0x79,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x7a[13] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x84,
-    0xf4,
-    0xec,
-    0xdc,
-    0xbc,
-    0x84,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x7a = { image_data_twr_font_ubuntu_13_0x7a,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x7b[13] = {
-    0xf0,
-    0xe0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xb0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xd0,
-    0xe0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x7b = { image_data_twr_font_ubuntu_13_0x7b,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x7c[13] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x7c = { image_data_twr_font_ubuntu_13_0x7c,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x7d[13] = {
-    0xf0,
-    0x70,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xd0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0x70,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x7d = { image_data_twr_font_ubuntu_13_0x7d,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0x7e[13] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xcc,
-    0xb2,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0x7e = { image_data_twr_font_ubuntu_13_0x7e,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xb0[13] = {
-    0xd0,
-    0xa0,
-    0xa0,
-    0xd0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xb0 = { image_data_twr_font_ubuntu_13_0xb0,
-    4, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xb9[13] = {
-    0xfc,
-    0xd4,
-    0xec,
-    0xfc,
-    0xc4,
-    0xbc,
-    0x9c,
-    0xe4,
-    0xf4,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xb9 = { image_data_twr_font_ubuntu_13_0xb9,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xbb[13] = {
-    0xfc,
-    0xec,
-    0xac,
-    0xbc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xbb = { image_data_twr_font_ubuntu_13_0xbb,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xbe[13] = {
-    0xfc,
-    0xac,
-    0xdc,
-    0xfc,
-    0x84,
-    0xf4,
-    0xec,
-    0xdc,
-    0xbc,
-    0x84,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xbe = { image_data_twr_font_ubuntu_13_0xbe,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xe1[13] = {
-    0xfc,
-    0xf4,
-    0xec,
-    0xfc,
-    0x8c,
-    0xf4,
-    0xc4,
-    0xb4,
-    0xb4,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xe1 = { image_data_twr_font_ubuntu_13_0xe1,
-    6, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xe8[13] = {
-    0xfe,
-    0xd6,
-    0xee,
-    0xfe,
-    0xc2,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xe8 = { image_data_twr_font_ubuntu_13_0xe8,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xe9[13] = {
-    0xfe,
-    0xf6,
-    0xee,
-    0xfe,
-    0xc6,
-    0xba,
-    0x82,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xe9 = { image_data_twr_font_ubuntu_13_0xe9,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xec[13] = {
-    0xd6,
-    0xee,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xba,
-    0x82,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xec = { image_data_twr_font_ubuntu_13_0xec,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xed[13] = {
-    0xe0,
-    0xc0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xed = { image_data_twr_font_ubuntu_13_0xed,
-    3, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xef[13] = {
-    0xff,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xc3,
-    0xbb,
-    0xbb,
-    0xbb,
-    0xbb,
-    0xc3,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xef = { image_data_twr_font_ubuntu_13_0xef,
-    8, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xf2[13] = {
-    0xfe,
-    0xd6,
-    0xee,
-    0xfe,
-    0x86,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xf2 = { image_data_twr_font_ubuntu_13_0xf2,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xf8[13] = {
-    0xf8,
-    0xd0,
-    0xe8,
-    0xf8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xf8 = { image_data_twr_font_ubuntu_13_0xf8,
-    5, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xf9[13] = {
-    0xee,
-    0xd6,
-    0xee,
-    0xfe,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xf9 = { image_data_twr_font_ubuntu_13_0xf9,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xfa[13] = {
-    0xfe,
-    0xf6,
-    0xee,
-    0xfe,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xfa = { image_data_twr_font_ubuntu_13_0xfa,
-    7, 13/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_13_0xfd[13] = {
-    0xf8,
-    0xe8,
-    0xd8,
-    0xf8,
-    0x70,
-    0x70,
-    0xa8,
-    0xa8,
-    0xa8,
-    0xd8,
-    0xd8,
-    0x38,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_13_0xfd = { image_data_twr_font_ubuntu_13_0xfd,
-    5, 13/*, 8*/};
-#endif
-
-
-static const twr_font_char_t twr_font_ubuntu_13_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &twr_font_ubuntu_13_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &twr_font_ubuntu_13_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &twr_font_ubuntu_13_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &twr_font_ubuntu_13_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &twr_font_ubuntu_13_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &twr_font_ubuntu_13_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &twr_font_ubuntu_13_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &twr_font_ubuntu_13_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &twr_font_ubuntu_13_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &twr_font_ubuntu_13_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &twr_font_ubuntu_13_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &twr_font_ubuntu_13_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &twr_font_ubuntu_13_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &twr_font_ubuntu_13_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &twr_font_ubuntu_13_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &twr_font_ubuntu_13_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &twr_font_ubuntu_13_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &twr_font_ubuntu_13_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &twr_font_ubuntu_13_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &twr_font_ubuntu_13_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &twr_font_ubuntu_13_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &twr_font_ubuntu_13_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &twr_font_ubuntu_13_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &twr_font_ubuntu_13_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &twr_font_ubuntu_13_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &twr_font_ubuntu_13_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &twr_font_ubuntu_13_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &twr_font_ubuntu_13_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &twr_font_ubuntu_13_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &twr_font_ubuntu_13_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &twr_font_ubuntu_13_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &twr_font_ubuntu_13_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &twr_font_ubuntu_13_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &twr_font_ubuntu_13_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &twr_font_ubuntu_13_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &twr_font_ubuntu_13_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &twr_font_ubuntu_13_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &twr_font_ubuntu_13_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &twr_font_ubuntu_13_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &twr_font_ubuntu_13_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &twr_font_ubuntu_13_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &twr_font_ubuntu_13_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &twr_font_ubuntu_13_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &twr_font_ubuntu_13_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &twr_font_ubuntu_13_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &twr_font_ubuntu_13_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &twr_font_ubuntu_13_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &twr_font_ubuntu_13_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &twr_font_ubuntu_13_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &twr_font_ubuntu_13_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &twr_font_ubuntu_13_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &twr_font_ubuntu_13_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &twr_font_ubuntu_13_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &twr_font_ubuntu_13_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &twr_font_ubuntu_13_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &twr_font_ubuntu_13_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &twr_font_ubuntu_13_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &twr_font_ubuntu_13_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &twr_font_ubuntu_13_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &twr_font_ubuntu_13_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &twr_font_ubuntu_13_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &twr_font_ubuntu_13_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &twr_font_ubuntu_13_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &twr_font_ubuntu_13_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &twr_font_ubuntu_13_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &twr_font_ubuntu_13_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &twr_font_ubuntu_13_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &twr_font_ubuntu_13_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &twr_font_ubuntu_13_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &twr_font_ubuntu_13_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &twr_font_ubuntu_13_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &twr_font_ubuntu_13_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &twr_font_ubuntu_13_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &twr_font_ubuntu_13_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &twr_font_ubuntu_13_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &twr_font_ubuntu_13_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &twr_font_ubuntu_13_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &twr_font_ubuntu_13_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &twr_font_ubuntu_13_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &twr_font_ubuntu_13_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &twr_font_ubuntu_13_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &twr_font_ubuntu_13_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &twr_font_ubuntu_13_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &twr_font_ubuntu_13_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &twr_font_ubuntu_13_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &twr_font_ubuntu_13_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &twr_font_ubuntu_13_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &twr_font_ubuntu_13_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &twr_font_ubuntu_13_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &twr_font_ubuntu_13_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &twr_font_ubuntu_13_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &twr_font_ubuntu_13_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &twr_font_ubuntu_13_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &twr_font_ubuntu_13_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &twr_font_ubuntu_13_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &twr_font_ubuntu_13_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &twr_font_ubuntu_13_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &twr_font_ubuntu_13_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &twr_font_ubuntu_13_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &twr_font_ubuntu_13_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &twr_font_ubuntu_13_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &twr_font_ubuntu_13_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &twr_font_ubuntu_13_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &twr_font_ubuntu_13_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &twr_font_ubuntu_13_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &twr_font_ubuntu_13_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &twr_font_ubuntu_13_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &twr_font_ubuntu_13_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &twr_font_ubuntu_13_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &twr_font_ubuntu_13_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &twr_font_ubuntu_13_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &twr_font_ubuntu_13_0x}
-#endif
-
-};
-
-
-const twr_font_t twr_font_ubuntu_13 = { 110, twr_font_ubuntu_13_array };
+static const uint8_t twr_font_ubuntu_13_bitmaps[1132] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x49, 0x20, 0x90, 0x00, 0x0a, 0x52, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0xfc, 0x28, 0x50, 0xfc, 0x50, 0x50, 0x00, 0x00, 0x00, 0x20,
+    0x41, 0xe4, 0x08, 0x0c, 0x04, 0x04, 0x09, 0xe0, 0x81, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x4a, 0x13,
+    0x03, 0x40, 0x2c, 0x0c, 0x85, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0x42, 0x41,
+    0x82, 0xa4, 0x64, 0x63, 0xa0, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48, 0x88,
+    0x88, 0x44, 0x20, 0x10, 0x88, 0x44, 0x44, 0x48, 0x90, 0x00, 0x00, 0x22, 0xa7, 0x14, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x0f, 0x84, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x94, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80,
+    0x00, 0x08, 0x84, 0x22, 0x10, 0x88, 0x42, 0x20, 0x00, 0x00, 0x0e, 0x22, 0x44, 0x89, 0x12, 0x24,
+    0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x0a, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x88, 0x10, 0x41, 0x04, 0x10, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x02, 0x38,
+    0x08, 0x10, 0x27, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0xc2, 0x85, 0x12, 0x3e, 0x08, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x1e, 0x20, 0x40, 0xe0, 0x20, 0x40, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x84,
+    0x10, 0x3c, 0x44, 0x89, 0x11, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x10, 0x41, 0x02, 0x04, 0x10,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x22, 0x44, 0x71, 0x12, 0x24, 0x47, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xc4, 0x48, 0x91, 0x1e, 0x04, 0x10, 0xc0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00,
+    0x12, 0x00, 0x24, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x47, 0x10, 0x1c, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1c,
+    0x04, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x08, 0x44, 0x40, 0x10, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x1f, 0x04, 0x11, 0x39, 0x29, 0x25, 0x24, 0xa4, 0x93, 0x61, 0x00, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xa1, 0x42, 0x88, 0x9f, 0x22, 0x82, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc4, 0x24,
+    0x27, 0xc4, 0x24, 0x24, 0x27, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe2, 0x04, 0x04, 0x04, 0x04,
+    0x02, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x84, 0x41, 0x20, 0x90, 0x48, 0x24, 0x23,
+    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x02, 0x07, 0x88, 0x10, 0x20, 0x7c, 0x00, 0x00, 0x00,
+    0x00, 0x7d, 0x04, 0x1e, 0x41, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0x88, 0x10, 0x10, 0x10,
+    0x90, 0x88, 0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x90, 0x9f, 0x90, 0x90, 0x90, 0x90,
+    0x80, 0x00, 0x00, 0x00, 0x49, 0x24, 0x92, 0x00, 0x00, 0x00, 0x41, 0x04, 0x10, 0x41, 0x44, 0xe0,
+    0x00, 0x00, 0x00, 0x00, 0x84, 0x88, 0x90, 0xa0, 0xc0, 0xb0, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x20, 0x82, 0x08, 0x20, 0x83, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09, 0x83, 0x28, 0xa5,
+    0x14, 0x94, 0x92, 0x92, 0x22, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0xc2, 0x51,
+    0x24, 0x91, 0x48, 0xa4, 0x32, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x22, 0x09, 0x04,
+    0x82, 0x41, 0x11, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc8, 0x50, 0xa1, 0x7c, 0x81, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x22, 0x09, 0x04, 0x82, 0x41, 0x11, 0x07, 0x01, 0x00,
+    0x60, 0x00, 0x00, 0x01, 0xf1, 0x09, 0x09, 0x09, 0xf1, 0x11, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x41, 0x03, 0x02, 0x08, 0x27, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x88, 0x10, 0x20, 0x40, 0x81,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x18, 0x28, 0x91, 0x14, 0x28, 0x50, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x30, 0x86, 0x10, 0xa5, 0x24, 0xa4, 0xa2, 0x94, 0x51, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x05, 0x11, 0x41, 0x02, 0x0a, 0x22, 0x82, 0x00, 0x00, 0x00, 0x00, 0x20, 0xa2, 0x44, 0x50, 0x40,
+    0x81, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x41, 0x04, 0x10, 0x20, 0x81, 0xf0, 0x00, 0x00,
+    0x01, 0xd1, 0x11, 0x11, 0x11, 0x11, 0xc0, 0x10, 0x42, 0x10, 0x42, 0x10, 0x42, 0x10, 0x40, 0x1c,
+    0x44, 0x44, 0x44, 0x44, 0x5c, 0x00, 0x00, 0x08, 0x28, 0x50, 0xa2, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x20, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0x1c, 0x92, 0x47, 0x00, 0x00, 0x00, 0x10, 0x20, 0x40,
+    0xf1, 0x12, 0x24, 0x48, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x20, 0x40, 0x81, 0x01,
+    0xe0, 0x00, 0x00, 0x00, 0x04, 0x08, 0x11, 0xe4, 0x48, 0x91, 0x22, 0x3c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x89, 0xf2, 0x04, 0x07, 0x80, 0x00, 0x00, 0x03, 0xa1, 0x0f, 0x42, 0x10, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc8, 0x91, 0x22, 0x44, 0x78, 0x13, 0xc0, 0x00, 0x10, 0x20,
+    0x40, 0xf1, 0x12, 0x24, 0x48, 0x91, 0x00, 0x00, 0x00, 0x24, 0x12, 0x49, 0x20, 0x00, 0x48, 0x24,
+    0x92, 0x4a, 0x00, 0x10, 0x41, 0x04, 0x94, 0x61, 0x44, 0x91, 0x00, 0x00, 0x02, 0x49, 0x24, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xdc, 0x44, 0x48, 0x89, 0x11, 0x22, 0x24, 0x44, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x88, 0x91, 0x22, 0x44, 0x88, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x71, 0x12, 0x24, 0x48, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x22, 0x44,
+    0x89, 0x13, 0xc4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe4, 0x48, 0x91, 0x22, 0x3c, 0x08, 0x10,
+    0x00, 0x00, 0x00, 0x7a, 0x10, 0x84, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc8, 0x30, 0x30, 0x4e,
+    0x00, 0x00, 0x00, 0x00, 0x82, 0x0f, 0x20, 0x82, 0x08, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x24, 0x48, 0x91, 0x22, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x54, 0xa5, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x62, 0x2a, 0xa5, 0x52, 0xa8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x48, 0xc3, 0x12, 0x84, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc5, 0x4a, 0x51, 0x09, 0x80,
+    0x00, 0x00, 0x00, 0x3c, 0x10, 0x84, 0x20, 0xf0, 0x00, 0x00, 0x02, 0x44, 0x44, 0x84, 0x44, 0x42,
+    0x01, 0x24, 0x92, 0x49, 0x24, 0x02, 0x11, 0x11, 0x09, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x08,
+    0x01, 0xc8, 0x30, 0x30, 0x4e, 0x00, 0x00, 0x00, 0x08, 0xa2, 0x0f, 0x20, 0x82, 0x08, 0x1c, 0x00,
+    0x00, 0x00, 0xa1, 0x00, 0x3c, 0x10, 0x84, 0x20, 0xf0, 0x00, 0x00, 0x00, 0x42, 0x00, 0xe0, 0x47,
+    0x24, 0x91, 0xc0, 0x00, 0x00, 0x02, 0x82, 0x00, 0x1e, 0x40, 0x81, 0x02, 0x03, 0xc0, 0x00, 0x00,
+    0x00, 0x10, 0x40, 0x03, 0x88, 0x9f, 0x20, 0x40, 0x78, 0x00, 0x00, 0x05, 0x04, 0x00, 0x00, 0x71,
+    0x13, 0xe4, 0x08, 0x0f, 0x00, 0x00, 0x00, 0x14, 0x12, 0x49, 0x20, 0x00, 0x00, 0x28, 0x28, 0x29,
+    0xe2, 0x22, 0x22, 0x22, 0x21, 0xe0, 0x00, 0x00, 0x00, 0x02, 0x82, 0x00, 0x3c, 0x44, 0x89, 0x12,
+    0x24, 0x40, 0x00, 0x00, 0x01, 0x44, 0x07, 0xa1, 0x08, 0x42, 0x00, 0x00, 0x08, 0x28, 0x20, 0x02,
+    0x24, 0x48, 0x91, 0x22, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x44, 0x89, 0x12, 0x24, 0x47,
+    0x80, 0x00, 0x00, 0x01, 0x10, 0x11, 0x8a, 0x94, 0xa2, 0x13, 0x00, 0x00
+};
+
+static const twr_font_glyph_t twr_font_ubuntu_13_glyphs[110] = {
+    {0x20, 3, 13, 0},
+    {0x21, 3, 13, 39},
+    {0x22, 5, 13, 78},
+    {0x23, 8, 13, 143},
+    {0x24, 7, 13, 247},
+    {0x25, 10, 13, 338},
+    {0x26, 8, 13, 468},
+    {0x27, 3, 13, 572},
+    {0x28, 4, 13, 611},
+    {0x29, 4, 13, 663},
+    {0x2a, 6, 13, 715},
+    {0x2b, 7, 13, 793},
+    {0x2c, 3, 13, 884},
+    {0x2d, 5, 13, 923},
+    {0x2e, 3, 13, 988},
+    {0x2f, 5, 13, 1027},
+    {0x30, 7, 13, 1092},
+    {0x31, 7, 13, 1183},
+    {0x32, 7, 13, 1274},
+    {0x33, 7, 13, 1365},
+    {0x34, 7, 13, 1456},
+    {0x35, 7, 13, 1547},
+    {0x36, 7, 13, 1638},
+    {0x37, 7, 13, 1729},
+    {0x38, 7, 13, 1820},
+    {0x39, 7, 13, 1911},
+    {0x3a, 3, 13, 2002},
+    {0x3b, 3, 13, 2041},
+    {0x3c, 7, 13, 2080},
+    {0x3d, 7, 13, 2171},
+    {0x3e, 7, 13, 2262},
+    {0x3f, 5, 13, 2353},
+    {0x40, 11, 13, 2418},
+    {0x41, 7, 13, 2561},
+    {0x42, 8, 13, 2652},
+    {0x43, 8, 13, 2756},
+    {0x44, 9, 13, 2860},
+    {0x45, 7, 13, 2977},
+    {0x46, 6, 13, 3068},
+    {0x47, 8, 13, 3146},
+    {0x48, 8, 13, 3250},
+    {0x49, 3, 13, 3354},
+    {0x4a, 6, 13, 3393},
+    {0x4b, 8, 13, 3471},
+    {0x4c, 6, 13, 3575},
+    {0x4d, 11, 13, 3653},
+    {0x4e, 9, 13, 3796},
+    {0x4f, 9, 13, 3913},
+    {0x50, 7, 13, 4030},
+    {0x51, 9, 13, 4121},
+    {0x52, 8, 13, 4238},
+    {0x53, 6, 13, 4342},
+    {0x54, 7, 13, 4420},
+    {0x55, 8, 13, 4511},
+    {0x56, 7, 13, 4615},
+    {0x57, 11, 13, 4706},
+    {0x58, 7, 13, 4849},
+    {0x59, 7, 13, 4940},
+    {0x5a, 7, 13, 5031},
+    {0x5b, 4, 13, 5122},
+    {0x5c, 5, 13, 5174},
+    {0x5d, 4, 13, 5239},
+    {0x5e, 7, 13, 5291},
+    {0x5f, 6, 13, 5382},
+    {0x60, 5, 13, 5460},
+    {0x61, 6, 13, 5525},
+    {0x62, 7, 13, 5603},
+    {0x63, 7, 13, 5694},
+    {0x64, 7, 13, 5785},
+    {0x65, 7, 13, 5876},
+    {0x66, 5, 13, 5967},
+    {0x67, 7, 13, 6032},
+    {0x68, 7, 13, 6123},
+    {0x69, 3, 13, 6214},
+    {0x6a, 3, 13, 6253},
+    {0x6b, 6, 13, 6292},
+    {0x6c, 3, 13, 6370},
+    {0x6d, 11, 13, 6409},
+    {0x6e, 7, 13, 6552},
+    {0x6f, 7, 13, 6643},
+    {0x70, 7, 13, 6734},
+    {0x71, 7, 13, 6825},
+    {0x72, 5, 13, 6916},
+    {0x73, 6, 13, 6981},
+    {0x74, 6, 13, 7059},
+    {0x75, 7, 13, 7137},
+    {0x76, 5, 13, 7228},
+    {0x77, 9, 13, 7293},
+    {0x78, 6, 13, 7410},
+    {0x79, 5, 13, 7488},
+    {0x7a, 6, 13, 7553},
+    {0x7b, 4, 13, 7631},
+    {0x7c, 3, 13, 7683},
+    {0x7d, 4, 13, 7722},
+    {0x7e, 7, 13, 7774},
+    {0xb0, 4, 13, 7865},
+    {0xb9, 6, 13, 7917},
+    {0xbb, 6, 13, 7995},
+    {0xbe, 6, 13, 8073},
+    {0xe1, 6, 13, 8151},
+    {0xe8, 7, 13, 8229},
+    {0xe9, 7, 13, 8320},
+    {0xec, 7, 13, 8411},
+    {0xed, 3, 13, 8502},
+    {0xef, 8, 13, 8541},
+    {0xf2, 7, 13, 8645},
+    {0xf8, 5, 13, 8736},
+    {0xf9, 7, 13, 8801},
+    {0xfa, 7, 13, 8892},
+    {0xfd, 5, 13, 8983}
+};
+
+static const uint8_t twr_font_ubuntu_13_index[222] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d
+};
+
+const twr_font_t twr_font_ubuntu_13 = { 110, NULL, 0x20, 222, twr_font_ubuntu_13_index, twr_font_ubuntu_13_glyphs, twr_font_ubuntu_13_bitmaps };
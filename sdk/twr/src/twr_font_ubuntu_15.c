@@ -1,3339 +1,233 @@
-
-/*******************************************************************************
-* font
-* filename: C:/Users/mhubacek/Documents/Dev/BigClown/github/bc-lcd-fonts/sdk/fonts/twr_font_ubuntu15.xml
-* name: twr_font_ubuntu_15
-* family: Ubuntu
-* size: 14
-* style: Normal
-* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~°ěščřžýáíéúůťďň
-* antialiasing: no
-* type: proportional
-* encoding: ISO-8859-2
-* unicode bom: no
-*
-* preset name: HARDWARIO LCD Module
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Diffuse Dither 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
+// Generated by twr_font_compile.py from bc_font_ubuntu15.xml, do not edit
 
 #include <twr_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x20[15] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x20 = { image_data_twr_font_ubuntu_15_0x20,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x21[15] = {
-    0xf0,
-    0xf0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xf0,
-    0xb0,
-    0xb0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x21 = { image_data_twr_font_ubuntu_15_0x21,
-    4, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x22[15] = {
-    0xfc,
-    0xac,
-    0xac,
-    0xac,
-    0xac,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x22 = { image_data_twr_font_ubuntu_15_0x22,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x23[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xf5, 0x80,
-    0xf5, 0x80,
-    0xed, 0x80,
-    0x80, 0x80,
-    0xeb, 0x80,
-    0xeb, 0x80,
-    0x80, 0x80,
-    0xdb, 0x80,
-    0xd7, 0x80,
-    0xd7, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x23 = { image_data_twr_font_ubuntu_15_0x23,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x24[15] = {
-    0xff,
-    0xef,
-    0xef,
-    0xc3,
-    0xbf,
-    0xbf,
-    0xdf,
-    0xe7,
-    0xfb,
-    0xfd,
-    0xfd,
-    0x83,
-    0xef,
-    0xef,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x24 = { image_data_twr_font_ubuntu_15_0x24,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x25[30] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xcf, 0x70,
-    0xb6, 0xf0,
-    0xb6, 0xf0,
-    0xb5, 0xf0,
-    0xcd, 0xf0,
-    0xfb, 0x30,
-    0xfa, 0xd0,
-    0xf6, 0xd0,
-    0xf6, 0xd0,
-    0xef, 0x30,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x25 = { image_data_twr_font_ubuntu_15_0x25,
-    12, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x26[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe7, 0x80,
-    0xdb, 0x80,
-    0xdb, 0x80,
-    0xd7, 0x80,
-    0xef, 0x80,
-    0xd6, 0x80,
-    0xba, 0x80,
-    0xbd, 0x80,
-    0xba, 0x80,
-    0xc7, 0x00,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x26 = { image_data_twr_font_ubuntu_15_0x26,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x27[15] = {
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x27 = { image_data_twr_font_ubuntu_15_0x27,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x28[15] = {
-    0xf8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xd8,
-    0xd8,
-    0xe8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x28 = { image_data_twr_font_ubuntu_15_0x28,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x29[15] = {
-    0xf8,
-    0xb8,
-    0xd8,
-    0xd8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xb8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x29 = { image_data_twr_font_ubuntu_15_0x29,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x2a[15] = {
-    0xfe,
-    0xfe,
-    0xee,
-    0xaa,
-    0xc6,
-    0xd6,
-    0xba,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2a = { image_data_twr_font_ubuntu_15_0x2a,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x2b[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xef,
-    0xef,
-    0xef,
-    0x01,
-    0xef,
-    0xef,
-    0xef,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2b = { image_data_twr_font_ubuntu_15_0x2b,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x2c[15] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2c = { image_data_twr_font_ubuntu_15_0x2c,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x2d[15] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x88,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2d = { image_data_twr_font_ubuntu_15_0x2d,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x2e[15] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2e = { image_data_twr_font_ubuntu_15_0x2e,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x2f[15] = {
-    0xfc,
-    0xf8,
-    0xf4,
-    0xf4,
-    0xf4,
-    0xec,
-    0xec,
-    0xec,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0x7c
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x2f = { image_data_twr_font_ubuntu_15_0x2f,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x30[15] = {
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x30 = { image_data_twr_font_ubuntu_15_0x30,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x31[15] = {
-    0xff,
-    0xff,
-    0xf7,
-    0xe7,
-    0xd7,
-    0xb7,
-    0xf7,
-    0xf7,
-    0xf7,
-    0xf7,
-    0xf7,
-    0xf7,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x31 = { image_data_twr_font_ubuntu_15_0x31,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x32[15] = {
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xfd,
-    0xfd,
-    0xfb,
-    0xf7,
-    0xef,
-    0xdf,
-    0xbf,
-    0x81,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x32 = { image_data_twr_font_ubuntu_15_0x32,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x33[15] = {
-    0xff,
-    0xff,
-    0x83,
-    0xfd,
-    0xfd,
-    0xfd,
-    0xe3,
-    0xfd,
-    0xfd,
-    0xfd,
-    0xfd,
-    0x83,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x33 = { image_data_twr_font_ubuntu_15_0x33,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x34[15] = {
-    0xff,
-    0xff,
-    0xfb,
-    0xf3,
-    0xeb,
-    0xdb,
-    0xdb,
-    0xbb,
-    0x81,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x34 = { image_data_twr_font_ubuntu_15_0x34,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x35[15] = {
-    0xff,
-    0xff,
-    0xc1,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xc3,
-    0xfd,
-    0xfd,
-    0xfd,
-    0xfd,
-    0x83,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x35 = { image_data_twr_font_ubuntu_15_0x35,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x36[15] = {
-    0xff,
-    0xff,
-    0xf3,
-    0xef,
-    0xdf,
-    0xbf,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x36 = { image_data_twr_font_ubuntu_15_0x36,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x37[15] = {
-    0xff,
-    0xff,
-    0x81,
-    0xfd,
-    0xfb,
-    0xf7,
-    0xf7,
-    0xef,
-    0xef,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x37 = { image_data_twr_font_ubuntu_15_0x37,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x38[15] = {
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x38 = { image_data_twr_font_ubuntu_15_0x38,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x39[15] = {
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xfd,
-    0xfb,
-    0xf7,
-    0xcf,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x39 = { image_data_twr_font_ubuntu_15_0x39,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3a[15] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3a = { image_data_twr_font_ubuntu_15_0x3a,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3b[15] = {
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3b = { image_data_twr_font_ubuntu_15_0x3b,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3c[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xfd,
-    0xf3,
-    0xcf,
-    0xbf,
-    0xcf,
-    0xf3,
-    0xfd,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3c = { image_data_twr_font_ubuntu_15_0x3c,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3d[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x81,
-    0xff,
-    0xff,
-    0x81,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3d = { image_data_twr_font_ubuntu_15_0x3d,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3e[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xbf,
-    0xcf,
-    0xf3,
-    0xfd,
-    0xf3,
-    0xcf,
-    0xbf,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3e = { image_data_twr_font_ubuntu_15_0x3e,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x3f[15] = {
-    0xfc,
-    0xfc,
-    0x84,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xe4,
-    0xdc,
-    0xdc,
-    0xfc,
-    0xdc,
-    0xdc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x3f = { image_data_twr_font_ubuntu_15_0x3f,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x40[30] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf0, 0x78,
-    0xef, 0xb8,
-    0xdf, 0xd8,
-    0xb8, 0x68,
-    0xb7, 0x68,
-    0xb7, 0x68,
-    0xb7, 0x68,
-    0xb7, 0x68,
-    0xb8, 0x98,
-    0xdf, 0xf8,
-    0xef, 0xf8,
-    0xf0, 0x78,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x40 = { image_data_twr_font_ubuntu_15_0x40,
-    13, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x41[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xf7, 0x80,
-    0xeb, 0x80,
-    0xeb, 0x80,
-    0xeb, 0x80,
-    0xdd, 0x80,
-    0xdd, 0x80,
-    0x80, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0x7f, 0x00,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x41 = { image_data_twr_font_ubuntu_15_0x41,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x42[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x83, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xbd, 0x80,
-    0x83, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbd, 0x80,
-    0x83, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x42 = { image_data_twr_font_ubuntu_15_0x42,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x43[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xe0, 0xc0,
-    0xdf, 0x40,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xdf, 0x40,
-    0xe0, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x43 = { image_data_twr_font_ubuntu_15_0x43,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x44[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0x83, 0xc0,
-    0xbd, 0xc0,
-    0xbe, 0xc0,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbe, 0xc0,
-    0xbd, 0xc0,
-    0x83, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x44 = { image_data_twr_font_ubuntu_15_0x44,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x45[15] = {
-    0xff,
-    0xff,
-    0x81,
-    0xbf,
-    0xbf,
-    0xbf,
-    0x83,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0x81,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x45 = { image_data_twr_font_ubuntu_15_0x45,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x46[15] = {
-    0xff,
-    0xff,
-    0x80,
-    0xbf,
-    0xbf,
-    0xbf,
-    0x81,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x46 = { image_data_twr_font_ubuntu_15_0x46,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x47[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xe0, 0xc0,
-    0xdf, 0x40,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0xc0,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xdf, 0x40,
-    0xe0, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x47 = { image_data_twr_font_ubuntu_15_0x47,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x48[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0x80, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x48 = { image_data_twr_font_ubuntu_15_0x48,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x49[15] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x49 = { image_data_twr_font_ubuntu_15_0x49,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x4a[15] = {
-    0xfe,
-    0xfe,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xfa,
-    0xfa,
-    0x7a,
-    0x86,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4a = { image_data_twr_font_ubuntu_15_0x4a,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x4b[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xbd, 0x80,
-    0xbb, 0x80,
-    0xb7, 0x80,
-    0xaf, 0x80,
-    0x9f, 0x80,
-    0xaf, 0x80,
-    0xb7, 0x80,
-    0xbb, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4b = { image_data_twr_font_ubuntu_15_0x4b,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x4c[15] = {
-    0xfe,
-    0xfe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0x80,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4c = { image_data_twr_font_ubuntu_15_0x4c,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x4d[30] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xdf, 0xd8,
-    0xcf, 0x98,
-    0xcf, 0x98,
-    0xd7, 0x58,
-    0xd7, 0x58,
-    0xba, 0xe8,
-    0xba, 0xe8,
-    0xba, 0xe8,
-    0xbd, 0xe8,
-    0xbf, 0xe8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4d = { image_data_twr_font_ubuntu_15_0x4d,
-    13, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x4e[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xbf, 0x40,
-    0x9f, 0x40,
-    0xaf, 0x40,
-    0xb7, 0x40,
-    0xb7, 0x40,
-    0xbb, 0x40,
-    0xbd, 0x40,
-    0xbd, 0x40,
-    0xbe, 0x40,
-    0xbf, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4e = { image_data_twr_font_ubuntu_15_0x4e,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x4f[30] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0xe0,
-    0xdf, 0x60,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xdf, 0x60,
-    0xe0, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x4f = { image_data_twr_font_ubuntu_15_0x4f,
-    11, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x50[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x81, 0x80,
-    0xbe, 0x80,
-    0xbf, 0x00,
-    0xbf, 0x00,
-    0xbe, 0x80,
-    0x81, 0x80,
-    0xbf, 0x80,
-    0xbf, 0x80,
-    0xbf, 0x80,
-    0xbf, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x50 = { image_data_twr_font_ubuntu_15_0x50,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x51[30] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0xe0,
-    0xdf, 0x60,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xbf, 0xa0,
-    0xdf, 0x60,
-    0xe0, 0xe0,
-    0xfb, 0xe0,
-    0xfd, 0xe0,
-    0xfe, 0x60
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x51 = { image_data_twr_font_ubuntu_15_0x51,
-    11, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x52[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x83, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbd, 0x80,
-    0x83, 0x80,
-    0xbb, 0x80,
-    0xbd, 0x80,
-    0xbe, 0x80,
-    0xbf, 0x00,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x52 = { image_data_twr_font_ubuntu_15_0x52,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x53[15] = {
-    0xfe,
-    0xfe,
-    0xc2,
-    0xba,
-    0xbe,
-    0xbe,
-    0xde,
-    0xe6,
-    0xfa,
-    0xfa,
-    0xba,
-    0x86,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x53 = { image_data_twr_font_ubuntu_15_0x53,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x54[15] = {
-    0xfe,
-    0xfe,
-    0x00,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x54 = { image_data_twr_font_ubuntu_15_0x54,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x55[30] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xbf, 0x40,
-    0xde, 0xc0,
-    0xe1, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x55 = { image_data_twr_font_ubuntu_15_0x55,
-    10, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x56[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x7f, 0x00,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xbe, 0x80,
-    0xdd, 0x80,
-    0xdd, 0x80,
-    0xdd, 0x80,
-    0xeb, 0x80,
-    0xeb, 0x80,
-    0xf7, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x56 = { image_data_twr_font_ubuntu_15_0x56,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x57[30] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0x7f, 0xf0,
-    0x7d, 0xf0,
-    0xbd, 0xe8,
-    0xba, 0xe8,
-    0xba, 0xe8,
-    0xba, 0xe8,
-    0xd7, 0x58,
-    0xd7, 0x58,
-    0xd7, 0x58,
-    0xef, 0xb8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x57 = { image_data_twr_font_ubuntu_15_0x57,
-    13, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x58[15] = {
-    0xff,
-    0xff,
-    0x7e,
-    0xbd,
-    0xdb,
-    0xdb,
-    0xe7,
-    0xe7,
-    0xdb,
-    0xdb,
-    0xbd,
-    0x7e,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x58 = { image_data_twr_font_ubuntu_15_0x58,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x59[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0x7f, 0x00,
-    0xbe, 0x80,
-    0xdd, 0x80,
-    0xdd, 0x80,
-    0xeb, 0x80,
-    0xf7, 0x80,
-    0xf7, 0x80,
-    0xf7, 0x80,
-    0xf7, 0x80,
-    0xf7, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x59 = { image_data_twr_font_ubuntu_15_0x59,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x5a[15] = {
-    0xff,
-    0xff,
-    0x81,
-    0xfd,
-    0xfb,
-    0xf7,
-    0xf7,
-    0xef,
-    0xdf,
-    0xdf,
-    0xbf,
-    0x81,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x5a = { image_data_twr_font_ubuntu_15_0x5a,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x5b[15] = {
-    0xf8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x5b = { image_data_twr_font_ubuntu_15_0x5b,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x5c[15] = {
-    0xfc,
-    0x7c,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xec,
-    0xec,
-    0xec,
-    0xf4,
-    0xf4,
-    0xf4,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x5c = { image_data_twr_font_ubuntu_15_0x5c,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x5d[15] = {
-    0xf8,
-    0x08,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0xe8,
-    0x08
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x5d = { image_data_twr_font_ubuntu_15_0x5d,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x5e[15] = {
-    0xff,
-    0xff,
-    0xef,
-    0xd7,
-    0xbb,
-    0xbb,
-    0x7d,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x5e = { image_data_twr_font_ubuntu_15_0x5e,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x5f[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x00
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x5f = { image_data_twr_font_ubuntu_15_0x5f,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x60[15] = {
-    0xf8,
-    0xb8,
-    0xd8,
-    0xe8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x60 = { image_data_twr_font_ubuntu_15_0x60,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x61[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xfa,
-    0xfa,
-    0xc2,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x61 = { image_data_twr_font_ubuntu_15_0x61,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x62[15] = {
-    0xff,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0x83,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x62 = { image_data_twr_font_ubuntu_15_0x62,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x63[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc2,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x63 = { image_data_twr_font_ubuntu_15_0x63,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x64[15] = {
-    0xff,
-    0xfd,
-    0xfd,
-    0xfd,
-    0xfd,
-    0xc1,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x64 = { image_data_twr_font_ubuntu_15_0x64,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x65[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0x81,
-    0xbf,
-    0xbf,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x65 = { image_data_twr_font_ubuntu_15_0x65,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x66[15] = {
-    0xf8,
-    0xc0,
-    0xb8,
-    0xb8,
-    0xb8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x66 = { image_data_twr_font_ubuntu_15_0x66,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x67[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc1,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xfd,
-    0xfd,
-    0x83
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x67 = { image_data_twr_font_ubuntu_15_0x67,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x68[15] = {
-    0xff,
-    0xbf,
-    0xbf,
-    0xbf,
-    0xbf,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x68 = { image_data_twr_font_ubuntu_15_0x68,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x69[15] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x69 = { image_data_twr_font_ubuntu_15_0x69,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x6a[15] = {
-    0xe0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0x60
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6a = { image_data_twr_font_ubuntu_15_0x6a,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x6b[15] = {
-    0xfe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xba,
-    0xb6,
-    0xae,
-    0x9e,
-    0xae,
-    0xb6,
-    0xba,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6b = { image_data_twr_font_ubuntu_15_0x6b,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x6c[15] = {
-    0xf0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xc0,
-    0xf0,
-    0xf0,
-    0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6c = { image_data_twr_font_ubuntu_15_0x6c,
-    4, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x6d[30] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0x82, 0x18,
-    0xbd, 0xe8,
-    0xbd, 0xe8,
-    0xbd, 0xe8,
-    0xbd, 0xe8,
-    0xbd, 0xe8,
-    0xbd, 0xe8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6d = { image_data_twr_font_ubuntu_15_0x6d,
-    13, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x6e[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6e = { image_data_twr_font_ubuntu_15_0x6e,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x6f[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc3,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x6f = { image_data_twr_font_ubuntu_15_0x6f,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x70[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0x83,
-    0xbf,
-    0xbf,
-    0xbf
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x70 = { image_data_twr_font_ubuntu_15_0x70,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x71[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc1,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xfd,
-    0xfd,
-    0xfd
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x71 = { image_data_twr_font_ubuntu_15_0x71,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x72[15] = {
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0x80,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xb8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x72 = { image_data_twr_font_ubuntu_15_0x72,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x73[15] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xc4,
-    0xbc,
-    0xbc,
-    0xcc,
-    0xf4,
-    0xf4,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x73 = { image_data_twr_font_ubuntu_15_0x73,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x74[15] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xbc,
-    0xbc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x74 = { image_data_twr_font_ubuntu_15_0x74,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x75[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x75 = { image_data_twr_font_ubuntu_15_0x75,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x76[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x7c,
-    0xba,
-    0xba,
-    0xba,
-    0xd6,
-    0xd6,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x76 = { image_data_twr_font_ubuntu_15_0x76,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x77[30] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0x77, 0x00,
-    0x77, 0x00,
-    0xaa, 0x80,
-    0xaa, 0x80,
-    0xaa, 0x80,
-    0xdd, 0x80,
-    0xdd, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x77 = { image_data_twr_font_ubuntu_15_0x77,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x78[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x7c,
-    0xba,
-    0xd6,
-    0xee,
-    0xd6,
-    0xba,
-    0x7c,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x78 = { image_data_twr_font_ubuntu_15_0x78,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x79[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x7c,
-    0xba,
-    0xba,
-    0xba,
-    0xd6,
-    0xd6,
-    0xee,
-    0xee,
-    0xde,
-    0x3e
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x79 = { image_data_twr_font_ubuntu_15_0x79,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x7a[15] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0x82,
-    0xfa,
-    0xf6,
-    0xee,
-    0xde,
-    0xbe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x7a = { image_data_twr_font_ubuntu_15_0x7a,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x7b[15] = {
-    0xf8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xb8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xe8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x7b = { image_data_twr_font_ubuntu_15_0x7b,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x7c[15] = {
-    0xf0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0,
-    0xb0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x7c = { image_data_twr_font_ubuntu_15_0x7c,
-    4, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x7d[15] = {
-    0xf8,
-    0xb8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xe8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xb8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x7d = { image_data_twr_font_ubuntu_15_0x7d,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0x7e[15] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xcd,
-    0xb3,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0x7e = { image_data_twr_font_ubuntu_15_0x7e,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xb0[15] = {
-    0xf8,
-    0xc8,
-    0xb0,
-    0xb0,
-    0xc8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8,
-    0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xb0 = { image_data_twr_font_ubuntu_15_0xb0,
-    5, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xb9[15] = {
-    0xfc,
-    0xb8,
-    0xd4,
-    0xec,
-    0xfc,
-    0xc4,
-    0xbc,
-    0xbc,
-    0xcc,
-    0xf4,
-    0xf4,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xb9 = { image_data_twr_font_ubuntu_15_0xb9,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xbb[15] = {
-    0xfc,
-    0xec,
-    0xec,
-    0xac,
-    0xbc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xc4,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xbb = { image_data_twr_font_ubuntu_15_0xbb,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xbe[15] = {
-    0xfe,
-    0xba,
-    0xd6,
-    0xee,
-    0xfe,
-    0x82,
-    0xfa,
-    0xf6,
-    0xee,
-    0xde,
-    0xbe,
-    0x82,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xbe = { image_data_twr_font_ubuntu_15_0xbe,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xe1[15] = {
-    0xfe,
-    0xfa,
-    0xf6,
-    0xee,
-    0xfe,
-    0xc6,
-    0xfa,
-    0xfa,
-    0xc2,
-    0xba,
-    0xba,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xe1 = { image_data_twr_font_ubuntu_15_0xe1,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xe8[15] = {
-    0xfe,
-    0xba,
-    0xd6,
-    0xee,
-    0xfe,
-    0xc2,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xbe,
-    0xc2,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xe8 = { image_data_twr_font_ubuntu_15_0xe8,
-    7, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xe9[15] = {
-    0xff,
-    0xfb,
-    0xf7,
-    0xef,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0x81,
-    0xbf,
-    0xbf,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xe9 = { image_data_twr_font_ubuntu_15_0xe9,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xec[15] = {
-    0xdd,
-    0xeb,
-    0xf7,
-    0xff,
-    0xff,
-    0xc3,
-    0xbd,
-    0xbd,
-    0x81,
-    0xbf,
-    0xbf,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xec = { image_data_twr_font_ubuntu_15_0xec,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xed[15] = {
-    0xe0,
-    0xc0,
-    0xa0,
-    0x60,
-    0xe0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xa0,
-    0xe0,
-    0xe0,
-    0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xed = { image_data_twr_font_ubuntu_15_0xed,
-    3, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xef[30] = {
-    0xff, 0x80,
-    0xfd, 0x00,
-    0xfd, 0x00,
-    0xfd, 0x00,
-    0xfd, 0x80,
-    0xc1, 0x80,
-    0xbd, 0x80,
-    0xbd, 0x80,
-    0xbd, 0x80,
-    0xbd, 0x80,
-    0xbd, 0x80,
-    0xc1, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xef = { image_data_twr_font_ubuntu_15_0xef,
-    9, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xf2[15] = {
-    0xff,
-    0xdd,
-    0xeb,
-    0xf7,
-    0xff,
-    0x83,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xf2 = { image_data_twr_font_ubuntu_15_0xf2,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xf8[15] = {
-    0xfc,
-    0xb8,
-    0xd4,
-    0xec,
-    0xfc,
-    0x84,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xbc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xf8 = { image_data_twr_font_ubuntu_15_0xf8,
-    6, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xf9[15] = {
-    0xff,
-    0xf7,
-    0xeb,
-    0xf7,
-    0xff,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xf9 = { image_data_twr_font_ubuntu_15_0xf9,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xfa[15] = {
-    0xff,
-    0xfb,
-    0xf7,
-    0xef,
-    0xff,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xbd,
-    0xc1,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xfa = { image_data_twr_font_ubuntu_15_0xfa,
-    8, 15/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_15_0xfd[15] = {
-    0xfe,
-    0xfa,
-    0xf6,
-    0xee,
-    0xfe,
-    0x7c,
-    0xba,
-    0xba,
-    0xba,
-    0xd6,
-    0xd6,
-    0xee,
-    0xee,
-    0xde,
-    0x3e
-};
-static const twr_font_image_t twr_font_ubuntu_15_0xfd = { image_data_twr_font_ubuntu_15_0xfd,
-    7, 15/*, 8*/};
-#endif
-
-
-static const twr_font_char_t twr_font_ubuntu_15_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &twr_font_ubuntu_15_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &twr_font_ubuntu_15_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &twr_font_ubuntu_15_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &twr_font_ubuntu_15_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &twr_font_ubuntu_15_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &twr_font_ubuntu_15_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &twr_font_ubuntu_15_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &twr_font_ubuntu_15_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &twr_font_ubuntu_15_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &twr_font_ubuntu_15_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &twr_font_ubuntu_15_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &twr_font_ubuntu_15_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &twr_font_ubuntu_15_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &twr_font_ubuntu_15_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &twr_font_ubuntu_15_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &twr_font_ubuntu_15_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &twr_font_ubuntu_15_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &twr_font_ubuntu_15_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &twr_font_ubuntu_15_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &twr_font_ubuntu_15_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &twr_font_ubuntu_15_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &twr_font_ubuntu_15_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &twr_font_ubuntu_15_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &twr_font_ubuntu_15_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &twr_font_ubuntu_15_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &twr_font_ubuntu_15_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &twr_font_ubuntu_15_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &twr_font_ubuntu_15_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &twr_font_ubuntu_15_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &twr_font_ubuntu_15_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &twr_font_ubuntu_15_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &twr_font_ubuntu_15_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &twr_font_ubuntu_15_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &twr_font_ubuntu_15_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &twr_font_ubuntu_15_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &twr_font_ubuntu_15_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &twr_font_ubuntu_15_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &twr_font_ubuntu_15_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &twr_font_ubuntu_15_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &twr_font_ubuntu_15_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &twr_font_ubuntu_15_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &twr_font_ubuntu_15_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &twr_font_ubuntu_15_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &twr_font_ubuntu_15_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &twr_font_ubuntu_15_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &twr_font_ubuntu_15_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &twr_font_ubuntu_15_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &twr_font_ubuntu_15_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &twr_font_ubuntu_15_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &twr_font_ubuntu_15_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &twr_font_ubuntu_15_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &twr_font_ubuntu_15_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &twr_font_ubuntu_15_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &twr_font_ubuntu_15_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &twr_font_ubuntu_15_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &twr_font_ubuntu_15_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &twr_font_ubuntu_15_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &twr_font_ubuntu_15_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &twr_font_ubuntu_15_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &twr_font_ubuntu_15_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &twr_font_ubuntu_15_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &twr_font_ubuntu_15_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &twr_font_ubuntu_15_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &twr_font_ubuntu_15_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &twr_font_ubuntu_15_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &twr_font_ubuntu_15_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &twr_font_ubuntu_15_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &twr_font_ubuntu_15_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &twr_font_ubuntu_15_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &twr_font_ubuntu_15_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &twr_font_ubuntu_15_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &twr_font_ubuntu_15_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &twr_font_ubuntu_15_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &twr_font_ubuntu_15_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &twr_font_ubuntu_15_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &twr_font_ubuntu_15_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &twr_font_ubuntu_15_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &twr_font_ubuntu_15_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &twr_font_ubuntu_15_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &twr_font_ubuntu_15_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &twr_font_ubuntu_15_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &twr_font_ubuntu_15_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &twr_font_ubuntu_15_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &twr_font_ubuntu_15_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &twr_font_ubuntu_15_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &twr_font_ubuntu_15_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &twr_font_ubuntu_15_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &twr_font_ubuntu_15_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &twr_font_ubuntu_15_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &twr_font_ubuntu_15_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &twr_font_ubuntu_15_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &twr_font_ubuntu_15_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &twr_font_ubuntu_15_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &twr_font_ubuntu_15_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &twr_font_ubuntu_15_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &twr_font_ubuntu_15_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &twr_font_ubuntu_15_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &twr_font_ubuntu_15_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &twr_font_ubuntu_15_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &twr_font_ubuntu_15_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &twr_font_ubuntu_15_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &twr_font_ubuntu_15_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &twr_font_ubuntu_15_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &twr_font_ubuntu_15_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &twr_font_ubuntu_15_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &twr_font_ubuntu_15_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &twr_font_ubuntu_15_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &twr_font_ubuntu_15_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &twr_font_ubuntu_15_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &twr_font_ubuntu_15_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &twr_font_ubuntu_15_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &twr_font_ubuntu_15_0x}
-#endif
-
-};
-
-
-const twr_font_t twr_font_ubuntu_15 = { 110, twr_font_ubuntu_15_array };
+static const uint8_t twr_font_ubuntu_15_bitmaps[1507] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x02, 0x20, 0x00, 0x00, 0xa2, 0x8a,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x28, 0x24, 0x7f, 0x0a,
+    0x05, 0x0f, 0xe2, 0x41, 0x40, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0f, 0x10, 0x10, 0x08,
+    0x06, 0x01, 0x00, 0x80, 0x9f, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x21, 0x24, 0x12, 0x41,
+    0x28, 0x0c, 0x80, 0x13, 0x01, 0x48, 0x24, 0x82, 0x48, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x12, 0x09, 0x05, 0x01, 0x01, 0x49, 0x14, 0x84, 0x45, 0x1c, 0x40, 0x00, 0x00, 0x00,
+    0x49, 0x20, 0x00, 0x00, 0x00, 0x00, 0x22, 0x11, 0x08, 0x42, 0x10, 0x84, 0x20, 0x84, 0x10, 0x10,
+    0x42, 0x08, 0x42, 0x10, 0x84, 0x21, 0x10, 0x88, 0x00, 0x00, 0x42, 0xa3, 0x85, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x7f, 0x08, 0x08,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x42, 0x08, 0x21, 0x04, 0x10, 0x82,
+    0x08, 0x41, 0x04, 0x20, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x48, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x7e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7c, 0x02, 0x02, 0x02, 0x1c, 0x02, 0x02, 0x02, 0x02, 0x7c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x0c, 0x14, 0x24, 0x24, 0x44, 0x7e, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3e, 0x20, 0x20, 0x20, 0x3c, 0x02, 0x02, 0x02, 0x02, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x10, 0x20, 0x40, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e,
+    0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42,
+    0x42, 0x42, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42,
+    0x42, 0x42, 0x3e, 0x02, 0x04, 0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x01, 0x20, 0x00,
+    0x00, 0x24, 0x00, 0x09, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x0c, 0x10, 0x0c, 0x03,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x1f, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0c, 0x03, 0x00, 0x83, 0x0c, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xe0, 0x41, 0x04, 0x62, 0x08, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3e, 0x02, 0x08, 0x20, 0x22, 0x3c, 0x92, 0x24, 0x91, 0x24, 0x89, 0x24, 0x49, 0x1d, 0x84,
+    0x00, 0x10, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x02, 0x81, 0x41, 0x10, 0x88, 0xfe,
+    0x41, 0x20, 0xa0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x21, 0x10, 0x48, 0x47, 0xc2, 0x11,
+    0x04, 0x82, 0x42, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x12, 0x00, 0x80, 0x20,
+    0x08, 0x02, 0x00, 0x80, 0x10, 0x43, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x21, 0x08,
+    0x22, 0x04, 0x81, 0x20, 0x48, 0x12, 0x08, 0x84, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+    0x20, 0x20, 0x20, 0x3e, 0x20, 0x20, 0x20, 0x20, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xa0,
+    0x20, 0x20, 0x3f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x41,
+    0x20, 0x08, 0x02, 0x00, 0x81, 0x20, 0x48, 0x11, 0x04, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x12, 0x04, 0x81, 0x20, 0x4f, 0xf2, 0x04, 0x81, 0x20, 0x48, 0x12, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x24, 0x92, 0x49, 0x00, 0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x84,
+    0xf0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x10, 0x90, 0x50, 0x30, 0x14, 0x09, 0x04, 0x42, 0x11,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0c, 0x18, 0x60, 0xc2, 0x8a, 0x14, 0x51, 0x14, 0x48, 0xa2,
+    0x45, 0x12, 0x10, 0x90, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x26, 0x09, 0x42,
+    0x48, 0x92, 0x24, 0x49, 0x0a, 0x42, 0x90, 0x64, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xc1, 0x04, 0x40, 0x48, 0x09, 0x01, 0x20, 0x24, 0x04, 0x80, 0x88, 0x20, 0xf8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0xc4, 0x12, 0x05, 0x02, 0x82, 0x7e, 0x20, 0x10, 0x08, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x10, 0x44, 0x04, 0x80, 0x90, 0x12, 0x02, 0x40, 0x48, 0x08,
+    0x82, 0x0f, 0x80, 0x40, 0x04, 0x00, 0x60, 0x00, 0x00, 0xf8, 0x42, 0x20, 0x90, 0x48, 0x47, 0xc2,
+    0x21, 0x08, 0x82, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x22, 0x40, 0x80, 0x80, 0xc0, 0x40,
+    0x91, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc4, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x24, 0x09, 0x02, 0x40, 0x90, 0x24, 0x09, 0x02, 0x40, 0x88, 0x41,
+    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x82, 0x41, 0x20, 0x88, 0x84, 0x42, 0x20, 0xa0,
+    0x50, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x60, 0x82, 0x84, 0x24, 0x51, 0x22,
+    0x89, 0x14, 0x45, 0x14, 0x28, 0xa1, 0x45, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x05, 0x08, 0x90, 0x90, 0x60, 0x60, 0x90, 0x91, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xa0, 0x88, 0x84, 0x41, 0x40, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xf0, 0x10, 0x20, 0x40, 0x40, 0x81, 0x01, 0x02, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x1e, 0x84, 0x21,
+    0x08, 0x42, 0x10, 0x84, 0x21, 0x0f, 0x02, 0x04, 0x10, 0x40, 0x82, 0x08, 0x10, 0x41, 0x02, 0x08,
+    0x20, 0x41, 0xe1, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0xf0, 0x00, 0x00, 0x81, 0x42, 0x22,
+    0x24, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x08, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x81, 0x1e, 0x44, 0x88, 0xf0, 0x00, 0x00, 0x00, 0x10, 0x10,
+    0x10, 0x10, 0x1f, 0x10, 0x90, 0x90, 0x90, 0x90, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xe4, 0x08, 0x10, 0x20, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x47, 0xc8,
+    0x48, 0x48, 0x48, 0x48, 0x47, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x88, 0x48,
+    0x4f, 0xc8, 0x08, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x3a, 0x10, 0x87, 0xa1, 0x08, 0x42, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x09, 0x09, 0x09, 0x09, 0x08, 0xf8, 0x08, 0x09, 0xf0,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0xf1, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x00, 0x00, 0x00, 0x04,
+    0x82, 0x49, 0x24, 0x80, 0x00, 0x24, 0x12, 0x49, 0x24, 0x94, 0x00, 0x81, 0x02, 0x04, 0x08, 0x92,
+    0x28, 0x60, 0xa1, 0x22, 0x20, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x21, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf7, 0x88, 0x42, 0x42, 0x12, 0x10, 0x90, 0x84, 0x84,
+    0x24, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x7c, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3e,
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x3d, 0x08, 0x42, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x82, 0x06, 0x04, 0x13, 0x80, 0x00, 0x00, 0x00, 0x00, 0x82, 0x0f, 0x20, 0x82, 0x08, 0x20,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x7c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xa2, 0x44, 0x88, 0xa1, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x46, 0x22, 0xaa, 0x55, 0x2a, 0x88, 0x84, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xa2, 0x28, 0x20, 0xa2, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x51, 0x22, 0x44, 0x50, 0xa0, 0x81, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
+    0x82, 0x08, 0x20, 0x81, 0xf0, 0x00, 0x00, 0x00, 0x22, 0x10, 0x84, 0x22, 0x08, 0x42, 0x10, 0x84,
+    0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0x04, 0x21, 0x08, 0x41, 0x10, 0x84, 0x21,
+    0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x24, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0x29, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x25, 0x08, 0x01, 0xc8, 0x20,
+    0x60, 0x41, 0x38, 0x00, 0x00, 0x00, 0x20, 0x8a, 0x20, 0xf2, 0x08, 0x20, 0x82, 0x07, 0x00, 0x00,
+    0x00, 0x11, 0x14, 0x10, 0x01, 0xf0, 0x20, 0x82, 0x08, 0x20, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x82,
+    0x08, 0x00, 0x70, 0x10, 0x23, 0xc8, 0x91, 0x1e, 0x00, 0x00, 0x00, 0x04, 0x45, 0x04, 0x00, 0x3c,
+    0x81, 0x02, 0x04, 0x08, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0x00, 0xf1, 0x09, 0x09,
+    0xf9, 0x01, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x88, 0x50, 0x20, 0x00, 0x00, 0xf1, 0x09, 0x09, 0xf9,
+    0x01, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x15, 0x02, 0x49, 0x24, 0x80, 0x00, 0x00, 0x28, 0x14, 0x0a,
+    0x04, 0x3e, 0x21, 0x10, 0x88, 0x44, 0x22, 0x10, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0x85, 0x02,
+    0x00, 0x1f, 0x10, 0x90, 0x90, 0x90, 0x90, 0x90, 0x80, 0x00, 0x00, 0x00, 0x44, 0xa1, 0x00, 0x79,
+    0x04, 0x10, 0x41, 0x04, 0x00, 0x00, 0x00, 0x00, 0x81, 0x40, 0x80, 0x04, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x23, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x81, 0x00, 0x04, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x23, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x82, 0x08, 0x01, 0x05, 0x12, 0x24, 0x45, 0x0a, 0x08, 0x10,
+    0x43, 0x00, 0x00
+};
+
+static const twr_font_glyph_t twr_font_ubuntu_15_glyphs[110] = {
+    {0x20, 3, 15, 0},
+    {0x21, 4, 15, 45},
+    {0x22, 6, 15, 105},
+    {0x23, 9, 15, 195},
+    {0x24, 8, 15, 330},
+    {0x25, 12, 15, 450},
+    {0x26, 9, 15, 630},
+    {0x27, 3, 15, 765},
+    {0x28, 5, 15, 810},
+    {0x29, 5, 15, 885},
+    {0x2a, 7, 15, 960},
+    {0x2b, 8, 15, 1065},
+    {0x2c, 3, 15, 1185},
+    {0x2d, 5, 15, 1230},
+    {0x2e, 3, 15, 1305},
+    {0x2f, 6, 15, 1350},
+    {0x30, 8, 15, 1440},
+    {0x31, 8, 15, 1560},
+    {0x32, 8, 15, 1680},
+    {0x33, 8, 15, 1800},
+    {0x34, 8, 15, 1920},
+    {0x35, 8, 15, 2040},
+    {0x36, 8, 15, 2160},
+    {0x37, 8, 15, 2280},
+    {0x38, 8, 15, 2400},
+    {0x39, 8, 15, 2520},
+    {0x3a, 3, 15, 2640},
+    {0x3b, 3, 15, 2685},
+    {0x3c, 8, 15, 2730},
+    {0x3d, 8, 15, 2850},
+    {0x3e, 8, 15, 2970},
+    {0x3f, 6, 15, 3090},
+    {0x40, 13, 15, 3180},
+    {0x41, 9, 15, 3375},
+    {0x42, 9, 15, 3510},
+    {0x43, 10, 15, 3645},
+    {0x44, 10, 15, 3795},
+    {0x45, 8, 15, 3945},
+    {0x46, 8, 15, 4065},
+    {0x47, 10, 15, 4185},
+    {0x48, 10, 15, 4335},
+    {0x49, 3, 15, 4485},
+    {0x4a, 7, 15, 4530},
+    {0x4b, 9, 15, 4635},
+    {0x4c, 7, 15, 4770},
+    {0x4d, 13, 15, 4875},
+    {0x4e, 10, 15, 5070},
+    {0x4f, 11, 15, 5220},
+    {0x50, 9, 15, 5385},
+    {0x51, 11, 15, 5520},
+    {0x52, 9, 15, 5685},
+    {0x53, 7, 15, 5820},
+    {0x54, 7, 15, 5925},
+    {0x55, 10, 15, 6030},
+    {0x56, 9, 15, 6180},
+    {0x57, 13, 15, 6315},
+    {0x58, 8, 15, 6510},
+    {0x59, 9, 15, 6630},
+    {0x5a, 8, 15, 6765},
+    {0x5b, 5, 15, 6885},
+    {0x5c, 6, 15, 6960},
+    {0x5d, 5, 15, 7050},
+    {0x5e, 8, 15, 7125},
+    {0x5f, 7, 15, 7245},
+    {0x60, 5, 15, 7350},
+    {0x61, 7, 15, 7425},
+    {0x62, 8, 15, 7530},
+    {0x63, 7, 15, 7650},
+    {0x64, 8, 15, 7755},
+    {0x65, 8, 15, 7875},
+    {0x66, 5, 15, 7995},
+    {0x67, 8, 15, 8070},
+    {0x68, 8, 15, 8190},
+    {0x69, 3, 15, 8310},
+    {0x6a, 3, 15, 8355},
+    {0x6b, 7, 15, 8400},
+    {0x6c, 4, 15, 8505},
+    {0x6d, 13, 15, 8565},
+    {0x6e, 8, 15, 8760},
+    {0x6f, 8, 15, 8880},
+    {0x70, 8, 15, 9000},
+    {0x71, 8, 15, 9120},
+    {0x72, 5, 15, 9240},
+    {0x73, 6, 15, 9315},
+    {0x74, 6, 15, 9405},
+    {0x75, 8, 15, 9495},
+    {0x76, 7, 15, 9615},
+    {0x77, 9, 15, 9720},
+    {0x78, 7, 15, 9855},
+    {0x79, 7, 15, 9960},
+    {0x7a, 7, 15, 10065},
+    {0x7b, 5, 15, 10170},
+    {0x7c, 4, 15, 10245},
+    {0x7d, 5, 15, 10305},
+    {0x7e, 8, 15, 10380},
+    {0xb0, 5, 15, 10500},
+    {0xb9, 6, 15, 10575},
+    {0xbb, 6, 15, 10665},
+    {0xbe, 7, 15, 10755},
+    {0xe1, 7, 15, 10860},
+    {0xe8, 7, 15, 10965},
+    {0xe9, 8, 15, 11070},
+    {0xec, 8, 15, 11190},
+    {0xed, 3, 15, 11310},
+    {0xef, 9, 15, 11355},
+    {0xf2, 8, 15, 11490},
+    {0xf8, 6, 15, 11610},
+    {0xf9, 8, 15, 11700},
+    {0xfa, 8, 15, 11820},
+    {0xfd, 7, 15, 11940}
+};
+
+static const uint8_t twr_font_ubuntu_15_index[222] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d
+};
+
+const twr_font_t twr_font_ubuntu_15 = { 110, NULL, 0x20, 222, twr_font_ubuntu_15_index, twr_font_ubuntu_15_glyphs, twr_font_ubuntu_15_bitmaps };
@@ -1,4329 +1,398 @@
-
-/*******************************************************************************
-* font
-* filename: C:/Users/mhubacek/Documents/Dev/BigClown/github/bc-lcd-fonts/sdk/fonts/twr_font_ubuntu24.xml
-* name: twr_font_ubuntu_24
-* family: Ubuntu
-* size: 24
-* style: Normal
-* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~°ěščřžýáíéúůťďň
-* antialiasing: no
-* type: proportional
-* encoding: ISO-8859-2
-* unicode bom: no
-*
-* preset name: HARDWARIO LCD Module
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Diffuse Dither 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
+// Generated by twr_font_compile.py from bc_font_ubuntu24.xml, do not edit
 
 #include <twr_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x20[24] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x20 = { image_data_twr_font_ubuntu_24_0x20,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x21[24] = {
-    0xfe,
-    0xfe,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xfe,
-    0xfe,
-    0xce,
-    0xce,
-    0xce,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x21 = { image_data_twr_font_ubuntu_24_0x21,
-    7, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x22[48] = {
-    0xcc, 0xc0,
-    0xcc, 0xc0,
-    0xcc, 0xc0,
-    0xcc, 0xc0,
-    0xcc, 0xc0,
-    0xcc, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x22 = { image_data_twr_font_ubuntu_24_0x22,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x23[48] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf9, 0xf3,
-    0xf9, 0xf3,
-    0xf9, 0xf3,
-    0xf3, 0xe7,
-    0x80, 0x01,
-    0x80, 0x01,
-    0xf3, 0xe7,
-    0xf3, 0xe7,
-    0xe3, 0xc7,
-    0xe7, 0xcf,
-    0xe7, 0xcf,
-    0x80, 0x01,
-    0x80, 0x01,
-    0xe7, 0xcf,
-    0xcf, 0x9f,
-    0xcf, 0x9f,
-    0xcf, 0x9f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x23 = { image_data_twr_font_ubuntu_24_0x23,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x24[48] = {
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xf0, 0x1c,
-    0xc0, 0x1c,
-    0x8f, 0xdc,
-    0x9f, 0xfc,
-    0x9f, 0xfc,
-    0x8f, 0xfc,
-    0xc3, 0xfc,
-    0xf0, 0xfc,
-    0xfc, 0x3c,
-    0xff, 0x1c,
-    0xff, 0x8c,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0x9f, 0x8c,
-    0x80, 0x1c,
-    0xc0, 0x3c,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x24 = { image_data_twr_font_ubuntu_24_0x24,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x25[72] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xe1, 0xfe, 0x78,
-    0xc0, 0xfc, 0xf8,
-    0x8c, 0x79, 0xf8,
-    0x9e, 0x79, 0xf8,
-    0x9e, 0x73, 0xf8,
-    0x9e, 0x67, 0xf8,
-    0x9e, 0x67, 0xf8,
-    0x8c, 0x4c, 0x38,
-    0xc0, 0x88, 0x18,
-    0xe1, 0x91, 0x88,
-    0xff, 0x33, 0xc8,
-    0xff, 0x33, 0xc8,
-    0xfe, 0x73, 0xc8,
-    0xfc, 0xf3, 0xc8,
-    0xfc, 0xf1, 0x88,
-    0xf9, 0xf8, 0x18,
-    0xf3, 0xfc, 0x38,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x25 = { image_data_twr_font_ubuntu_24_0x25,
-    21, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x26[48] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x7f,
-    0xf0, 0x3f,
-    0xe3, 0x1f,
-    0xe7, 0x9f,
-    0xe7, 0x9f,
-    0xe7, 0x9f,
-    0xf3, 0x3f,
-    0xf0, 0x7f,
-    0xf0, 0xff,
-    0xc0, 0x79,
-    0xce, 0x39,
-    0x9f, 0x33,
-    0x9f, 0x97,
-    0x9f, 0xc7,
-    0x8f, 0xc7,
-    0xc0, 0x13,
-    0xf0, 0x39,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x26 = { image_data_twr_font_ubuntu_24_0x26,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x27[24] = {
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x27 = { image_data_twr_font_ubuntu_24_0x27,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x28[24] = {
-    0xfd,
-    0xf9,
-    0xf3,
-    0xf3,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xf3,
-    0xf3,
-    0xf9,
-    0xfd,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x28 = { image_data_twr_font_ubuntu_24_0x28,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x29[24] = {
-    0xbf,
-    0x9f,
-    0xcf,
-    0xcf,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xcf,
-    0xcf,
-    0x9f,
-    0xbf,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x29 = { image_data_twr_font_ubuntu_24_0x29,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2a[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xf8, 0xf0,
-    0xf8, 0xf0,
-    0xc8, 0x90,
-    0xc4, 0x10,
-    0xf0, 0x70,
-    0xfa, 0xf0,
-    0xf2, 0x70,
-    0xe2, 0x30,
-    0xf7, 0x70,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x2a = { image_data_twr_font_ubuntu_24_0x2a,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2b[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0x80, 0x04,
-    0x80, 0x04,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x2b = { image_data_twr_font_ubuntu_24_0x2b,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2c[24] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xdc,
-    0x9c,
-    0x9c,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x2c = { image_data_twr_font_ubuntu_24_0x2c,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2d[24] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x81,
-    0x81,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x2d = { image_data_twr_font_ubuntu_24_0x2d,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2e[24] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x8c,
-    0x8c,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x2e = { image_data_twr_font_ubuntu_24_0x2e,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x2f[48] = {
-    0xff, 0x00,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xfc, 0xc0,
-    0xfc, 0xc0,
-    0xf9, 0xc0,
-    0xf9, 0xc0,
-    0xf9, 0xc0,
-    0xf3, 0xc0,
-    0xf3, 0xc0,
-    0xe3, 0xc0,
-    0xe7, 0xc0,
-    0xe7, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0x9f, 0xc0,
-    0x9f, 0xc0,
-    0x3f, 0xc0,
-    0x3f, 0xc0,
-    0x3f, 0xc0,
-    0x7f, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x2f = { image_data_twr_font_ubuntu_24_0x2f,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x30[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf8, 0x7c,
-    0xe0, 0x1c,
-    0xc7, 0x8c,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xc7, 0x8c,
-    0xe0, 0x1c,
-    0xf8, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x30 = { image_data_twr_font_ubuntu_24_0x30,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x31[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xfe, 0x7c,
-    0xfc, 0x7c,
-    0xf0, 0x7c,
-    0xe2, 0x7c,
-    0xe6, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x31 = { image_data_twr_font_ubuntu_24_0x31,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x32[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x3c,
-    0xe0, 0x1c,
-    0xc7, 0x8c,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0x9c,
-    0xff, 0x1c,
-    0xfe, 0x3c,
-    0xfc, 0x7c,
-    0xf8, 0xfc,
-    0xf1, 0xfc,
-    0xf3, 0xfc,
-    0xe7, 0xfc,
-    0xcf, 0xfc,
-    0xc0, 0x04,
-    0xc0, 0x04,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x32 = { image_data_twr_font_ubuntu_24_0x32,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x33[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xe0, 0xfc,
-    0x80, 0x3c,
-    0xdf, 0x1c,
-    0xff, 0x9c,
-    0xff, 0x9c,
-    0xff, 0x9c,
-    0xff, 0x3c,
-    0xf0, 0x3c,
-    0xf0, 0x3c,
-    0xff, 0x1c,
-    0xff, 0x8c,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xbf, 0x1c,
-    0x80, 0x1c,
-    0xc0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x33 = { image_data_twr_font_ubuntu_24_0x33,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x34[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0x1c,
-    0xff, 0x1c,
-    0xfe, 0x1c,
-    0xfc, 0x1c,
-    0xf8, 0x9c,
-    0xf1, 0x9c,
-    0xf3, 0x9c,
-    0xe7, 0x9c,
-    0xc7, 0x9c,
-    0xcf, 0x9c,
-    0x9f, 0x9c,
-    0x80, 0x04,
-    0x80, 0x04,
-    0xff, 0x9c,
-    0xff, 0x9c,
-    0xff, 0x9c,
-    0xff, 0x9c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x34 = { image_data_twr_font_ubuntu_24_0x34,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x35[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x1c,
-    0xf0, 0x1c,
-    0xf3, 0xfc,
-    0xf3, 0xfc,
-    0xf3, 0xfc,
-    0xf3, 0xfc,
-    0xe0, 0xfc,
-    0xe0, 0x3c,
-    0xfe, 0x1c,
-    0xff, 0x8c,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xdf, 0x9c,
-    0xc0, 0x1c,
-    0xe0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x35 = { image_data_twr_font_ubuntu_24_0x35,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x36[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0x0c,
-    0xfc, 0x0c,
-    0xf8, 0xfc,
-    0xf3, 0xfc,
-    0xe7, 0xfc,
-    0xe7, 0xfc,
-    0xc8, 0x3c,
-    0xc0, 0x0c,
-    0xcf, 0xcc,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xe7, 0xc4,
-    0xe3, 0x8c,
-    0xf0, 0x1c,
-    0xf8, 0x3c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x36 = { image_data_twr_font_ubuntu_24_0x36,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x37[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x80, 0x0c,
-    0x80, 0x0c,
-    0xff, 0xcc,
-    0xff, 0x9c,
-    0xff, 0x3c,
-    0xff, 0x3c,
-    0xfe, 0x7c,
-    0xfe, 0x7c,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xf9, 0xfc,
-    0xf9, 0xfc,
-    0xf9, 0xfc,
-    0xf9, 0xfc,
-    0xf3, 0xfc,
-    0xf3, 0xfc,
-    0xf3, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x37 = { image_data_twr_font_ubuntu_24_0x37,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x38[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x3c,
-    0xc0, 0x0c,
-    0xcf, 0xcc,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0xc7, 0xcc,
-    0xc1, 0x1c,
-    0xf0, 0x3c,
-    0xe6, 0x0c,
-    0xcf, 0x8c,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x8f, 0xc4,
-    0xc0, 0x0c,
-    0xf0, 0x3c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x38 = { image_data_twr_font_ubuntu_24_0x38,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x39[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x7c,
-    0xc0, 0x3c,
-    0xcf, 0x1c,
-    0x9f, 0x9c,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0xcf, 0xcc,
-    0xc0, 0x0c,
-    0xf0, 0x4c,
-    0xff, 0x8c,
-    0xff, 0x9c,
-    0xff, 0x1c,
-    0xfe, 0x3c,
-    0xfc, 0x7c,
-    0xc0, 0xfc,
-    0xc3, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x39 = { image_data_twr_font_ubuntu_24_0x39,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3a[24] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x8c,
-    0x8c,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x8c,
-    0x8c,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x3a = { image_data_twr_font_ubuntu_24_0x3a,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3b[24] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0x8c,
-    0x8c,
-    0x8c,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xdc,
-    0x9c,
-    0x9c,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x3b = { image_data_twr_font_ubuntu_24_0x3b,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3c[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xec,
-    0xff, 0x84,
-    0xfc, 0x1c,
-    0xf0, 0x7c,
-    0xc3, 0xfc,
-    0xcf, 0xfc,
-    0xc3, 0xfc,
-    0xf0, 0x7c,
-    0xfc, 0x1c,
-    0xff, 0x84,
-    0xff, 0xec,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x3c = { image_data_twr_font_ubuntu_24_0x3c,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3d[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xc0, 0x04,
-    0xc0, 0x04,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xc0, 0x04,
-    0xc0, 0x04,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x3d = { image_data_twr_font_ubuntu_24_0x3d,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3e[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xdf, 0xfc,
-    0x87, 0xfc,
-    0xe0, 0xfc,
-    0xf8, 0x3c,
-    0xff, 0x0c,
-    0xff, 0xcc,
-    0xff, 0x0c,
-    0xf8, 0x3c,
-    0xe0, 0xfc,
-    0x87, 0xfc,
-    0xdf, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x3e = { image_data_twr_font_ubuntu_24_0x3e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x3f[48] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xc1, 0xc0,
-    0x80, 0xc0,
-    0xfc, 0x40,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xfc, 0xc0,
-    0xf9, 0xc0,
-    0xf3, 0xc0,
-    0xe3, 0xc0,
-    0xe7, 0xc0,
-    0xe7, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xe7, 0xc0,
-    0xe7, 0xc0,
-    0xe7, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x3f = { image_data_twr_font_ubuntu_24_0x3f,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x40[72] = {
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0x01, 0xfe,
-    0xfc, 0x00, 0x7e,
-    0xf8, 0x7e, 0x3e,
-    0xf1, 0xff, 0x1e,
-    0xe3, 0xff, 0x8e,
-    0xe7, 0xc0, 0xce,
-    0xe7, 0x00, 0xe6,
-    0xcf, 0x3c, 0xe6,
-    0xce, 0x3c, 0xe6,
-    0xce, 0x7c, 0xe6,
-    0xce, 0x7c, 0xe6,
-    0xce, 0x7c, 0xe6,
-    0xce, 0x7c, 0xc6,
-    0xcf, 0x3c, 0xce,
-    0xe7, 0x00, 0x0e,
-    0xe7, 0xc2, 0x1e,
-    0xe3, 0xff, 0xfe,
-    0xf1, 0xff, 0xfe,
-    0xf8, 0x7f, 0xfe,
-    0xfc, 0x00, 0xfe,
-    0xff, 0x80, 0xfe,
-    0xff, 0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x40 = { image_data_twr_font_ubuntu_24_0x40,
-    23, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x41[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xf9, 0x3e,
-    0xf9, 0x3e,
-    0xf1, 0x1e,
-    0xf3, 0x9e,
-    0xf3, 0x9e,
-    0xe7, 0xce,
-    0xe7, 0xce,
-    0xc7, 0xce,
-    0xc0, 0x06,
-    0xc0, 0x06,
-    0x9f, 0xf2,
-    0x9f, 0xf2,
-    0x9f, 0xf2,
-    0x3f, 0xf8,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x41 = { image_data_twr_font_ubuntu_24_0x41,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x42[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xc0, 0x3e,
-    0xc0, 0x0e,
-    0xcf, 0xc6,
-    0xcf, 0xe6,
-    0xcf, 0xe6,
-    0xcf, 0xe6,
-    0xcf, 0xce,
-    0xc0, 0x1e,
-    0xc0, 0x0e,
-    0xcf, 0xc6,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xc6,
-    0xc0, 0x0e,
-    0xc0, 0x1e,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x42 = { image_data_twr_font_ubuntu_24_0x42,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x43[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xfc, 0x06,
-    0xf0, 0x02,
-    0xe3, 0xf2,
-    0xc7, 0xfe,
-    0xcf, 0xfe,
-    0x8f, 0xfe,
-    0x9f, 0xfe,
-    0x9f, 0xfe,
-    0x9f, 0xfe,
-    0x9f, 0xfe,
-    0x9f, 0xfe,
-    0x9f, 0xfe,
-    0xcf, 0xfe,
-    0xc7, 0xfe,
-    0xe3, 0xf2,
-    0xf0, 0x02,
-    0xfc, 0x06,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x43 = { image_data_twr_font_ubuntu_24_0x43,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x44[72] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xc0, 0x3f, 0x80,
-    0xc0, 0x07, 0x80,
-    0xcf, 0xc3, 0x80,
-    0xcf, 0xf1, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf8, 0x80,
-    0xcf, 0xfc, 0x80,
-    0xcf, 0xfc, 0x80,
-    0xcf, 0xfc, 0x80,
-    0xcf, 0xfc, 0x80,
-    0xcf, 0xfc, 0x80,
-    0xcf, 0xf8, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf1, 0x80,
-    0xcf, 0xc3, 0x80,
-    0xc0, 0x07, 0x80,
-    0xc0, 0x3f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x44 = { image_data_twr_font_ubuntu_24_0x44,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x45[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xc0, 0x0c,
-    0xc0, 0x0c,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xc0, 0x0c,
-    0xc0, 0x0c,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xc0, 0x04,
-    0xc0, 0x04,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x45 = { image_data_twr_font_ubuntu_24_0x45,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x46[48] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xc0, 0x08,
-    0xc0, 0x08,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xc0, 0x18,
-    0xc0, 0x18,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x46 = { image_data_twr_font_ubuntu_24_0x46,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x47[48] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xfc, 0x07,
-    0xf0, 0x03,
-    0xe3, 0xf7,
-    0xc7, 0xff,
-    0xcf, 0xff,
-    0x8f, 0xff,
-    0x9f, 0xff,
-    0x9f, 0xff,
-    0x9f, 0xff,
-    0x9f, 0xf3,
-    0x9f, 0xf3,
-    0x9f, 0xf3,
-    0xcf, 0xf3,
-    0xc7, 0xf3,
-    0xe3, 0xf3,
-    0xf0, 0x03,
-    0xfc, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x47 = { image_data_twr_font_ubuntu_24_0x47,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x48[72] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xc0, 0x01, 0x80,
-    0xc0, 0x01, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x48 = { image_data_twr_font_ubuntu_24_0x48,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x49[24] = {
-    0xfc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x49 = { image_data_twr_font_ubuntu_24_0x49,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4a[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xff, 0x30,
-    0xbe, 0x70,
-    0x00, 0x70,
-    0xc1, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x4a = { image_data_twr_font_ubuntu_24_0x4a,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4b[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xcf, 0xe6,
-    0xcf, 0xce,
-    0xcf, 0x9e,
-    0xcf, 0x3e,
-    0xce, 0x7e,
-    0xcc, 0xfe,
-    0xc9, 0xfe,
-    0xc3, 0xfe,
-    0xc1, 0xfe,
-    0xc8, 0x7e,
-    0xcc, 0x3e,
-    0xce, 0x1e,
-    0xcf, 0x0e,
-    0xcf, 0x86,
-    0xcf, 0xc6,
-    0xcf, 0xe2,
-    0xcf, 0xf0,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x4b = { image_data_twr_font_ubuntu_24_0x4b,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4c[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xcf, 0xf0,
-    0xc0, 0x00,
-    0xc0, 0x00,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x4c = { image_data_twr_font_ubuntu_24_0x4c,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4d[72] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc3, 0xfc, 0x30,
-    0xcb, 0xfd, 0x30,
-    0xc9, 0xf9, 0x30,
-    0xcd, 0xfb, 0x30,
-    0x9c, 0xf3, 0x90,
-    0x9e, 0xf7, 0x90,
-    0x9e, 0x67, 0x90,
-    0x9e, 0x67, 0x90,
-    0x9f, 0x6f, 0x90,
-    0x9f, 0x0f, 0x90,
-    0x9f, 0x0f, 0x90,
-    0x9f, 0x9f, 0x90,
-    0x9f, 0xff, 0x90,
-    0x9f, 0xff, 0x90,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x4d = { image_data_twr_font_ubuntu_24_0x4d,
-    20, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4e[72] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xc7, 0xf9, 0x80,
-    0xc3, 0xf9, 0x80,
-    0xc1, 0xf9, 0x80,
-    0xc9, 0xf9, 0x80,
-    0xcc, 0xf9, 0x80,
-    0xcc, 0x79, 0x80,
-    0xce, 0x39, 0x80,
-    0xcf, 0x39, 0x80,
-    0xcf, 0x99, 0x80,
-    0xcf, 0x89, 0x80,
-    0xcf, 0xc9, 0x80,
-    0xcf, 0xe1, 0x80,
-    0xcf, 0xf1, 0x80,
-    0xcf, 0xf1, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xfd, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x4e = { image_data_twr_font_ubuntu_24_0x4e,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x4f[72] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xcf, 0xfc, 0xc0,
-    0x8f, 0xfc, 0x40,
-    0x9f, 0xfe, 0x40,
-    0x9f, 0xfe, 0x40,
-    0x9f, 0xfe, 0x40,
-    0x9f, 0xfe, 0x40,
-    0x9f, 0xfe, 0x40,
-    0x8f, 0xfc, 0x40,
-    0xcf, 0xfc, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x4f = { image_data_twr_font_ubuntu_24_0x4f,
-    18, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x50[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xc0, 0x3e,
-    0xc0, 0x0e,
-    0xcf, 0xc6,
-    0xcf, 0xe2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xe2,
-    0xcf, 0xc6,
-    0xc0, 0x0e,
-    0xc0, 0x3e,
-    0xcf, 0xfe,
-    0xcf, 0xfe,
-    0xcf, 0xfe,
-    0xcf, 0xfe,
-    0xcf, 0xfe,
-    0xcf, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x50 = { image_data_twr_font_ubuntu_24_0x50,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x51[72] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfc, 0x07, 0xe0,
-    0xf0, 0x01, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xc7, 0xfc, 0x60,
-    0xcf, 0xfe, 0x60,
-    0x8f, 0xfe, 0x20,
-    0x9f, 0xff, 0x20,
-    0x9f, 0xff, 0x20,
-    0x9f, 0xff, 0x20,
-    0x9f, 0xff, 0x20,
-    0x9f, 0xff, 0x20,
-    0x8f, 0xfe, 0x20,
-    0xcf, 0xfe, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xe1, 0xf0, 0xe0,
-    0xf0, 0x03, 0xe0,
-    0xfc, 0x0f, 0xe0,
-    0xff, 0x9f, 0xe0,
-    0xff, 0xc7, 0xe0,
-    0xff, 0xe0, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x51 = { image_data_twr_font_ubuntu_24_0x51,
-    19, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x52[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xc0, 0x3e,
-    0xc0, 0x0e,
-    0xcf, 0xc6,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xf2,
-    0xcf, 0xc6,
-    0xc0, 0x0e,
-    0xc0, 0x1e,
-    0xcf, 0x9e,
-    0xcf, 0xce,
-    0xcf, 0xc6,
-    0xcf, 0xe6,
-    0xcf, 0xf2,
-    0xcf, 0xf0,
-    0xcf, 0xf8,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x52 = { image_data_twr_font_ubuntu_24_0x52,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x53[48] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf0, 0x38,
-    0xc0, 0x18,
-    0x8f, 0xb8,
-    0x9f, 0xf8,
-    0x9f, 0xf8,
-    0x8f, 0xf8,
-    0xc3, 0xf8,
-    0xe1, 0xf8,
-    0xf8, 0x78,
-    0xfe, 0x18,
-    0xff, 0x88,
-    0xff, 0xc8,
-    0xff, 0xc8,
-    0xff, 0xc8,
-    0x9f, 0x88,
-    0x80, 0x18,
-    0xe0, 0x78,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x53 = { image_data_twr_font_ubuntu_24_0x53,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x54[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0x00, 0x00,
-    0x00, 0x00,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xf9, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x54 = { image_data_twr_font_ubuntu_24_0x54,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x55[72] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xcf, 0xf9, 0x80,
-    0xe7, 0xf3, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xf0, 0x07, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x55 = { image_data_twr_font_ubuntu_24_0x55,
-    17, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x56[48] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0x3f, 0xfc,
-    0x9f, 0xf9,
-    0x9f, 0xf9,
-    0x9f, 0xf9,
-    0xcf, 0xf3,
-    0xcf, 0xf3,
-    0xc7, 0xe3,
-    0xe7, 0xe7,
-    0xe7, 0xe7,
-    0xf3, 0xcf,
-    0xf3, 0xcf,
-    0xf9, 0x9f,
-    0xf9, 0x9f,
-    0xf8, 0x1f,
-    0xfc, 0x3f,
-    0xfc, 0x3f,
-    0xfe, 0x7f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x56 = { image_data_twr_font_ubuntu_24_0x56,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x57[72] = {
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0x9f, 0xff, 0xf2,
-    0x9f, 0xff, 0xf2,
-    0x8f, 0xe7, 0xe2,
-    0xcf, 0xc7, 0xe6,
-    0xcf, 0xc7, 0xe6,
-    0xcf, 0xd7, 0xe6,
-    0xcf, 0x93, 0xe6,
-    0xe7, 0x93, 0xce,
-    0xe7, 0x91, 0xce,
-    0xe7, 0x39, 0xce,
-    0xe7, 0x39, 0xce,
-    0xe2, 0x38, 0x8e,
-    0xf2, 0x7c, 0x9e,
-    0xf2, 0x7c, 0x9e,
-    0xf0, 0xfc, 0x1e,
-    0xf8, 0xfe, 0x3e,
-    0xf8, 0xfe, 0x3e,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x57 = { image_data_twr_font_ubuntu_24_0x57,
-    23, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x58[48] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0x8f, 0xf0,
-    0xcf, 0xf2,
-    0xe7, 0xe6,
-    0xe3, 0xc6,
-    0xf3, 0xce,
-    0xf9, 0x9e,
-    0xfc, 0x1e,
-    0xfc, 0x3e,
-    0xfe, 0x7e,
-    0xfc, 0x3e,
-    0xf8, 0x1e,
-    0xf9, 0x9e,
-    0xf3, 0xce,
-    0xe3, 0xc6,
-    0xe7, 0xe6,
-    0xcf, 0xf2,
-    0x8f, 0xf0,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x58 = { image_data_twr_font_ubuntu_24_0x58,
-    15, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x59[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x3f, 0xf0,
-    0x9f, 0xe4,
-    0x8f, 0xc4,
-    0xcf, 0xcc,
-    0xe7, 0x9c,
-    0xe7, 0x9c,
-    0xf3, 0x3c,
-    0xf0, 0x3c,
-    0xf8, 0x7c,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x59 = { image_data_twr_font_ubuntu_24_0x59,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x5a[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x80, 0x04,
-    0x80, 0x04,
-    0xff, 0xc4,
-    0xff, 0xcc,
-    0xff, 0x9c,
-    0xff, 0x3c,
-    0xfe, 0x7c,
-    0xfc, 0xfc,
-    0xfc, 0xfc,
-    0xf9, 0xfc,
-    0xf3, 0xfc,
-    0xe3, 0xfc,
-    0xe7, 0xfc,
-    0xcf, 0xfc,
-    0x8f, 0xfc,
-    0x80, 0x04,
-    0x80, 0x04,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x5a = { image_data_twr_font_ubuntu_24_0x5a,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x5b[24] = {
-    0xc0,
-    0xc0,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xcf,
-    0xc0,
-    0xc0,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x5b = { image_data_twr_font_ubuntu_24_0x5b,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x5c[48] = {
-    0x7f, 0xc0,
-    0x3f, 0xc0,
-    0x3f, 0xc0,
-    0x3f, 0xc0,
-    0x9f, 0xc0,
-    0x9f, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xe7, 0xc0,
-    0xe7, 0xc0,
-    0xe3, 0xc0,
-    0xf3, 0xc0,
-    0xf3, 0xc0,
-    0xf9, 0xc0,
-    0xf9, 0xc0,
-    0xf9, 0xc0,
-    0xfc, 0xc0,
-    0xfc, 0xc0,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xfe, 0x40,
-    0xff, 0x00,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x5c = { image_data_twr_font_ubuntu_24_0x5c,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x5d[24] = {
-    0x03,
-    0x03,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0xf3,
-    0x03,
-    0x03,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x5d = { image_data_twr_font_ubuntu_24_0x5d,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x5e[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xfd, 0xfc,
-    0xf8, 0xfc,
-    0xf2, 0x7c,
-    0xf2, 0x7c,
-    0xe7, 0x3c,
-    0xe7, 0x3c,
-    0xcf, 0x9c,
-    0x8f, 0x8c,
-    0xdf, 0xdc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x5e = { image_data_twr_font_ubuntu_24_0x5e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x5f[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0x00, 0x00,
-    0x00, 0x00,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x5f = { image_data_twr_font_ubuntu_24_0x5f,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x60[48] = {
-    0xdf, 0x80,
-    0x8f, 0x80,
-    0xc7, 0x80,
-    0xe3, 0x80,
-    0xf7, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x60 = { image_data_twr_font_ubuntu_24_0x60,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x61[48] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xc0, 0x78,
-    0xc0, 0x38,
-    0xff, 0x18,
-    0xff, 0x98,
-    0xff, 0x98,
-    0xe0, 0x18,
-    0xc0, 0x18,
-    0x8f, 0x98,
-    0x9f, 0x98,
-    0x9f, 0x98,
-    0x8f, 0x98,
-    0xc0, 0x18,
-    0xe0, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x61 = { image_data_twr_font_ubuntu_24_0x61,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x62[48] = {
-    0xff, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xc8, 0x3c,
-    0xc0, 0x1c,
-    0xc7, 0x8c,
-    0xcf, 0xcc,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xcc,
-    0xcf, 0x8c,
-    0xc0, 0x1c,
-    0xe0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x62 = { image_data_twr_font_ubuntu_24_0x62,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x63[48] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xf8, 0x00,
-    0xe0, 0x00,
-    0xc7, 0xe0,
-    0xcf, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0xcf, 0xe0,
-    0xc7, 0xe0,
-    0xe0, 0x00,
-    0xf8, 0x00,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x63 = { image_data_twr_font_ubuntu_24_0x63,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x64[48] = {
-    0xff, 0xfc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xf0, 0x4c,
-    0xe0, 0x0c,
-    0xc7, 0x8c,
-    0xcf, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0xcf, 0xcc,
-    0xc7, 0xcc,
-    0xe0, 0x0c,
-    0xf8, 0x1c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x64 = { image_data_twr_font_ubuntu_24_0x64,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x65[48] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf0, 0x78,
-    0xe0, 0x18,
-    0xc7, 0x98,
-    0xcf, 0xc8,
-    0x9f, 0xc8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0x9f, 0xf8,
-    0x9f, 0xf8,
-    0xcf, 0xf8,
-    0xc7, 0xd8,
-    0xe0, 0x18,
-    0xf0, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x65 = { image_data_twr_font_ubuntu_24_0x65,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x66[48] = {
-    0xff, 0x80,
-    0xf0, 0x00,
-    0xe0, 0x00,
-    0xc7, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xc0, 0x80,
-    0xc0, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x66 = { image_data_twr_font_ubuntu_24_0x66,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x67[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf8, 0x1c,
-    0xe0, 0x0c,
-    0xc7, 0xcc,
-    0xcf, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x8f, 0xcc,
-    0xc7, 0x8c,
-    0xe0, 0x0c,
-    0xf0, 0x4c,
-    0xff, 0xcc,
-    0xdf, 0x9c,
-    0xc0, 0x1c,
-    0xc0, 0x7c,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x67 = { image_data_twr_font_ubuntu_24_0x67,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x68[48] = {
-    0xff, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xc0, 0x7c,
-    0xc0, 0x1c,
-    0xcf, 0x9c,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x68 = { image_data_twr_font_ubuntu_24_0x68,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x69[24] = {
-    0xfc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x69 = { image_data_twr_font_ubuntu_24_0x69,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6a[24] = {
-    0xfc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0x8c,
-    0x1c,
-    0x3c,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x6a = { image_data_twr_font_ubuntu_24_0x6a,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6b[48] = {
-    0xff, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xf8,
-    0xcf, 0xc8,
-    0xcf, 0x98,
-    0xce, 0x38,
-    0xcc, 0x78,
-    0xc9, 0xf8,
-    0xc3, 0xf8,
-    0xc1, 0xf8,
-    0xc8, 0x78,
-    0xce, 0x78,
-    0xcf, 0x38,
-    0xcf, 0x98,
-    0xcf, 0xc8,
-    0xcf, 0xe0,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x6b = { image_data_twr_font_ubuntu_24_0x6b,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6c[24] = {
-    0xfe,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xc2,
-    0xe2,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x6c = { image_data_twr_font_ubuntu_24_0x6c,
-    7, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6d[72] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xe0, 0x30, 0x3c,
-    0xc0, 0x00, 0x1c,
-    0xcf, 0x8f, 0x8c,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xcf, 0xcf, 0xcc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x6d = { image_data_twr_font_ubuntu_24_0x6d,
-    22, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6e[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xe0, 0x3c,
-    0xc0, 0x1c,
-    0xcf, 0x9c,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x6e = { image_data_twr_font_ubuntu_24_0x6e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x6f[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x3c,
-    0xe0, 0x1c,
-    0xc7, 0x8c,
-    0xcf, 0xcc,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0x9f, 0xe4,
-    0xcf, 0xcc,
-    0xc7, 0x8c,
-    0xe0, 0x1c,
-    0xf8, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x6f = { image_data_twr_font_ubuntu_24_0x6f,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x70[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xe0, 0x7c,
-    0xc0, 0x1c,
-    0xcf, 0x8c,
-    0xcf, 0xcc,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xe4,
-    0xcf, 0xcc,
-    0xc7, 0x8c,
-    0xc0, 0x1c,
-    0xc8, 0x3c,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xcf, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x70 = { image_data_twr_font_ubuntu_24_0x70,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x71[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf8, 0x1c,
-    0xe0, 0x0c,
-    0xc7, 0xcc,
-    0xcf, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0x9f, 0xcc,
-    0xcf, 0xcc,
-    0xc7, 0x8c,
-    0xe0, 0x0c,
-    0xf0, 0x4c,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x71 = { image_data_twr_font_ubuntu_24_0x71,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x72[48] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe0, 0x00,
-    0xc0, 0x00,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x72 = { image_data_twr_font_ubuntu_24_0x72,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x73[48] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0x60,
-    0xc0, 0x60,
-    0x9f, 0x60,
-    0x9f, 0xe0,
-    0x8f, 0xe0,
-    0xc3, 0xe0,
-    0xe0, 0xe0,
-    0xf8, 0x20,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xbf, 0x20,
-    0x80, 0x60,
-    0xc0, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x73 = { image_data_twr_font_ubuntu_24_0x73,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x74[48] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xc0, 0x40,
-    0xc0, 0x40,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xc7, 0x40,
-    0xe0, 0x40,
-    0xf0, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x74 = { image_data_twr_font_ubuntu_24_0x74,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x75[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xe7, 0xcc,
-    0xe0, 0x0c,
-    0xf8, 0x1c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x75 = { image_data_twr_font_ubuntu_24_0x75,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x76[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0x3f, 0xc0,
-    0x1f, 0x80,
-    0x9f, 0x90,
-    0x9f, 0x90,
-    0x8f, 0x10,
-    0xcf, 0x30,
-    0xcf, 0x30,
-    0xe6, 0x70,
-    0xe6, 0x70,
-    0xe0, 0x70,
-    0xf0, 0xf0,
-    0xf0, 0xf0,
-    0xf9, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x76 = { image_data_twr_font_ubuntu_24_0x76,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x77[72] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0x3f, 0xbf, 0x80,
-    0x3f, 0x1f, 0x80,
-    0x9f, 0x1f, 0x20,
-    0x9f, 0x1f, 0x20,
-    0x9e, 0x4f, 0x20,
-    0xce, 0x4e, 0x60,
-    0xce, 0x4e, 0x60,
-    0xce, 0x46, 0x60,
-    0xe4, 0xe4, 0xe0,
-    0xe4, 0xe4, 0xe0,
-    0xe0, 0xe0, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x77 = { image_data_twr_font_ubuntu_24_0x77,
-    19, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x78[48] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0x1f, 0x80,
-    0x9f, 0x90,
-    0xcf, 0x30,
-    0xe6, 0x70,
-    0xe0, 0x70,
-    0xf0, 0xf0,
-    0xf9, 0xf0,
-    0xf0, 0xf0,
-    0xe0, 0x70,
-    0xc6, 0x30,
-    0xcf, 0x30,
-    0x9f, 0x90,
-    0x1f, 0x80,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x78 = { image_data_twr_font_ubuntu_24_0x78,
-    12, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x79[48] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0x3f, 0x80,
-    0x1f, 0x20,
-    0x9f, 0x20,
-    0x9f, 0x20,
-    0xce, 0x60,
-    0xce, 0x60,
-    0xce, 0x60,
-    0xe4, 0xe0,
-    0xe4, 0xe0,
-    0xe4, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf3, 0xe0,
-    0xe3, 0xe0,
-    0x07, 0xe0,
-    0x0f, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x79 = { image_data_twr_font_ubuntu_24_0x79,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x7a[48] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0x80, 0x20,
-    0x80, 0x20,
-    0xfe, 0x20,
-    0xfc, 0x60,
-    0xfc, 0xe0,
-    0xf9, 0xe0,
-    0xf3, 0xe0,
-    0xe3, 0xe0,
-    0xe7, 0xe0,
-    0xcf, 0xe0,
-    0x8f, 0xe0,
-    0x80, 0x20,
-    0x80, 0x20,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x7a = { image_data_twr_font_ubuntu_24_0x7a,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x7b[24] = {
-    0xf8,
-    0xf0,
-    0xe3,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xcf,
-    0x9f,
-    0x8f,
-    0xc7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe3,
-    0xf0,
-    0xf8,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x7b = { image_data_twr_font_ubuntu_24_0x7b,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x7c[24] = {
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xce,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x7c = { image_data_twr_font_ubuntu_24_0x7c,
-    7, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x7d[24] = {
-    0x1f,
-    0x0f,
-    0xc7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xf3,
-    0xf9,
-    0xf1,
-    0xe3,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xc7,
-    0x0f,
-    0x1f,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x7d = { image_data_twr_font_ubuntu_24_0x7d,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0x7e[48] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xe3, 0xcc,
-    0xc1, 0x8c,
-    0x8c, 0x1c,
-    0x9e, 0x3c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0x7e = { image_data_twr_font_ubuntu_24_0x7e,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xb0[24] = {
-    0xe3,
-    0xc1,
-    0x9c,
-    0x9c,
-    0x9c,
-    0xc1,
-    0xe3,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xb0 = { image_data_twr_font_ubuntu_24_0xb0,
-    8, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xb9[48] = {
-    0xff, 0xe0,
-    0xce, 0x60,
-    0xe4, 0xe0,
-    0xf1, 0xe0,
-    0xfb, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0x60,
-    0xc0, 0x60,
-    0x9f, 0x60,
-    0x9f, 0xe0,
-    0x8f, 0xe0,
-    0xc3, 0xe0,
-    0xe0, 0xe0,
-    0xf8, 0x20,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xbf, 0x20,
-    0x80, 0x60,
-    0xc0, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xb9 = { image_data_twr_font_ubuntu_24_0xb9,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xbb[48] = {
-    0xf9, 0xc0,
-    0xf9, 0xc0,
-    0xc9, 0xc0,
-    0xc9, 0xc0,
-    0xcb, 0xc0,
-    0xcf, 0xc0,
-    0xc0, 0x40,
-    0xc0, 0x40,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xcf, 0xc0,
-    0xc7, 0x40,
-    0xe0, 0x40,
-    0xf0, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xbb = { image_data_twr_font_ubuntu_24_0xbb,
-    10, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xbe[48] = {
-    0xff, 0xe0,
-    0xce, 0x60,
-    0xe4, 0xe0,
-    0xf1, 0xe0,
-    0xfb, 0xe0,
-    0xff, 0xe0,
-    0x80, 0x20,
-    0x80, 0x20,
-    0xfe, 0x20,
-    0xfc, 0x60,
-    0xfc, 0xe0,
-    0xf9, 0xe0,
-    0xf3, 0xe0,
-    0xe3, 0xe0,
-    0xe7, 0xe0,
-    0xcf, 0xe0,
-    0x8f, 0xe0,
-    0x80, 0x20,
-    0x80, 0x20,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xbe = { image_data_twr_font_ubuntu_24_0xbe,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xe1[48] = {
-    0xff, 0x78,
-    0xfe, 0x38,
-    0xfc, 0x78,
-    0xf8, 0xf8,
-    0xfd, 0xf8,
-    0xff, 0xf8,
-    0xc0, 0x78,
-    0xc0, 0x38,
-    0xff, 0x18,
-    0xff, 0x98,
-    0xff, 0x98,
-    0xe0, 0x18,
-    0xc0, 0x18,
-    0x8f, 0x98,
-    0x9f, 0x98,
-    0x9f, 0x98,
-    0x8f, 0x98,
-    0xc0, 0x18,
-    0xe0, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xe1 = { image_data_twr_font_ubuntu_24_0xe1,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xe8[48] = {
-    0xff, 0xe0,
-    0xe7, 0x20,
-    0xf2, 0x60,
-    0xf8, 0xe0,
-    0xfd, 0xe0,
-    0xff, 0xe0,
-    0xf8, 0x00,
-    0xe0, 0x00,
-    0xc7, 0xe0,
-    0xcf, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0xcf, 0xe0,
-    0xc7, 0xe0,
-    0xe0, 0x00,
-    0xf8, 0x00,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xe8 = { image_data_twr_font_ubuntu_24_0xe8,
-    11, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xe9[48] = {
-    0xff, 0x78,
-    0xfe, 0x38,
-    0xfc, 0x78,
-    0xf8, 0xf8,
-    0xfd, 0xf8,
-    0xff, 0xf8,
-    0xf0, 0x78,
-    0xe0, 0x18,
-    0xc7, 0x98,
-    0xcf, 0xc8,
-    0x9f, 0xc8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0x9f, 0xf8,
-    0x9f, 0xf8,
-    0xcf, 0xf8,
-    0xc7, 0xd8,
-    0xe0, 0x18,
-    0xf0, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xe9 = { image_data_twr_font_ubuntu_24_0xe9,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xec[48] = {
-    0xe7, 0x38,
-    0xf2, 0x78,
-    0xf8, 0xf8,
-    0xfd, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf0, 0x78,
-    0xe0, 0x18,
-    0xc7, 0x98,
-    0xcf, 0xc8,
-    0x9f, 0xc8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0x9f, 0xf8,
-    0x9f, 0xf8,
-    0xcf, 0xf8,
-    0xc7, 0xd8,
-    0xe0, 0x18,
-    0xf0, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xec = { image_data_twr_font_ubuntu_24_0xec,
-    13, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xed[24] = {
-    0xf4,
-    0xe0,
-    0xc4,
-    0x8c,
-    0xdc,
-    0xfc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xed = { image_data_twr_font_ubuntu_24_0xed,
-    6, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xef[48] = {
-    0xff, 0xff,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcc,
-    0xff, 0xcd,
-    0xf0, 0x4f,
-    0xe0, 0x0f,
-    0xc7, 0x8f,
-    0xcf, 0xcf,
-    0x9f, 0xcf,
-    0x9f, 0xcf,
-    0x9f, 0xcf,
-    0x9f, 0xcf,
-    0x9f, 0xcf,
-    0xcf, 0xcf,
-    0xc7, 0xcf,
-    0xe0, 0x0f,
-    0xf8, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xef = { image_data_twr_font_ubuntu_24_0xef,
-    16, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xf2[48] = {
-    0xff, 0xfc,
-    0xf3, 0x9c,
-    0xf9, 0x3c,
-    0xfc, 0x7c,
-    0xfe, 0xfc,
-    0xff, 0xfc,
-    0xe0, 0x3c,
-    0xc0, 0x1c,
-    0xcf, 0x9c,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xf2 = { image_data_twr_font_ubuntu_24_0xf2,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xf8[48] = {
-    0xff, 0x80,
-    0xce, 0x00,
-    0xe4, 0x80,
-    0xf1, 0x80,
-    0xfb, 0x80,
-    0xff, 0x80,
-    0xe0, 0x00,
-    0xc0, 0x00,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xcf, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xf8 = { image_data_twr_font_ubuntu_24_0xf8,
-    9, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xf9[48] = {
-    0xf8, 0x7c,
-    0xf3, 0x3c,
-    0xf3, 0x3c,
-    0xf3, 0x3c,
-    0xf8, 0x7c,
-    0xff, 0xfc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xe7, 0xcc,
-    0xe0, 0x0c,
-    0xf8, 0x1c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xf9 = { image_data_twr_font_ubuntu_24_0xf9,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xfa[48] = {
-    0xff, 0x7c,
-    0xfe, 0x3c,
-    0xfc, 0x7c,
-    0xf8, 0xfc,
-    0xfd, 0xfc,
-    0xff, 0xfc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xcf, 0xcc,
-    0xe7, 0xcc,
-    0xe0, 0x0c,
-    0xf8, 0x1c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xfa = { image_data_twr_font_ubuntu_24_0xfa,
-    14, 24/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_24_0xfd[48] = {
-    0xfe, 0xe0,
-    0xfc, 0x60,
-    0xf8, 0xe0,
-    0xf1, 0xe0,
-    0xfb, 0xe0,
-    0xff, 0xe0,
-    0x3f, 0x80,
-    0x1f, 0x20,
-    0x9f, 0x20,
-    0x9f, 0x20,
-    0xce, 0x60,
-    0xce, 0x60,
-    0xce, 0x60,
-    0xe4, 0xe0,
-    0xe4, 0xe0,
-    0xe4, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf3, 0xe0,
-    0xe3, 0xe0,
-    0x07, 0xe0,
-    0x0f, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_24_0xfd = { image_data_twr_font_ubuntu_24_0xfd,
-    11, 24/*, 8*/};
-#endif
-
-
-static const twr_font_char_t twr_font_ubuntu_24_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &twr_font_ubuntu_24_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &twr_font_ubuntu_24_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &twr_font_ubuntu_24_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &twr_font_ubuntu_24_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &twr_font_ubuntu_24_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &twr_font_ubuntu_24_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &twr_font_ubuntu_24_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &twr_font_ubuntu_24_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &twr_font_ubuntu_24_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &twr_font_ubuntu_24_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &twr_font_ubuntu_24_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &twr_font_ubuntu_24_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &twr_font_ubuntu_24_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &twr_font_ubuntu_24_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &twr_font_ubuntu_24_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &twr_font_ubuntu_24_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &twr_font_ubuntu_24_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &twr_font_ubuntu_24_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &twr_font_ubuntu_24_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &twr_font_ubuntu_24_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &twr_font_ubuntu_24_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &twr_font_ubuntu_24_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &twr_font_ubuntu_24_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &twr_font_ubuntu_24_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &twr_font_ubuntu_24_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &twr_font_ubuntu_24_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &twr_font_ubuntu_24_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &twr_font_ubuntu_24_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &twr_font_ubuntu_24_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &twr_font_ubuntu_24_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &twr_font_ubuntu_24_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &twr_font_ubuntu_24_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &twr_font_ubuntu_24_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &twr_font_ubuntu_24_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &twr_font_ubuntu_24_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &twr_font_ubuntu_24_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &twr_font_ubuntu_24_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &twr_font_ubuntu_24_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &twr_font_ubuntu_24_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &twr_font_ubuntu_24_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &twr_font_ubuntu_24_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &twr_font_ubuntu_24_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &twr_font_ubuntu_24_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &twr_font_ubuntu_24_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &twr_font_ubuntu_24_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &twr_font_ubuntu_24_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &twr_font_ubuntu_24_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &twr_font_ubuntu_24_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &twr_font_ubuntu_24_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &twr_font_ubuntu_24_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &twr_font_ubuntu_24_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &twr_font_ubuntu_24_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &twr_font_ubuntu_24_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &twr_font_ubuntu_24_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &twr_font_ubuntu_24_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &twr_font_ubuntu_24_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &twr_font_ubuntu_24_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &twr_font_ubuntu_24_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &twr_font_ubuntu_24_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &twr_font_ubuntu_24_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &twr_font_ubuntu_24_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &twr_font_ubuntu_24_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &twr_font_ubuntu_24_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &twr_font_ubuntu_24_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &twr_font_ubuntu_24_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &twr_font_ubuntu_24_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &twr_font_ubuntu_24_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &twr_font_ubuntu_24_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &twr_font_ubuntu_24_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &twr_font_ubuntu_24_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &twr_font_ubuntu_24_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &twr_font_ubuntu_24_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &twr_font_ubuntu_24_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &twr_font_ubuntu_24_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &twr_font_ubuntu_24_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &twr_font_ubuntu_24_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &twr_font_ubuntu_24_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &twr_font_ubuntu_24_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &twr_font_ubuntu_24_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &twr_font_ubuntu_24_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &twr_font_ubuntu_24_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &twr_font_ubuntu_24_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &twr_font_ubuntu_24_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &twr_font_ubuntu_24_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &twr_font_ubuntu_24_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &twr_font_ubuntu_24_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &twr_font_ubuntu_24_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &twr_font_ubuntu_24_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &twr_font_ubuntu_24_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &twr_font_ubuntu_24_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &twr_font_ubuntu_24_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &twr_font_ubuntu_24_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &twr_font_ubuntu_24_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &twr_font_ubuntu_24_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &twr_font_ubuntu_24_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &twr_font_ubuntu_24_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &twr_font_ubuntu_24_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &twr_font_ubuntu_24_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &twr_font_ubuntu_24_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &twr_font_ubuntu_24_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &twr_font_ubuntu_24_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &twr_font_ubuntu_24_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &twr_font_ubuntu_24_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &twr_font_ubuntu_24_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &twr_font_ubuntu_24_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &twr_font_ubuntu_24_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &twr_font_ubuntu_24_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &twr_font_ubuntu_24_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &twr_font_ubuntu_24_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &twr_font_ubuntu_24_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &twr_font_ubuntu_24_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &twr_font_ubuntu_24_0x}
-#endif
-
-};
-
-
-const twr_font_t twr_font_ubuntu_24 = { 110, twr_font_ubuntu_24_array };
+static const uint8_t twr_font_ubuntu_24_bitmaps[4150] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc1, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x06, 0x00, 0x00,
+    0x30, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc3, 0x30, 0xcc, 0x33, 0x0c, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0c, 0x06, 0x0c, 0x06, 0x0c, 0x0c,
+    0x18, 0x7f, 0xfe, 0x7f, 0xfe, 0x0c, 0x18, 0x0c, 0x18, 0x1c, 0x38, 0x18, 0x30, 0x18, 0x30, 0x7f,
+    0xfe, 0x7f, 0xfe, 0x18, 0x30, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x03, 0xf8, 0x3f, 0xe1, 0xc0, 0x86,
+    0x00, 0x18, 0x00, 0x70, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x00,
+    0x0c, 0x60, 0x71, 0xff, 0x83, 0xfc, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x60, 0x7e, 0x06, 0x07, 0x38, 0x60, 0x30, 0xc3, 0x01, 0x86,
+    0x30, 0x0c, 0x33, 0x00, 0x61, 0x98, 0x03, 0x9d, 0x9e, 0x0f, 0xdd, 0xf8, 0x3c, 0xdc, 0xe0, 0x0c,
+    0xc3, 0x00, 0x66, 0x18, 0x06, 0x30, 0xc0, 0x61, 0x86, 0x03, 0x0e, 0x70, 0x30, 0x3f, 0x03, 0x00,
+    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x80, 0x0f, 0xc0, 0x1c, 0xe0, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x0c, 0xc0,
+    0x0f, 0x80, 0x0f, 0x00, 0x3f, 0x86, 0x31, 0xc6, 0x60, 0xcc, 0x60, 0x68, 0x60, 0x38, 0x70, 0x38,
+    0x3f, 0xec, 0x0f, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc3,
+    0x0c, 0x30, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x06, 0x0c, 0x0c, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x18, 0x18, 0x18, 0x0c, 0x0c, 0x06, 0x02, 0x00, 0x40, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x70, 0x37, 0x63, 0xbe, 0x0f, 0x80, 0x50, 0x0d, 0x81, 0xdc, 0x08,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x1f, 0xfe, 0x7f, 0xf8, 0x0c, 0x00, 0x30, 0x00, 0xc0,
+    0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc3, 0x0c, 0x21, 0x86, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x71, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x18, 0x06, 0x03,
+    0x00, 0xc0, 0x60, 0x18, 0x06, 0x03, 0x00, 0xc0, 0x70, 0x18, 0x06, 0x03, 0x00, 0xc0, 0x30, 0x18,
+    0x06, 0x03, 0x00, 0xc0, 0x30, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0xf8, 0x38,
+    0x70, 0xc0, 0xc3, 0x03, 0x18, 0x06, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80,
+    0x63, 0x03, 0x0c, 0x0c, 0x38, 0x70, 0x7f, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xe0, 0x0f, 0x80, 0x76, 0x01, 0x98, 0x00, 0x60,
+    0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
+    0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x07, 0xf8, 0x38, 0x70, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x60, 0x03, 0x80, 0x1c, 0x00,
+    0xe0, 0x07, 0x00, 0x38, 0x00, 0xc0, 0x06, 0x00, 0x30, 0x00, 0xff, 0xe3, 0xff, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0xf0, 0x20, 0xe0, 0x01,
+    0x80, 0x06, 0x00, 0x18, 0x00, 0xc0, 0x3f, 0x00, 0xfc, 0x00, 0x38, 0x00, 0x70, 0x00, 0xc0, 0x03,
+    0x00, 0x0c, 0x40, 0xe1, 0xff, 0x83, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x38, 0x01, 0xe0, 0x0f, 0x80, 0x76, 0x03, 0x98, 0x0c, 0x60,
+    0x61, 0x83, 0x86, 0x0c, 0x18, 0x60, 0x61, 0xff, 0xe7, 0xff, 0x80, 0x18, 0x00, 0x60, 0x01, 0x80,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x03,
+    0xf8, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x1f, 0x00, 0x7f, 0x00, 0x1e, 0x00, 0x1c, 0x00,
+    0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x20, 0x60, 0xff, 0x81, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xfc, 0x07, 0x00, 0x30, 0x01, 0x80,
+    0x06, 0x00, 0x37, 0xc0, 0xff, 0xc3, 0x03, 0x0c, 0x06, 0x30, 0x18, 0xc0, 0x63, 0x01, 0x86, 0x0e,
+    0x1c, 0x70, 0x3f, 0x80, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xff, 0x1f, 0xfc, 0x00, 0x30, 0x01, 0x80, 0x0c, 0x00, 0x30, 0x01, 0x80, 0x06, 0x00,
+    0x30, 0x00, 0xc0, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x0f, 0xfc, 0x30,
+    0x31, 0x80, 0x66, 0x01, 0x98, 0x06, 0x38, 0x30, 0xfb, 0x80, 0xfc, 0x06, 0x7c, 0x30, 0x71, 0x80,
+    0x66, 0x01, 0x98, 0x06, 0x70, 0x38, 0xff, 0xc0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0f, 0xf0, 0x30, 0xe1, 0x81, 0x86, 0x03, 0x18, 0x0c,
+    0x60, 0x30, 0xc0, 0xc3, 0xff, 0x03, 0xec, 0x00, 0x70, 0x01, 0x80, 0x0e, 0x00, 0x70, 0x03, 0x80,
+    0xfc, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xc3, 0x0c, 0x21, 0x86, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x03, 0xe0,
+    0x3e, 0x03, 0xc0, 0x0c, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x1e, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe3, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x1e, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0xf0, 0x1f, 0x01, 0xf0, 0x1e, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xe1, 0xfc, 0x03, 0x80, 0x60, 0x18, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x70, 0x18, 0x06, 0x00,
+    0x00, 0x00, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xf8, 0x00, 0x1f, 0xfc, 0x00, 0x78, 0x1c, 0x01, 0xc0, 0x1c, 0x07, 0x00, 0x1c,
+    0x0c, 0x1f, 0x98, 0x18, 0xff, 0x18, 0x61, 0x86, 0x30, 0xc7, 0x0c, 0x61, 0x8c, 0x18, 0xc3, 0x18,
+    0x31, 0x86, 0x30, 0x63, 0x0c, 0x60, 0xce, 0x18, 0x61, 0x98, 0x18, 0xff, 0xf0, 0x30, 0x7b, 0xc0,
+    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0xd8, 0x01, 0xb0, 0x07, 0x70,
+    0x0c, 0x60, 0x18, 0xc0, 0x60, 0xc0, 0xc1, 0x83, 0x83, 0x07, 0xff, 0x0f, 0xfe, 0x30, 0x06, 0x60,
+    0x0c, 0xc0, 0x1b, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0x01, 0xff, 0x83, 0x03, 0x86, 0x03, 0x0c, 0x06, 0x18, 0x0c, 0x30, 0x30, 0x7f,
+    0xc0, 0xff, 0xc1, 0x81, 0xc3, 0x00, 0xc6, 0x01, 0x8c, 0x03, 0x18, 0x06, 0x30, 0x38, 0x7f, 0xe0,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0xe0, 0x7f, 0xe1, 0xc0, 0xc7, 0x00, 0x0c, 0x00, 0x38, 0x00, 0x60, 0x00, 0xc0, 0x01, 0x80, 0x03,
+    0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x1c, 0x0c, 0x1f, 0xf8, 0x0f, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x07, 0xff,
+    0x03, 0x03, 0xc1, 0x80, 0x70, 0xc0, 0x18, 0x60, 0x0e, 0x30, 0x03, 0x18, 0x01, 0x8c, 0x00, 0xc6,
+    0x00, 0x63, 0x00, 0x31, 0x80, 0x38, 0xc0, 0x18, 0x60, 0x1c, 0x30, 0x3c, 0x1f, 0xfc, 0x0f, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
+    0x0f, 0xfc, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xff, 0xc3, 0xff, 0x0c, 0x00,
+    0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xff, 0xe3, 0xff, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfc, 0x7f, 0xe3, 0x00, 0x18, 0x00, 0xc0,
+    0x06, 0x00, 0x30, 0x01, 0xff, 0x0f, 0xf8, 0x60, 0x03, 0x00, 0x18, 0x00, 0xc0, 0x06, 0x00, 0x30,
+    0x01, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xf8, 0x0f, 0xfc, 0x1c, 0x08, 0x38, 0x00, 0x30, 0x00, 0x70, 0x00, 0x60, 0x00, 0x60, 0x00,
+    0x60, 0x00, 0x60, 0x0c, 0x60, 0x0c, 0x60, 0x0c, 0x30, 0x0c, 0x38, 0x0c, 0x1c, 0x0c, 0x0f, 0xfc,
+    0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x01, 0x86, 0x00, 0xc3, 0x00, 0x61, 0x80, 0x30, 0xc0, 0x18, 0x60, 0x0c, 0x30, 0x06, 0x1f,
+    0xff, 0x0f, 0xff, 0x86, 0x00, 0xc3, 0x00, 0x61, 0x80, 0x30, 0xc0, 0x18, 0x60, 0x0c, 0x30, 0x06,
+    0x18, 0x03, 0x0c, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c,
+    0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x41, 0x8f, 0xf8, 0x3e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x61, 0x81, 0x83, 0x06, 0x06, 0x18,
+    0x0c, 0x60, 0x19, 0x80, 0x36, 0x00, 0x78, 0x00, 0xf8, 0x01, 0xbc, 0x03, 0x3c, 0x06, 0x3c, 0x0c,
+    0x3c, 0x18, 0x3c, 0x30, 0x38, 0x60, 0x38, 0xc0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03,
+    0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0xff, 0x3f, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xc3, 0x80, 0x1c,
+    0x38, 0x01, 0xc3, 0xc0, 0x3c, 0x34, 0x02, 0xc3, 0x60, 0x6c, 0x32, 0x04, 0xc6, 0x30, 0xc6, 0x61,
+    0x08, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x09, 0x06, 0x60, 0xf0, 0x66, 0x0f, 0x06, 0x60, 0x60,
+    0x66, 0x00, 0x06, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x87, 0x00, 0xc3, 0xc0, 0x61, 0xf0, 0x30, 0xd8,
+    0x18, 0x66, 0x0c, 0x33, 0x86, 0x18, 0xe3, 0x0c, 0x31, 0x86, 0x0c, 0xc3, 0x07, 0x61, 0x81, 0xb0,
+    0xc0, 0x78, 0x60, 0x1c, 0x30, 0x0e, 0x18, 0x03, 0x0c, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f, 0xf0, 0x1c, 0x0e,
+    0x0e, 0x01, 0xc3, 0x00, 0x31, 0xc0, 0x0e, 0x60, 0x01, 0x98, 0x00, 0x66, 0x00, 0x19, 0x80, 0x06,
+    0x60, 0x01, 0x9c, 0x00, 0xe3, 0x00, 0x30, 0xe0, 0x1c, 0x1c, 0x0e, 0x03, 0xff, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0x01, 0xff, 0x83, 0x03, 0x86, 0x03, 0x8c, 0x03, 0x18, 0x06, 0x30, 0x0c, 0x60, 0x38, 0xc0, 0xe1,
+    0xff, 0x83, 0xfc, 0x06, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x07,
+    0xff, 0x01, 0xe0, 0xf0, 0x70, 0x07, 0x0c, 0x00, 0x63, 0x80, 0x0e, 0x60, 0x00, 0xcc, 0x00, 0x19,
+    0x80, 0x03, 0x30, 0x00, 0x66, 0x00, 0x0c, 0xe0, 0x03, 0x8c, 0x00, 0x61, 0xc0, 0x1c, 0x1e, 0x0f,
+    0x01, 0xff, 0x80, 0x0f, 0xc0, 0x00, 0x30, 0x00, 0x03, 0x80, 0x00, 0x3e, 0x00, 0x01, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x83, 0x03, 0x86, 0x01, 0x8c, 0x03, 0x18, 0x06,
+    0x30, 0x0c, 0x60, 0x70, 0xff, 0xc1, 0xff, 0x03, 0x06, 0x06, 0x06, 0x0c, 0x0e, 0x18, 0x0c, 0x30,
+    0x0c, 0x60, 0x1c, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x7f, 0xc7, 0x04, 0x30, 0x01, 0x80, 0x0e, 0x00, 0x3c, 0x00, 0xf0, 0x01, 0xe0,
+    0x03, 0xc0, 0x07, 0x00, 0x18, 0x00, 0xc0, 0x06, 0x60, 0x73, 0xff, 0x07, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0x00, 0x60, 0x06, 0x00,
+    0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x86,
+    0x00, 0xc3, 0x00, 0x61, 0x80, 0x30, 0xc0, 0x18, 0x60, 0x0c, 0x30, 0x06, 0x18, 0x03, 0x0c, 0x01,
+    0x86, 0x00, 0xc3, 0x00, 0x61, 0x80, 0x30, 0xc0, 0x18, 0x30, 0x18, 0x1c, 0x1c, 0x07, 0xfc, 0x00,
+    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0x03, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x30, 0x0c, 0x30, 0x0c, 0x38, 0x1c, 0x18, 0x18,
+    0x18, 0x18, 0x0c, 0x30, 0x0c, 0x30, 0x06, 0x60, 0x06, 0x60, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x80, 0x00, 0x33, 0x00, 0x00, 0x67, 0x01, 0x81, 0xc6, 0x07, 0x03, 0x0c, 0x0e, 0x06,
+    0x18, 0x14, 0x0c, 0x30, 0x6c, 0x18, 0x30, 0xd8, 0x60, 0x61, 0xb8, 0xc0, 0xc6, 0x31, 0x81, 0x8c,
+    0x63, 0x03, 0xb8, 0xee, 0x03, 0x60, 0xd8, 0x06, 0xc1, 0xb0, 0x0f, 0x03, 0xe0, 0x0e, 0x03, 0x80,
+    0x1c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x39, 0x80, 0x61, 0x81, 0x83, 0x87, 0x03, 0x0c, 0x03, 0x30,
+    0x03, 0xe0, 0x07, 0x80, 0x06, 0x00, 0x1e, 0x00, 0x7e, 0x00, 0xcc, 0x03, 0x0c, 0x0e, 0x1c, 0x18,
+    0x18, 0x60, 0x19, 0xc0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0x00, 0xd8, 0x06, 0x70, 0x38, 0xc0, 0xc1, 0x86, 0x06, 0x18, 0x0c, 0xc0, 0x3f, 0x00,
+    0x78, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x9f, 0xfe, 0x00,
+    0x38, 0x00, 0xc0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0c, 0x00, 0x30, 0x01, 0x80, 0x0c, 0x00, 0x70,
+    0x01, 0x80, 0x0c, 0x00, 0x70, 0x01, 0xff, 0xe7, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x00, 0x80, 0x30, 0x0c, 0x03, 0x00, 0x60,
+    0x18, 0x03, 0x00, 0xc0, 0x30, 0x06, 0x01, 0x80, 0x70, 0x0c, 0x03, 0x00, 0x60, 0x18, 0x06, 0x00,
+    0xc0, 0x30, 0x06, 0x01, 0x80, 0x60, 0x0c, 0x00, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0xc0, 0x0d, 0x80, 0x36, 0x01, 0x8c, 0x06, 0x30, 0x30, 0x61,
+    0xc1, 0xc2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x20, 0x38,
+    0x0e, 0x03, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfe, 0x07, 0xf8, 0x00, 0xe0, 0x03, 0x00, 0x18, 0x3f, 0xc3, 0xfe, 0x38, 0x31,
+    0x81, 0x8c, 0x0c, 0x70, 0x61, 0xff, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x7c, 0x0f, 0xf8, 0x38, 0x70,
+    0xc0, 0xc3, 0x01, 0x8c, 0x06, 0x30, 0x18, 0xc0, 0x63, 0x01, 0x8c, 0x0c, 0x30, 0x70, 0xff, 0x81,
+    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xf8, 0xff, 0x38, 0x06, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x01, 0x80,
+    0x38, 0x03, 0xfc, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03,
+    0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0xfb, 0x07, 0xfc, 0x38, 0x70, 0xc0, 0xc6, 0x03, 0x18, 0x0c,
+    0x60, 0x31, 0x80, 0xc6, 0x03, 0x0c, 0x0c, 0x38, 0x30, 0x7f, 0xc0, 0x7e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e,
+    0x03, 0xfc, 0x38, 0x61, 0x81, 0x98, 0x0c, 0xff, 0xe7, 0xff, 0x30, 0x01, 0x80, 0x06, 0x00, 0x38,
+    0x20, 0xff, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc7, 0xe7,
+    0x03, 0x01, 0x80, 0xfc, 0x7e, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7e, 0x07, 0xfc, 0x38, 0x30, 0xc0, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
+    0x03, 0x1c, 0x0c, 0x38, 0x70, 0x7f, 0xc0, 0xfb, 0x00, 0x0c, 0x20, 0x60, 0xff, 0x83, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0xf8, 0x0f, 0xf8, 0x30,
+    0x60, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0xc0,
+    0xc3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x03,
+    0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00,
+    0x00, 0x03, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x73, 0x8c, 0x00, 0x00,
+    0x01, 0x80, 0x0c, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xc0, 0xc6, 0x0c, 0x31, 0xc1, 0x9c, 0x0d,
+    0x80, 0x78, 0x03, 0xe0, 0x1b, 0xc0, 0xc6, 0x06, 0x18, 0x30, 0x61, 0x81, 0x8c, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc1, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1,
+    0x83, 0x06, 0x0c, 0x18, 0x30, 0x78, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0xfc, 0x0f, 0xff,
+    0xf8, 0x30, 0x70, 0x70, 0xc0, 0xc0, 0xc3, 0x03, 0x03, 0x0c, 0x0c, 0x0c, 0x30, 0x30, 0x30, 0xc0,
+    0xc0, 0xc3, 0x03, 0x03, 0x0c, 0x0c, 0x0c, 0x30, 0x30, 0x30, 0xc0, 0xc0, 0xc3, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x0f, 0xf8, 0x30, 0x60, 0xc0, 0xc3, 0x03,
+    0x0c, 0x0c, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfc, 0x07, 0xf8, 0x38, 0x70, 0xc0, 0xc6, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80, 0x66,
+    0x01, 0x8c, 0x0c, 0x38, 0x70, 0x7f, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x0f, 0xf8, 0x30,
+    0x70, 0xc0, 0xc3, 0x01, 0x8c, 0x06, 0x30, 0x18, 0xc0, 0x63, 0x01, 0x8c, 0x0c, 0x38, 0x70, 0xff,
+    0x83, 0x7c, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x07, 0xfc, 0x38, 0x30, 0xc0, 0xc6, 0x03, 0x18, 0x0c,
+    0x60, 0x31, 0x80, 0xc6, 0x03, 0x0c, 0x0c, 0x38, 0x70, 0x7f, 0xc0, 0xfb, 0x00, 0x0c, 0x00, 0x30,
+    0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7f, 0x30, 0x18,
+    0x0c, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe1, 0xfc, 0x60, 0x8c, 0x01, 0xc0, 0x1e,
+    0x01, 0xf0, 0x0f, 0x80, 0x30, 0x06, 0x40, 0xcf, 0xf0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0xf8, 0xfe, 0x30, 0x0c, 0x03, 0x00, 0xc0,
+    0x30, 0x0c, 0x03, 0x00, 0xc0, 0x38, 0x87, 0xe0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0xc0,
+    0xc3, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x18, 0x30, 0x7f, 0xc0, 0x7e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0x3e, 0x07, 0x60, 0x66, 0x06, 0x70, 0xe3, 0x0c, 0x30, 0xc1, 0x98, 0x19, 0x81,
+    0xf8, 0x0f, 0x00, 0xf0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x1e, 0x07, 0x03,
+    0x60, 0xe0, 0xcc, 0x1c, 0x19, 0x86, 0xc3, 0x18, 0xd8, 0xc3, 0x1b, 0x18, 0x63, 0x73, 0x06, 0xc6,
+    0xc0, 0xd8, 0xd8, 0x1f, 0x1f, 0x01, 0xc1, 0xc0, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
+    0x76, 0x06, 0x30, 0xc1, 0x98, 0x1f, 0x80, 0xf0, 0x06, 0x00, 0xf0, 0x1f, 0x83, 0x9c, 0x30, 0xc6,
+    0x06, 0xe0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x1f, 0x06, 0x60, 0xcc, 0x18, 0xc6, 0x18, 0xc3, 0x18, 0x36, 0x06, 0xc0, 0xd8,
+    0x0e, 0x01, 0xc0, 0x38, 0x06, 0x01, 0xc1, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1f, 0xf3, 0xfe, 0x01, 0xc0, 0x70, 0x0c, 0x03, 0x00, 0xc0, 0x38, 0x06, 0x01,
+    0x80, 0x70, 0x0f, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x1c, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x60, 0x70, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x1c, 0x0f, 0x07, 0x00, 0x30, 0x60, 0xc1, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x06,
+    0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x06, 0x0c, 0x00, 0xe0, 0xf0, 0x38, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x0c, 0x06, 0x0e, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0xf0, 0xe0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xc3, 0x0f, 0x9c, 0x73, 0xe1, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3e, 0x63, 0x63, 0x63,
+    0x3e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x30, 0x6c, 0x07, 0x00, 0x40, 0x00, 0x07, 0xe1, 0xfc, 0x60, 0x8c,
+    0x01, 0xc0, 0x1e, 0x01, 0xf0, 0x0f, 0x80, 0x30, 0x06, 0x40, 0xcf, 0xf0, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x83, 0x60, 0xd8, 0x34, 0x0c, 0x03, 0xf8, 0xfe, 0x30, 0x0c,
+    0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x38, 0x87, 0xe0, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x30, 0x6c, 0x07, 0x00, 0x40, 0x00, 0x1f, 0xf3, 0xfe, 0x01, 0xc0, 0x70,
+    0x0c, 0x03, 0x00, 0xc0, 0x38, 0x06, 0x01, 0x80, 0x70, 0x0f, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0x20, 0x00, 0x00, 0xfe, 0x07, 0xf8,
+    0x00, 0xe0, 0x03, 0x00, 0x18, 0x3f, 0xc3, 0xfe, 0x38, 0x31, 0x81, 0x8c, 0x0c, 0x70, 0x61, 0xff,
+    0x07, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x36, 0x03, 0x80,
+    0x20, 0x00, 0x01, 0xf8, 0xff, 0x38, 0x06, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x01, 0x80,
+    0x38, 0x03, 0xfc, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0e, 0x00, 0xe0,
+    0x0e, 0x00, 0x20, 0x00, 0x00, 0x3e, 0x03, 0xfc, 0x38, 0x61, 0x81, 0x98, 0x0c, 0xff, 0xe7, 0xff,
+    0x30, 0x01, 0x80, 0x06, 0x00, 0x38, 0x20, 0xff, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0xc0, 0x6c, 0x01, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x03, 0xfc, 0x38,
+    0x61, 0x81, 0x98, 0x0c, 0xff, 0xe7, 0xff, 0x30, 0x01, 0x80, 0x06, 0x00, 0x38, 0x20, 0xff, 0x03,
+    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x73, 0x9c, 0x20, 0x03, 0x0c, 0x30,
+    0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00,
+    0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x32, 0x0f, 0xb0, 0x1f, 0xf0, 0x38, 0x70, 0x30, 0x30, 0x60,
+    0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x30, 0x30, 0x38, 0x30, 0x1f, 0xf0, 0x07,
+    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x80, 0x6c,
+    0x00, 0xe0, 0x01, 0x00, 0x00, 0x01, 0xfc, 0x0f, 0xf8, 0x30, 0x60, 0xc0, 0xc3, 0x03, 0x0c, 0x0c,
+    0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xc1, 0xc0, 0x40, 0x00, 0x7e, 0x7f, 0x30, 0x18,
+    0x0c, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x80, 0x33, 0x00, 0xcc, 0x03, 0x30, 0x07, 0x80, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x30, 0x30,
+    0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x18, 0x30, 0x7f, 0xc0,
+    0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x38, 0x01,
+    0xc0, 0x02, 0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x30,
+    0x30, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x18, 0x30, 0x7f, 0xc0, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x1c, 0x07, 0x00, 0x40, 0x00, 0x30, 0x1f, 0x06, 0x60,
+    0xcc, 0x18, 0xc6, 0x18, 0xc3, 0x18, 0x36, 0x06, 0xc0, 0xd8, 0x0e, 0x01, 0xc0, 0x38, 0x06, 0x01,
+    0xc1, 0xf0, 0x3c, 0x00, 0x00, 0x00
+};
+
+static const twr_font_glyph_t twr_font_ubuntu_24_glyphs[110] = {
+    {0x20, 6, 24, 0},
+    {0x21, 7, 24, 144},
+    {0x22, 10, 24, 312},
+    {0x23, 16, 24, 552},
+    {0x24, 14, 24, 936},
+    {0x25, 21, 24, 1272},
+    {0x26, 16, 24, 1776},
+    {0x27, 6, 24, 2160},
+    {0x28, 8, 24, 2304},
+    {0x29, 8, 24, 2496},
+    {0x2a, 12, 24, 2688},
+    {0x2b, 14, 24, 2976},
+    {0x2c, 6, 24, 3312},
+    {0x2d, 8, 24, 3456},
+    {0x2e, 6, 24, 3648},
+    {0x2f, 10, 24, 3792},
+    {0x30, 14, 24, 4032},
+    {0x31, 14, 24, 4368},
+    {0x32, 14, 24, 4704},
+    {0x33, 14, 24, 5040},
+    {0x34, 14, 24, 5376},
+    {0x35, 14, 24, 5712},
+    {0x36, 14, 24, 6048},
+    {0x37, 14, 24, 6384},
+    {0x38, 14, 24, 6720},
+    {0x39, 14, 24, 7056},
+    {0x3a, 6, 24, 7392},
+    {0x3b, 6, 24, 7536},
+    {0x3c, 14, 24, 7680},
+    {0x3d, 14, 24, 8016},
+    {0x3e, 14, 24, 8352},
+    {0x3f, 10, 24, 8688},
+    {0x40, 23, 24, 8928},
+    {0x41, 15, 24, 9480},
+    {0x42, 15, 24, 9840},
+    {0x43, 15, 24, 10200},
+    {0x44, 17, 24, 10560},
+    {0x45, 14, 24, 10968},
+    {0x46, 13, 24, 11304},
+    {0x47, 16, 24, 11616},
+    {0x48, 17, 24, 12000},
+    {0x49, 6, 24, 12408},
+    {0x4a, 12, 24, 12552},
+    {0x4b, 15, 24, 12840},
+    {0x4c, 12, 24, 13200},
+    {0x4d, 20, 24, 13488},
+    {0x4e, 17, 24, 13968},
+    {0x4f, 18, 24, 14376},
+    {0x50, 15, 24, 14808},
+    {0x51, 19, 24, 15168},
+    {0x52, 15, 24, 15624},
+    {0x53, 13, 24, 15984},
+    {0x54, 12, 24, 16296},
+    {0x55, 17, 24, 16584},
+    {0x56, 16, 24, 16992},
+    {0x57, 23, 24, 17376},
+    {0x58, 15, 24, 17928},
+    {0x59, 14, 24, 18288},
+    {0x5a, 14, 24, 18624},
+    {0x5b, 8, 24, 18960},
+    {0x5c, 10, 24, 19152},
+    {0x5d, 8, 24, 19392},
+    {0x5e, 14, 24, 19584},
+    {0x5f, 12, 24, 19920},
+    {0x60, 9, 24, 20208},
+    {0x61, 13, 24, 20424},
+    {0x62, 14, 24, 20736},
+    {0x63, 11, 24, 21072},
+    {0x64, 14, 24, 21336},
+    {0x65, 13, 24, 21672},
+    {0x66, 9, 24, 21984},
+    {0x67, 14, 24, 22200},
+    {0x68, 14, 24, 22536},
+    {0x69, 6, 24, 22872},
+    {0x6a, 6, 24, 23016},
+    {0x6b, 13, 24, 23160},
+    {0x6c, 7, 24, 23472},
+    {0x6d, 22, 24, 23640},
+    {0x6e, 14, 24, 24168},
+    {0x6f, 14, 24, 24504},
+    {0x70, 14, 24, 24840},
+    {0x71, 14, 24, 25176},
+    {0x72, 9, 24, 25512},
+    {0x73, 11, 24, 25728},
+    {0x74, 10, 24, 25992},
+    {0x75, 14, 24, 26232},
+    {0x76, 12, 24, 26568},
+    {0x77, 19, 24, 26856},
+    {0x78, 12, 24, 27312},
+    {0x79, 11, 24, 27600},
+    {0x7a, 11, 24, 27864},
+    {0x7b, 8, 24, 28128},
+    {0x7c, 7, 24, 28320},
+    {0x7d, 8, 24, 28488},
+    {0x7e, 14, 24, 28680},
+    {0xb0, 8, 24, 29016},
+    {0xb9, 11, 24, 29208},
+    {0xbb, 10, 24, 29472},
+    {0xbe, 11, 24, 29712},
+    {0xe1, 13, 24, 29976},
+    {0xe8, 11, 24, 30288},
+    {0xe9, 13, 24, 30552},
+    {0xec, 13, 24, 30864},
+    {0xed, 6, 24, 31176},
+    {0xef, 16, 24, 31320},
+    {0xf2, 14, 24, 31704},
+    {0xf8, 9, 24, 32040},
+    {0xf9, 14, 24, 32256},
+    {0xfa, 14, 24, 32592},
+    {0xfd, 11, 24, 32928}
+};
+
+static const uint8_t twr_font_ubuntu_24_index[222] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d
+};
+
+const twr_font_t twr_font_ubuntu_24 = { 110, NULL, 0x20, 222, twr_font_ubuntu_24_index, twr_font_ubuntu_24_glyphs, twr_font_ubuntu_24_bitmaps };
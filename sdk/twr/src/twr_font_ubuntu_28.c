@@ -1,4769 +1,491 @@
-
-/*******************************************************************************
-* font
-* filename: C:/Users/mhubacek/Documents/Dev/BigClown/github/bc-lcd-fonts/sdk/fonts/twr_font_ubuntu28.xml
-* name: twr_font_ubuntu_28
-* family: Ubuntu
-* size: 28
-* style: Normal
-* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~°ěščřžýáíéúůťďň
-* antialiasing: no
-* type: proportional
-* encoding: ISO-8859-2
-* unicode bom: no
-*
-* preset name: HARDWARIO LCD Module
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Diffuse Dither 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
+// Generated by twr_font_compile.py from bc_font_ubuntu28.xml, do not edit
 
 #include <twr_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x20[28] = {
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc,
-    0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x20 = { image_data_twr_font_ubuntu_28_0x20,
-    6, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x21[28] = {
-    0xff,
-    0xff,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xf7,
-    0xff,
-    0xff,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x21 = { image_data_twr_font_ubuntu_28_0x21,
-    8, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x22[56] = {
-    0xc6, 0x30,
-    0xc6, 0x30,
-    0xc6, 0x30,
-    0xc6, 0x30,
-    0xc6, 0x30,
-    0xc6, 0x30,
-    0xef, 0x70,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x22 = { image_data_twr_font_ubuntu_28_0x22,
-    12, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x23[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfc, 0x7c, 0x60,
-    0xfc, 0x7c, 0x60,
-    0xf8, 0xf8, 0xe0,
-    0xf8, 0xf8, 0xe0,
-    0xf8, 0xf8, 0xe0,
-    0x80, 0x00, 0x20,
-    0x80, 0x00, 0x20,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0x80, 0x00, 0x20,
-    0x80, 0x00, 0x20,
-    0xe3, 0xe3, 0xe0,
-    0xe3, 0xe3, 0xe0,
-    0xe3, 0xe3, 0xe0,
-    0xc7, 0xc7, 0xe0,
-    0xc7, 0xc7, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x23 = { image_data_twr_font_ubuntu_28_0x23,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x24[56] = {
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xf8, 0x0f,
-    0xf0, 0x07,
-    0xe3, 0xf7,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc3, 0xff,
-    0xe1, 0xff,
-    0xe0, 0x7f,
-    0xf8, 0x1f,
-    0xfe, 0x07,
-    0xff, 0xc7,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xcf, 0xc7,
-    0xc0, 0x07,
-    0xf0, 0x1f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x24 = { image_data_twr_font_ubuntu_28_0x24,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x25[84] = {
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xe0, 0xff, 0x1f,
-    0xc0, 0x7f, 0x3f,
-    0x8e, 0x3e, 0x7f,
-    0x9f, 0x3e, 0x7f,
-    0x9f, 0x3c, 0xff,
-    0x9f, 0x38, 0xff,
-    0x9f, 0x39, 0xff,
-    0x8e, 0x33, 0xff,
-    0xc0, 0x73, 0xff,
-    0xe0, 0xe7, 0x07,
-    0xff, 0xce, 0x03,
-    0xff, 0xcc, 0x71,
-    0xff, 0x9c, 0xf9,
-    0xff, 0x1c, 0xf9,
-    0xff, 0x3c, 0xf9,
-    0xfe, 0x7c, 0xf9,
-    0xfe, 0x7c, 0x71,
-    0xfc, 0xfe, 0x03,
-    0xf8, 0xff, 0x07,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x25 = { image_data_twr_font_ubuntu_28_0x25,
-    24, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x26[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfc, 0x1f, 0xe0,
-    0xf0, 0x0f, 0xe0,
-    0xf1, 0x87, 0xe0,
-    0xe3, 0xc7, 0xe0,
-    0xe3, 0xc7, 0xe0,
-    0xe3, 0xc7, 0xe0,
-    0xe3, 0x8f, 0xe0,
-    0xf1, 0x0f, 0xe0,
-    0xf8, 0x3f, 0xe0,
-    0xf0, 0x7f, 0xe0,
-    0xe2, 0x3e, 0x60,
-    0xc7, 0x1e, 0x60,
-    0x8f, 0x8c, 0xe0,
-    0x8f, 0xc0, 0xe0,
-    0x8f, 0xe1, 0xe0,
-    0x8f, 0xf1, 0xe0,
-    0xc3, 0xc0, 0xe0,
-    0xe0, 0x0c, 0x60,
-    0xf0, 0x1e, 0x20,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x26 = { image_data_twr_font_ubuntu_28_0x26,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x27[28] = {
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xee,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x27 = { image_data_twr_font_ubuntu_28_0x27,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x28[56] = {
-    0xfe, 0x80,
-    0xfc, 0x00,
-    0xf8, 0x80,
-    0xf8, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf8, 0x80,
-    0xf8, 0x80,
-    0xfc, 0x00,
-    0xfe, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x28 = { image_data_twr_font_ubuntu_28_0x28,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x29[56] = {
-    0xbf, 0x80,
-    0x1f, 0x80,
-    0x8f, 0x80,
-    0x8f, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xf1, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0x8f, 0x80,
-    0x8f, 0x80,
-    0x1f, 0x80,
-    0xbf, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x29 = { image_data_twr_font_ubuntu_28_0x29,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2a[56] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xdc, 0xd8,
-    0x85, 0x08,
-    0xc0, 0x18,
-    0xf8, 0xf8,
-    0xf2, 0x78,
-    0xe2, 0x38,
-    0xc7, 0x18,
-    0xef, 0xb8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x2a = { image_data_twr_font_ubuntu_28_0x2a,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2b[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xc0, 0x03,
-    0xc0, 0x03,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xfe, 0x7f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x2b = { image_data_twr_font_ubuntu_28_0x2b,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2c[28] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xce,
-    0x8e,
-    0x9e,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x2c = { image_data_twr_font_ubuntu_28_0x2c,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2d[56] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0x80, 0x80,
-    0x80, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x2d = { image_data_twr_font_ubuntu_28_0x2d,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2e[28] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xe6,
-    0xc2,
-    0xc2,
-    0xe6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x2e = { image_data_twr_font_ubuntu_28_0x2e,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x2f[56] = {
-    0xff, 0x80,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xfe, 0x60,
-    0xfe, 0x60,
-    0xfe, 0x60,
-    0xfc, 0xe0,
-    0xfc, 0xe0,
-    0xf8, 0xe0,
-    0xf9, 0xe0,
-    0xf9, 0xe0,
-    0xf3, 0xe0,
-    0xf3, 0xe0,
-    0xf3, 0xe0,
-    0xe7, 0xe0,
-    0xe7, 0xe0,
-    0xc7, 0xe0,
-    0xcf, 0xe0,
-    0xcf, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x3f, 0xe0,
-    0x3f, 0xe0,
-    0x3f, 0xe0,
-    0x7f, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x2f = { image_data_twr_font_ubuntu_28_0x2f,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x30[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x1f,
-    0xf0, 0x0f,
-    0xe3, 0xc7,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xe3, 0xc7,
-    0xf0, 0x0f,
-    0xf8, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x30 = { image_data_twr_font_ubuntu_28_0x30,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x31[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0x1f,
-    0xfe, 0x1f,
-    0xfc, 0x1f,
-    0xf0, 0x1f,
-    0xe1, 0x1f,
-    0xf7, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x31 = { image_data_twr_font_ubuntu_28_0x31,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x32[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x3f,
-    0xe0, 0x0f,
-    0xc7, 0x8f,
-    0xef, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xcf,
-    0xff, 0x8f,
-    0xff, 0x1f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xf8, 0xff,
-    0xf1, 0xff,
-    0xe3, 0xff,
-    0xe3, 0xff,
-    0xc7, 0xff,
-    0xc0, 0x03,
-    0xc0, 0x03,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x32 = { image_data_twr_font_ubuntu_28_0x32,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x33[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf0, 0x3f,
-    0xc0, 0x0f,
-    0xef, 0x8f,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0x0f,
-    0xf8, 0x1f,
-    0xf8, 0x1f,
-    0xff, 0x87,
-    0xff, 0xc7,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xc3,
-    0xcf, 0x87,
-    0xc0, 0x0f,
-    0xe0, 0x3f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x33 = { image_data_twr_font_ubuntu_28_0x33,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x34[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0x87,
-    0xff, 0x87,
-    0xff, 0x07,
-    0xfe, 0x07,
-    0xfc, 0x47,
-    0xf8, 0xc7,
-    0xf9, 0xc7,
-    0xf1, 0xc7,
-    0xe3, 0xc7,
-    0xe7, 0xc7,
-    0xc7, 0xc7,
-    0x8f, 0xc7,
-    0x80, 0x01,
-    0x80, 0x01,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x34 = { image_data_twr_font_ubuntu_28_0x34,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x35[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf0, 0x07,
-    0xf0, 0x07,
-    0xf1, 0xff,
-    0xf1, 0xff,
-    0xf1, 0xff,
-    0xf1, 0xff,
-    0xf1, 0xff,
-    0xe0, 0x3f,
-    0xe0, 0x0f,
-    0xff, 0x07,
-    0xff, 0xc7,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xc3,
-    0xcf, 0x87,
-    0xc0, 0x0f,
-    0xe0, 0x3f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x35 = { image_data_twr_font_ubuntu_28_0x35,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x36[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xc3,
-    0xfe, 0x03,
-    0xfc, 0x3f,
-    0xf8, 0xff,
-    0xf1, 0xff,
-    0xe3, 0xff,
-    0xe3, 0xff,
-    0xc4, 0x0f,
-    0xc0, 0x07,
-    0xc3, 0xe3,
-    0xc7, 0xe1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xe3, 0xe3,
-    0xe1, 0xc3,
-    0xf0, 0x07,
-    0xfc, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x36 = { image_data_twr_font_ubuntu_28_0x36,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x37[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc0, 0x03,
-    0xc0, 0x03,
-    0xff, 0xe3,
-    0xff, 0xc7,
-    0xff, 0x8f,
-    0xff, 0x8f,
-    0xff, 0x1f,
-    0xff, 0x1f,
-    0xff, 0x3f,
-    0xfe, 0x3f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xfc, 0x7f,
-    0xfc, 0x7f,
-    0xfc, 0x7f,
-    0xf8, 0xff,
-    0xf8, 0xff,
-    0xf8, 0xff,
-    0xf8, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x37 = { image_data_twr_font_ubuntu_28_0x37,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x38[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x1f,
-    0xf0, 0x0f,
-    0xe3, 0xc7,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xe3,
-    0xe1, 0xc7,
-    0xf0, 0x0f,
-    0xf8, 0x1f,
-    0xf2, 0x0f,
-    0xe3, 0x87,
-    0xc7, 0xc3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xe3, 0xc7,
-    0xe0, 0x07,
-    0xf8, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x38 = { image_data_twr_font_ubuntu_28_0x38,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x39[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x3f,
-    0xe0, 0x0f,
-    0xc3, 0x87,
-    0xc7, 0xc7,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x87, 0xe3,
-    0xc7, 0xc3,
-    0xe0, 0x03,
-    0xf0, 0x23,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0x8f,
-    0xff, 0x0f,
-    0xfc, 0x1f,
-    0xc0, 0x7f,
-    0xc3, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x39 = { image_data_twr_font_ubuntu_28_0x39,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3a[28] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xe6,
-    0xc2,
-    0xc2,
-    0xe6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xe6,
-    0xc2,
-    0xc2,
-    0xe6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x3a = { image_data_twr_font_ubuntu_28_0x3a,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3b[28] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xce,
-    0x86,
-    0x86,
-    0xce,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xce,
-    0x8e,
-    0x9e,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x3b = { image_data_twr_font_ubuntu_28_0x3b,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3c[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xfb,
-    0xff, 0xe1,
-    0xff, 0x07,
-    0xfc, 0x1f,
-    0xf0, 0x7f,
-    0x83, 0xff,
-    0x8f, 0xff,
-    0x83, 0xff,
-    0xf0, 0x7f,
-    0xfc, 0x1f,
-    0xff, 0x07,
-    0xff, 0xe1,
-    0xff, 0xfb,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x3c = { image_data_twr_font_ubuntu_28_0x3c,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3d[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc0, 0x01,
-    0xc0, 0x01,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc0, 0x01,
-    0xc0, 0x01,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x3d = { image_data_twr_font_ubuntu_28_0x3d,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3e[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xdf, 0xff,
-    0x87, 0xff,
-    0xe1, 0xff,
-    0xf8, 0x7f,
-    0xfe, 0x1f,
-    0xff, 0x87,
-    0xff, 0xe3,
-    0xff, 0x87,
-    0xfe, 0x1f,
-    0xf8, 0x7f,
-    0xe1, 0xff,
-    0x87, 0xff,
-    0xdf, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x3e = { image_data_twr_font_ubuntu_28_0x3e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x3f[56] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xc0, 0xe0,
-    0x80, 0x60,
-    0xdc, 0x20,
-    0xfe, 0x20,
-    0xfe, 0x20,
-    0xfe, 0x20,
-    0xfc, 0x60,
-    0xf8, 0x60,
-    0xf8, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x3f = { image_data_twr_font_ubuntu_28_0x3f,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x40[112] = {
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xc0, 0x7f, 0xe0,
-    0xfe, 0x00, 0x0f, 0xe0,
-    0xfc, 0x1f, 0x87, 0xe0,
-    0xf8, 0x7f, 0xe3, 0xe0,
-    0xf1, 0xff, 0xf1, 0xe0,
-    0xe1, 0xe0, 0x78, 0xe0,
-    0xe3, 0xc0, 0x38, 0xe0,
-    0xe3, 0x8e, 0x3c, 0x60,
-    0xc7, 0x8e, 0x3c, 0x60,
-    0xc7, 0x1e, 0x3c, 0x60,
-    0xc7, 0x1e, 0x3c, 0x60,
-    0xc7, 0x1e, 0x3c, 0x60,
-    0xc7, 0x1e, 0x3c, 0x60,
-    0xc7, 0x1e, 0x3c, 0x60,
-    0xc7, 0x0e, 0x38, 0xe0,
-    0xe3, 0x8e, 0x30, 0xe0,
-    0xe3, 0xc0, 0x01, 0xe0,
-    0xe1, 0xe0, 0x83, 0xe0,
-    0xf1, 0xff, 0xff, 0xe0,
-    0xf8, 0x7f, 0xff, 0xe0,
-    0xfc, 0x1f, 0xff, 0xe0,
-    0xfe, 0x00, 0x3f, 0xe0,
-    0xff, 0xc0, 0x3f, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x40 = { image_data_twr_font_ubuntu_28_0x40,
-    27, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x41[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0x0f, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xfc, 0x47, 0xe0,
-    0xfc, 0x47, 0xe0,
-    0xf8, 0xe3, 0xe0,
-    0xf8, 0xe3, 0xe0,
-    0xf8, 0xe3, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe0, 0x00, 0xe0,
-    0xc0, 0x00, 0x60,
-    0xc7, 0xfc, 0x60,
-    0x8f, 0xfe, 0x20,
-    0x8f, 0xfe, 0x20,
-    0x8f, 0xfe, 0x20,
-    0x1f, 0xff, 0x00,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x41 = { image_data_twr_font_ubuntu_28_0x41,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x42[84] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xc0, 0x0f, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc0, 0x01, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xf8, 0x40,
-    0xc7, 0xfc, 0x40,
-    0xc7, 0xfc, 0x40,
-    0xc7, 0xfc, 0x40,
-    0xc7, 0xf8, 0x40,
-    0xc7, 0xf0, 0xc0,
-    0xc0, 0x01, 0xc0,
-    0xc0, 0x0f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x42 = { image_data_twr_font_ubuntu_28_0x42,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x43[84] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0x03, 0x80,
-    0xfc, 0x00, 0x80,
-    0xf8, 0x7c, 0x80,
-    0xf1, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xf1, 0xff, 0x80,
-    0xf0, 0xfc, 0x80,
-    0xf8, 0x00, 0x80,
-    0xfe, 0x03, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x43 = { image_data_twr_font_ubuntu_28_0x43,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x44[84] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xc0, 0x1f, 0xf0,
-    0xc0, 0x03, 0xf0,
-    0xc7, 0xe1, 0xf0,
-    0xc7, 0xf8, 0xf0,
-    0xc7, 0xfc, 0x70,
-    0xc7, 0xfc, 0x70,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfc, 0x70,
-    0xc7, 0xfc, 0x70,
-    0xc7, 0xf8, 0xf0,
-    0xc7, 0xe1, 0xf0,
-    0xc0, 0x03, 0xf0,
-    0xc0, 0x1f, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x44 = { image_data_twr_font_ubuntu_28_0x44,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x45[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc0, 0x03,
-    0xc0, 0x03,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc0, 0x07,
-    0xc0, 0x07,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc0, 0x01,
-    0xc0, 0x01,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x45 = { image_data_twr_font_ubuntu_28_0x45,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x46[56] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xc0, 0x02,
-    0xc0, 0x02,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc0, 0x06,
-    0xc0, 0x06,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x46 = { image_data_twr_font_ubuntu_28_0x46,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x47[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0x01, 0xe0,
-    0xfc, 0x00, 0x60,
-    0xf8, 0x7e, 0xe0,
-    0xf1, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xc7, 0xff, 0xe0,
-    0xc7, 0xff, 0xe0,
-    0xc7, 0xff, 0xe0,
-    0xc7, 0xff, 0xe0,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xf1, 0xfc, 0x60,
-    0xf0, 0x7c, 0x60,
-    0xfc, 0x00, 0x60,
-    0xff, 0x00, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x47 = { image_data_twr_font_ubuntu_28_0x47,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x48[84] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc0, 0x00, 0x30,
-    0xc0, 0x00, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x48 = { image_data_twr_font_ubuntu_28_0x48,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x49[28] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x49 = { image_data_twr_font_ubuntu_28_0x49,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4a[56] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0xff, 0x0c,
-    0x9e, 0x1c,
-    0x00, 0x3c,
-    0xc0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x4a = { image_data_twr_font_ubuntu_28_0x4a,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4b[84] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf1, 0xc0,
-    0xc7, 0xe3, 0xc0,
-    0xc7, 0xc7, 0xc0,
-    0xc7, 0x8f, 0xc0,
-    0xc7, 0x1f, 0xc0,
-    0xc6, 0x3f, 0xc0,
-    0xc4, 0x7f, 0xc0,
-    0xc0, 0xff, 0xc0,
-    0xc0, 0x7f, 0xc0,
-    0xc4, 0x3f, 0xc0,
-    0xc6, 0x1f, 0xc0,
-    0xc7, 0x07, 0xc0,
-    0xc7, 0xc3, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xf8, 0x40,
-    0xc7, 0xfc, 0x00,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x4b = { image_data_twr_font_ubuntu_28_0x4b,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4c[56] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc0, 0x00,
-    0xc0, 0x00,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x4c = { image_data_twr_font_ubuntu_28_0x4c,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4d[112] = {
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xe3, 0xff, 0xe3, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xe0, 0xff, 0x83, 0x80,
-    0xe0, 0x7f, 0x83, 0x80,
-    0xe2, 0x7f, 0x23, 0x80,
-    0xe6, 0x3f, 0x33, 0x80,
-    0xc7, 0x3e, 0x73, 0x80,
-    0xc7, 0x3e, 0x71, 0x80,
-    0xc7, 0x1c, 0x71, 0x80,
-    0xc7, 0x9c, 0xf1, 0x80,
-    0xc7, 0x88, 0xf1, 0x80,
-    0xc7, 0xc9, 0xf1, 0x80,
-    0xc7, 0xc1, 0xf1, 0x80,
-    0xc7, 0xc1, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x4d = { image_data_twr_font_ubuntu_28_0x4d,
-    25, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4e[84] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xc7, 0xfe, 0x30,
-    0xc3, 0xfe, 0x30,
-    0xc1, 0xfe, 0x30,
-    0xc0, 0xfe, 0x30,
-    0xc0, 0x7e, 0x30,
-    0xc4, 0x7e, 0x30,
-    0xc6, 0x3e, 0x30,
-    0xc7, 0x1e, 0x30,
-    0xc7, 0x9e, 0x30,
-    0xc7, 0x8e, 0x30,
-    0xc7, 0xc6, 0x30,
-    0xc7, 0xe6, 0x30,
-    0xc7, 0xe2, 0x30,
-    0xc7, 0xf0, 0x30,
-    0xc7, 0xf8, 0x30,
-    0xc7, 0xf8, 0x30,
-    0xc7, 0xfc, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xc7, 0xfe, 0x30,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x4e = { image_data_twr_font_ubuntu_28_0x4e,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x4f[84] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0x03, 0xfc,
-    0xfc, 0x00, 0xfc,
-    0xf8, 0x78, 0x7c,
-    0xf1, 0xfe, 0x3c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xf1, 0xfe, 0x3c,
-    0xf8, 0x78, 0x7c,
-    0xfc, 0x00, 0xfc,
-    0xff, 0x03, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x4f = { image_data_twr_font_ubuntu_28_0x4f,
-    22, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x50[84] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xc0, 0x1f, 0x80,
-    0xc0, 0x03, 0x80,
-    0xc7, 0xe1, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xc7, 0xf8, 0x80,
-    0xc7, 0xf8, 0x80,
-    0xc7, 0xf8, 0x80,
-    0xc7, 0xf8, 0x80,
-    0xc7, 0xf0, 0x80,
-    0xc7, 0xe1, 0x80,
-    0xc0, 0x03, 0x80,
-    0xc0, 0x0f, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x50 = { image_data_twr_font_ubuntu_28_0x50,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x51[84] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0x03, 0xfc,
-    0xfc, 0x00, 0xfc,
-    0xf8, 0x78, 0x7c,
-    0xf1, 0xfe, 0x3c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xc7, 0xff, 0x8c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xf1, 0xfe, 0x3c,
-    0xf0, 0x78, 0x7c,
-    0xfc, 0x00, 0xfc,
-    0xff, 0x03, 0xfc,
-    0xff, 0xc7, 0xfc,
-    0xff, 0xe3, 0xfc,
-    0xff, 0xe0, 0xfc,
-    0xff, 0xf8, 0x3c,
-    0xff, 0xfe, 0x3c,
-    0xff, 0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x51 = { image_data_twr_font_ubuntu_28_0x51,
-    22, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x52[84] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xc0, 0x0f, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc7, 0xf1, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc0, 0x0f, 0xc0,
-    0xc7, 0x87, 0xc0,
-    0xc7, 0xc3, 0xc0,
-    0xc7, 0xe1, 0xc0,
-    0xc7, 0xf1, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xf8, 0x40,
-    0xc7, 0xfc, 0x40,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x52 = { image_data_twr_font_ubuntu_28_0x52,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x53[56] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xf0, 0x1e,
-    0xe0, 0x06,
-    0xc7, 0xee,
-    0x8f, 0xfe,
-    0x8f, 0xfe,
-    0x8f, 0xfe,
-    0x87, 0xfe,
-    0xc1, 0xfe,
-    0xe0, 0x3e,
-    0xf0, 0x0e,
-    0xfe, 0x06,
-    0xff, 0xc2,
-    0xff, 0xe2,
-    0xff, 0xe2,
-    0xff, 0xe2,
-    0xff, 0xe2,
-    0x8f, 0xc6,
-    0x80, 0x0e,
-    0xe0, 0x3e,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x53 = { image_data_twr_font_ubuntu_28_0x53,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x54[56] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0x00, 0x00,
-    0x00, 0x00,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x54 = { image_data_twr_font_ubuntu_28_0x54,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x55[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xf0, 0x01, 0xe0,
-    0xfc, 0x07, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x55 = { image_data_twr_font_ubuntu_28_0x55,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x56[84] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0x1f, 0xff, 0x00,
-    0x8f, 0xfe, 0x20,
-    0x8f, 0xfe, 0x20,
-    0x8f, 0xfe, 0x20,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc3, 0xf8, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf8, 0xe3, 0xe0,
-    0xf8, 0xe3, 0xe0,
-    0xf8, 0x43, 0xe0,
-    0xfc, 0x47, 0xe0,
-    0xfc, 0x07, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x56 = { image_data_twr_font_ubuntu_28_0x56,
-    19, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x57[112] = {
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0x8f, 0xff, 0xfe, 0x20,
-    0x8f, 0xff, 0xfe, 0x20,
-    0x87, 0xf1, 0xfc, 0x20,
-    0xc7, 0xf0, 0xfc, 0x60,
-    0xc7, 0xe0, 0xfc, 0x60,
-    0xc7, 0xe0, 0xfc, 0x60,
-    0xc7, 0xe4, 0xfc, 0x60,
-    0xc3, 0xc4, 0x78, 0x60,
-    0xe3, 0xc4, 0x78, 0xe0,
-    0xe3, 0xcc, 0x78, 0xe0,
-    0xe3, 0x8e, 0x38, 0xe0,
-    0xe3, 0x8e, 0x38, 0xe0,
-    0xe1, 0x9e, 0x30, 0xe0,
-    0xf1, 0x1f, 0x11, 0xe0,
-    0xf1, 0x1f, 0x11, 0xe0,
-    0xf1, 0x3f, 0x11, 0xe0,
-    0xf0, 0x3f, 0x81, 0xe0,
-    0xf8, 0x3f, 0x83, 0xe0,
-    0xf8, 0x7f, 0x83, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x57 = { image_data_twr_font_ubuntu_28_0x57,
-    27, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x58[84] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0x8f, 0xfc, 0x40,
-    0xc7, 0xf8, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xf1, 0xe3, 0xc0,
-    0xf8, 0xc7, 0xc0,
-    0xf8, 0xc7, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xfe, 0x1f, 0xc0,
-    0xfe, 0x1f, 0xc0,
-    0xfe, 0x1f, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf8, 0xc7, 0xc0,
-    0xf8, 0xc7, 0xc0,
-    0xf1, 0xe3, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xc3, 0xf0, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0x8f, 0xfc, 0x40,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x58 = { image_data_twr_font_ubuntu_28_0x58,
-    18, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x59[84] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0x1f, 0xfc, 0x00,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xf1, 0xc7, 0x80,
-    0xf8, 0x8f, 0x80,
-    0xf8, 0x8f, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x59 = { image_data_twr_font_ubuntu_28_0x59,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5a[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc0, 0x01,
-    0xc0, 0x01,
-    0xff, 0xf1,
-    0xff, 0xe3,
-    0xff, 0xc7,
-    0xff, 0x8f,
-    0xff, 0x8f,
-    0xff, 0x1f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xfc, 0x7f,
-    0xf8, 0xff,
-    0xf1, 0xff,
-    0xf1, 0xff,
-    0xe3, 0xff,
-    0xe3, 0xff,
-    0xc7, 0xff,
-    0x80, 0x01,
-    0x80, 0x01,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x5a = { image_data_twr_font_ubuntu_28_0x5a,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5b[56] = {
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x5b = { image_data_twr_font_ubuntu_28_0x5b,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5c[56] = {
-    0x7f, 0xe0,
-    0x3f, 0xe0,
-    0x3f, 0xe0,
-    0x3f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0x9f, 0xe0,
-    0xcf, 0xe0,
-    0xcf, 0xe0,
-    0xc7, 0xe0,
-    0xe7, 0xe0,
-    0xe7, 0xe0,
-    0xf3, 0xe0,
-    0xf3, 0xe0,
-    0xf3, 0xe0,
-    0xf9, 0xe0,
-    0xf9, 0xe0,
-    0xf8, 0xe0,
-    0xfc, 0xe0,
-    0xfc, 0xe0,
-    0xfe, 0x60,
-    0xfe, 0x60,
-    0xfe, 0x60,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xff, 0x20,
-    0xff, 0x80,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x5c = { image_data_twr_font_ubuntu_28_0x5c,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5d[56] = {
-    0x03, 0x80,
-    0x03, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0x03, 0x80,
-    0x03, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x5d = { image_data_twr_font_ubuntu_28_0x5d,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5e[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xfc, 0x7f,
-    0xf8, 0x3f,
-    0xf8, 0x3f,
-    0xf1, 0x1f,
-    0xf1, 0x1f,
-    0xe3, 0x8f,
-    0xe3, 0x8f,
-    0xc7, 0xc7,
-    0xcf, 0xe7,
-    0x8f, 0xe3,
-    0xdf, 0xf7,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x5e = { image_data_twr_font_ubuntu_28_0x5e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x5f[56] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x00, 0x00,
-    0x00, 0x00,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x5f = { image_data_twr_font_ubuntu_28_0x5f,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x60[56] = {
-    0xff, 0xe0,
-    0xef, 0xe0,
-    0xc7, 0xe0,
-    0xe3, 0xe0,
-    0xf1, 0xe0,
-    0xfb, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x60 = { image_data_twr_font_ubuntu_28_0x60,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x61[56] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xe0, 0x3e,
-    0xe0, 0x0e,
-    0xff, 0x8e,
-    0xff, 0xc6,
-    0xff, 0xc6,
-    0xff, 0xc6,
-    0xf0, 0x06,
-    0xc0, 0x06,
-    0x87, 0xc6,
-    0x8f, 0xc6,
-    0x8f, 0xc6,
-    0x8f, 0xc6,
-    0x87, 0xc6,
-    0xc0, 0x06,
-    0xf0, 0x06,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x61 = { image_data_twr_font_ubuntu_28_0x61,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x62[56] = {
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc4, 0x1f,
-    0xc0, 0x07,
-    0xc3, 0xc3,
-    0xc7, 0xe3,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xe1,
-    0xc7, 0xe3,
-    0xc7, 0xc7,
-    0xc0, 0x0f,
-    0xe0, 0x1f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x62 = { image_data_twr_font_ubuntu_28_0x62,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x63[56] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf8, 0x18,
-    0xf0, 0x08,
-    0xe3, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x87, 0xf8,
-    0xc7, 0xf8,
-    0xc3, 0xe8,
-    0xe0, 0x08,
-    0xf8, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x63 = { image_data_twr_font_ubuntu_28_0x63,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x64[56] = {
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xf8, 0x23,
-    0xe0, 0x03,
-    0xc3, 0xc3,
-    0xc7, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x87, 0xe3,
-    0xc7, 0xe3,
-    0xe3, 0xe3,
-    0xf0, 0x03,
-    0xf8, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x64 = { image_data_twr_font_ubuntu_28_0x64,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x65[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xfc, 0x1f,
-    0xf0, 0x07,
-    0xe3, 0xc3,
-    0xc7, 0xe3,
-    0xcf, 0xf1,
-    0x8f, 0xf1,
-    0x80, 0x01,
-    0x80, 0x01,
-    0x8f, 0xff,
-    0x8f, 0xff,
-    0x87, 0xff,
-    0xc7, 0xff,
-    0xe1, 0xfb,
-    0xf0, 0x03,
-    0xfc, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x65 = { image_data_twr_font_ubuntu_28_0x65,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x66[56] = {
-    0xf8, 0x00,
-    0xe0, 0x00,
-    0xe3, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc0, 0x20,
-    0xc0, 0x20,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x66 = { image_data_twr_font_ubuntu_28_0x66,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x67[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x07,
-    0xf0, 0x03,
-    0xc3, 0xe3,
-    0xc7, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xc3,
-    0xe0, 0x03,
-    0xf8, 0x23,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xc3,
-    0xdf, 0x87,
-    0xc0, 0x0f,
-    0xe0, 0x3f,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x67 = { image_data_twr_font_ubuntu_28_0x67,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x68[56] = {
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc0, 0x1f,
-    0xc0, 0x0f,
-    0xc7, 0xc7,
-    0xc7, 0xc3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x68 = { image_data_twr_font_ubuntu_28_0x68,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x69[28] = {
-    0xfe,
-    0xc6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x69 = { image_data_twr_font_ubuntu_28_0x69,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6a[28] = {
-    0xfe,
-    0xc6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0x8e,
-    0x0e,
-    0x3e,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x6a = { image_data_twr_font_ubuntu_28_0x6a,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6b[56] = {
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xc2,
-    0xc7, 0xc6,
-    0xc7, 0x8e,
-    0xc7, 0x1e,
-    0xc6, 0x3e,
-    0xc4, 0x7e,
-    0xc0, 0xfe,
-    0xc0, 0x7e,
-    0xc4, 0x3e,
-    0xc6, 0x1e,
-    0xc7, 0x0e,
-    0xc7, 0x86,
-    0xc7, 0xc6,
-    0xc7, 0xc2,
-    0xc7, 0xe0,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x6b = { image_data_twr_font_ubuntu_28_0x6b,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6c[28] = {
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc3,
-    0xe1,
-    0xf1,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x6c = { image_data_twr_font_ubuntu_28_0x6c,
-    8, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6d[112] = {
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xe0, 0x1c, 0x0f, 0x80,
-    0xc0, 0x00, 0x03, 0x80,
-    0xc7, 0xc3, 0xe3, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x6d = { image_data_twr_font_ubuntu_28_0x6d,
-    25, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6e[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xe0, 0x1f,
-    0xc0, 0x0f,
-    0xc7, 0xc7,
-    0xc7, 0xc3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x6e = { image_data_twr_font_ubuntu_28_0x6e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x6f[84] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xf0, 0x07, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xc7, 0xf1, 0x80,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xf0, 0x07, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x6f = { image_data_twr_font_ubuntu_28_0x6f,
-    17, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x70[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xe0, 0x1f,
-    0xc0, 0x0f,
-    0xc7, 0xc7,
-    0xc7, 0xe3,
-    0xc7, 0xe1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xf1,
-    0xc7, 0xe3,
-    0xc3, 0xc3,
-    0xc0, 0x07,
-    0xc4, 0x1f,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xc7, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x70 = { image_data_twr_font_ubuntu_28_0x70,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x71[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xf8, 0x07,
-    0xf0, 0x03,
-    0xe3, 0xe3,
-    0xc7, 0xe3,
-    0x87, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0x8f, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xc3,
-    0xe0, 0x03,
-    0xf8, 0x23,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xe3,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x71 = { image_data_twr_font_ubuntu_28_0x71,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x72[56] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xf0, 0x00,
-    0xc0, 0x00,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x72 = { image_data_twr_font_ubuntu_28_0x72,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x73[56] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xf0, 0x30,
-    0xc0, 0x30,
-    0x87, 0xb0,
-    0x8f, 0xf0,
-    0x8f, 0xf0,
-    0x87, 0xf0,
-    0x81, 0xf0,
-    0xc0, 0x30,
-    0xf8, 0x10,
-    0xfe, 0x10,
-    0xff, 0x10,
-    0xff, 0x10,
-    0xbe, 0x10,
-    0x80, 0x30,
-    0xc0, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x73 = { image_data_twr_font_ubuntu_28_0x73,
-    12, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x74[56] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc0, 0x60,
-    0xc0, 0x60,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc3, 0xa0,
-    0xe0, 0x20,
-    0xf0, 0x60,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x74 = { image_data_twr_font_ubuntu_28_0x74,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x75[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xe3,
-    0xe3, 0xe3,
-    0xf0, 0x03,
-    0xf8, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x75 = { image_data_twr_font_ubuntu_28_0x75,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x76[56] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0x1f, 0xc0,
-    0x1f, 0xc0,
-    0x8f, 0x88,
-    0x8f, 0x88,
-    0x8f, 0x88,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xe2, 0x38,
-    0xe2, 0x38,
-    0xe0, 0x38,
-    0xf0, 0x78,
-    0xf0, 0x78,
-    0xf0, 0x78,
-    0xf8, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x76 = { image_data_twr_font_ubuntu_28_0x76,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x77[84] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0x1f, 0x8f, 0xc0,
-    0x1f, 0x8f, 0xc0,
-    0x9f, 0x8f, 0xc8,
-    0x8f, 0x07, 0x88,
-    0x8f, 0x07, 0x88,
-    0x8f, 0x27, 0x88,
-    0xce, 0x23, 0x98,
-    0xce, 0x23, 0x98,
-    0xc6, 0x73, 0x18,
-    0xc4, 0x71, 0x18,
-    0xe4, 0x71, 0x38,
-    0xe4, 0xf9, 0x38,
-    0xe0, 0xf8, 0x38,
-    0xf0, 0xf8, 0x78,
-    0xf1, 0xfc, 0x78,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x77 = { image_data_twr_font_ubuntu_28_0x77,
-    21, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x78[56] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x1f, 0xc4,
-    0x8f, 0x8c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0xe2, 0x3c,
-    0xf0, 0x7c,
-    0xf8, 0xfc,
-    0xf8, 0xfc,
-    0xf0, 0x7c,
-    0xf0, 0x7c,
-    0xe2, 0x3c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0x8f, 0x8c,
-    0x1f, 0xc4,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x78 = { image_data_twr_font_ubuntu_28_0x78,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x79[56] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0x1f, 0xc4,
-    0x1f, 0xc4,
-    0x8f, 0x8c,
-    0x8f, 0x8c,
-    0x8f, 0x8c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0xe2, 0x3c,
-    0xe2, 0x3c,
-    0xe2, 0x3c,
-    0xe2, 0x7c,
-    0xf0, 0x7c,
-    0xf0, 0x7c,
-    0xf0, 0xfc,
-    0xf0, 0xfc,
-    0xf0, 0xfc,
-    0xf1, 0xfc,
-    0x03, 0xfc,
-    0x07, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x79 = { image_data_twr_font_ubuntu_28_0x79,
-    14, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x7a[56] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0xff, 0x88,
-    0xff, 0x18,
-    0xfe, 0x38,
-    0xfc, 0x78,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xf1, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xc7, 0xf8,
-    0x8f, 0xf8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x7a = { image_data_twr_font_ubuntu_28_0x7a,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x7b[56] = {
-    0xfc, 0x00,
-    0xf8, 0x00,
-    0xf0, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xe1, 0xc0,
-    0x83, 0xc0,
-    0x87, 0xc0,
-    0xe3, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf0, 0xc0,
-    0xf8, 0x00,
-    0xfe, 0x00,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x7b = { image_data_twr_font_ubuntu_28_0x7b,
-    10, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x7c[28] = {
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xe7,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x7c = { image_data_twr_font_ubuntu_28_0x7c,
-    8, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x7d[56] = {
-    0x1f, 0x80,
-    0x0f, 0x80,
-    0x87, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc3, 0x80,
-    0xe0, 0x80,
-    0xf0, 0x80,
-    0xe3, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0xc7, 0x80,
-    0x87, 0x80,
-    0x0f, 0x80,
-    0x3f, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x7d = { image_data_twr_font_ubuntu_28_0x7d,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0x7e[56] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xe1, 0xf3,
-    0xc0, 0x63,
-    0x8c, 0x07,
-    0x9f, 0x0f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0x7e = { image_data_twr_font_ubuntu_28_0x7e,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xb0[56] = {
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xc1, 0x80,
-    0x9c, 0x80,
-    0x9c, 0x80,
-    0x9c, 0x80,
-    0xc1, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xb0 = { image_data_twr_font_ubuntu_28_0xb0,
-    9, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xb9[56] = {
-    0xff, 0xf0,
-    0xee, 0xf0,
-    0xc4, 0x70,
-    0xe0, 0xf0,
-    0xf1, 0xf0,
-    0xfb, 0xf0,
-    0xff, 0xf0,
-    0xf0, 0x30,
-    0xc0, 0x30,
-    0x87, 0xb0,
-    0x8f, 0xf0,
-    0x8f, 0xf0,
-    0x87, 0xf0,
-    0x81, 0xf0,
-    0xc0, 0x30,
-    0xf8, 0x10,
-    0xfe, 0x10,
-    0xff, 0x10,
-    0xff, 0x10,
-    0xbe, 0x10,
-    0x80, 0x30,
-    0xc0, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xb9 = { image_data_twr_font_ubuntu_28_0xb9,
-    12, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xbb[56] = {
-    0xfe, 0x60,
-    0xfe, 0x60,
-    0xc6, 0x60,
-    0xc6, 0x60,
-    0xc6, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc0, 0x60,
-    0xc0, 0x60,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc3, 0xa0,
-    0xe0, 0x20,
-    0xf0, 0x60,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xbb = { image_data_twr_font_ubuntu_28_0xbb,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xbe[56] = {
-    0xff, 0xf8,
-    0xf7, 0x78,
-    0xe2, 0x38,
-    0xf0, 0x78,
-    0xf8, 0xf8,
-    0xfd, 0xf8,
-    0xff, 0xf8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0xff, 0x88,
-    0xff, 0x18,
-    0xfe, 0x38,
-    0xfc, 0x78,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xf1, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xc7, 0xf8,
-    0x8f, 0xf8,
-    0x80, 0x08,
-    0x80, 0x08,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xbe = { image_data_twr_font_ubuntu_28_0xbe,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xe1[56] = {
-    0xff, 0xfe,
-    0xff, 0xbe,
-    0xff, 0x1e,
-    0xfe, 0x3e,
-    0xfc, 0x7e,
-    0xfe, 0xfe,
-    0xff, 0xfe,
-    0xe0, 0x3e,
-    0xe0, 0x0e,
-    0xff, 0x8e,
-    0xff, 0xc6,
-    0xff, 0xc6,
-    0xff, 0xc6,
-    0xf0, 0x06,
-    0xc0, 0x06,
-    0x87, 0xc6,
-    0x8f, 0xc6,
-    0x8f, 0xc6,
-    0x8f, 0xc6,
-    0x87, 0xc6,
-    0xc0, 0x06,
-    0xf0, 0x06,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xe1 = { image_data_twr_font_ubuntu_28_0xe1,
-    15, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xe8[56] = {
-    0xff, 0xf8,
-    0xfb, 0xb8,
-    0xf1, 0x18,
-    0xf8, 0x38,
-    0xfc, 0x78,
-    0xfe, 0xf8,
-    0xff, 0xf8,
-    0xf8, 0x18,
-    0xf0, 0x08,
-    0xe3, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x87, 0xf8,
-    0xc7, 0xf8,
-    0xc3, 0xe8,
-    0xe0, 0x08,
-    0xf8, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xe8 = { image_data_twr_font_ubuntu_28_0xe8,
-    13, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xe9[56] = {
-    0xff, 0xff,
-    0xff, 0xbf,
-    0xff, 0x1f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xfe, 0xff,
-    0xff, 0xff,
-    0xfc, 0x1f,
-    0xf0, 0x07,
-    0xe3, 0xc3,
-    0xc7, 0xe3,
-    0xcf, 0xf1,
-    0x8f, 0xf1,
-    0x80, 0x01,
-    0x80, 0x01,
-    0x8f, 0xff,
-    0x8f, 0xff,
-    0x87, 0xff,
-    0xc7, 0xff,
-    0xe1, 0xfb,
-    0xf0, 0x03,
-    0xfc, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xe9 = { image_data_twr_font_ubuntu_28_0xe9,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xec[56] = {
-    0xfd, 0xdf,
-    0xf8, 0x8f,
-    0xfc, 0x1f,
-    0xfe, 0x3f,
-    0xff, 0x7f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xfc, 0x1f,
-    0xf0, 0x07,
-    0xe3, 0xc3,
-    0xc7, 0xe3,
-    0xcf, 0xf1,
-    0x8f, 0xf1,
-    0x80, 0x01,
-    0x80, 0x01,
-    0x8f, 0xff,
-    0x8f, 0xff,
-    0x87, 0xff,
-    0xc7, 0xff,
-    0xe1, 0xfb,
-    0xf0, 0x03,
-    0xfc, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xec = { image_data_twr_font_ubuntu_28_0xec,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xed[28] = {
-    0xfe,
-    0xfa,
-    0xf0,
-    0xe2,
-    0xc6,
-    0xee,
-    0xfe,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xc6,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xed = { image_data_twr_font_ubuntu_28_0xed,
-    7, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xef[84] = {
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x90,
-    0xff, 0xe3, 0x90,
-    0xff, 0xe3, 0xf0,
-    0xf8, 0x23, 0xf0,
-    0xe0, 0x03, 0xf0,
-    0xc3, 0xc3, 0xf0,
-    0xc7, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x8f, 0xe3, 0xf0,
-    0x87, 0xe3, 0xf0,
-    0xc7, 0xe3, 0xf0,
-    0xe3, 0xe3, 0xf0,
-    0xf0, 0x03, 0xf0,
-    0xf8, 0x07, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xef = { image_data_twr_font_ubuntu_28_0xef,
-    20, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xf2[56] = {
-    0xff, 0xff,
-    0xfb, 0xbf,
-    0xf1, 0x1f,
-    0xf8, 0x3f,
-    0xfc, 0x7f,
-    0xfe, 0xff,
-    0xff, 0xff,
-    0xe0, 0x1f,
-    0xc0, 0x0f,
-    0xc7, 0xc7,
-    0xc7, 0xc3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xf2 = { image_data_twr_font_ubuntu_28_0xf2,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xf8[56] = {
-    0xff, 0xe0,
-    0xf7, 0x60,
-    0xe2, 0x20,
-    0xf0, 0x60,
-    0xf8, 0xe0,
-    0xfd, 0xe0,
-    0xff, 0xe0,
-    0xf0, 0x00,
-    0xc0, 0x00,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xc7, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xf8 = { image_data_twr_font_ubuntu_28_0xf8,
-    11, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xf9[56] = {
-    0xf8, 0x3f,
-    0xf3, 0x9f,
-    0xf3, 0x9f,
-    0xf3, 0x9f,
-    0xf3, 0x9f,
-    0xf8, 0x3f,
-    0xff, 0xff,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xe3,
-    0xe3, 0xe3,
-    0xf0, 0x03,
-    0xf8, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xf9 = { image_data_twr_font_ubuntu_28_0xf9,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xfa[56] = {
-    0xff, 0xff,
-    0xff, 0xbf,
-    0xff, 0x1f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xfe, 0xff,
-    0xff, 0xff,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc3, 0xe3,
-    0xe3, 0xe3,
-    0xf0, 0x03,
-    0xf8, 0x07,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xfa = { image_data_twr_font_ubuntu_28_0xfa,
-    16, 28/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_28_0xfd[56] = {
-    0xff, 0xfc,
-    0xff, 0x7c,
-    0xfe, 0x3c,
-    0xfc, 0x7c,
-    0xf8, 0xfc,
-    0xfd, 0xfc,
-    0xff, 0xfc,
-    0x1f, 0xc4,
-    0x1f, 0xc4,
-    0x8f, 0x8c,
-    0x8f, 0x8c,
-    0x8f, 0x8c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0xc7, 0x1c,
-    0xe2, 0x3c,
-    0xe2, 0x3c,
-    0xe2, 0x3c,
-    0xe2, 0x7c,
-    0xf0, 0x7c,
-    0xf0, 0x7c,
-    0xf0, 0xfc,
-    0xf0, 0xfc,
-    0xf0, 0xfc,
-    0xf1, 0xfc,
-    0x03, 0xfc,
-    0x07, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_28_0xfd = { image_data_twr_font_ubuntu_28_0xfd,
-    14, 28/*, 8*/};
-#endif
-
-
-static const twr_font_char_t twr_font_ubuntu_28_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &twr_font_ubuntu_28_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &twr_font_ubuntu_28_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &twr_font_ubuntu_28_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &twr_font_ubuntu_28_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &twr_font_ubuntu_28_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &twr_font_ubuntu_28_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &twr_font_ubuntu_28_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &twr_font_ubuntu_28_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &twr_font_ubuntu_28_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &twr_font_ubuntu_28_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &twr_font_ubuntu_28_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &twr_font_ubuntu_28_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &twr_font_ubuntu_28_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &twr_font_ubuntu_28_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &twr_font_ubuntu_28_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &twr_font_ubuntu_28_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &twr_font_ubuntu_28_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &twr_font_ubuntu_28_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &twr_font_ubuntu_28_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &twr_font_ubuntu_28_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &twr_font_ubuntu_28_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &twr_font_ubuntu_28_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &twr_font_ubuntu_28_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &twr_font_ubuntu_28_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &twr_font_ubuntu_28_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &twr_font_ubuntu_28_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &twr_font_ubuntu_28_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &twr_font_ubuntu_28_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &twr_font_ubuntu_28_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &twr_font_ubuntu_28_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &twr_font_ubuntu_28_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &twr_font_ubuntu_28_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &twr_font_ubuntu_28_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &twr_font_ubuntu_28_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &twr_font_ubuntu_28_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &twr_font_ubuntu_28_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &twr_font_ubuntu_28_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &twr_font_ubuntu_28_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &twr_font_ubuntu_28_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &twr_font_ubuntu_28_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &twr_font_ubuntu_28_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &twr_font_ubuntu_28_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &twr_font_ubuntu_28_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &twr_font_ubuntu_28_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &twr_font_ubuntu_28_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &twr_font_ubuntu_28_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &twr_font_ubuntu_28_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &twr_font_ubuntu_28_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &twr_font_ubuntu_28_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &twr_font_ubuntu_28_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &twr_font_ubuntu_28_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &twr_font_ubuntu_28_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &twr_font_ubuntu_28_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &twr_font_ubuntu_28_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &twr_font_ubuntu_28_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &twr_font_ubuntu_28_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &twr_font_ubuntu_28_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &twr_font_ubuntu_28_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &twr_font_ubuntu_28_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &twr_font_ubuntu_28_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &twr_font_ubuntu_28_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &twr_font_ubuntu_28_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &twr_font_ubuntu_28_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &twr_font_ubuntu_28_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &twr_font_ubuntu_28_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &twr_font_ubuntu_28_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &twr_font_ubuntu_28_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &twr_font_ubuntu_28_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &twr_font_ubuntu_28_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &twr_font_ubuntu_28_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &twr_font_ubuntu_28_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &twr_font_ubuntu_28_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &twr_font_ubuntu_28_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &twr_font_ubuntu_28_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &twr_font_ubuntu_28_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &twr_font_ubuntu_28_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &twr_font_ubuntu_28_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &twr_font_ubuntu_28_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &twr_font_ubuntu_28_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &twr_font_ubuntu_28_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &twr_font_ubuntu_28_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &twr_font_ubuntu_28_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &twr_font_ubuntu_28_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &twr_font_ubuntu_28_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &twr_font_ubuntu_28_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &twr_font_ubuntu_28_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &twr_font_ubuntu_28_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &twr_font_ubuntu_28_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &twr_font_ubuntu_28_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &twr_font_ubuntu_28_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &twr_font_ubuntu_28_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &twr_font_ubuntu_28_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &twr_font_ubuntu_28_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &twr_font_ubuntu_28_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &twr_font_ubuntu_28_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &twr_font_ubuntu_28_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &twr_font_ubuntu_28_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &twr_font_ubuntu_28_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &twr_font_ubuntu_28_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &twr_font_ubuntu_28_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &twr_font_ubuntu_28_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &twr_font_ubuntu_28_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &twr_font_ubuntu_28_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &twr_font_ubuntu_28_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &twr_font_ubuntu_28_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &twr_font_ubuntu_28_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &twr_font_ubuntu_28_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &twr_font_ubuntu_28_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &twr_font_ubuntu_28_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &twr_font_ubuntu_28_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &twr_font_ubuntu_28_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &twr_font_ubuntu_28_0x}
-#endif
-
-};
-
-
-const twr_font_t twr_font_ubuntu_28 = { 110, twr_font_ubuntu_28_array };
+static const uint8_t twr_font_ubuntu_28_bitmaps[5633] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x39, 0xc3, 0x9c, 0x39, 0xc3, 0x9c, 0x39, 0xc3, 0x9c, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xc1, 0xc0, 0x38, 0x38, 0x0e, 0x0e, 0x01, 0xc1, 0xc0, 0x38, 0x38, 0x7f, 0xff,
+    0xcf, 0xff, 0xf8, 0x38, 0x38, 0x07, 0x07, 0x00, 0xe0, 0xe0, 0x1c, 0x1c, 0x03, 0x83, 0x83, 0xff,
+    0xfe, 0x7f, 0xff, 0xc3, 0x83, 0x80, 0x70, 0x70, 0x0e, 0x0e, 0x03, 0x83, 0x80, 0x70, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+    0x18, 0x00, 0x18, 0x00, 0x7f, 0x00, 0xff, 0x81, 0xc0, 0x83, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0xc0, 0x01, 0xe0, 0x01, 0xf8, 0x00, 0x7e, 0x00, 0x1f, 0x80, 0x03, 0x80, 0x01, 0xc0, 0x01, 0xc0,
+    0x01, 0xc0, 0x01, 0xc3, 0x03, 0x83, 0xff, 0x80, 0xfe, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
+    0x0e, 0x03, 0xf8, 0x0c, 0x07, 0x1c, 0x18, 0x06, 0x0c, 0x18, 0x06, 0x0c, 0x30, 0x06, 0x0c, 0x70,
+    0x06, 0x0c, 0x60, 0x07, 0x1c, 0xc0, 0x03, 0xf8, 0xc0, 0x01, 0xf1, 0x8f, 0x80, 0x03, 0x1f, 0xc0,
+    0x03, 0x38, 0xe0, 0x06, 0x30, 0x60, 0x0e, 0x30, 0x60, 0x0c, 0x30, 0x60, 0x18, 0x30, 0x60, 0x18,
+    0x38, 0xe0, 0x30, 0x1f, 0xc0, 0x70, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1f, 0x00, 0x0f, 0xf0, 0x01, 0xcf, 0x00, 0x70, 0xe0, 0x0e, 0x1c, 0x01, 0xc3, 0x80, 0x38,
+    0xe0, 0x03, 0xbc, 0x00, 0x3e, 0x00, 0x0f, 0x80, 0x03, 0xb8, 0x30, 0xe3, 0x86, 0x38, 0x39, 0x87,
+    0x03, 0xf0, 0xe0, 0x3c, 0x1c, 0x03, 0x81, 0xe1, 0xf8, 0x1f, 0xf3, 0x81, 0xfc, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x70, 0xe1, 0xc3,
+    0x87, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1c, 0x1c, 0x0e, 0x0e, 0x07, 0x07, 0x03, 0x81, 0xc1, 0xc0,
+    0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0x70, 0x38, 0x1c, 0x07, 0x03, 0x80, 0xe0,
+    0x70, 0x1c, 0x04, 0x00, 0x40, 0x70, 0x1c, 0x0e, 0x03, 0x81, 0xc0, 0x70, 0x38, 0x1c, 0x07, 0x03,
+    0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x07, 0x03, 0x81, 0xc1, 0xc0, 0xe0, 0xe0, 0x70,
+    0x70, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x08, 0xc8, 0xf5,
+    0xe3, 0xfe, 0x03, 0x80, 0x36, 0x03, 0xb8, 0x38, 0xe0, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x3f, 0xfc, 0x3f, 0xfc, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc3, 0x87, 0x0e, 0x18, 0x70, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0x9f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x61, 0xe3, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x80, 0x30, 0x06, 0x01,
+    0x80, 0x30, 0x06, 0x01, 0x80, 0x30, 0x0e, 0x01, 0x80, 0x30, 0x0c, 0x01, 0x80, 0x30, 0x0c, 0x01,
+    0x80, 0x70, 0x0c, 0x01, 0x80, 0x60, 0x0c, 0x01, 0x80, 0x60, 0x0c, 0x01, 0x80, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x0f, 0xf0, 0x1c, 0x38, 0x38, 0x1c, 0x38, 0x1c,
+    0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e,
+    0x70, 0x0e, 0x38, 0x1c, 0x38, 0x1c, 0x1c, 0x38, 0x0f, 0xf0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
+    0x01, 0xe0, 0x03, 0xe0, 0x0f, 0xe0, 0x1e, 0xe0, 0x08, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+    0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+    0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0xf0, 0x38, 0x70, 0x10, 0x38, 0x00, 0x38,
+    0x00, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00,
+    0x0e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0,
+    0x3f, 0xf0, 0x10, 0x70, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xf0, 0x07, 0xe0,
+    0x07, 0xe0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3c, 0x30, 0x78,
+    0x3f, 0xf0, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xf8, 0x01, 0xf8, 0x03, 0xb8,
+    0x07, 0x38, 0x06, 0x38, 0x0e, 0x38, 0x1c, 0x38, 0x18, 0x38, 0x38, 0x38, 0x70, 0x38, 0x7f, 0xfe,
+    0x7f, 0xfe, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8,
+    0x0f, 0xf8, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x1f, 0xc0, 0x1f, 0xf0,
+    0x00, 0xf8, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3c, 0x30, 0x78,
+    0x3f, 0xf0, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x01, 0xfc, 0x03, 0xc0, 0x07, 0x00, 0x0e, 0x00,
+    0x1c, 0x00, 0x1c, 0x00, 0x3b, 0xf0, 0x3f, 0xf8, 0x3c, 0x1c, 0x38, 0x1e, 0x38, 0x0e, 0x38, 0x0e,
+    0x38, 0x0e, 0x38, 0x0e, 0x1c, 0x1c, 0x1e, 0x3c, 0x0f, 0xf8, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc,
+    0x3f, 0xfc, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xc0,
+    0x01, 0xc0, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x0f, 0xf0, 0x1c, 0x38, 0x38, 0x1c, 0x38, 0x1c,
+    0x38, 0x1c, 0x3c, 0x1c, 0x1e, 0x38, 0x0f, 0xf0, 0x07, 0xe0, 0x0d, 0xf0, 0x1c, 0x78, 0x38, 0x3c,
+    0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x1c, 0x38, 0x1f, 0xf8, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
+    0x1f, 0xf0, 0x3c, 0x78, 0x38, 0x38, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c,
+    0x38, 0x3c, 0x1f, 0xfc, 0x0f, 0xdc, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0xf0, 0x03, 0xe0,
+    0x3f, 0x80, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3c, 0x78, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x61, 0xe3, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x87,
+    0x8f, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x70, 0xe1, 0x87, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x1e, 0x00, 0xf8, 0x03, 0xe0, 0x0f, 0x80, 0x7c, 0x00, 0x70, 0x00, 0x7c, 0x00, 0x0f,
+    0x80, 0x03, 0xe0, 0x00, 0xf8, 0x00, 0x1e, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0x3f,
+    0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0x3f, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x1c, 0x00, 0x78, 0x01,
+    0xe0, 0x07, 0x80, 0x1e, 0x00, 0x78, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xf8,
+    0x47, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x70, 0x1e, 0x03, 0x80, 0xe0, 0x1c, 0x03, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xff, 0xf0,
+    0x00, 0x7c, 0x0f, 0x00, 0x1e, 0x00, 0x70, 0x07, 0x00, 0x07, 0x01, 0xe1, 0xf8, 0x70, 0x38, 0x7f,
+    0x8e, 0x07, 0x1c, 0x70, 0xe1, 0xc3, 0x8e, 0x1c, 0x38, 0xe1, 0xc3, 0x87, 0x1c, 0x38, 0x70, 0xe3,
+    0x87, 0x0e, 0x1c, 0x70, 0xe1, 0xc3, 0x8e, 0x1c, 0x38, 0x71, 0xe3, 0x8e, 0x07, 0x1c, 0x73, 0xc0,
+    0xe1, 0xff, 0xf0, 0x1e, 0x1f, 0x7c, 0x01, 0xc0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x01, 0xf0, 0x00,
+    0x00, 0x1f, 0xfc, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1f, 0x00, 0x03, 0xe0, 0x00, 0xee, 0x00, 0x1d,
+    0xc0, 0x07, 0x1c, 0x00, 0xe3, 0x80, 0x1c, 0x70, 0x07, 0x07, 0x00, 0xe0, 0xe0, 0x38, 0x0e, 0x07,
+    0x01, 0xc0, 0xff, 0xf8, 0x3f, 0xff, 0x87, 0x00, 0x71, 0xc0, 0x07, 0x38, 0x00, 0xe7, 0x00, 0x1d,
+    0xc0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfc, 0x03, 0xff, 0xc0, 0xe0, 0x78, 0x38, 0x07,
+    0x0e, 0x01, 0xc3, 0x80, 0x70, 0xe0, 0x1c, 0x38, 0x1e, 0x0f, 0xff, 0x03, 0xff, 0xe0, 0xe0, 0x3c,
+    0x38, 0x07, 0x8e, 0x00, 0xe3, 0x80, 0x38, 0xe0, 0x0e, 0x38, 0x07, 0x8e, 0x03, 0xc3, 0xff, 0xe0,
+    0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x03, 0xff, 0x03, 0xc1, 0x83, 0x80, 0x03, 0x80,
+    0x01, 0xc0, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07,
+    0x00, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x1e, 0x06, 0x07, 0xff, 0x00, 0xfe, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xfe, 0x00, 0x3f, 0xfc, 0x03, 0x81, 0xe0, 0x38, 0x07, 0x03, 0x80, 0x38, 0x38,
+    0x03, 0x83, 0x80, 0x1c, 0x38, 0x01, 0xc3, 0x80, 0x1c, 0x38, 0x01, 0xc3, 0x80, 0x1c, 0x38, 0x01,
+    0xc3, 0x80, 0x1c, 0x38, 0x03, 0x83, 0x80, 0x38, 0x38, 0x07, 0x03, 0x81, 0xe0, 0x3f, 0xfc, 0x03,
+    0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x3f, 0xfc, 0x38, 0x00, 0x38, 0x00, 0x38,
+    0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3f, 0xf8, 0x3f, 0xf8, 0x38, 0x00, 0x38, 0x00, 0x38,
+    0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3f, 0xfe, 0x3f, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
+    0xe3, 0xff, 0xc7, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xff, 0xc3,
+    0xff, 0x87, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x03, 0xff, 0x80, 0xf0, 0x20, 0x38, 0x00, 0x0e, 0x00,
+    0x01, 0xc0, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x70, 0xe0,
+    0x0e, 0x1c, 0x01, 0xc1, 0xc0, 0x38, 0x38, 0x07, 0x03, 0x80, 0xe0, 0x7c, 0x1c, 0x03, 0xff, 0x80,
+    0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x1c, 0x38, 0x01, 0xc3, 0x80, 0x1c, 0x38,
+    0x01, 0xc3, 0x80, 0x1c, 0x38, 0x01, 0xc3, 0x80, 0x1c, 0x38, 0x01, 0xc3, 0xff, 0xfc, 0x3f, 0xff,
+    0xc3, 0x80, 0x1c, 0x38, 0x01, 0xc3, 0x80, 0x1c, 0x38, 0x01, 0xc3, 0x80, 0x1c, 0x38, 0x01, 0xc3,
+    0x80, 0x1c, 0x38, 0x01, 0xc3, 0x80, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x70, 0xe1,
+    0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x70, 0xe1, 0xc3, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x07, 0x00, 0x1c, 0x00, 0x70, 0x01, 0xc0, 0x07, 0x00, 0x1c,
+    0x00, 0x70, 0x01, 0xc0, 0x07, 0x00, 0x1c, 0x00, 0x70, 0x01, 0xc0, 0x07, 0x00, 0x1c, 0x00, 0xf1,
+    0x87, 0x8f, 0xfc, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0xc3, 0x80, 0xe0, 0xe0, 0x70, 0x38, 0x38, 0x0e,
+    0x1c, 0x03, 0x8e, 0x00, 0xe7, 0x00, 0x3b, 0x80, 0x0f, 0xc0, 0x03, 0xf8, 0x00, 0xef, 0x00, 0x39,
+    0xe0, 0x0e, 0x3e, 0x03, 0x83, 0xc0, 0xe0, 0x78, 0x38, 0x1e, 0x0e, 0x03, 0xc3, 0x80, 0x78, 0xe0,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07,
+    0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00,
+    0x0e, 0x00, 0x1c, 0x00, 0x3f, 0xfe, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x81,
+    0xe0, 0x03, 0xc0, 0xf0, 0x01, 0xe0, 0x7c, 0x01, 0xf0, 0x3f, 0x00, 0xf8, 0x1d, 0x80, 0xdc, 0x0c,
+    0xe0, 0x66, 0x0e, 0x30, 0x63, 0x07, 0x18, 0x31, 0xc3, 0x8e, 0x38, 0xe1, 0xc3, 0x18, 0x70, 0xe1,
+    0xdc, 0x38, 0x70, 0x6c, 0x1c, 0x38, 0x3e, 0x0e, 0x1c, 0x1f, 0x07, 0x0e, 0x07, 0x03, 0x87, 0x00,
+    0x01, 0xc3, 0x80, 0x00, 0xe1, 0xc0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x01, 0xc3, 0xc0, 0x1c, 0x3e, 0x01, 0xc3, 0xf0, 0x1c, 0x3f, 0x81, 0xc3, 0xb8,
+    0x1c, 0x39, 0xc1, 0xc3, 0x8e, 0x1c, 0x38, 0x61, 0xc3, 0x87, 0x1c, 0x38, 0x39, 0xc3, 0x81, 0x9c,
+    0x38, 0x1d, 0xc3, 0x80, 0xfc, 0x38, 0x07, 0xc3, 0x80, 0x7c, 0x38, 0x03, 0xc3, 0x80, 0x1c, 0x38,
+    0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x3f, 0xf0, 0x01, 0xe1,
+    0xe0, 0x0e, 0x01, 0xc0, 0x70, 0x03, 0x81, 0xc0, 0x0e, 0x0e, 0x00, 0x1c, 0x38, 0x00, 0x70, 0xe0,
+    0x01, 0xc3, 0x80, 0x07, 0x0e, 0x00, 0x1c, 0x38, 0x00, 0x70, 0xe0, 0x01, 0xc1, 0xc0, 0x0e, 0x07,
+    0x00, 0x38, 0x0e, 0x01, 0xc0, 0x1e, 0x1e, 0x00, 0x3f, 0xf0, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x3f, 0xfc, 0x1c, 0x0f, 0x0e, 0x03, 0x87, 0x00, 0xe3, 0x80,
+    0x71, 0xc0, 0x38, 0xe0, 0x1c, 0x70, 0x1e, 0x38, 0x1e, 0x1f, 0xfe, 0x0f, 0xfc, 0x07, 0x00, 0x03,
+    0x80, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x03, 0xff, 0x00, 0x1e, 0x1e, 0x00, 0xe0, 0x1c, 0x07, 0x00, 0x38, 0x1c,
+    0x00, 0xe0, 0xe0, 0x01, 0xc3, 0x80, 0x07, 0x0e, 0x00, 0x1c, 0x38, 0x00, 0x70, 0xe0, 0x01, 0xc3,
+    0x80, 0x07, 0x0e, 0x00, 0x1c, 0x1c, 0x00, 0xe0, 0x70, 0x03, 0x80, 0xe0, 0x1c, 0x03, 0xe1, 0xe0,
+    0x03, 0xff, 0x00, 0x03, 0xf0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f,
+    0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x3f,
+    0xfc, 0x0e, 0x07, 0x83, 0x80, 0xe0, 0xe0, 0x1c, 0x38, 0x07, 0x0e, 0x01, 0xc3, 0x80, 0x70, 0xe0,
+    0x3c, 0x38, 0x1e, 0x0f, 0xff, 0x03, 0xff, 0x00, 0xe1, 0xe0, 0x38, 0x3c, 0x0e, 0x07, 0x83, 0x80,
+    0xe0, 0xe0, 0x3c, 0x38, 0x07, 0x8e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x01, 0xff, 0x87, 0x02,
+    0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xf0, 0x00, 0xf8, 0x00, 0xfe, 0x00, 0xff, 0x00, 0x3f, 0x00,
+    0x0f, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x73, 0x81, 0xc7, 0xff, 0x03, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
+    0xff, 0xff, 0xfe, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0,
+    0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03,
+    0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x01, 0xc3, 0x80, 0x38, 0x70, 0x07, 0x0e, 0x00, 0xe1, 0xc0,
+    0x1c, 0x38, 0x03, 0x87, 0x00, 0x70, 0xe0, 0x0e, 0x1c, 0x01, 0xc3, 0x80, 0x38, 0x70, 0x07, 0x0e,
+    0x00, 0xe1, 0xc0, 0x1c, 0x38, 0x03, 0x87, 0x00, 0x70, 0x70, 0x1c, 0x0f, 0x07, 0x80, 0xff, 0xe0,
+    0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x70, 0x01, 0xce, 0x00, 0x39, 0xc0,
+    0x07, 0x1c, 0x01, 0xc3, 0x80, 0x38, 0x78, 0x0f, 0x07, 0x01, 0xc0, 0xe0, 0x38, 0x0e, 0x0e, 0x01,
+    0xc1, 0xc0, 0x1c, 0x70, 0x03, 0x8e, 0x00, 0x7b, 0xc0, 0x07, 0x70, 0x00, 0xfe, 0x00, 0x0f, 0x80,
+    0x01, 0xf0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+    0xe7, 0x00, 0x00, 0x1c, 0xf0, 0x1c, 0x07, 0x8e, 0x03, 0xc0, 0xe1, 0xc0, 0xf8, 0x1c, 0x38, 0x1f,
+    0x03, 0x87, 0x03, 0x60, 0x70, 0xf0, 0xee, 0x1e, 0x0e, 0x1d, 0xc3, 0x81, 0xc3, 0x38, 0x70, 0x38,
+    0xe3, 0x8e, 0x07, 0x1c, 0x71, 0xc0, 0xf3, 0x0e, 0x78, 0x0e, 0xe0, 0xee, 0x01, 0xdc, 0x1d, 0xc0,
+    0x3b, 0x03, 0xb8, 0x07, 0xe0, 0x3f, 0x00, 0x7c, 0x07, 0xc0, 0x0f, 0x00, 0xf8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0xe3, 0x80, 0x70, 0x70, 0x38, 0x1c,
+    0x0e, 0x03, 0x87, 0x00, 0x73, 0x80, 0x1c, 0xe0, 0x03, 0xf0, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x07,
+    0x80, 0x03, 0xf0, 0x01, 0xce, 0x00, 0x73, 0x80, 0x38, 0x70, 0x1c, 0x0e, 0x0f, 0x03, 0xc3, 0x80,
+    0x71, 0xc0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x07, 0x70, 0x07, 0x38, 0x03, 0x8e, 0x03, 0x83,
+    0x83, 0x81, 0xc1, 0xc0, 0x71, 0xc0, 0x1d, 0xc0, 0x0e, 0xe0, 0x03, 0xe0, 0x00, 0xe0, 0x00, 0x70,
+    0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xc0, 0x00, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0xfe, 0x3f, 0xfe, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70,
+    0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+    0x1c, 0x00, 0x38, 0x00, 0x7f, 0xfe, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0x8f, 0xc7, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07,
+    0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c,
+    0x0f, 0xc7, 0xe0, 0x08, 0x01, 0x80, 0x30, 0x06, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x18, 0x03, 0x00,
+    0x70, 0x06, 0x00, 0xc0, 0x0c, 0x01, 0x80, 0x30, 0x03, 0x00, 0x60, 0x0e, 0x00, 0xc0, 0x18, 0x01,
+    0x80, 0x30, 0x06, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x18, 0x00, 0xfc, 0x7e, 0x07, 0x03, 0x81, 0xc0,
+    0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03,
+    0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x7e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0xee, 0x00, 0xee, 0x01, 0xc7, 0x01, 0xc7, 0x03, 0x83, 0x83,
+    0x01, 0x87, 0x01, 0xc2, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff,
+    0xfc, 0x00, 0x00, 0x00, 0x20, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x1f, 0xf0, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0,
+    0x03, 0x81, 0xff, 0x0f, 0xfe, 0x3c, 0x1c, 0x70, 0x38, 0xe0, 0x71, 0xc0, 0xe3, 0xc1, 0xc3, 0xff,
+    0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0xbe, 0x03, 0xff, 0x83,
+    0xc3, 0xc3, 0x81, 0xc3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xe3,
+    0x81, 0xe3, 0x81, 0xc3, 0x83, 0x83, 0xff, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0xff, 0x0e, 0x00, 0xe0, 0x07, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07,
+    0x00, 0x3c, 0x00, 0xe0, 0x07, 0x82, 0x1f, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+    0x1c, 0x07, 0xdc, 0x1f, 0xfc, 0x3c, 0x3c, 0x38, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
+    0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x38, 0x1c, 0x1c, 0x1c, 0x0f, 0xfc, 0x07, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x0f, 0xf8, 0x1c, 0x3c, 0x38,
+    0x1c, 0x30, 0x0e, 0x70, 0x0e, 0x7f, 0xfe, 0x7f, 0xfe, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x38,
+    0x00, 0x1e, 0x04, 0x0f, 0xfc, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xe3, 0xfc, 0x70, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xfe, 0x3f, 0xc7,
+    0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0xff, 0xc3, 0xc1, 0xc3, 0x81, 0xc7,
+    0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc3, 0x81, 0xc3, 0xc3, 0xc1,
+    0xff, 0xc0, 0x7d, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x03, 0xc2, 0x07, 0x83, 0xff, 0x01, 0xfc, 0x00,
+    0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0xfe, 0x03, 0xff, 0x03, 0x83, 0x83, 0x83, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3,
+    0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x00, 0x00, 0x00, 0x01,
+    0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x70, 0xe1, 0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xe0, 0x00, 0x00, 0x00, 0x1c, 0x38, 0x70, 0xe1, 0xc3, 0x87, 0x0e, 0x1c,
+    0x38, 0x70, 0xe1, 0xc3, 0x87, 0x0e, 0x1c, 0x71, 0xe3, 0x00, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00,
+    0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc1, 0xe3, 0x83, 0x87, 0x0e, 0x0e, 0x38, 0x1c,
+    0xe0, 0x3b, 0x80, 0x7e, 0x00, 0xfe, 0x01, 0xde, 0x03, 0x9e, 0x07, 0x1e, 0x0e, 0x1e, 0x1c, 0x1c,
+    0x38, 0x3c, 0x70, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x3c, 0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3f, 0xc7, 0xe0, 0x3f, 0xff, 0xfc, 0x1c, 0x1e, 0x0e, 0x0e, 0x07, 0x03, 0x87, 0x03, 0x81,
+    0xc3, 0x81, 0xc0, 0xe1, 0xc0, 0xe0, 0x70, 0xe0, 0x70, 0x38, 0x70, 0x38, 0x1c, 0x38, 0x1c, 0x0e,
+    0x1c, 0x0e, 0x07, 0x0e, 0x07, 0x03, 0x87, 0x03, 0x81, 0xc3, 0x81, 0xc0, 0xe1, 0xc0, 0xe0, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xfe, 0x03, 0xff, 0x03, 0x83, 0x83, 0x83, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81,
+    0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xff, 0x80, 0xe0, 0xe0,
+    0xe0, 0x38, 0x70, 0x1c, 0x70, 0x07, 0x38, 0x03, 0x9c, 0x01, 0xce, 0x00, 0xe7, 0x00, 0x71, 0xc0,
+    0x70, 0xe0, 0x38, 0x38, 0x38, 0x0f, 0xf8, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x3f, 0xf0, 0x38, 0x38, 0x38, 0x1c, 0x38, 0x1e, 0x38, 0x0e,
+    0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x1c, 0x3c, 0x3c, 0x3f, 0xf8,
+    0x3b, 0xe0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x0f, 0xfc,
+    0x1c, 0x1c, 0x38, 0x1c, 0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
+    0x70, 0x1c, 0x38, 0x1c, 0x3c, 0x3c, 0x1f, 0xfc, 0x07, 0xdc, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
+    0x00, 0x1c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x3f, 0xe7, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0,
+    0x1c, 0x03, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc3, 0xfc, 0x78, 0x47, 0x00, 0x70, 0x07, 0x80,
+    0x7e, 0x03, 0xfc, 0x07, 0xe0, 0x1e, 0x00, 0xe0, 0x0e, 0x41, 0xe7, 0xfc, 0x3f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0,
+    0x1f, 0xc3, 0xf8, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e,
+    0x01, 0xe2, 0x1f, 0xc1, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+    0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38,
+    0x1c, 0x3c, 0x1c, 0x1c, 0x1c, 0x0f, 0xfc, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x07, 0xe0, 0x3b, 0x83, 0x9c, 0x1c, 0xe0, 0xe3, 0x8e, 0x1c, 0x70, 0xe3, 0x83, 0xb8, 0x1d,
+    0xc0, 0xfe, 0x03, 0xe0, 0x1f, 0x00, 0xf8, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xe0, 0x7e, 0x07, 0x03, 0xb0, 0x38, 0x19, 0xc3, 0xe1, 0xce,
+    0x1f, 0x0e, 0x70, 0xd8, 0x71, 0x8e, 0xe3, 0x0c, 0x77, 0x18, 0x73, 0x19, 0xc3, 0xb8, 0xee, 0x0d,
+    0xc7, 0x60, 0x6c, 0x1b, 0x03, 0xe0, 0xf8, 0x0f, 0x07, 0x80, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0e, 0x70, 0x70, 0xe3, 0x83, 0x8e, 0x07,
+    0x70, 0x0f, 0x80, 0x1c, 0x00, 0x70, 0x03, 0xe0, 0x0f, 0x80, 0x77, 0x03, 0x8e, 0x0e, 0x38, 0x70,
+    0x73, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0e, 0xe0, 0x39, 0xc1, 0xc7, 0x07,
+    0x1c, 0x1c, 0x38, 0xe0, 0xe3, 0x83, 0x8e, 0x07, 0x70, 0x1d, 0xc0, 0x77, 0x01, 0xd8, 0x03, 0xe0,
+    0x0f, 0x80, 0x3c, 0x00, 0xf0, 0x03, 0xc0, 0x0e, 0x03, 0xf0, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x7f, 0xf0, 0x03, 0x80, 0x38,
+    0x03, 0x80, 0x38, 0x03, 0x80, 0x1c, 0x01, 0xc0, 0x1c, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x07, 0xff,
+    0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x1f, 0x0f, 0x03,
+    0x80, 0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x07, 0x87, 0xc1, 0xe0, 0x1c, 0x03, 0x80,
+    0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0x80, 0xf0, 0x1f, 0x01, 0xc0, 0x01, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x0e, 0x07, 0x81, 0xe0, 0x70, 0x38,
+    0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x78, 0x1f, 0x07, 0x87, 0x07, 0x03, 0x81, 0xc0, 0xe0,
+    0x70, 0x38, 0x1c, 0x0e, 0x07, 0x07, 0x87, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1e, 0x0c, 0x3f, 0x9c, 0x73, 0xf8, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x0f, 0x8c, 0x66, 0x33, 0x18, 0xf8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x03, 0xb8, 0x1f, 0x00, 0xe0, 0x04, 0x00, 0x00, 0x0f, 0xc3, 0xfc, 0x78,
+    0x47, 0x00, 0x70, 0x07, 0x80, 0x7e, 0x03, 0xfc, 0x07, 0xe0, 0x1e, 0x00, 0xe0, 0x0e, 0x41, 0xe7,
+    0xfc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x0e, 0x61,
+    0xcc, 0x39, 0x07, 0x00, 0xe0, 0x1f, 0xc3, 0xf8, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0,
+    0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xe2, 0x1f, 0xc1, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x07, 0x70, 0x1f, 0x00, 0x70, 0x01, 0x00, 0x00, 0x0f, 0xfe, 0x7f,
+    0xf0, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x1c, 0x01, 0xc0, 0x1c, 0x00, 0xe0, 0x0e,
+    0x00, 0xe0, 0x07, 0xff, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xff,
+    0x00, 0x0e, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x1f, 0xf0, 0xff, 0xe3, 0xc1, 0xc7, 0x03, 0x8e,
+    0x07, 0x1c, 0x0e, 0x3c, 0x1c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x03, 0xb8, 0x0f, 0x80, 0x38, 0x00, 0x80, 0x00, 0x00,
+    0xfc, 0x0f, 0xf0, 0xe0, 0x0e, 0x00, 0x70, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03,
+    0xc0, 0x0e, 0x00, 0x78, 0x21, 0xff, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x3e, 0x00, 0xff, 0x81, 0xc3, 0xc3, 0x81, 0xc3, 0x00, 0xe7, 0x00, 0xe7, 0xff, 0xe7, 0xff, 0xe7,
+    0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0x80, 0x01, 0xe0, 0x40, 0xff, 0xc0, 0x3f, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x77, 0x00, 0x3e, 0x00,
+    0x1c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0xff, 0x81, 0xc3, 0xc3, 0x81, 0xc3,
+    0x00, 0xe7, 0x00, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0x80, 0x01,
+    0xe0, 0x40, 0xff, 0xc0, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x83, 0x8e, 0x38, 0x20, 0x01, 0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x70, 0xe1, 0xc3,
+    0x87, 0x0e, 0x1c, 0x38, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x01, 0xc7, 0x00,
+    0x1c, 0x70, 0x01, 0xc7, 0x00, 0x1c, 0x60, 0x01, 0xc6, 0x00, 0x1c, 0x00, 0x7d, 0xc0, 0x1f, 0xfc,
+    0x03, 0xc3, 0xc0, 0x38, 0x1c, 0x07, 0x01, 0xc0, 0x70, 0x1c, 0x07, 0x01, 0xc0, 0x70, 0x1c, 0x07,
+    0x01, 0xc0, 0x70, 0x1c, 0x07, 0x81, 0xc0, 0x38, 0x1c, 0x01, 0xc1, 0xc0, 0x0f, 0xfc, 0x00, 0x7f,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x40, 0x0e, 0xe0, 0x07, 0xc0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x1f, 0xe0,
+    0x3f, 0xf0, 0x38, 0x38, 0x38, 0x3c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c,
+    0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x77, 0x07, 0xc0, 0x70, 0x04,
+    0x00, 0x00, 0x7f, 0x3f, 0xe7, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07,
+    0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c,
+    0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x7c, 0x00, 0x00, 0x03, 0x81, 0xc3, 0x81,
+    0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81,
+    0xc3, 0x81, 0xc3, 0xc1, 0xc1, 0xc1, 0xc0, 0xff, 0xc0, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38,
+    0x00, 0x10, 0x00, 0x00, 0x03, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81,
+    0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0x81, 0xc3, 0xc1, 0xc1, 0xc1, 0xc0, 0xff,
+    0xc0, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x00, 0x80, 0x00, 0x03, 0x80, 0xee, 0x03, 0x9c, 0x1c,
+    0x70, 0x71, 0xc1, 0xc3, 0x8e, 0x0e, 0x38, 0x38, 0xe0, 0x77, 0x01, 0xdc, 0x07, 0x70, 0x1d, 0x80,
+    0x3e, 0x00, 0xf8, 0x03, 0xc0, 0x0f, 0x00, 0x3c, 0x00, 0xe0, 0x3f, 0x00, 0xf8, 0x00, 0x00, 0x00,
+    0x00
+};
+
+static const twr_font_glyph_t twr_font_ubuntu_28_glyphs[110] = {
+    {0x20, 6, 28, 0},
+    {0x21, 8, 28, 168},
+    {0x22, 12, 28, 392},
+    {0x23, 19, 28, 728},
+    {0x24, 16, 28, 1260},
+    {0x25, 24, 28, 1708},
+    {0x26, 19, 28, 2380},
+    {0x27, 7, 28, 2912},
+    {0x28, 9, 28, 3108},
+    {0x29, 9, 28, 3360},
+    {0x2a, 13, 28, 3612},
+    {0x2b, 16, 28, 3976},
+    {0x2c, 7, 28, 4424},
+    {0x2d, 9, 28, 4620},
+    {0x2e, 7, 28, 4872},
+    {0x2f, 11, 28, 5068},
+    {0x30, 16, 28, 5376},
+    {0x31, 16, 28, 5824},
+    {0x32, 16, 28, 6272},
+    {0x33, 16, 28, 6720},
+    {0x34, 16, 28, 7168},
+    {0x35, 16, 28, 7616},
+    {0x36, 16, 28, 8064},
+    {0x37, 16, 28, 8512},
+    {0x38, 16, 28, 8960},
+    {0x39, 16, 28, 9408},
+    {0x3a, 7, 28, 9856},
+    {0x3b, 7, 28, 10052},
+    {0x3c, 16, 28, 10248},
+    {0x3d, 16, 28, 10696},
+    {0x3e, 16, 28, 11144},
+    {0x3f, 11, 28, 11592},
+    {0x40, 27, 28, 11900},
+    {0x41, 19, 28, 12656},
+    {0x42, 18, 28, 13188},
+    {0x43, 17, 28, 13692},
+    {0x44, 20, 28, 14168},
+    {0x45, 16, 28, 14728},
+    {0x46, 15, 28, 15176},
+    {0x47, 19, 28, 15596},
+    {0x48, 20, 28, 16128},
+    {0x49, 7, 28, 16688},
+    {0x4a, 14, 28, 16884},
+    {0x4b, 18, 28, 17276},
+    {0x4c, 15, 28, 17780},
+    {0x4d, 25, 28, 18200},
+    {0x4e, 20, 28, 18900},
+    {0x4f, 22, 28, 19460},
+    {0x50, 17, 28, 20076},
+    {0x51, 22, 28, 20552},
+    {0x52, 18, 28, 21168},
+    {0x53, 15, 28, 21672},
+    {0x54, 15, 28, 22092},
+    {0x55, 19, 28, 22512},
+    {0x56, 19, 28, 23044},
+    {0x57, 27, 28, 23576},
+    {0x58, 18, 28, 24332},
+    {0x59, 17, 28, 24836},
+    {0x5a, 16, 28, 25312},
+    {0x5b, 9, 28, 25760},
+    {0x5c, 11, 28, 26012},
+    {0x5d, 9, 28, 26320},
+    {0x5e, 16, 28, 26572},
+    {0x5f, 14, 28, 27020},
+    {0x60, 11, 28, 27412},
+    {0x61, 15, 28, 27720},
+    {0x62, 16, 28, 28140},
+    {0x63, 13, 28, 28588},
+    {0x64, 16, 28, 28952},
+    {0x65, 16, 28, 29400},
+    {0x66, 11, 28, 29848},
+    {0x67, 16, 28, 30156},
+    {0x68, 16, 28, 30604},
+    {0x69, 7, 28, 31052},
+    {0x6a, 7, 28, 31248},
+    {0x6b, 15, 28, 31444},
+    {0x6c, 8, 28, 31864},
+    {0x6d, 25, 28, 32088},
+    {0x6e, 16, 28, 32788},
+    {0x6f, 17, 28, 33236},
+    {0x70, 16, 28, 33712},
+    {0x71, 16, 28, 34160},
+    {0x72, 11, 28, 34608},
+    {0x73, 12, 28, 34916},
+    {0x74, 11, 28, 35252},
+    {0x75, 16, 28, 35560},
+    {0x76, 13, 28, 36008},
+    {0x77, 21, 28, 36372},
+    {0x78, 14, 28, 36960},
+    {0x79, 14, 28, 37352},
+    {0x7a, 13, 28, 37744},
+    {0x7b, 10, 28, 38108},
+    {0x7c, 8, 28, 38388},
+    {0x7d, 9, 28, 38612},
+    {0x7e, 16, 28, 38864},
+    {0xb0, 9, 28, 39312},
+    {0xb9, 12, 28, 39564},
+    {0xbb, 11, 28, 39900},
+    {0xbe, 13, 28, 40208},
+    {0xe1, 15, 28, 40572},
+    {0xe8, 13, 28, 40992},
+    {0xe9, 16, 28, 41356},
+    {0xec, 16, 28, 41804},
+    {0xed, 7, 28, 42252},
+    {0xef, 20, 28, 42448},
+    {0xf2, 16, 28, 43008},
+    {0xf8, 11, 28, 43456},
+    {0xf9, 16, 28, 43764},
+    {0xfa, 16, 28, 44212},
+    {0xfd, 14, 28, 44660}
+};
+
+static const uint8_t twr_font_ubuntu_28_index[222] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d
+};
+
+const twr_font_t twr_font_ubuntu_28 = { 110, NULL, 0x20, 222, twr_font_ubuntu_28_index, twr_font_ubuntu_28_glyphs, twr_font_ubuntu_28_bitmaps };
@@ -1,5319 +1,613 @@
-
-/*******************************************************************************
-* font
-* filename: C:/Users/mhubacek/Documents/Dev/BigClown/github/bc-lcd-fonts/sdk/fonts/twr_font_ubuntu33.xml
-* name: twr_font_ubuntu_33
-* family: Ubuntu
-* size: 32
-* style: Normal
-* included characters:  !"#$%&'()*+,-./0123456789:;<=>?\x0040ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~°ěščřžýáíéúůťďň
-* antialiasing: no
-* type: proportional
-* encoding: ISO-8859-2
-* unicode bom: no
-*
-* preset name: HARDWARIO LCD Module
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Diffuse Dither 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
+// Generated by twr_font_compile.py from bc_font_ubuntu33.xml, do not edit
 
 #include <twr_font_common.h>
 
-
-
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x20[33] = {
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe,
-    0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x20 = { image_data_twr_font_ubuntu_33_0x20,
-    7, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x21[66] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xf7, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xc1, 0x80,
-    0xc1, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x21 = { image_data_twr_font_ubuntu_33_0x21,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x22[66] = {
-    0xff, 0xf8,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xc7, 0x18,
-    0xef, 0xb8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x22 = { image_data_twr_font_ubuntu_33_0x22,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x23[99] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0x1c, 0x78,
-    0xff, 0x1c, 0x78,
-    0xff, 0x1c, 0x78,
-    0xfe, 0x38, 0xf8,
-    0xfe, 0x38, 0xf8,
-    0xfe, 0x38, 0xf8,
-    0xc0, 0x00, 0x18,
-    0xc0, 0x00, 0x18,
-    0xc0, 0x00, 0x18,
-    0xfc, 0x71, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xc0, 0x00, 0x18,
-    0xc0, 0x00, 0x18,
-    0xc0, 0x00, 0x18,
-    0xf8, 0xe3, 0xf8,
-    0xf8, 0xe3, 0xf8,
-    0xf8, 0xe3, 0xf8,
-    0xf1, 0xc7, 0xf8,
-    0xf1, 0xc7, 0xf8,
-    0xf1, 0xc7, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x23 = { image_data_twr_font_ubuntu_33_0x23,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x24[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfc, 0x03, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xe0, 0x01, 0xc0,
-    0xc3, 0xfb, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc3, 0xff, 0xc0,
-    0xe0, 0x7f, 0xc0,
-    0xf0, 0x1f, 0xc0,
-    0xfc, 0x07, 0xc0,
-    0xff, 0x03, 0xc0,
-    0xff, 0xe1, 0xc0,
-    0xff, 0xf0, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xe7, 0xf0, 0xc0,
-    0xc0, 0x01, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xf0, 0x07, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x24 = { image_data_twr_font_ubuntu_33_0x24,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x25[132] = {
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xf8, 0x3f, 0xc7, 0xe0,
-    0xe0, 0x0f, 0x8f, 0xe0,
-    0xe3, 0x8f, 0x8f, 0xe0,
-    0xc7, 0xc7, 0x1f, 0xe0,
-    0xc7, 0xc7, 0x1f, 0xe0,
-    0xc7, 0xc6, 0x3f, 0xe0,
-    0xc7, 0xc4, 0x7f, 0xe0,
-    0xc7, 0xc4, 0x7f, 0xe0,
-    0xe3, 0x88, 0xff, 0xe0,
-    0xe0, 0x08, 0xff, 0xe0,
-    0xf8, 0x31, 0xff, 0xe0,
-    0xff, 0xf1, 0x83, 0xe0,
-    0xff, 0xe2, 0x00, 0xe0,
-    0xff, 0xe2, 0x38, 0xe0,
-    0xff, 0xc4, 0x7c, 0x60,
-    0xff, 0xc4, 0x7c, 0x60,
-    0xff, 0x8c, 0x7c, 0x60,
-    0xff, 0x1c, 0x7c, 0x60,
-    0xff, 0x1c, 0x7c, 0x60,
-    0xfe, 0x3e, 0x38, 0xe0,
-    0xfe, 0x3e, 0x00, 0xe0,
-    0xfc, 0x7f, 0x83, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x25 = { image_data_twr_font_ubuntu_33_0x25,
-    27, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x26[99] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xfc, 0x0f, 0xf8,
-    0xf8, 0x03, 0xf8,
-    0xf0, 0x03, 0xf8,
-    0xe1, 0xe1, 0xf8,
-    0xe3, 0xf1, 0xf8,
-    0xe3, 0xf1, 0xf8,
-    0xe3, 0xe1, 0xf8,
-    0xf3, 0x83, 0xf8,
-    0xf0, 0x07, 0xf8,
-    0xf8, 0x1f, 0xf8,
-    0xf0, 0x3f, 0xf8,
-    0xe0, 0x3f, 0x98,
-    0xc1, 0x1f, 0x18,
-    0xc7, 0x8f, 0x18,
-    0x8f, 0xc6, 0x38,
-    0x8f, 0xe0, 0x38,
-    0x8f, 0xf0, 0x78,
-    0x8f, 0xf8, 0xf8,
-    0xc3, 0xf0, 0x78,
-    0xc0, 0x00, 0x38,
-    0xe0, 0x07, 0x18,
-    0xf8, 0x1f, 0x88,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x26 = { image_data_twr_font_ubuntu_33_0x26,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x27[33] = {
-    0xff,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xc7,
-    0xef,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x27 = { image_data_twr_font_ubuntu_33_0x27,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x28[66] = {
-    0xff, 0xe0,
-    0xff, 0xa0,
-    0xff, 0x00,
-    0xfe, 0x20,
-    0xfc, 0x60,
-    0xfc, 0x60,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xfc, 0x60,
-    0xfc, 0x60,
-    0xfe, 0x20,
-    0xff, 0x00,
-    0xff, 0xa0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x28 = { image_data_twr_font_ubuntu_33_0x28,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x29[66] = {
-    0xff, 0xc0,
-    0x7f, 0xc0,
-    0x3f, 0xc0,
-    0x1f, 0xc0,
-    0x8f, 0xc0,
-    0x8f, 0xc0,
-    0xc7, 0xc0,
-    0xc7, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xf1, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xc7, 0xc0,
-    0xc7, 0xc0,
-    0x8f, 0xc0,
-    0x8f, 0xc0,
-    0x1f, 0xc0,
-    0x3f, 0xc0,
-    0x7f, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x29 = { image_data_twr_font_ubuntu_33_0x29,
-    10, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2a[66] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xfc, 0x7e,
-    0xdc, 0x76,
-    0x86, 0xc2,
-    0xc0, 0x06,
-    0xfc, 0x7e,
-    0xf9, 0x3e,
-    0xf1, 0x1e,
-    0xf1, 0x1e,
-    0xe3, 0x8e,
-    0xfb, 0xbe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x2a = { image_data_twr_font_ubuntu_33_0x2a,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2b[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xc0, 0x00, 0x40,
-    0xc0, 0x00, 0x40,
-    0xc0, 0x00, 0x40,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x2b = { image_data_twr_font_ubuntu_33_0x2b,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2c[33] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe7,
-    0xe7,
-    0xc7,
-    0xef,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x2c = { image_data_twr_font_ubuntu_33_0x2c,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2d[66] = {
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0x80, 0x40,
-    0x80, 0x40,
-    0x80, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x2d = { image_data_twr_font_ubuntu_33_0x2d,
-    10, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2e[33] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe7,
-    0xc3,
-    0xc3,
-    0xe7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x2e = { image_data_twr_font_ubuntu_33_0x2e,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x2f[66] = {
-    0xff, 0xf8,
-    0xff, 0xc0,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xfe, 0x38,
-    0xfe, 0x38,
-    0xfe, 0x38,
-    0xfc, 0x78,
-    0xfc, 0x78,
-    0xfc, 0x78,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xf0, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x1f, 0xf8,
-    0x1f, 0xf8,
-    0x1f, 0xf8,
-    0x3f, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x2f = { image_data_twr_font_ubuntu_33_0x2f,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x30[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfe, 0x1f, 0xc0,
-    0xf8, 0x07, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xe1, 0xe1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe1, 0xe1, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xf8, 0x07, 0xc0,
-    0xfe, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x30 = { image_data_twr_font_ubuntu_33_0x30,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x31[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x0f, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf0, 0x0f, 0xc0,
-    0xe0, 0x0f, 0xc0,
-    0xe1, 0x8f, 0xc0,
-    0xf7, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x31 = { image_data_twr_font_ubuntu_33_0x31,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x32[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xf8, 0x1f, 0xc0,
-    0xe0, 0x07, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xe3, 0xc1, 0xc0,
-    0xef, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xc3, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xfc, 0x7f, 0xc0,
-    0xf8, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x32 = { image_data_twr_font_ubuntu_33_0x32,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x33[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xf8, 0x0f, 0xc0,
-    0xc0, 0x07, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xe7, 0xe1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xc3, 0xc0,
-    0xfc, 0x07, 0xc0,
-    0xfc, 0x07, 0xc0,
-    0xfc, 0x03, 0xc0,
-    0xff, 0xc1, 0xc0,
-    0xff, 0xf0, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf0, 0xc0,
-    0xcf, 0xe1, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc0, 0x07, 0xc0,
-    0xf0, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x33 = { image_data_twr_font_ubuntu_33_0x33,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x34[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xc3, 0xc0,
-    0xff, 0x83, 0xc0,
-    0xff, 0x03, 0xc0,
-    0xfe, 0x03, 0xc0,
-    0xfc, 0x23, 0xc0,
-    0xf8, 0x63, 0xc0,
-    0xf8, 0xe3, 0xc0,
-    0xf1, 0xe3, 0xc0,
-    0xe3, 0xe3, 0xc0,
-    0xe3, 0xe3, 0xc0,
-    0xc7, 0xe3, 0xc0,
-    0x8f, 0xe3, 0xc0,
-    0x80, 0x00, 0x40,
-    0x80, 0x00, 0x40,
-    0x80, 0x00, 0x40,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x34 = { image_data_twr_font_ubuntu_33_0x34,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x35[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xf0, 0x3f, 0xc0,
-    0xe0, 0x07, 0xc0,
-    0xe0, 0x03, 0xc0,
-    0xff, 0x81, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xf0, 0xc0,
-    0xcf, 0xe1, 0xc0,
-    0xc0, 0x01, 0xc0,
-    0xc0, 0x07, 0xc0,
-    0xf0, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x35 = { image_data_twr_font_ubuntu_33_0x35,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x36[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xe1, 0xc0,
-    0xff, 0x01, 0xc0,
-    0xfc, 0x01, 0xc0,
-    0xf8, 0x1f, 0xc0,
-    0xf0, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe4, 0x0f, 0xc0,
-    0xc0, 0x03, 0xc0,
-    0xc0, 0x01, 0xc0,
-    0xc3, 0xe1, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc3, 0xf8, 0xc0,
-    0xe3, 0xf0, 0xc0,
-    0xe1, 0xe1, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xf8, 0x03, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x36 = { image_data_twr_font_ubuntu_33_0x36,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x37[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xff, 0xf9, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xfc, 0x7f, 0xc0,
-    0xfc, 0x7f, 0xc0,
-    0xfc, 0x7f, 0xc0,
-    0xfc, 0xff, 0xc0,
-    0xf8, 0xff, 0xc0,
-    0xf8, 0xff, 0xc0,
-    0xf8, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x37 = { image_data_twr_font_ubuntu_33_0x37,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x38[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf8, 0x07, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xe1, 0xe1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xf0, 0xe3, 0xc0,
-    0xf8, 0x07, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xe3, 0xc1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc3, 0xf8, 0xc0,
-    0xe1, 0xe0, 0xc0,
-    0xe0, 0x01, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x38 = { image_data_twr_font_ubuntu_33_0x38,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x39[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfc, 0x0f, 0xc0,
-    0xf0, 0x07, 0xc0,
-    0xf0, 0x03, 0xc0,
-    0xe1, 0xe1, 0xc0,
-    0xc3, 0xf1, 0xc0,
-    0xc7, 0xf0, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc3, 0xf8, 0xc0,
-    0xe1, 0xf0, 0xc0,
-    0xe0, 0x00, 0xc0,
-    0xf0, 0x00, 0xc0,
-    0xfc, 0x08, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xf1, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xc3, 0xc0,
-    0xfe, 0x07, 0xc0,
-    0xe0, 0x0f, 0xc0,
-    0xe0, 0x3f, 0xc0,
-    0xe1, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x39 = { image_data_twr_font_ubuntu_33_0x39,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3a[33] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe7,
-    0xc3,
-    0xc3,
-    0xe7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe7,
-    0xc3,
-    0xc3,
-    0xe7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x3a = { image_data_twr_font_ubuntu_33_0x3a,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3b[33] = {
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe7,
-    0xc3,
-    0xc3,
-    0xe7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xe7,
-    0xe7,
-    0xc7,
-    0xef,
-    0xff,
-    0xff
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x3b = { image_data_twr_font_ubuntu_33_0x3b,
-    8, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3c[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xfe, 0xc0,
-    0xff, 0xf0, 0xc0,
-    0xff, 0xc0, 0x40,
-    0xfe, 0x01, 0xc0,
-    0xf8, 0x0f, 0xc0,
-    0xe0, 0x3f, 0xc0,
-    0xc1, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc1, 0xff, 0xc0,
-    0xe0, 0x3f, 0xc0,
-    0xf8, 0x0f, 0xc0,
-    0xfe, 0x01, 0xc0,
-    0xff, 0xc0, 0x40,
-    0xff, 0xf0, 0xc0,
-    0xff, 0xfe, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x3c = { image_data_twr_font_ubuntu_33_0x3c,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3d[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0x80, 0x00, 0xc0,
-    0x80, 0x00, 0xc0,
-    0x80, 0x00, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0x80, 0x00, 0xc0,
-    0x80, 0x00, 0xc0,
-    0x80, 0x00, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x3d = { image_data_twr_font_ubuntu_33_0x3d,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3e[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xef, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xc0, 0x7f, 0xc0,
-    0xf0, 0x1f, 0xc0,
-    0xfc, 0x07, 0xc0,
-    0xff, 0x81, 0xc0,
-    0xff, 0xe0, 0xc0,
-    0xff, 0xf8, 0xc0,
-    0xff, 0xe0, 0xc0,
-    0xff, 0x81, 0xc0,
-    0xfc, 0x07, 0xc0,
-    0xf0, 0x1f, 0xc0,
-    0xc0, 0x7f, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xef, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x3e = { image_data_twr_font_ubuntu_33_0x3e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x3f[66] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xe0, 0x78,
-    0x80, 0x18,
-    0x80, 0x18,
-    0xdf, 0x08,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xfc, 0x38,
-    0xf8, 0x78,
-    0xf8, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x3f = { image_data_twr_font_ubuntu_33_0x3f,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x40[132] = {
-    0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xe0, 0x1f, 0xfc,
-    0xff, 0x80, 0x03, 0xfc,
-    0xfe, 0x00, 0x01, 0xfc,
-    0xfc, 0x0f, 0xe0, 0xfc,
-    0xf8, 0x3f, 0xf8, 0x7c,
-    0xf0, 0xff, 0xfc, 0x3c,
-    0xf1, 0xff, 0xfe, 0x1c,
-    0xe1, 0xf8, 0x1f, 0x1c,
-    0xe3, 0xe0, 0x0f, 0x1c,
-    0xe3, 0xc0, 0x0f, 0x8c,
-    0xc7, 0xc3, 0x8f, 0x8c,
-    0xc7, 0x87, 0x8f, 0x8c,
-    0xc7, 0x8f, 0x8f, 0x8c,
-    0xc7, 0x8f, 0x8f, 0x8c,
-    0xc7, 0x8f, 0x8f, 0x8c,
-    0xc7, 0x8f, 0x8f, 0x0c,
-    0xc7, 0x87, 0x8f, 0x1c,
-    0xc7, 0xc7, 0x8e, 0x1c,
-    0xc3, 0xc0, 0x00, 0x3c,
-    0xe3, 0xe0, 0x00, 0x7c,
-    0xe1, 0xf0, 0x60, 0xfc,
-    0xf1, 0xff, 0xff, 0xfc,
-    0xf0, 0xff, 0xff, 0xfc,
-    0xf8, 0x3f, 0xff, 0xfc,
-    0xfc, 0x0f, 0xef, 0xfc,
-    0xfe, 0x00, 0x0f, 0xfc,
-    0xff, 0x80, 0x0f, 0xfc,
-    0xff, 0xe0, 0x0f, 0xfc,
-    0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x40 = { image_data_twr_font_ubuntu_33_0x40,
-    30, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x41[99] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0x8f, 0xf8,
-    0xff, 0x07, 0xf8,
-    0xff, 0x07, 0xf8,
-    0xff, 0x07, 0xf8,
-    0xfe, 0x23, 0xf8,
-    0xfe, 0x23, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xf8, 0x70, 0xf8,
-    0xf8, 0xf8, 0xf8,
-    0xf8, 0xf8, 0xf8,
-    0xf1, 0xfc, 0x78,
-    0xf1, 0xfc, 0x78,
-    0xe1, 0xfc, 0x38,
-    0xe0, 0x00, 0x38,
-    0xe0, 0x00, 0x38,
-    0xc0, 0x00, 0x18,
-    0xc7, 0xff, 0x18,
-    0x87, 0xff, 0x08,
-    0x8f, 0xff, 0x88,
-    0x8f, 0xff, 0x88,
-    0x1f, 0xff, 0xc0,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x41 = { image_data_twr_font_ubuntu_33_0x41,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x42[99] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xe0, 0x03, 0xf8,
-    0xe0, 0x00, 0xf8,
-    0xe0, 0x00, 0x78,
-    0xe3, 0xf8, 0x38,
-    0xe3, 0xfc, 0x38,
-    0xe3, 0xfe, 0x38,
-    0xe3, 0xfe, 0x38,
-    0xe3, 0xfe, 0x38,
-    0xe3, 0xf8, 0x78,
-    0xe0, 0x00, 0xf8,
-    0xe0, 0x00, 0xf8,
-    0xe0, 0x00, 0x78,
-    0xe3, 0xfc, 0x38,
-    0xe3, 0xfe, 0x18,
-    0xe3, 0xff, 0x18,
-    0xe3, 0xff, 0x18,
-    0xe3, 0xff, 0x18,
-    0xe3, 0xfe, 0x18,
-    0xe3, 0xf8, 0x38,
-    0xe0, 0x00, 0x38,
-    0xe0, 0x00, 0xf8,
-    0xe0, 0x03, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x42 = { image_data_twr_font_ubuntu_33_0x42,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x43[99] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0x80, 0x70,
-    0xfe, 0x00, 0x10,
-    0xf8, 0x00, 0x10,
-    0xf8, 0x3f, 0x30,
-    0xf0, 0xff, 0xf0,
-    0xe1, 0xff, 0xf0,
-    0xe3, 0xff, 0xf0,
-    0xc3, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc7, 0xff, 0xf0,
-    0xc3, 0xff, 0xf0,
-    0xe3, 0xff, 0xf0,
-    0xe1, 0xff, 0xf0,
-    0xf0, 0xff, 0xf0,
-    0xf0, 0x7f, 0x30,
-    0xf8, 0x00, 0x10,
-    0xfe, 0x00, 0x10,
-    0xff, 0x80, 0x70,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x43 = { image_data_twr_font_ubuntu_33_0x43,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x44[99] = {
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xe0, 0x07, 0xfe,
-    0xe0, 0x00, 0xfe,
-    0xe0, 0x00, 0x7e,
-    0xe3, 0xf8, 0x3e,
-    0xe3, 0xfe, 0x1e,
-    0xe3, 0xff, 0x0e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x86,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0xc6,
-    0xe3, 0xff, 0x86,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x0e,
-    0xe3, 0xfe, 0x1e,
-    0xe3, 0xf8, 0x3e,
-    0xe0, 0x00, 0x7e,
-    0xe0, 0x00, 0xfe,
-    0xe0, 0x07, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x44 = { image_data_twr_font_ubuntu_33_0x44,
-    23, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x45[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xe0, 0x00, 0xc0,
-    0xe0, 0x00, 0xc0,
-    0xe0, 0x00, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe0, 0x01, 0xc0,
-    0xe0, 0x01, 0xc0,
-    0xe0, 0x01, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe0, 0x00, 0x40,
-    0xe0, 0x00, 0x40,
-    0xe0, 0x00, 0x40,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x45 = { image_data_twr_font_ubuntu_33_0x45,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x46[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xe0, 0x00, 0x80,
-    0xe0, 0x00, 0x80,
-    0xe0, 0x00, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe0, 0x01, 0x80,
-    0xe0, 0x01, 0x80,
-    0xe0, 0x01, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x46 = { image_data_twr_font_ubuntu_33_0x46,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x47[99] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0x80, 0x7c,
-    0xfe, 0x00, 0x1c,
-    0xf8, 0x00, 0x1c,
-    0xf0, 0x3f, 0x3c,
-    0xf0, 0xff, 0xfc,
-    0xe1, 0xff, 0xfc,
-    0xe3, 0xff, 0xfc,
-    0xc3, 0xff, 0xfc,
-    0xc7, 0xff, 0xfc,
-    0xc7, 0xff, 0xfc,
-    0xc7, 0xff, 0xfc,
-    0xc7, 0xff, 0x1c,
-    0xc7, 0xff, 0x1c,
-    0xc7, 0xff, 0x1c,
-    0xc3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe1, 0xff, 0x1c,
-    0xf0, 0xff, 0x1c,
-    0xf0, 0x7f, 0x1c,
-    0xf8, 0x00, 0x1c,
-    0xfc, 0x00, 0x1c,
-    0xff, 0x80, 0x7c,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x47 = { image_data_twr_font_ubuntu_33_0x47,
-    22, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x48[99] = {
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe0, 0x00, 0x0e,
-    0xe0, 0x00, 0x0e,
-    0xe0, 0x00, 0x0e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x48 = { image_data_twr_font_ubuntu_33_0x48,
-    23, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x49[66] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x49 = { image_data_twr_font_ubuntu_33_0x49,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4a[66] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0xc7,
-    0xff, 0x87,
-    0x9f, 0x0f,
-    0x00, 0x0f,
-    0x00, 0x1f,
-    0xe0, 0x7f,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x4a = { image_data_twr_font_ubuntu_33_0x4a,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4b[99] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xe3, 0xfe, 0x10,
-    0xe3, 0xfc, 0x30,
-    0xe3, 0xf8, 0x70,
-    0xe3, 0xf0, 0xf0,
-    0xe3, 0xe1, 0xf0,
-    0xe3, 0xc3, 0xf0,
-    0xe3, 0x87, 0xf0,
-    0xe3, 0x0f, 0xf0,
-    0xe2, 0x1f, 0xf0,
-    0xe0, 0x3f, 0xf0,
-    0xe0, 0x7f, 0xf0,
-    0xe0, 0x1f, 0xf0,
-    0xe2, 0x0f, 0xf0,
-    0xe3, 0x07, 0xf0,
-    0xe3, 0x83, 0xf0,
-    0xe3, 0xe1, 0xf0,
-    0xe3, 0xf0, 0xf0,
-    0xe3, 0xf8, 0x70,
-    0xe3, 0xf8, 0x30,
-    0xe3, 0xfc, 0x30,
-    0xe3, 0xfe, 0x10,
-    0xe3, 0xff, 0x00,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x4b = { image_data_twr_font_ubuntu_33_0x4b,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4c[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe0, 0x00, 0x80,
-    0xe0, 0x00, 0x80,
-    0xe0, 0x00, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x4c = { image_data_twr_font_ubuntu_33_0x4c,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4d[132] = {
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xf1, 0xff, 0xfc, 0x78,
-    0xf0, 0xff, 0xf8, 0x78,
-    0xf0, 0xff, 0xf8, 0x78,
-    0xf0, 0x7f, 0xf0, 0x78,
-    0xe0, 0x7f, 0xf0, 0x38,
-    0xe0, 0x3f, 0xe0, 0x38,
-    0xe2, 0x3f, 0xe2, 0x38,
-    0xe3, 0x1f, 0xc6, 0x38,
-    0xe3, 0x1f, 0xc6, 0x38,
-    0xe3, 0x8f, 0x8e, 0x38,
-    0xe3, 0x8f, 0x8e, 0x38,
-    0xe3, 0xc7, 0x1e, 0x38,
-    0xe3, 0xc7, 0x1e, 0x38,
-    0xe3, 0xe7, 0x3e, 0x38,
-    0xc3, 0xe2, 0x3e, 0x38,
-    0xc7, 0xf2, 0x7f, 0x18,
-    0xc7, 0xf0, 0x7f, 0x18,
-    0xc7, 0xf0, 0x7f, 0x18,
-    0xc7, 0xf8, 0xff, 0x18,
-    0xc7, 0xff, 0xff, 0x18,
-    0xc7, 0xff, 0xff, 0x18,
-    0xc7, 0xff, 0xff, 0x18,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x4d = { image_data_twr_font_ubuntu_33_0x4d,
-    29, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4e[99] = {
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xe3, 0xff, 0x8e,
-    0xe1, 0xff, 0x8e,
-    0xe0, 0xff, 0x8e,
-    0xe0, 0x7f, 0x8e,
-    0xe0, 0x7f, 0x8e,
-    0xe2, 0x3f, 0x8e,
-    0xe2, 0x1f, 0x8e,
-    0xe3, 0x0f, 0x8e,
-    0xe3, 0x8f, 0x8e,
-    0xe3, 0xc7, 0x8e,
-    0xe3, 0xc3, 0x8e,
-    0xe3, 0xe3, 0x8e,
-    0xe3, 0xf1, 0x8e,
-    0xe3, 0xf1, 0x8e,
-    0xe3, 0xf8, 0x8e,
-    0xe3, 0xfc, 0x0e,
-    0xe3, 0xfc, 0x0e,
-    0xe3, 0xfe, 0x0e,
-    0xe3, 0xff, 0x0e,
-    0xe3, 0xff, 0x0e,
-    0xe3, 0xff, 0x8e,
-    0xe3, 0xff, 0x8e,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x4e = { image_data_twr_font_ubuntu_33_0x4e,
-    23, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x4f[132] = {
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0x80, 0xff, 0x80,
-    0xfe, 0x00, 0x3f, 0x80,
-    0xf8, 0x00, 0x0f, 0x80,
-    0xf0, 0x3e, 0x07, 0x80,
-    0xf0, 0xff, 0x87, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xe3, 0xff, 0xe3, 0x80,
-    0xc3, 0xff, 0xe1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc3, 0xff, 0xe1, 0x80,
-    0xe3, 0xff, 0xe3, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xf0, 0xff, 0x87, 0x80,
-    0xf0, 0x3e, 0x07, 0x80,
-    0xf8, 0x00, 0x0f, 0x80,
-    0xfe, 0x00, 0x3f, 0x80,
-    0xff, 0x80, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x4f = { image_data_twr_font_ubuntu_33_0x4f,
-    25, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x50[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xe0, 0x07, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe0, 0x00, 0xe0,
-    0xe3, 0xf8, 0x60,
-    0xe3, 0xfc, 0x20,
-    0xe3, 0xfe, 0x20,
-    0xe3, 0xfe, 0x20,
-    0xe3, 0xfe, 0x20,
-    0xe3, 0xfe, 0x20,
-    0xe3, 0xfc, 0x20,
-    0xe3, 0xf0, 0x60,
-    0xe0, 0x00, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe0, 0x07, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x50 = { image_data_twr_font_ubuntu_33_0x50,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x51[132] = {
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0x80, 0xff, 0x80,
-    0xfe, 0x00, 0x3f, 0x80,
-    0xf8, 0x00, 0x0f, 0x80,
-    0xf0, 0x3e, 0x07, 0x80,
-    0xf0, 0xff, 0x87, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xe3, 0xff, 0xe3, 0x80,
-    0xc3, 0xff, 0xe1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc7, 0xff, 0xf1, 0x80,
-    0xc3, 0xff, 0xe1, 0x80,
-    0xe3, 0xff, 0xe3, 0x80,
-    0xe1, 0xff, 0xc3, 0x80,
-    0xf0, 0xff, 0x87, 0x80,
-    0xf8, 0x3e, 0x07, 0x80,
-    0xfc, 0x00, 0x0f, 0x80,
-    0xfe, 0x00, 0x3f, 0x80,
-    0xff, 0x80, 0xff, 0x80,
-    0xff, 0xf1, 0xff, 0x80,
-    0xff, 0xf0, 0xff, 0x80,
-    0xff, 0xf8, 0x1f, 0x80,
-    0xff, 0xfc, 0x03, 0x80,
-    0xff, 0xff, 0x07, 0x80,
-    0xff, 0xff, 0xc7, 0x80,
-    0xff, 0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x51 = { image_data_twr_font_ubuntu_33_0x51,
-    25, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x52[99] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xe0, 0x07, 0xf0,
-    0xe0, 0x01, 0xf0,
-    0xe0, 0x00, 0x70,
-    0xe3, 0xf8, 0x70,
-    0xe3, 0xfc, 0x30,
-    0xe3, 0xfe, 0x30,
-    0xe3, 0xfe, 0x30,
-    0xe3, 0xfe, 0x30,
-    0xe3, 0xfc, 0x30,
-    0xe3, 0xf8, 0x70,
-    0xe0, 0x00, 0x70,
-    0xe0, 0x01, 0xf0,
-    0xe0, 0x07, 0xf0,
-    0xe3, 0xe3, 0xf0,
-    0xe3, 0xe1, 0xf0,
-    0xe3, 0xf1, 0xf0,
-    0xe3, 0xf0, 0xf0,
-    0xe3, 0xf8, 0xf0,
-    0xe3, 0xf8, 0x70,
-    0xe3, 0xfc, 0x70,
-    0xe3, 0xfc, 0x30,
-    0xe3, 0xfe, 0x10,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x52 = { image_data_twr_font_ubuntu_33_0x52,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x53[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xfc, 0x07, 0x80,
-    0xf0, 0x01, 0x80,
-    0xe0, 0x01, 0x80,
-    0xc3, 0xf3, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc7, 0xff, 0x80,
-    0xc3, 0xff, 0x80,
-    0xe0, 0xff, 0x80,
-    0xf0, 0x3f, 0x80,
-    0xf8, 0x0f, 0x80,
-    0xff, 0x03, 0x80,
-    0xff, 0xc1, 0x80,
-    0xff, 0xe1, 0x80,
-    0xff, 0xf8, 0x80,
-    0xff, 0xf8, 0x80,
-    0xff, 0xf8, 0x80,
-    0xff, 0xf8, 0x80,
-    0xcf, 0xe0, 0x80,
-    0x80, 0x01, 0x80,
-    0x80, 0x03, 0x80,
-    0xf0, 0x0f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x53 = { image_data_twr_font_ubuntu_33_0x53,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x54[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0x80, 0x00, 0x20,
-    0x80, 0x00, 0x20,
-    0x80, 0x00, 0x20,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x54 = { image_data_twr_font_ubuntu_33_0x54,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x55[99] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe3, 0xff, 0x1c,
-    0xe1, 0xfe, 0x1c,
-    0xf1, 0xfe, 0x3c,
-    0xf0, 0x78, 0x3c,
-    0xf8, 0x00, 0x7c,
-    0xfc, 0x00, 0xfc,
-    0xff, 0x03, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x55 = { image_data_twr_font_ubuntu_33_0x55,
-    22, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x56[99] = {
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xc0,
-    0x8f, 0xff, 0x88,
-    0x8f, 0xff, 0x88,
-    0x87, 0xff, 0x08,
-    0xc7, 0xff, 0x18,
-    0xc7, 0xff, 0x18,
-    0xc3, 0xfe, 0x18,
-    0xe3, 0xfe, 0x38,
-    0xe3, 0xfe, 0x38,
-    0xf1, 0xfc, 0x78,
-    0xf1, 0xfc, 0x78,
-    0xf0, 0xf8, 0x78,
-    0xf8, 0xf8, 0xf8,
-    0xf8, 0x70, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xfc, 0x71, 0xf8,
-    0xfe, 0x21, 0xf8,
-    0xfe, 0x23, 0xf8,
-    0xfe, 0x03, 0xf8,
-    0xff, 0x07, 0xf8,
-    0xff, 0x07, 0xf8,
-    0xff, 0x8f, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x56 = { image_data_twr_font_ubuntu_33_0x56,
-    21, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x57[132] = {
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0x8f, 0xff, 0xff, 0xe2,
-    0x8f, 0xff, 0xff, 0xe2,
-    0x87, 0xff, 0xff, 0xc2,
-    0xc7, 0xfc, 0x7f, 0xc6,
-    0xc7, 0xfc, 0x3f, 0xc6,
-    0xc7, 0xf8, 0x3f, 0xc6,
-    0xc7, 0xf8, 0x3f, 0xc6,
-    0xc3, 0xf9, 0x1f, 0x86,
-    0xe3, 0xf1, 0x1f, 0x8e,
-    0xe3, 0xf1, 0x1f, 0x8e,
-    0xe3, 0xf3, 0x0f, 0x8e,
-    0xe1, 0xe3, 0x8f, 0x0e,
-    0xf1, 0xe3, 0x8f, 0x1e,
-    0xf1, 0xc7, 0x87, 0x1e,
-    0xf1, 0xc7, 0xc7, 0x1e,
-    0xf0, 0xc7, 0xc6, 0x1e,
-    0xf8, 0x8f, 0xe2, 0x3e,
-    0xf8, 0x8f, 0xe2, 0x3e,
-    0xf8, 0x0f, 0xe0, 0x3e,
-    0xf8, 0x1f, 0xf0, 0x3e,
-    0xfc, 0x1f, 0xf0, 0x7e,
-    0xfc, 0x3f, 0xf0, 0x7e,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x57 = { image_data_twr_font_ubuntu_33_0x57,
-    31, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x58[99] = {
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0x87, 0xfc, 0x30,
-    0xc7, 0xfc, 0x70,
-    0xe3, 0xf8, 0xf0,
-    0xe1, 0xf0, 0xf0,
-    0xf1, 0xf1, 0xf0,
-    0xf8, 0xe1, 0xf0,
-    0xf8, 0x63, 0xf0,
-    0xfc, 0x47, 0xf0,
-    0xfe, 0x07, 0xf0,
-    0xfe, 0x0f, 0xf0,
-    0xff, 0x0f, 0xf0,
-    0xfe, 0x0f, 0xf0,
-    0xfe, 0x07, 0xf0,
-    0xfc, 0x03, 0xf0,
-    0xf8, 0x63, 0xf0,
-    0xf8, 0xe1, 0xf0,
-    0xf0, 0xf0, 0xf0,
-    0xf1, 0xf8, 0xf0,
-    0xe3, 0xf8, 0x70,
-    0xc3, 0xfc, 0x30,
-    0xc7, 0xfe, 0x30,
-    0x87, 0xfe, 0x10,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x58 = { image_data_twr_font_ubuntu_33_0x58,
-    20, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x59[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0x0f, 0xfe, 0x00,
-    0x8f, 0xfe, 0x20,
-    0x87, 0xfc, 0x20,
-    0xc7, 0xfc, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xf1, 0xf1, 0xe0,
-    0xf0, 0xe1, 0xe0,
-    0xf8, 0xc3, 0xe0,
-    0xfc, 0x47, 0xe0,
-    0xfc, 0x07, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0x1f, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x59 = { image_data_twr_font_ubuntu_33_0x59,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5a[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xc0, 0x00, 0x40,
-    0xc0, 0x00, 0x40,
-    0xc0, 0x00, 0x40,
-    0xff, 0xf8, 0x40,
-    0xff, 0xf0, 0xc0,
-    0xff, 0xe1, 0xc0,
-    0xff, 0xe3, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0x87, 0xc0,
-    0xff, 0x0f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xfc, 0x3f, 0xc0,
-    0xf8, 0x7f, 0xc0,
-    0xf8, 0xff, 0xc0,
-    0xf1, 0xff, 0xc0,
-    0xe1, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xc3, 0xff, 0xc0,
-    0x80, 0x00, 0x40,
-    0x80, 0x00, 0x40,
-    0x80, 0x00, 0x40,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x5a = { image_data_twr_font_ubuntu_33_0x5a,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5b[66] = {
-    0xff, 0xe0,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe3, 0xe0,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x5b = { image_data_twr_font_ubuntu_33_0x5b,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5c[66] = {
-    0xff, 0xf8,
-    0x3f, 0xf8,
-    0x1f, 0xf8,
-    0x1f, 0xf8,
-    0x1f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0x8f, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0xc7, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xf1, 0xf8,
-    0xf1, 0xf8,
-    0xf0, 0xf8,
-    0xf8, 0xf8,
-    0xf8, 0xf8,
-    0xfc, 0x78,
-    0xfc, 0x78,
-    0xfc, 0x78,
-    0xfe, 0x38,
-    0xfe, 0x38,
-    0xfe, 0x38,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0x88,
-    0xff, 0xc0,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x5c = { image_data_twr_font_ubuntu_33_0x5c,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5d[66] = {
-    0xff, 0xe0,
-    0x00, 0xe0,
-    0x00, 0xe0,
-    0x00, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0xf8, 0xe0,
-    0x00, 0xe0,
-    0x00, 0xe0,
-    0x00, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x5d = { image_data_twr_font_ubuntu_33_0x5d,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5e[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xfc, 0x47, 0xc0,
-    0xf8, 0x43, 0xc0,
-    0xf8, 0xe3, 0xc0,
-    0xf1, 0xf1, 0xc0,
-    0xf1, 0xf1, 0xc0,
-    0xe3, 0xf8, 0xc0,
-    0xe3, 0xf8, 0xc0,
-    0xc7, 0xfc, 0x40,
-    0xef, 0xfe, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x5e = { image_data_twr_font_ubuntu_33_0x5e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x5f[66] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0x00, 0x00,
-    0x00, 0x00,
-    0x00, 0x00,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x5f = { image_data_twr_font_ubuntu_33_0x5f,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x60[66] = {
-    0xff, 0xf0,
-    0xef, 0xf0,
-    0xc7, 0xf0,
-    0xe3, 0xf0,
-    0xf1, 0xf0,
-    0xf8, 0xf0,
-    0xfd, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x60 = { image_data_twr_font_ubuntu_33_0x60,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x61[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xf0, 0x1f, 0x80,
-    0xe0, 0x0f, 0x80,
-    0xe0, 0x07, 0x80,
-    0xef, 0xc3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xf8, 0x03, 0x80,
-    0xe0, 0x03, 0x80,
-    0xc0, 0x03, 0x80,
-    0x87, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x87, 0xe3, 0x80,
-    0xc0, 0x03, 0x80,
-    0xe0, 0x03, 0x80,
-    0xf0, 0x07, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x61 = { image_data_twr_font_ubuntu_33_0x61,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x62[99] = {
-    0xff, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe2, 0x07, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xf8, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xe0, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xf0, 0x0f, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x62 = { image_data_twr_font_ubuntu_33_0x62,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x63[66] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xfe, 0x06,
-    0xf8, 0x02,
-    0xf0, 0x02,
-    0xe0, 0xfe,
-    0xe3, 0xfe,
-    0xc3, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc3, 0xfe,
-    0xe3, 0xfe,
-    0xe0, 0xfa,
-    0xf0, 0x02,
-    0xf8, 0x02,
-    0xfe, 0x06,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x63 = { image_data_twr_font_ubuntu_33_0x63,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x64[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xfc, 0x08, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xc3, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe0, 0xf8, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xfe, 0x01, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x64 = { image_data_twr_font_ubuntu_33_0x64,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x65[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xf8, 0x03, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xe3, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe0, 0xfd, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfe, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x65 = { image_data_twr_font_ubuntu_33_0x65,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x66[66] = {
-    0xff, 0xf0,
-    0xfc, 0x00,
-    0xf8, 0x00,
-    0xf0, 0x00,
-    0xe1, 0xe0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe0, 0x10,
-    0xe0, 0x10,
-    0xe0, 0x10,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x66 = { image_data_twr_font_ubuntu_33_0x66,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x67[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfe, 0x03, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xe1, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xc3, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xfc, 0x08, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf0, 0xe0,
-    0xe7, 0xe1, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xf0, 0x0f, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x67 = { image_data_twr_font_ubuntu_33_0x67,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x68[99] = {
-    0xff, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe0, 0x0f, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe3, 0xe1, 0xe0,
-    0xe3, 0xf0, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x68 = { image_data_twr_font_ubuntu_33_0x68,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x69[66] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x69 = { image_data_twr_font_ubuntu_33_0x69,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6a[66] = {
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xc3, 0x80,
-    0x07, 0x80,
-    0x0f, 0x80,
-    0x1f, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x6a = { image_data_twr_font_ubuntu_33_0x6a,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6b[99] = {
-    0xff, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xff, 0x80,
-    0xe3, 0xf0, 0x80,
-    0xe3, 0xf1, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xe3, 0xc7, 0x80,
-    0xe3, 0x8f, 0x80,
-    0xe3, 0x1f, 0x80,
-    0xe2, 0x3f, 0x80,
-    0xe0, 0x7f, 0x80,
-    0xe0, 0x3f, 0x80,
-    0xe2, 0x1f, 0x80,
-    0xe3, 0x0f, 0x80,
-    0xe3, 0x87, 0x80,
-    0xe3, 0xc3, 0x80,
-    0xe3, 0xe1, 0x80,
-    0xe3, 0xf1, 0x80,
-    0xe3, 0xf8, 0x80,
-    0xe3, 0xf8, 0x00,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x6b = { image_data_twr_font_ubuntu_33_0x6b,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6c[66] = {
-    0xff, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe3, 0xc0,
-    0xe1, 0xc0,
-    0xe0, 0x40,
-    0xf0, 0x40,
-    0xf8, 0x40,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0,
-    0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x6c = { image_data_twr_font_ubuntu_33_0x6c,
-    10, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6d[132] = {
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xf8, 0x07, 0x81, 0xf8,
-    0xe0, 0x02, 0x00, 0xf8,
-    0xe0, 0x00, 0x00, 0x78,
-    0xe3, 0xe0, 0x78, 0x78,
-    0xe3, 0xf0, 0xfc, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xe3, 0xf8, 0xfe, 0x38,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x6d = { image_data_twr_font_ubuntu_33_0x6d,
-    29, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6e[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xf0, 0x0f, 0xc0,
-    0xe0, 0x07, 0xc0,
-    0xe0, 0x03, 0xc0,
-    0xe3, 0xe3, 0xc0,
-    0xe3, 0xe1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x6e = { image_data_twr_font_ubuntu_33_0x6e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x6f[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xf8, 0x03, 0xe0,
-    0xf0, 0x01, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xc3, 0xf8, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc7, 0xfc, 0x60,
-    0xc3, 0xf8, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xf0, 0x01, 0xe0,
-    0xf8, 0x03, 0xe0,
-    0xfe, 0x0f, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x6f = { image_data_twr_font_ubuntu_33_0x6f,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x70[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xf8, 0x0f, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe3, 0xe0, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xfc, 0x60,
-    0xe3, 0xf8, 0x60,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xe0, 0x01, 0xe0,
-    0xe0, 0x03, 0xe0,
-    0xe2, 0x07, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xe3, 0xff, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x70 = { image_data_twr_font_ubuntu_33_0x70,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x71[99] = {
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xe0,
-    0xfe, 0x03, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xe0, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xc3, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc7, 0xf8, 0xe0,
-    0xc3, 0xf8, 0xe0,
-    0xe3, 0xf8, 0xe0,
-    0xe1, 0xf0, 0xe0,
-    0xf0, 0x00, 0xe0,
-    0xf8, 0x00, 0xe0,
-    0xfc, 0x08, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x71 = { image_data_twr_font_ubuntu_33_0x71,
-    19, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x72[66] = {
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xf8, 0x00,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x72 = { image_data_twr_font_ubuntu_33_0x72,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x73[66] = {
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x3c,
-    0xc0, 0x1c,
-    0xc0, 0x1c,
-    0x87, 0xdc,
-    0x8f, 0xfc,
-    0x8f, 0xfc,
-    0x87, 0xfc,
-    0xc0, 0xfc,
-    0xe0, 0x3c,
-    0xf8, 0x1c,
-    0xff, 0x0c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0x9f, 0x0c,
-    0x80, 0x0c,
-    0x80, 0x1c,
-    0xc0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x73 = { image_data_twr_font_ubuntu_33_0x73,
-    14, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x74[66] = {
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe0, 0x18,
-    0xe0, 0x18,
-    0xe0, 0x18,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe1, 0xf8,
-    0xf0, 0x08,
-    0xf0, 0x08,
-    0xfc, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x74 = { image_data_twr_font_ubuntu_33_0x74,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x75[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xf1, 0xf1, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfc, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x75 = { image_data_twr_font_ubuntu_33_0x75,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x76[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0x8f, 0xf8, 0x80,
-    0x8f, 0xf8, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xc7, 0xf1, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xe3, 0xe3, 0x80,
-    0xf1, 0xc7, 0x80,
-    0xf1, 0xc7, 0x80,
-    0xf0, 0x87, 0x80,
-    0xf8, 0x8f, 0x80,
-    0xf8, 0x8f, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xfc, 0x1f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x76 = { image_data_twr_font_ubuntu_33_0x76,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x77[132] = {
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0x8f, 0xe3, 0xf8, 0x80,
-    0x8f, 0xe3, 0xf8, 0x80,
-    0xc7, 0xe3, 0xf1, 0x80,
-    0xc7, 0xc1, 0xf1, 0x80,
-    0xc7, 0xc1, 0xf1, 0x80,
-    0xc7, 0xc9, 0xf1, 0x80,
-    0xe7, 0xc9, 0xf3, 0x80,
-    0xe3, 0x88, 0xe3, 0x80,
-    0xe3, 0x88, 0xe3, 0x80,
-    0xe3, 0x9c, 0xe3, 0x80,
-    0xf1, 0x1c, 0x47, 0x80,
-    0xf1, 0x1c, 0x47, 0x80,
-    0xf1, 0x3e, 0x47, 0x80,
-    0xf8, 0x3e, 0x0f, 0x80,
-    0xf8, 0x3e, 0x0f, 0x80,
-    0xf8, 0x7f, 0x0f, 0x80,
-    0xfc, 0x7f, 0x1f, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x77 = { image_data_twr_font_ubuntu_33_0x77,
-    25, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x78[66] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0x8f, 0xe3,
-    0xc7, 0xc7,
-    0xe3, 0xc7,
-    0xe3, 0x8f,
-    0xf1, 0x1f,
-    0xf8, 0x1f,
-    0xf8, 0x3f,
-    0xfc, 0x3f,
-    0xfc, 0x3f,
-    0xf8, 0x3f,
-    0xf8, 0x1f,
-    0xf1, 0x0f,
-    0xe1, 0x8f,
-    0xe3, 0xc7,
-    0xc7, 0xc3,
-    0xc7, 0xe3,
-    0x8f, 0xf1,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x78 = { image_data_twr_font_ubuntu_33_0x78,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x79[66] = {
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xe3, 0xc7,
-    0xe3, 0xc7,
-    0xe3, 0xc7,
-    0xf1, 0xc7,
-    0xf1, 0x8f,
-    0xf1, 0x8f,
-    0xf8, 0x8f,
-    0xf8, 0x9f,
-    0xf8, 0x9f,
-    0xfc, 0x1f,
-    0xfc, 0x3f,
-    0xfc, 0x3f,
-    0xfe, 0x3f,
-    0xfc, 0x3f,
-    0xfc, 0x7f,
-    0x80, 0xff,
-    0x80, 0xff,
-    0x83, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x79 = { image_data_twr_font_ubuntu_33_0x79,
-    16, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x7a[66] = {
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0x80, 0x02,
-    0x80, 0x02,
-    0x80, 0x02,
-    0xff, 0xc2,
-    0xff, 0xc6,
-    0xff, 0x8e,
-    0xff, 0x1e,
-    0xfe, 0x3e,
-    0xfc, 0x7e,
-    0xf8, 0xfe,
-    0xf1, 0xfe,
-    0xf1, 0xfe,
-    0xe3, 0xfe,
-    0xc7, 0xfe,
-    0x80, 0x02,
-    0x80, 0x02,
-    0x80, 0x02,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x7a = { image_data_twr_font_ubuntu_33_0x7a,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x7b[66] = {
-    0xff, 0xe0,
-    0xfe, 0x20,
-    0xf8, 0x20,
-    0xf0, 0x20,
-    0xf0, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xe1, 0xe0,
-    0x83, 0xe0,
-    0x87, 0xe0,
-    0x83, 0xe0,
-    0xe1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf0, 0xe0,
-    0xf0, 0x20,
-    0xf8, 0x20,
-    0xfe, 0x20,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x7b = { image_data_twr_font_ubuntu_33_0x7b,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x7c[66] = {
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x7c = { image_data_twr_font_ubuntu_33_0x7c,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x7d[66] = {
-    0xff, 0xe0,
-    0x8f, 0xe0,
-    0x83, 0xe0,
-    0x81, 0xe0,
-    0xe1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf0, 0xe0,
-    0xf8, 0x20,
-    0xfc, 0x20,
-    0xf8, 0x20,
-    0xf0, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xf1, 0xe0,
-    0xe1, 0xe0,
-    0x81, 0xe0,
-    0x83, 0xe0,
-    0x8f, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x7d = { image_data_twr_font_ubuntu_33_0x7d,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0x7e[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xe1, 0xf8, 0xc0,
-    0xc0, 0xf8, 0xc0,
-    0xc0, 0x30, 0xc0,
-    0x86, 0x01, 0xc0,
-    0x8f, 0x81, 0xc0,
-    0x8f, 0xc3, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0x7e = { image_data_twr_font_ubuntu_33_0x7e,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xb0[66] = {
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xe0, 0xe0,
-    0xc0, 0x60,
-    0x8e, 0x20,
-    0x9f, 0x20,
-    0x9f, 0x20,
-    0x8e, 0x20,
-    0xc0, 0x60,
-    0xe0, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0,
-    0xff, 0xe0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xb0 = { image_data_twr_font_ubuntu_33_0xb0,
-    11, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xb9[66] = {
-    0xff, 0xfc,
-    0xef, 0xbc,
-    0xc7, 0x1c,
-    0xe2, 0x3c,
-    0xf0, 0x7c,
-    0xf8, 0xfc,
-    0xfd, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xf0, 0x3c,
-    0xc0, 0x1c,
-    0xc0, 0x1c,
-    0x87, 0xdc,
-    0x8f, 0xfc,
-    0x8f, 0xfc,
-    0x87, 0xfc,
-    0xc0, 0xfc,
-    0xe0, 0x3c,
-    0xf8, 0x1c,
-    0xff, 0x0c,
-    0xff, 0x8c,
-    0xff, 0x8c,
-    0x9f, 0x0c,
-    0x80, 0x0c,
-    0x80, 0x1c,
-    0xc0, 0x7c,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc,
-    0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xb9 = { image_data_twr_font_ubuntu_33_0xb9,
-    14, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xbb[66] = {
-    0xff, 0xf8,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xff, 0x18,
-    0xe3, 0x38,
-    0xe3, 0x38,
-    0xe3, 0x38,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe0, 0x18,
-    0xe0, 0x18,
-    0xe0, 0x18,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe3, 0xf8,
-    0xe1, 0xf8,
-    0xf0, 0x08,
-    0xf0, 0x08,
-    0xfc, 0x18,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8,
-    0xff, 0xf8
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xbb = { image_data_twr_font_ubuntu_33_0xbb,
-    13, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xbe[66] = {
-    0xff, 0xfe,
-    0xf7, 0xde,
-    0xe3, 0x8e,
-    0xf1, 0x1e,
-    0xf8, 0x3e,
-    0xfc, 0x7e,
-    0xfe, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0x80, 0x02,
-    0x80, 0x02,
-    0x80, 0x02,
-    0xff, 0xc2,
-    0xff, 0xc6,
-    0xff, 0x8e,
-    0xff, 0x1e,
-    0xfe, 0x3e,
-    0xfc, 0x7e,
-    0xf8, 0xfe,
-    0xf1, 0xfe,
-    0xf1, 0xfe,
-    0xe3, 0xfe,
-    0xc7, 0xfe,
-    0x80, 0x02,
-    0x80, 0x02,
-    0x80, 0x02,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xbe = { image_data_twr_font_ubuntu_33_0xbe,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xe1[99] = {
-    0xff, 0xff, 0x80,
-    0xff, 0xdf, 0x80,
-    0xff, 0x8f, 0x80,
-    0xff, 0x1f, 0x80,
-    0xfe, 0x3f, 0x80,
-    0xfc, 0x7f, 0x80,
-    0xfe, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xf0, 0x1f, 0x80,
-    0xe0, 0x0f, 0x80,
-    0xe0, 0x07, 0x80,
-    0xef, 0xc3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xff, 0xe3, 0x80,
-    0xf8, 0x03, 0x80,
-    0xe0, 0x03, 0x80,
-    0xc0, 0x03, 0x80,
-    0x87, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x8f, 0xe3, 0x80,
-    0x87, 0xe3, 0x80,
-    0xc0, 0x03, 0x80,
-    0xe0, 0x03, 0x80,
-    0xf0, 0x07, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80,
-    0xff, 0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xe1 = { image_data_twr_font_ubuntu_33_0xe1,
-    17, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xe8[66] = {
-    0xff, 0xfe,
-    0xfd, 0xf6,
-    0xf8, 0xe2,
-    0xfc, 0x46,
-    0xfe, 0x0e,
-    0xff, 0x1e,
-    0xff, 0xbe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xfe, 0x06,
-    0xf8, 0x02,
-    0xf0, 0x02,
-    0xe0, 0xfe,
-    0xe3, 0xfe,
-    0xc3, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc7, 0xfe,
-    0xc3, 0xfe,
-    0xe3, 0xfe,
-    0xe0, 0xfa,
-    0xf0, 0x02,
-    0xf8, 0x02,
-    0xfe, 0x06,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe,
-    0xff, 0xfe
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xe8 = { image_data_twr_font_ubuntu_33_0xe8,
-    15, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xe9[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xef, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xff, 0x7f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xf8, 0x03, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xe3, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe0, 0xfd, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfe, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xe9 = { image_data_twr_font_ubuntu_33_0xe9,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xec[99] = {
-    0xfd, 0xf7, 0xc0,
-    0xf8, 0xe3, 0xc0,
-    0xfc, 0x47, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xff, 0xbf, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfe, 0x0f, 0xc0,
-    0xf8, 0x03, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xe3, 0xf8, 0xc0,
-    0xc7, 0xf8, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc0, 0x00, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc7, 0xff, 0xc0,
-    0xc3, 0xff, 0xc0,
-    0xe3, 0xff, 0xc0,
-    0xe0, 0xfd, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfe, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xec = { image_data_twr_font_ubuntu_33_0xec,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xed[66] = {
-    0xff, 0x80,
-    0xfd, 0x80,
-    0xf8, 0x80,
-    0xf1, 0x80,
-    0xe3, 0x80,
-    0xc7, 0x80,
-    0xef, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xe3, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80,
-    0xff, 0x80
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xed = { image_data_twr_font_ubuntu_33_0xed,
-    9, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xef[99] = {
-    0xff, 0xff, 0xfc,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe0,
-    0xff, 0xf8, 0xe4,
-    0xff, 0xf8, 0xe4,
-    0xff, 0xf8, 0xe4,
-    0xff, 0xf8, 0xfc,
-    0xfc, 0x08, 0xfc,
-    0xf8, 0x00, 0xfc,
-    0xf0, 0x00, 0xfc,
-    0xe1, 0xf0, 0xfc,
-    0xe3, 0xf8, 0xfc,
-    0xc3, 0xf8, 0xfc,
-    0xc7, 0xf8, 0xfc,
-    0xc7, 0xf8, 0xfc,
-    0xc7, 0xf8, 0xfc,
-    0xc7, 0xf8, 0xfc,
-    0xc7, 0xf8, 0xfc,
-    0xc3, 0xf8, 0xfc,
-    0xe3, 0xf8, 0xfc,
-    0xe0, 0xf8, 0xfc,
-    0xf0, 0x00, 0xfc,
-    0xf8, 0x00, 0xfc,
-    0xfe, 0x01, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xef = { image_data_twr_font_ubuntu_33_0xef,
-    22, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xf2[99] = {
-    0xff, 0xff, 0xc0,
-    0xfb, 0xef, 0xc0,
-    0xf1, 0xc7, 0xc0,
-    0xf8, 0x8f, 0xc0,
-    0xfc, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xff, 0x7f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xf0, 0x0f, 0xc0,
-    0xe0, 0x07, 0xc0,
-    0xe0, 0x03, 0xc0,
-    0xe3, 0xe3, 0xc0,
-    0xe3, 0xe1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xf2 = { image_data_twr_font_ubuntu_33_0xf2,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xf8[66] = {
-    0xff, 0xf0,
-    0xf7, 0xd0,
-    0xe3, 0x80,
-    0xf1, 0x10,
-    0xf8, 0x30,
-    0xfc, 0x70,
-    0xfe, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xf8, 0x00,
-    0xe0, 0x00,
-    0xe0, 0x00,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xe3, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0,
-    0xff, 0xf0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xf8 = { image_data_twr_font_ubuntu_33_0xf8,
-    12, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xf9[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xfc, 0x1f, 0xc0,
-    0xf9, 0xcf, 0xc0,
-    0xf9, 0xcf, 0xc0,
-    0xf9, 0xcf, 0xc0,
-    0xfc, 0x1f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xf1, 0xf1, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfc, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xf9 = { image_data_twr_font_ubuntu_33_0xf9,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xfa[99] = {
-    0xff, 0xff, 0xc0,
-    0xff, 0xef, 0xc0,
-    0xff, 0xc7, 0xc0,
-    0xff, 0x8f, 0xc0,
-    0xff, 0x1f, 0xc0,
-    0xfe, 0x3f, 0xc0,
-    0xff, 0x7f, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe3, 0xf1, 0xc0,
-    0xe1, 0xf1, 0xc0,
-    0xf1, 0xf1, 0xc0,
-    0xf0, 0x01, 0xc0,
-    0xf8, 0x01, 0xc0,
-    0xfc, 0x03, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xc0
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xfa = { image_data_twr_font_ubuntu_33_0xfa,
-    18, 33/*, 8*/};
-#endif
-
-#if (0x0 == 0x0)
-static const uint8_t image_data_twr_font_ubuntu_33_0xfd[66] = {
-    0xff, 0xff,
-    0xff, 0xdf,
-    0xff, 0x8f,
-    0xff, 0x1f,
-    0xfe, 0x3f,
-    0xfc, 0x7f,
-    0xfe, 0xff,
-    0xff, 0xff,
-    0xff, 0xff,
-    0x8f, 0xf1,
-    0x8f, 0xf1,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xc7, 0xe3,
-    0xe3, 0xc7,
-    0xe3, 0xc7,
-    0xe3, 0xc7,
-    0xf1, 0xc7,
-    0xf1, 0x8f,
-    0xf1, 0x8f,
-    0xf8, 0x8f,
-    0xf8, 0x9f,
-    0xf8, 0x9f,
-    0xfc, 0x1f,
-    0xfc, 0x3f,
-    0xfc, 0x3f,
-    0xfe, 0x3f,
-    0xfc, 0x3f,
-    0xfc, 0x7f,
-    0x80, 0xff,
-    0x80, 0xff,
-    0x83, 0xff,
-    0xff, 0xff
-};
-static const twr_font_image_t twr_font_ubuntu_33_0xfd = { image_data_twr_font_ubuntu_33_0xfd,
-    16, 33/*, 8*/};
-#endif
-
-
-static const twr_font_char_t twr_font_ubuntu_33_array[] = {
-
-#if (0x0 == 0x0)
-  // character: ' '
-  {0x20, &twr_font_ubuntu_33_0x20},
-#else
-  // character: ' ' == ''
-  {0x20, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '!'
-  {0x21, &twr_font_ubuntu_33_0x21},
-#else
-  // character: '!' == ''
-  {0x21, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '"'
-  {0x22, &twr_font_ubuntu_33_0x22},
-#else
-  // character: '"' == ''
-  {0x22, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '#'
-  {0x23, &twr_font_ubuntu_33_0x23},
-#else
-  // character: '#' == ''
-  {0x23, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '$'
-  {0x24, &twr_font_ubuntu_33_0x24},
-#else
-  // character: '$' == ''
-  {0x24, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '%'
-  {0x25, &twr_font_ubuntu_33_0x25},
-#else
-  // character: '%' == ''
-  {0x25, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '&'
-  {0x26, &twr_font_ubuntu_33_0x26},
-#else
-  // character: '&' == ''
-  {0x26, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '''
-  {0x27, &twr_font_ubuntu_33_0x27},
-#else
-  // character: ''' == ''
-  {0x27, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '('
-  {0x28, &twr_font_ubuntu_33_0x28},
-#else
-  // character: '(' == ''
-  {0x28, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ')'
-  {0x29, &twr_font_ubuntu_33_0x29},
-#else
-  // character: ')' == ''
-  {0x29, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '*'
-  {0x2a, &twr_font_ubuntu_33_0x2a},
-#else
-  // character: '*' == ''
-  {0x2a, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '+'
-  {0x2b, &twr_font_ubuntu_33_0x2b},
-#else
-  // character: '+' == ''
-  {0x2b, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ','
-  {0x2c, &twr_font_ubuntu_33_0x2c},
-#else
-  // character: ',' == ''
-  {0x2c, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '-'
-  {0x2d, &twr_font_ubuntu_33_0x2d},
-#else
-  // character: '-' == ''
-  {0x2d, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '.'
-  {0x2e, &twr_font_ubuntu_33_0x2e},
-#else
-  // character: '.' == ''
-  {0x2e, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '/'
-  {0x2f, &twr_font_ubuntu_33_0x2f},
-#else
-  // character: '/' == ''
-  {0x2f, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '0'
-  {0x30, &twr_font_ubuntu_33_0x30},
-#else
-  // character: '0' == ''
-  {0x30, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '1'
-  {0x31, &twr_font_ubuntu_33_0x31},
-#else
-  // character: '1' == ''
-  {0x31, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '2'
-  {0x32, &twr_font_ubuntu_33_0x32},
-#else
-  // character: '2' == ''
-  {0x32, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '3'
-  {0x33, &twr_font_ubuntu_33_0x33},
-#else
-  // character: '3' == ''
-  {0x33, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '4'
-  {0x34, &twr_font_ubuntu_33_0x34},
-#else
-  // character: '4' == ''
-  {0x34, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '5'
-  {0x35, &twr_font_ubuntu_33_0x35},
-#else
-  // character: '5' == ''
-  {0x35, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '6'
-  {0x36, &twr_font_ubuntu_33_0x36},
-#else
-  // character: '6' == ''
-  {0x36, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '7'
-  {0x37, &twr_font_ubuntu_33_0x37},
-#else
-  // character: '7' == ''
-  {0x37, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '8'
-  {0x38, &twr_font_ubuntu_33_0x38},
-#else
-  // character: '8' == ''
-  {0x38, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '9'
-  {0x39, &twr_font_ubuntu_33_0x39},
-#else
-  // character: '9' == ''
-  {0x39, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ':'
-  {0x3a, &twr_font_ubuntu_33_0x3a},
-#else
-  // character: ':' == ''
-  {0x3a, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ';'
-  {0x3b, &twr_font_ubuntu_33_0x3b},
-#else
-  // character: ';' == ''
-  {0x3b, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '<'
-  {0x3c, &twr_font_ubuntu_33_0x3c},
-#else
-  // character: '<' == ''
-  {0x3c, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '='
-  {0x3d, &twr_font_ubuntu_33_0x3d},
-#else
-  // character: '=' == ''
-  {0x3d, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '>'
-  {0x3e, &twr_font_ubuntu_33_0x3e},
-#else
-  // character: '>' == ''
-  {0x3e, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '?'
-  {0x3f, &twr_font_ubuntu_33_0x3f},
-#else
-  // character: '?' == ''
-  {0x3f, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\x0040'
-  {0x40, &twr_font_ubuntu_33_0x40},
-#else
-  // character: '\x0040' == ''
-  {0x40, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'A'
-  {0x41, &twr_font_ubuntu_33_0x41},
-#else
-  // character: 'A' == ''
-  {0x41, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'B'
-  {0x42, &twr_font_ubuntu_33_0x42},
-#else
-  // character: 'B' == ''
-  {0x42, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'C'
-  {0x43, &twr_font_ubuntu_33_0x43},
-#else
-  // character: 'C' == ''
-  {0x43, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'D'
-  {0x44, &twr_font_ubuntu_33_0x44},
-#else
-  // character: 'D' == ''
-  {0x44, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'E'
-  {0x45, &twr_font_ubuntu_33_0x45},
-#else
-  // character: 'E' == ''
-  {0x45, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'F'
-  {0x46, &twr_font_ubuntu_33_0x46},
-#else
-  // character: 'F' == ''
-  {0x46, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'G'
-  {0x47, &twr_font_ubuntu_33_0x47},
-#else
-  // character: 'G' == ''
-  {0x47, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'H'
-  {0x48, &twr_font_ubuntu_33_0x48},
-#else
-  // character: 'H' == ''
-  {0x48, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'I'
-  {0x49, &twr_font_ubuntu_33_0x49},
-#else
-  // character: 'I' == ''
-  {0x49, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'J'
-  {0x4a, &twr_font_ubuntu_33_0x4a},
-#else
-  // character: 'J' == ''
-  {0x4a, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'K'
-  {0x4b, &twr_font_ubuntu_33_0x4b},
-#else
-  // character: 'K' == ''
-  {0x4b, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'L'
-  {0x4c, &twr_font_ubuntu_33_0x4c},
-#else
-  // character: 'L' == ''
-  {0x4c, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'M'
-  {0x4d, &twr_font_ubuntu_33_0x4d},
-#else
-  // character: 'M' == ''
-  {0x4d, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'N'
-  {0x4e, &twr_font_ubuntu_33_0x4e},
-#else
-  // character: 'N' == ''
-  {0x4e, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'O'
-  {0x4f, &twr_font_ubuntu_33_0x4f},
-#else
-  // character: 'O' == ''
-  {0x4f, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'P'
-  {0x50, &twr_font_ubuntu_33_0x50},
-#else
-  // character: 'P' == ''
-  {0x50, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Q'
-  {0x51, &twr_font_ubuntu_33_0x51},
-#else
-  // character: 'Q' == ''
-  {0x51, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'R'
-  {0x52, &twr_font_ubuntu_33_0x52},
-#else
-  // character: 'R' == ''
-  {0x52, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'S'
-  {0x53, &twr_font_ubuntu_33_0x53},
-#else
-  // character: 'S' == ''
-  {0x53, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'T'
-  {0x54, &twr_font_ubuntu_33_0x54},
-#else
-  // character: 'T' == ''
-  {0x54, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'U'
-  {0x55, &twr_font_ubuntu_33_0x55},
-#else
-  // character: 'U' == ''
-  {0x55, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'V'
-  {0x56, &twr_font_ubuntu_33_0x56},
-#else
-  // character: 'V' == ''
-  {0x56, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'W'
-  {0x57, &twr_font_ubuntu_33_0x57},
-#else
-  // character: 'W' == ''
-  {0x57, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'X'
-  {0x58, &twr_font_ubuntu_33_0x58},
-#else
-  // character: 'X' == ''
-  {0x58, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Y'
-  {0x59, &twr_font_ubuntu_33_0x59},
-#else
-  // character: 'Y' == ''
-  {0x59, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'Z'
-  {0x5a, &twr_font_ubuntu_33_0x5a},
-#else
-  // character: 'Z' == ''
-  {0x5a, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '['
-  {0x5b, &twr_font_ubuntu_33_0x5b},
-#else
-  // character: '[' == ''
-  {0x5b, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '\'
-  {0x5c, &twr_font_ubuntu_33_0x5c},
-#else
-  // character: '\' == ''
-  {0x5c, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: ']'
-  {0x5d, &twr_font_ubuntu_33_0x5d},
-#else
-  // character: ']' == ''
-  {0x5d, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '^'
-  {0x5e, &twr_font_ubuntu_33_0x5e},
-#else
-  // character: '^' == ''
-  {0x5e, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '_'
-  {0x5f, &twr_font_ubuntu_33_0x5f},
-#else
-  // character: '_' == ''
-  {0x5f, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '`'
-  {0x60, &twr_font_ubuntu_33_0x60},
-#else
-  // character: '`' == ''
-  {0x60, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'a'
-  {0x61, &twr_font_ubuntu_33_0x61},
-#else
-  // character: 'a' == ''
-  {0x61, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'b'
-  {0x62, &twr_font_ubuntu_33_0x62},
-#else
-  // character: 'b' == ''
-  {0x62, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'c'
-  {0x63, &twr_font_ubuntu_33_0x63},
-#else
-  // character: 'c' == ''
-  {0x63, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'd'
-  {0x64, &twr_font_ubuntu_33_0x64},
-#else
-  // character: 'd' == ''
-  {0x64, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'e'
-  {0x65, &twr_font_ubuntu_33_0x65},
-#else
-  // character: 'e' == ''
-  {0x65, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'f'
-  {0x66, &twr_font_ubuntu_33_0x66},
-#else
-  // character: 'f' == ''
-  {0x66, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'g'
-  {0x67, &twr_font_ubuntu_33_0x67},
-#else
-  // character: 'g' == ''
-  {0x67, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'h'
-  {0x68, &twr_font_ubuntu_33_0x68},
-#else
-  // character: 'h' == ''
-  {0x68, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'i'
-  {0x69, &twr_font_ubuntu_33_0x69},
-#else
-  // character: 'i' == ''
-  {0x69, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'j'
-  {0x6a, &twr_font_ubuntu_33_0x6a},
-#else
-  // character: 'j' == ''
-  {0x6a, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'k'
-  {0x6b, &twr_font_ubuntu_33_0x6b},
-#else
-  // character: 'k' == ''
-  {0x6b, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'l'
-  {0x6c, &twr_font_ubuntu_33_0x6c},
-#else
-  // character: 'l' == ''
-  {0x6c, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'm'
-  {0x6d, &twr_font_ubuntu_33_0x6d},
-#else
-  // character: 'm' == ''
-  {0x6d, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'n'
-  {0x6e, &twr_font_ubuntu_33_0x6e},
-#else
-  // character: 'n' == ''
-  {0x6e, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'o'
-  {0x6f, &twr_font_ubuntu_33_0x6f},
-#else
-  // character: 'o' == ''
-  {0x6f, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'p'
-  {0x70, &twr_font_ubuntu_33_0x70},
-#else
-  // character: 'p' == ''
-  {0x70, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'q'
-  {0x71, &twr_font_ubuntu_33_0x71},
-#else
-  // character: 'q' == ''
-  {0x71, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'r'
-  {0x72, &twr_font_ubuntu_33_0x72},
-#else
-  // character: 'r' == ''
-  {0x72, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 's'
-  {0x73, &twr_font_ubuntu_33_0x73},
-#else
-  // character: 's' == ''
-  {0x73, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 't'
-  {0x74, &twr_font_ubuntu_33_0x74},
-#else
-  // character: 't' == ''
-  {0x74, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'u'
-  {0x75, &twr_font_ubuntu_33_0x75},
-#else
-  // character: 'u' == ''
-  {0x75, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'v'
-  {0x76, &twr_font_ubuntu_33_0x76},
-#else
-  // character: 'v' == ''
-  {0x76, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'w'
-  {0x77, &twr_font_ubuntu_33_0x77},
-#else
-  // character: 'w' == ''
-  {0x77, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'x'
-  {0x78, &twr_font_ubuntu_33_0x78},
-#else
-  // character: 'x' == ''
-  {0x78, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'y'
-  {0x79, &twr_font_ubuntu_33_0x79},
-#else
-  // character: 'y' == ''
-  {0x79, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'z'
-  {0x7a, &twr_font_ubuntu_33_0x7a},
-#else
-  // character: 'z' == ''
-  {0x7a, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '{'
-  {0x7b, &twr_font_ubuntu_33_0x7b},
-#else
-  // character: '{' == ''
-  {0x7b, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '|'
-  {0x7c, &twr_font_ubuntu_33_0x7c},
-#else
-  // character: '|' == ''
-  {0x7c, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '}'
-  {0x7d, &twr_font_ubuntu_33_0x7d},
-#else
-  // character: '}' == ''
-  {0x7d, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '~'
-  {0x7e, &twr_font_ubuntu_33_0x7e},
-#else
-  // character: '~' == ''
-  {0x7e, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: '°'
-  {0xb0, &twr_font_ubuntu_33_0xb0},
-#else
-  // character: '°' == ''
-  {0xb0, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'š'
-  {0xb9, &twr_font_ubuntu_33_0xb9},
-#else
-  // character: 'š' == ''
-  {0xb9, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ť'
-  {0xbb, &twr_font_ubuntu_33_0xbb},
-#else
-  // character: 'ť' == ''
-  {0xbb, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ž'
-  {0xbe, &twr_font_ubuntu_33_0xbe},
-#else
-  // character: 'ž' == ''
-  {0xbe, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'á'
-  {0xe1, &twr_font_ubuntu_33_0xe1},
-#else
-  // character: 'á' == ''
-  {0xe1, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'č'
-  {0xe8, &twr_font_ubuntu_33_0xe8},
-#else
-  // character: 'č' == ''
-  {0xe8, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'é'
-  {0xe9, &twr_font_ubuntu_33_0xe9},
-#else
-  // character: 'é' == ''
-  {0xe9, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ě'
-  {0xec, &twr_font_ubuntu_33_0xec},
-#else
-  // character: 'ě' == ''
-  {0xec, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'í'
-  {0xed, &twr_font_ubuntu_33_0xed},
-#else
-  // character: 'í' == ''
-  {0xed, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ď'
-  {0xef, &twr_font_ubuntu_33_0xef},
-#else
-  // character: 'ď' == ''
-  {0xef, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ň'
-  {0xf2, &twr_font_ubuntu_33_0xf2},
-#else
-  // character: 'ň' == ''
-  {0xf2, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ř'
-  {0xf8, &twr_font_ubuntu_33_0xf8},
-#else
-  // character: 'ř' == ''
-  {0xf8, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ů'
-  {0xf9, &twr_font_ubuntu_33_0xf9},
-#else
-  // character: 'ů' == ''
-  {0xf9, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ú'
-  {0xfa, &twr_font_ubuntu_33_0xfa},
-#else
-  // character: 'ú' == ''
-  {0xfa, &twr_font_ubuntu_33_0x},
-#endif
-
-#if (0x0 == 0x0)
-  // character: 'ý'
-  {0xfd, &twr_font_ubuntu_33_0xfd}
-#else
-  // character: 'ý' == ''
-  {0xfd, &twr_font_ubuntu_33_0x}
-#endif
-
-};
-
-
-const twr_font_t twr_font_ubuntu_33 = { 110, twr_font_ubuntu_33_array };
+static const uint8_t twr_font_ubuntu_33_bitmaps[7600] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38,
+    0x1c, 0x04, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf8, 0x7c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xc7, 0x0e, 0x38, 0x71, 0xc3, 0x8e, 0x1c, 0x70, 0xe3, 0x87, 0x1c, 0x10,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x71, 0xc0, 0x03, 0x8e, 0x00, 0x1c, 0x70, 0x01, 0xc7, 0x00, 0x0e, 0x38, 0x00,
+    0x71, 0xc0, 0x7f, 0xff, 0xc3, 0xff, 0xfe, 0x1f, 0xff, 0xf0, 0x0e, 0x38, 0x00, 0x71, 0xc0, 0x03,
+    0x8e, 0x00, 0x1c, 0x70, 0x0f, 0xff, 0xf8, 0x7f, 0xff, 0xc3, 0xff, 0xfe, 0x03, 0x8e, 0x00, 0x1c,
+    0x70, 0x00, 0xe3, 0x80, 0x0e, 0x38, 0x00, 0x71, 0xc0, 0x03, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x3f, 0xc0, 0x3f, 0xf8, 0x1f, 0xfe,
+    0x0f, 0x01, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x0f, 0x00, 0x01, 0xf8, 0x00, 0x3f, 0x80,
+    0x03, 0xf8, 0x00, 0x3f, 0x00, 0x01, 0xe0, 0x00, 0x3c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x70,
+    0x60, 0x3c, 0x3f, 0xfe, 0x0f, 0xff, 0x00, 0xff, 0x80, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x38, 0x03, 0xfe, 0x0e, 0x00, 0x71, 0xc1, 0xc0,
+    0x1c, 0x1c, 0x70, 0x03, 0x83, 0x8e, 0x00, 0x70, 0x73, 0x80, 0x0e, 0x0e, 0xe0, 0x01, 0xc1, 0xdc,
+    0x00, 0x1c, 0x77, 0x00, 0x03, 0xfe, 0xe0, 0x00, 0x1f, 0x38, 0x00, 0x00, 0x07, 0x3e, 0x00, 0x01,
+    0xdf, 0xf0, 0x00, 0x3b, 0x8e, 0x00, 0x0e, 0xe0, 0xe0, 0x01, 0xdc, 0x1c, 0x00, 0x73, 0x83, 0x80,
+    0x1c, 0x70, 0x70, 0x03, 0x8e, 0x0e, 0x00, 0xe0, 0xe3, 0x80, 0x1c, 0x1f, 0xf0, 0x07, 0x00, 0xf8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7e, 0x00, 0x07, 0xfc, 0x00, 0x7f, 0xe0, 0x07, 0x87, 0x80, 0x38, 0x1c, 0x01,
+    0xc0, 0xe0, 0x0e, 0x0f, 0x00, 0x31, 0xf0, 0x01, 0xff, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x07,
+    0xf0, 0x18, 0x7d, 0xc1, 0xc3, 0x87, 0x0e, 0x38, 0x1c, 0xe1, 0xc0, 0x7f, 0x0e, 0x01, 0xf0, 0x70,
+    0x07, 0x01, 0xe0, 0x7c, 0x0f, 0xff, 0xf0, 0x3f, 0xf1, 0xc0, 0x7e, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x38, 0x0e, 0x03, 0x80, 0x70, 0x1c, 0x03, 0x80, 0xe0, 0x1c, 0x03, 0x80, 0x70,
+    0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x01, 0xc0, 0x38, 0x07,
+    0x00, 0xe0, 0x0e, 0x01, 0xc0, 0x1c, 0x03, 0x80, 0x38, 0x03, 0x80, 0x20, 0x00, 0x00, 0x40, 0x18,
+    0x07, 0x00, 0xe0, 0x38, 0x07, 0x01, 0xc0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x1c, 0x07, 0x01, 0xc0,
+    0x70, 0x1c, 0x07, 0x01, 0xc0, 0x70, 0x1c, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x1c, 0x07, 0x03, 0x80,
+    0xe0, 0x70, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+    0x38, 0x00, 0x70, 0x08, 0xe2, 0x3c, 0x9e, 0x3f, 0xf8, 0x07, 0x00, 0x1b, 0x00, 0x77, 0x00, 0xee,
+    0x03, 0x8e, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x00,
+    0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00, 0xff, 0xfe, 0x3f, 0xff, 0x8f, 0xff, 0xe0, 0x0e, 0x00, 0x03,
+    0x80, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x0e, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7f, 0x9f, 0xe7, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83,
+    0xc3, 0xc1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x01, 0xc0, 0x0e,
+    0x00, 0x70, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x70, 0x03, 0x80, 0x1c,
+    0x01, 0xc0, 0x0e, 0x00, 0xf0, 0x07, 0x00, 0x38, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x0e, 0x00, 0x70,
+    0x03, 0x80, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xff, 0x00, 0x7f, 0xe0, 0x3c,
+    0x3c, 0x0e, 0x07, 0x03, 0x81, 0xc1, 0xc0, 0x38, 0x70, 0x0e, 0x1c, 0x03, 0x87, 0x00, 0xe1, 0xc0,
+    0x38, 0x70, 0x0e, 0x1c, 0x03, 0x87, 0x00, 0xe1, 0xc0, 0x38, 0x70, 0x0e, 0x0e, 0x07, 0x03, 0x81,
+    0xc0, 0xf0, 0xf0, 0x1f, 0xf8, 0x03, 0xfc, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x00, 0x07, 0x80, 0x07, 0xe0, 0x07, 0xf8, 0x03, 0xfe, 0x00, 0xf3, 0x80,
+    0x10, 0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00,
+    0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 0x00,
+    0x0e, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f,
+    0xf0, 0x1f, 0xfe, 0x03, 0x87, 0xc0, 0x80, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00,
+    0xe0, 0x00, 0x78, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xc0, 0x00, 0xe0,
+    0x00, 0x70, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x07, 0xff, 0xe1, 0xff, 0xf8, 0x7f, 0xfe, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x1f, 0xfc, 0x07, 0xff, 0x80, 0xc0, 0xf0,
+    0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x01, 0xe0, 0x07, 0xf0, 0x01, 0xfc, 0x00, 0x7f, 0x80,
+    0x01, 0xf0, 0x00, 0x1e, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x07, 0x86,
+    0x03, 0xc1, 0xff, 0xe0, 0x7f, 0xf0, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x00, 0x07, 0x80, 0x03, 0xe0, 0x01, 0xf8, 0x00, 0xfe, 0x00, 0x7b, 0x80, 0x3c,
+    0xe0, 0x0e, 0x38, 0x07, 0x0e, 0x03, 0x83, 0x80, 0xe0, 0xe0, 0x70, 0x38, 0x38, 0x0e, 0x0f, 0xff,
+    0xf3, 0xff, 0xfc, 0xff, 0xff, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x0e,
+    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x7f, 0xf0,
+    0x1f, 0xfc, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xf8, 0x00,
+    0xff, 0xc0, 0x3f, 0xf8, 0x00, 0x3f, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x03, 0x80,
+    0x00, 0xe0, 0x00, 0x78, 0x60, 0x3c, 0x1f, 0xff, 0x07, 0xff, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0xfc, 0x01, 0xff, 0x00, 0xfc, 0x00, 0x78,
+    0x00, 0x1c, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0xdf, 0x80, 0x7f, 0xf8, 0x1f, 0xff, 0x07, 0x83,
+    0xc1, 0xc0, 0x78, 0x70, 0x0e, 0x1c, 0x03, 0x87, 0x00, 0xe1, 0xe0, 0x38, 0x38, 0x1e, 0x0f, 0x0f,
+    0x01, 0xff, 0x80, 0x3f, 0xe0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0xfe, 0x1f, 0xff, 0x87, 0xff, 0xe0, 0x00, 0x30, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00,
+    0x01, 0xc0, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00,
+    0x38, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x60, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x03,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0xff, 0x00, 0x7f,
+    0xe0, 0x3c, 0x3c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x3c, 0x1c, 0x07, 0x8e, 0x00, 0xff,
+    0x00, 0x1f, 0x80, 0x1f, 0xf8, 0x0e, 0x1f, 0x03, 0x81, 0xc1, 0xc0, 0x38, 0x70, 0x0e, 0x1c, 0x03,
+    0x87, 0x80, 0xe0, 0xf0, 0xf8, 0x3f, 0xfc, 0x07, 0xfe, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7f, 0xc0, 0x1f, 0xf8, 0x0f, 0x0f, 0x07, 0x81, 0xc1,
+    0xc0, 0x78, 0x70, 0x0e, 0x1c, 0x03, 0x87, 0x00, 0xe1, 0xe0, 0x38, 0x3c, 0x1e, 0x0f, 0xff, 0x81,
+    0xff, 0xe0, 0x1f, 0xb8, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xe0, 0x03, 0xf0, 0x0f,
+    0xf8, 0x03, 0xf8, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1,
+    0xe1, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xe1, 0xe0, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc1, 0xe1, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0,
+    0xe0, 0xe0, 0xc0, 0xc1, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07,
+    0x80, 0x07, 0xf0, 0x0f, 0xf0, 0x0f, 0xe0, 0x0f, 0xe0, 0x07, 0xc0, 0x01, 0xc0, 0x00, 0x7c, 0x00,
+    0x0f, 0xe0, 0x00, 0xfe, 0x00, 0x0f, 0xf0, 0x00, 0x7f, 0x00, 0x07, 0x80, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf8, 0xff, 0xfe, 0x3f,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xe3, 0xff, 0xf8, 0xff,
+    0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0xe0, 0x00, 0x7f, 0x00, 0x07, 0xf0, 0x00, 0x7f, 0x00, 0x03, 0xf0, 0x00, 0x3e,
+    0x00, 0x03, 0x80, 0x03, 0xe0, 0x03, 0xf0, 0x07, 0xf0, 0x07, 0xf0, 0x07, 0xf0, 0x00, 0xe0, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x07, 0xfe,
+    0x3f, 0xf0, 0x83, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x38, 0x01, 0xc0, 0x3c, 0x03, 0xc0, 0x1c,
+    0x01, 0xc0, 0x0e, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x07,
+    0xff, 0xf8, 0x00, 0x3f, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xe0, 0x0f, 0x00, 0x03, 0xc0, 0x38, 0x00,
+    0x07, 0x81, 0xe0, 0x7e, 0x0e, 0x07, 0x07, 0xfc, 0x38, 0x1c, 0x3f, 0xf0, 0x70, 0xe0, 0xf1, 0xc1,
+    0xc3, 0x87, 0x87, 0x07, 0x0e, 0x1c, 0x1c, 0x1c, 0x38, 0x70, 0x70, 0x70, 0xe1, 0xc1, 0xc1, 0xc3,
+    0x87, 0x07, 0x0f, 0x0e, 0x1e, 0x1c, 0x38, 0x38, 0x38, 0x71, 0xe0, 0xf0, 0xff, 0xff, 0x01, 0xc1,
+    0xff, 0xf8, 0x07, 0x83, 0xe7, 0xc0, 0x0e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x7c, 0x00,
+    0x00, 0x00, 0xfc, 0x04, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x01, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0xf0, 0x00, 0x0f, 0x80, 0x00, 0x7c, 0x00, 0x07, 0x70, 0x00,
+    0x3b, 0x80, 0x03, 0x8e, 0x00, 0x1c, 0x70, 0x01, 0xe3, 0xc0, 0x0e, 0x0e, 0x00, 0x70, 0x70, 0x07,
+    0x01, 0xc0, 0x38, 0x0e, 0x03, 0xc0, 0x78, 0x1f, 0xff, 0xc0, 0xff, 0xfe, 0x0f, 0xff, 0xf8, 0x70,
+    0x01, 0xc7, 0x80, 0x0f, 0x38, 0x00, 0x39, 0xc0, 0x01, 0xdc, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x01, 0xff, 0xf0, 0x0f, 0xff,
+    0xc0, 0x70, 0x1f, 0x03, 0x80, 0x78, 0x1c, 0x01, 0xc0, 0xe0, 0x0e, 0x07, 0x00, 0x70, 0x38, 0x0f,
+    0x01, 0xff, 0xf0, 0x0f, 0xff, 0x80, 0x7f, 0xfe, 0x03, 0x80, 0x78, 0x1c, 0x01, 0xe0, 0xe0, 0x07,
+    0x07, 0x00, 0x38, 0x38, 0x01, 0xc1, 0xc0, 0x1e, 0x0e, 0x03, 0xe0, 0x7f, 0xff, 0x03, 0xff, 0xe0,
+    0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x80, 0x1f, 0xfe, 0x07, 0xff, 0xe0, 0x7c, 0x0c, 0x0f, 0x00, 0x01, 0xe0, 0x00, 0x1c, 0x00,
+    0x03, 0xc0, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03,
+    0x80, 0x00, 0x3c, 0x00, 0x01, 0xc0, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x80, 0xc0, 0x7f,
+    0xfe, 0x01, 0xff, 0xe0, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x3f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0xe0, 0x3e, 0x01, 0xc0,
+    0x1e, 0x03, 0x80, 0x1e, 0x07, 0x00, 0x1c, 0x0e, 0x00, 0x3c, 0x1c, 0x00, 0x38, 0x38, 0x00, 0x70,
+    0x70, 0x00, 0xe0, 0xe0, 0x01, 0xc1, 0xc0, 0x03, 0x83, 0x80, 0x07, 0x07, 0x00, 0x1e, 0x0e, 0x00,
+    0x38, 0x1c, 0x00, 0xf0, 0x38, 0x03, 0xc0, 0x70, 0x1f, 0x00, 0xff, 0xfc, 0x01, 0xff, 0xf0, 0x03,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xff, 0xe0, 0xff, 0xf8, 0x3f, 0xfe, 0x0e, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x0e,
+    0x00, 0x03, 0x80, 0x00, 0xff, 0xf0, 0x3f, 0xfc, 0x0f, 0xff, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38,
+    0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x0f, 0xff, 0xc3, 0xff, 0xf0, 0xff,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x87, 0xff, 0xc3, 0xff, 0xe1,
+    0xc0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0xff, 0x83, 0xff,
+    0xc1, 0xff, 0xe0, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03,
+    0x80, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xfe, 0x00, 0x1f, 0xfe, 0x01, 0xff, 0xf8, 0x0f, 0xc0, 0xc0, 0x3c, 0x00, 0x01,
+    0xe0, 0x00, 0x07, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xe0, 0x00, 0x03, 0x80, 0x00, 0x0e, 0x00, 0x00,
+    0x38, 0x00, 0xe0, 0xe0, 0x03, 0x83, 0x80, 0x0e, 0x0f, 0x00, 0x38, 0x1c, 0x00, 0xe0, 0x78, 0x03,
+    0x80, 0xf0, 0x0e, 0x03, 0xe0, 0x38, 0x07, 0xff, 0xe0, 0x0f, 0xff, 0x80, 0x07, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x70,
+    0x38, 0x00, 0xe0, 0x70, 0x01, 0xc0, 0xe0, 0x03, 0x81, 0xc0, 0x07, 0x03, 0x80, 0x0e, 0x07, 0x00,
+    0x1c, 0x0e, 0x00, 0x38, 0x1c, 0x00, 0x70, 0x3f, 0xff, 0xe0, 0x7f, 0xff, 0xc0, 0xff, 0xff, 0x81,
+    0xc0, 0x07, 0x03, 0x80, 0x0e, 0x07, 0x00, 0x1c, 0x0e, 0x00, 0x38, 0x1c, 0x00, 0x70, 0x38, 0x00,
+    0xe0, 0x70, 0x01, 0xc0, 0xe0, 0x03, 0x81, 0xc0, 0x07, 0x03, 0x80, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c,
+    0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x07, 0x86, 0x0f, 0x0f, 0xff, 0x0f, 0xfe, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xc0, 0x1e, 0x1c, 0x03, 0xc1, 0xc0, 0x78, 0x1c, 0x0f, 0x01, 0xc1, 0xe0, 0x1c, 0x3c,
+    0x01, 0xc7, 0x80, 0x1c, 0xf0, 0x01, 0xde, 0x00, 0x1f, 0xc0, 0x01, 0xf8, 0x00, 0x1f, 0xe0, 0x01,
+    0xdf, 0x00, 0x1c, 0xf8, 0x01, 0xc7, 0xc0, 0x1c, 0x1e, 0x01, 0xc0, 0xf0, 0x1c, 0x07, 0x81, 0xc0,
+    0x7c, 0x1c, 0x03, 0xc1, 0xc0, 0x1e, 0x1c, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07,
+    0x00, 0x03, 0x80, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00,
+    0x07, 0x00, 0x03, 0x80, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x3f, 0xfe, 0x1f, 0xff, 0x0f,
+    0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x00, 0x1c, 0x03, 0xc0, 0x01, 0xe0, 0x1e, 0x00, 0x0f, 0x00, 0xf8, 0x00, 0xf8, 0x0f, 0xc0, 0x07,
+    0xe0, 0x7f, 0x00, 0x7f, 0x03, 0xb8, 0x03, 0xb8, 0x1c, 0xe0, 0x39, 0xc0, 0xe7, 0x01, 0xce, 0x07,
+    0x1c, 0x1c, 0x70, 0x38, 0xe0, 0xe3, 0x81, 0xc3, 0x8e, 0x1c, 0x0e, 0x1c, 0x70, 0xe0, 0x70, 0x63,
+    0x07, 0x07, 0x83, 0xb8, 0x38, 0x38, 0x0d, 0x80, 0xe1, 0xc0, 0x7c, 0x07, 0x0e, 0x03, 0xe0, 0x38,
+    0x70, 0x0e, 0x01, 0xc3, 0x80, 0x00, 0x0e, 0x1c, 0x00, 0x00, 0x70, 0xe0, 0x00, 0x03, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x1c, 0x0f, 0x00, 0x38, 0x1f, 0x00, 0x70, 0x3f, 0x00, 0xe0, 0x7e,
+    0x01, 0xc0, 0xee, 0x03, 0x81, 0xde, 0x07, 0x03, 0x9e, 0x0e, 0x07, 0x1c, 0x1c, 0x0e, 0x1c, 0x38,
+    0x1c, 0x3c, 0x70, 0x38, 0x38, 0xe0, 0x70, 0x39, 0xc0, 0xe0, 0x73, 0x81, 0xc0, 0x77, 0x03, 0x80,
+    0x7e, 0x07, 0x00, 0xfc, 0x0e, 0x00, 0xf8, 0x1c, 0x00, 0xf0, 0x38, 0x01, 0xe0, 0x70, 0x01, 0xc0,
+    0xe0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x7f, 0xf0, 0x00, 0xff, 0xfe, 0x00, 0xfc, 0x1f, 0x80,
+    0x78, 0x03, 0xc0, 0x78, 0x00, 0xf0, 0x38, 0x00, 0x38, 0x3c, 0x00, 0x1e, 0x1c, 0x00, 0x07, 0x0e,
+    0x00, 0x03, 0x87, 0x00, 0x01, 0xc3, 0x80, 0x00, 0xe1, 0xc0, 0x00, 0x70, 0xe0, 0x00, 0x38, 0x78,
+    0x00, 0x3c, 0x1c, 0x00, 0x1c, 0x0f, 0x00, 0x1e, 0x03, 0xc0, 0x1e, 0x01, 0xf8, 0x3f, 0x00, 0x7f,
+    0xff, 0x00, 0x0f, 0xfe, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0xff, 0xf0, 0x1f, 0xff, 0x03, 0x80,
+    0xf0, 0x70, 0x0f, 0x0e, 0x00, 0xe1, 0xc0, 0x1c, 0x38, 0x03, 0x87, 0x00, 0x70, 0xe0, 0x1e, 0x1c,
+    0x0f, 0x83, 0xff, 0xe0, 0x7f, 0xf8, 0x0f, 0xfc, 0x01, 0xc0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00,
+    0xe0, 0x00, 0x1c, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x07, 0xff, 0x00, 0x0f,
+    0xff, 0xe0, 0x0f, 0xc1, 0xf8, 0x07, 0x80, 0x3c, 0x07, 0x80, 0x0f, 0x03, 0x80, 0x03, 0x83, 0xc0,
+    0x01, 0xe1, 0xc0, 0x00, 0x70, 0xe0, 0x00, 0x38, 0x70, 0x00, 0x1c, 0x38, 0x00, 0x0e, 0x1c, 0x00,
+    0x07, 0x0e, 0x00, 0x03, 0x87, 0x80, 0x03, 0xc1, 0xc0, 0x01, 0xc0, 0xf0, 0x01, 0xe0, 0x3c, 0x01,
+    0xe0, 0x0f, 0x83, 0xf0, 0x03, 0xff, 0xf0, 0x00, 0xff, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x01, 0xc0,
+    0x00, 0x00, 0xf0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00,
+    0x7f, 0xf8, 0x07, 0xff, 0xe0, 0x70, 0x1e, 0x07, 0x00, 0xf0, 0x70, 0x07, 0x07, 0x00, 0x70, 0x70,
+    0x07, 0x07, 0x00, 0xf0, 0x70, 0x1e, 0x07, 0xff, 0xe0, 0x7f, 0xf8, 0x07, 0xfe, 0x00, 0x70, 0x70,
+    0x07, 0x07, 0x80, 0x70, 0x38, 0x07, 0x03, 0xc0, 0x70, 0x1c, 0x07, 0x01, 0xe0, 0x70, 0x0e, 0x07,
+    0x00, 0xf0, 0x70, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
+    0x01, 0xff, 0xc1, 0xff, 0xe1, 0xe0, 0x60, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1e, 0x00, 0x07,
+    0xc0, 0x01, 0xf8, 0x00, 0x7f, 0x00, 0x07, 0xe0, 0x00, 0xf8, 0x00, 0x3c, 0x00, 0x07, 0x00, 0x03,
+    0x80, 0x01, 0xc0, 0x00, 0xe3, 0x01, 0xf3, 0xff, 0xf1, 0xff, 0xf0, 0x1f, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf9, 0xff, 0xff, 0x3f, 0xff, 0xe0, 0x0e, 0x00, 0x01,
+    0xc0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x1c, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00,
+    0x0e, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x1c, 0x00, 0x03, 0x80,
+    0x00, 0x70, 0x00, 0x0e, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x38, 0x1c, 0x00, 0xe0, 0x70, 0x03, 0x81, 0xc0, 0x0e,
+    0x07, 0x00, 0x38, 0x1c, 0x00, 0xe0, 0x70, 0x03, 0x81, 0xc0, 0x0e, 0x07, 0x00, 0x38, 0x1c, 0x00,
+    0xe0, 0x70, 0x03, 0x81, 0xc0, 0x0e, 0x07, 0x00, 0x38, 0x1c, 0x00, 0xe0, 0x70, 0x03, 0x81, 0xc0,
+    0x0e, 0x07, 0x80, 0x78, 0x0e, 0x01, 0xc0, 0x3e, 0x1f, 0x00, 0x7f, 0xf8, 0x00, 0xff, 0xc0, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0x00, 0x03, 0xb8, 0x00, 0x39, 0xc0, 0x01, 0xcf, 0x00, 0x1e, 0x38, 0x00, 0xe1, 0xc0, 0x07, 0x0f,
+    0x00, 0x78, 0x38, 0x03, 0x81, 0xc0, 0x1c, 0x07, 0x01, 0xc0, 0x38, 0x0e, 0x01, 0xe0, 0xf0, 0x07,
+    0x07, 0x00, 0x3c, 0x78, 0x00, 0xe3, 0x80, 0x07, 0x1c, 0x00, 0x1d, 0xe0, 0x00, 0xee, 0x00, 0x07,
+    0xf0, 0x00, 0x1f, 0x00, 0x00, 0xf8, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0e, 0x70,
+    0x00, 0x00, 0x1c, 0xf0, 0x00, 0x00, 0x78, 0xe0, 0x0e, 0x00, 0xe1, 0xc0, 0x1e, 0x01, 0xc3, 0x80,
+    0x7c, 0x03, 0x87, 0x00, 0xf8, 0x07, 0x0f, 0x01, 0xb8, 0x1e, 0x0e, 0x07, 0x70, 0x38, 0x1c, 0x0e,
+    0xe0, 0x70, 0x38, 0x19, 0xe0, 0xe0, 0x78, 0x71, 0xc3, 0xc0, 0x70, 0xe3, 0x87, 0x00, 0xe3, 0x87,
+    0x8e, 0x01, 0xc7, 0x07, 0x1c, 0x03, 0xce, 0x0e, 0x78, 0x03, 0xb8, 0x0e, 0xe0, 0x07, 0x70, 0x1d,
+    0xc0, 0x0f, 0xe0, 0x3f, 0x80, 0x1f, 0x80, 0x3f, 0x00, 0x1f, 0x00, 0x7c, 0x00, 0x3c, 0x00, 0xf8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3c, 0x38, 0x03, 0x81, 0xc0, 0x70, 0x1e, 0x0f, 0x00,
+    0xe0, 0xe0, 0x07, 0x1e, 0x00, 0x79, 0xc0, 0x03, 0xb8, 0x00, 0x1f, 0x80, 0x01, 0xf0, 0x00, 0x0f,
+    0x00, 0x01, 0xf0, 0x00, 0x1f, 0x80, 0x03, 0xfc, 0x00, 0x79, 0xc0, 0x07, 0x1e, 0x00, 0xf0, 0xf0,
+    0x0e, 0x07, 0x01, 0xc0, 0x78, 0x3c, 0x03, 0xc3, 0x80, 0x1c, 0x78, 0x01, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1e, 0xe0, 0x03, 0x9e, 0x00, 0xf1, 0xc0,
+    0x1c, 0x1c, 0x07, 0x03, 0xc1, 0xe0, 0x38, 0x38, 0x07, 0x8f, 0x00, 0x73, 0xc0, 0x07, 0x70, 0x00,
+    0xfe, 0x00, 0x0f, 0x80, 0x00, 0xe0, 0x00, 0x1c, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0e, 0x00,
+    0x01, 0xc0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf1, 0xff, 0xfc, 0x7f, 0xff, 0x00, 0x03, 0xc0, 0x01,
+    0xe0, 0x00, 0xf0, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0f, 0x00, 0x07, 0x80, 0x01, 0xc0, 0x00, 0xe0,
+    0x00, 0x78, 0x00, 0x3c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0xc0, 0x00, 0xe0, 0x00, 0x78, 0x00,
+    0x3f, 0xff, 0xcf, 0xff, 0xf3, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe3, 0xfc, 0x7f, 0x8e, 0x01, 0xc0, 0x38,
+    0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03,
+    0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xfe,
+    0x3f, 0xc7, 0xf8, 0x00, 0x00, 0x06, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x38, 0x01, 0xc0, 0x0e,
+    0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x38, 0x01, 0xc0, 0x0f, 0x00,
+    0x38, 0x01, 0xc0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x07, 0x00, 0x38,
+    0x01, 0xc0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x07, 0x00, 0x00, 0x00, 0xff, 0x1f, 0xe3, 0xfc, 0x03,
+    0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0,
+    0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c,
+    0x03, 0x8f, 0xf1, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x00, 0x7c, 0x00, 0x1f, 0x00, 0x0e, 0xe0, 0x07, 0xbc, 0x01, 0xc7, 0x00, 0xe0, 0xe0,
+    0x38, 0x38, 0x1c, 0x07, 0x07, 0x01, 0xc3, 0x80, 0x38, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x00, 0x00, 0x00, 0x40, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x1f, 0xf0, 0x0f, 0xfc, 0x04, 0x0f,
+    0x00, 0x03, 0x80, 0x01, 0xc0, 0x3f, 0xe0, 0x7f, 0xf0, 0x7f, 0xf8, 0x78, 0x1c, 0x38, 0x0e, 0x1c,
+    0x07, 0x0e, 0x03, 0x87, 0x81, 0xc1, 0xff, 0xe0, 0x7f, 0xf0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0xe0, 0x00, 0x1c, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x00,
+    0x07, 0x7e, 0x00, 0xff, 0xe0, 0x1f, 0xfe, 0x03, 0xc1, 0xe0, 0x70, 0x1c, 0x0e, 0x03, 0xc1, 0xc0,
+    0x38, 0x38, 0x07, 0x07, 0x00, 0xe0, 0xe0, 0x1c, 0x1c, 0x03, 0x83, 0x80, 0xf0, 0x70, 0x1c, 0x0e,
+    0x0f, 0x81, 0xff, 0xe0, 0x3f, 0xf8, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x07, 0xfc, 0x1f, 0xf8,
+    0x7c, 0x00, 0xe0, 0x03, 0xc0, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xf0,
+    0x00, 0xe0, 0x01, 0xf0, 0x41, 0xff, 0x81, 0xff, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x01,
+    0xc0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x1c, 0x00, 0x03, 0x80, 0x3f, 0x70, 0x0f,
+    0xfe, 0x03, 0xff, 0xc0, 0xf0, 0x78, 0x1c, 0x07, 0x07, 0x80, 0xe0, 0xe0, 0x1c, 0x1c, 0x03, 0x83,
+    0x80, 0x70, 0x70, 0x0e, 0x0e, 0x01, 0xc1, 0xe0, 0x38, 0x1c, 0x07, 0x03, 0xe0, 0xe0, 0x3f, 0xfc,
+    0x03, 0xff, 0x80, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x07, 0xfc, 0x03, 0xff,
+    0x81, 0xe0, 0xe0, 0x70, 0x1c, 0x38, 0x07, 0x0f, 0xff, 0xc3, 0xff, 0xf0, 0xff, 0xfc, 0x38, 0x00,
+    0x0e, 0x00, 0x03, 0xc0, 0x00, 0x70, 0x00, 0x1f, 0x02, 0x03, 0xff, 0x80, 0x7f, 0xe0, 0x07, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfc, 0x1f, 0xc3, 0xfc, 0x78, 0x47, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0xf8, 0x7f,
+    0x87, 0xf8, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07,
+    0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x07, 0xff, 0x01, 0xff, 0xe0, 0x78, 0x1c,
+    0x0e, 0x03, 0x83, 0xc0, 0x70, 0x70, 0x0e, 0x0e, 0x01, 0xc1, 0xc0, 0x38, 0x38, 0x07, 0x07, 0x00,
+    0xe0, 0x70, 0x1c, 0x0f, 0x07, 0x80, 0xff, 0xf0, 0x0f, 0xfe, 0x00, 0xfd, 0xc0, 0x00, 0x38, 0x00,
+    0x07, 0x00, 0x01, 0xe0, 0x60, 0x78, 0x0f, 0xff, 0x01, 0xff, 0xc0, 0x1f, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x00,
+    0x07, 0x00, 0x00, 0xe0, 0x00, 0x1f, 0xf0, 0x03, 0xff, 0x80, 0x7f, 0xf8, 0x0e, 0x0f, 0x01, 0xc0,
+    0xf0, 0x38, 0x0e, 0x07, 0x01, 0xc0, 0xe0, 0x38, 0x1c, 0x07, 0x03, 0x80, 0xe0, 0x70, 0x1c, 0x0e,
+    0x03, 0x81, 0xc0, 0x70, 0x38, 0x0e, 0x07, 0x01, 0xc0, 0xe0, 0x38, 0x1c, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x03, 0x81, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38,
+    0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0xc0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x81,
+    0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07,
+    0x03, 0x81, 0xc1, 0xe3, 0xe1, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x01, 0xc0, 0x00, 0xe0,
+    0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x81, 0xe1, 0xc0, 0xe0,
+    0xe0, 0xe0, 0x70, 0xe0, 0x38, 0xe0, 0x1c, 0xe0, 0x0e, 0xe0, 0x07, 0xe0, 0x03, 0xf8, 0x01, 0xde,
+    0x00, 0xe7, 0x80, 0x71, 0xe0, 0x38, 0x78, 0x1c, 0x1e, 0x0e, 0x07, 0x07, 0x01, 0xc3, 0x80, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0,
+    0x38, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x3c, 0x0f, 0xc1, 0xf0, 0x3c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x1f, 0x80, 0x3f, 0xfb, 0xfe, 0x01,
+    0xff, 0xff, 0xf8, 0x0e, 0x0f, 0xc3, 0xc0, 0x70, 0x3c, 0x0f, 0x03, 0x80, 0xe0, 0x38, 0x1c, 0x07,
+    0x01, 0xc0, 0xe0, 0x38, 0x0e, 0x07, 0x01, 0xc0, 0x70, 0x38, 0x0e, 0x03, 0x81, 0xc0, 0x70, 0x1c,
+    0x0e, 0x03, 0x80, 0xe0, 0x70, 0x1c, 0x07, 0x03, 0x80, 0xe0, 0x38, 0x1c, 0x07, 0x01, 0xc0, 0xe0,
+    0x38, 0x0e, 0x07, 0x01, 0xc0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x7f, 0xe0, 0x1f, 0xfc, 0x07, 0x07, 0x01, 0xc1, 0xe0, 0x70,
+    0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0,
+    0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xe0, 0x01, 0xff, 0x00, 0x7f, 0xf0, 0x1e, 0x0f, 0x03, 0x80, 0xe0, 0xf0, 0x1e, 0x1c, 0x01, 0xc3,
+    0x80, 0x38, 0x70, 0x07, 0x0e, 0x00, 0xe1, 0xc0, 0x1c, 0x3c, 0x07, 0x83, 0x80, 0xe0, 0x78, 0x3c,
+    0x07, 0xff, 0x00, 0x7f, 0xc0, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0xe0, 0x1f, 0xfe, 0x03, 0x83, 0xe0, 0x70, 0x1c, 0x0e, 0x03, 0xc1, 0xc0, 0x38, 0x38, 0x07,
+    0x07, 0x00, 0xe0, 0xe0, 0x1c, 0x1c, 0x03, 0x83, 0x80, 0xf0, 0x70, 0x1c, 0x0f, 0x07, 0x81, 0xff,
+    0xe0, 0x3f, 0xf8, 0x07, 0x7e, 0x00, 0xe0, 0x00, 0x1c, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0e,
+    0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x07, 0xff,
+    0x01, 0xff, 0xe0, 0x7c, 0x1c, 0x0e, 0x03, 0x83, 0xc0, 0x70, 0x70, 0x0e, 0x0e, 0x01, 0xc1, 0xc0,
+    0x38, 0x38, 0x07, 0x07, 0x00, 0xe0, 0xf0, 0x1c, 0x0e, 0x03, 0x81, 0xe0, 0xf0, 0x1f, 0xfe, 0x01,
+    0xff, 0xc0, 0x1f, 0xb8, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x1c, 0x00, 0x03, 0x80, 0x00, 0x70,
+    0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xf8, 0xff, 0x8f, 0xf8, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00,
+    0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x81, 0xff, 0x07, 0xfc, 0x3c, 0x10, 0xe0, 0x03, 0x80,
+    0x0f, 0x00, 0x1f, 0x80, 0x3f, 0x80, 0x3f, 0x00, 0x1e, 0x00, 0x38, 0x00, 0xe3, 0x07, 0x8f, 0xfe,
+    0x3f, 0xf0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xfe,
+    0x0f, 0xf0, 0x7f, 0x83, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70,
+    0x03, 0x80, 0x1c, 0x00, 0xf0, 0x03, 0xfc, 0x1f, 0xe0, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03,
+    0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e,
+    0x07, 0x03, 0x81, 0xc0, 0xe0, 0x78, 0x38, 0x0e, 0x0e, 0x03, 0xff, 0x80, 0x7f, 0xe0, 0x0f, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe0, 0x0e, 0x70, 0x07, 0x1c, 0x07, 0x0e, 0x03, 0x87, 0x01, 0xc1, 0xc1, 0xc0,
+    0xe0, 0xe0, 0x70, 0x70, 0x1c, 0x70, 0x0e, 0x38, 0x07, 0xbc, 0x01, 0xdc, 0x00, 0xee, 0x00, 0x3e,
+    0x00, 0x1f, 0x00, 0x0f, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x1c, 0x07, 0x38, 0x0e, 0x03, 0x8e, 0x07, 0x03, 0x87, 0x07, 0xc1, 0xc3, 0x83,
+    0xe0, 0xe1, 0xc1, 0xb0, 0x70, 0x60, 0xd8, 0x30, 0x38, 0xee, 0x38, 0x1c, 0x77, 0x1c, 0x0e, 0x31,
+    0x8e, 0x03, 0xb8, 0xee, 0x01, 0xdc, 0x77, 0x00, 0xec, 0x1b, 0x80, 0x3e, 0x0f, 0x80, 0x1f, 0x07,
+    0xc0, 0x0f, 0x01, 0xe0, 0x03, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x1c, 0x38, 0x38, 0x1c, 0x38, 0x1c, 0x70, 0x0e, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x07, 0xc0, 0x07, 0xe0, 0x0e, 0xf0, 0x1e, 0x70, 0x1c, 0x38, 0x38, 0x3c, 0x38, 0x1c, 0x70,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x0e, 0x70, 0x0e, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x1c, 0x38, 0x1c, 0x38, 0x1c,
+    0x38, 0x0e, 0x38, 0x0e, 0x70, 0x0e, 0x70, 0x07, 0x70, 0x07, 0x60, 0x07, 0x60, 0x03, 0xe0, 0x03,
+    0xc0, 0x03, 0xc0, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0x80, 0x7f, 0x00, 0x7f, 0x00, 0x7c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xe0, 0x03, 0xc0, 0x07, 0x00, 0x1c, 0x00, 0x70, 0x01,
+    0xc0, 0x07, 0x00, 0x1c, 0x00, 0x70, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x00, 0x3f, 0xfe, 0x7f, 0xfc,
+    0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x3e, 0x0f, 0xc1, 0xe0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01,
+    0xc0, 0x38, 0x0f, 0x07, 0xc0, 0xf0, 0x1f, 0x00, 0xf0, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0,
+    0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xe0, 0x3f, 0x03, 0xe0, 0x1c, 0x00, 0x00, 0x03, 0x81, 0xc0,
+    0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03,
+    0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e,
+    0x00, 0x00, 0x01, 0xc0, 0x3e, 0x07, 0xe0, 0x3c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07,
+    0x00, 0xe0, 0x1c, 0x03, 0x80, 0x78, 0x07, 0xc0, 0x78, 0x1f, 0x07, 0x80, 0xe0, 0x1c, 0x03, 0x80,
+    0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x3c, 0x1f, 0x83, 0xe0, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x07, 0x0f, 0xc1,
+    0xc3, 0xfc, 0xf1, 0xe7, 0xf8, 0x70, 0x7e, 0x1c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x1f, 0xc7, 0x1c,
+    0xc1, 0x98, 0x33, 0x8e, 0x3f, 0x83, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x71, 0xc0, 0xee, 0x01, 0xf0, 0x03,
+    0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x7f, 0xc1, 0xff, 0x0f, 0x04, 0x38, 0x00, 0xe0,
+    0x03, 0xc0, 0x07, 0xe0, 0x0f, 0xe0, 0x0f, 0xc0, 0x07, 0x80, 0x0e, 0x00, 0x38, 0xc1, 0xe3, 0xff,
+    0x8f, 0xfc, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0xe6, 0x07, 0x30, 0x39, 0x81, 0xc0, 0x0e, 0x00, 0x7f,
+    0x83, 0xfc, 0x1f, 0xe0, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c,
+    0x00, 0xe0, 0x07, 0x00, 0x3c, 0x00, 0xff, 0x07, 0xf8, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x01, 0xc7, 0x01, 0xdc, 0x01, 0xf0, 0x01,
+    0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe7, 0xff, 0xcf, 0xff, 0x80, 0x0f, 0x00, 0x1c,
+    0x00, 0x70, 0x01, 0xc0, 0x07, 0x00, 0x1c, 0x00, 0x70, 0x01, 0xc0, 0x03, 0x80, 0x0e, 0x00, 0x38,
+    0x00, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x3f, 0xe0, 0x1f, 0xf8, 0x08, 0x1e, 0x00,
+    0x07, 0x00, 0x03, 0x80, 0x7f, 0xc0, 0xff, 0xe0, 0xff, 0xf0, 0xf0, 0x38, 0x70, 0x1c, 0x38, 0x0e,
+    0x1c, 0x07, 0x0f, 0x03, 0x83, 0xff, 0xc0, 0xff, 0xe0, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x71, 0xc0,
+    0x77, 0x00, 0x7c, 0x00, 0x70, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x7f, 0xc1, 0xff,
+    0x87, 0xc0, 0x0e, 0x00, 0x3c, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0f,
+    0x00, 0x0e, 0x00, 0x1f, 0x04, 0x1f, 0xf8, 0x1f, 0xf0, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x0e,
+    0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x03, 0xfe,
+    0x01, 0xff, 0xc0, 0xf0, 0x70, 0x38, 0x0e, 0x1c, 0x03, 0x87, 0xff, 0xe1, 0xff, 0xf8, 0x7f, 0xfe,
+    0x1c, 0x00, 0x07, 0x00, 0x01, 0xe0, 0x00, 0x38, 0x00, 0x0f, 0x81, 0x01, 0xff, 0xc0, 0x3f, 0xf0,
+    0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x10, 0x03, 0x8e, 0x00, 0x77, 0x00, 0x0f, 0x80, 0x01, 0xc0, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xff, 0x80, 0x7f, 0xf0, 0x3c, 0x1c, 0x0e,
+    0x03, 0x87, 0x00, 0xe1, 0xff, 0xf8, 0x7f, 0xfe, 0x1f, 0xff, 0x87, 0x00, 0x01, 0xc0, 0x00, 0x78,
+    0x00, 0x0e, 0x00, 0x03, 0xe0, 0x40, 0x7f, 0xf0, 0x0f, 0xfc, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0,
+    0xe0, 0xe0, 0xe0, 0x20, 0x00, 0x00, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07,
+    0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x00, 0x1c, 0x70, 0x00, 0x71, 0xc0, 0x01, 0xc7, 0x00,
+    0x07, 0x18, 0x00, 0x1c, 0x60, 0x00, 0x71, 0x80, 0x01, 0xc0, 0x03, 0xf7, 0x00, 0x1f, 0xfc, 0x00,
+    0xff, 0xf0, 0x07, 0x83, 0xc0, 0x1c, 0x07, 0x00, 0xf0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0,
+    0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0f, 0x01, 0xc0, 0x1c, 0x07, 0x00, 0x7c, 0x1c,
+    0x00, 0xff, 0xf0, 0x01, 0xff, 0xc0, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04,
+    0x00, 0xe3, 0x80, 0x1d, 0xc0, 0x03, 0xe0, 0x00, 0x70, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xfc, 0x01, 0xff, 0x80, 0x7f, 0xf0, 0x1c, 0x1c, 0x07, 0x07, 0x81, 0xc0, 0xe0, 0x70, 0x38,
+    0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0,
+    0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x87, 0x1c, 0x3b, 0x81, 0xf0, 0x0e, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x1f, 0xc7, 0xfc, 0x7f, 0xc7, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00,
+    0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x63,
+    0x00, 0x18, 0xc0, 0x06, 0x30, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x0e, 0x07, 0x03,
+    0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e,
+    0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1e, 0x0e, 0x03, 0x83, 0x80, 0xff, 0xe0, 0x1f, 0xf8,
+    0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x80, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0x70, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07,
+    0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c,
+    0x0e, 0x07, 0x83, 0x80, 0xe0, 0xe0, 0x3f, 0xf8, 0x07, 0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x03,
+    0x9c, 0x03, 0x8e, 0x07, 0x0e, 0x07, 0x0e, 0x07, 0x07, 0x0e, 0x07, 0x0e, 0x07, 0x0e, 0x03, 0x8e,
+    0x03, 0x9c, 0x03, 0x9c, 0x01, 0xdc, 0x01, 0xd8, 0x01, 0xd8, 0x00, 0xf8, 0x00, 0xf0, 0x00, 0xf0,
+    0x00, 0x70, 0x00, 0xf0, 0x00, 0xe0, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const twr_font_glyph_t twr_font_ubuntu_33_glyphs[110] = {
+    {0x20, 7, 33, 0},
+    {0x21, 9, 33, 231},
+    {0x22, 13, 33, 528},
+    {0x23, 21, 33, 957},
+    {0x24, 18, 33, 1650},
+    {0x25, 27, 33, 2244},
+    {0x26, 21, 33, 3135},
+    {0x27, 8, 33, 3828},
+    {0x28, 11, 33, 4092},
+    {0x29, 10, 33, 4455},
+    {0x2a, 15, 33, 4785},
+    {0x2b, 18, 33, 5280},
+    {0x2c, 8, 33, 5874},
+    {0x2d, 10, 33, 6138},
+    {0x2e, 8, 33, 6468},
+    {0x2f, 13, 33, 6732},
+    {0x30, 18, 33, 7161},
+    {0x31, 18, 33, 7755},
+    {0x32, 18, 33, 8349},
+    {0x33, 18, 33, 8943},
+    {0x34, 18, 33, 9537},
+    {0x35, 18, 33, 10131},
+    {0x36, 18, 33, 10725},
+    {0x37, 18, 33, 11319},
+    {0x38, 18, 33, 11913},
+    {0x39, 18, 33, 12507},
+    {0x3a, 8, 33, 13101},
+    {0x3b, 8, 33, 13365},
+    {0x3c, 18, 33, 13629},
+    {0x3d, 18, 33, 14223},
+    {0x3e, 18, 33, 14817},
+    {0x3f, 13, 33, 15411},
+    {0x40, 30, 33, 15840},
+    {0x41, 21, 33, 16830},
+    {0x42, 21, 33, 17523},
+    {0x43, 20, 33, 18216},
+    {0x44, 23, 33, 18876},
+    {0x45, 18, 33, 19635},
+    {0x46, 17, 33, 20229},
+    {0x47, 22, 33, 20790},
+    {0x48, 23, 33, 21516},
+    {0x49, 9, 33, 22275},
+    {0x4a, 16, 33, 22572},
+    {0x4b, 20, 33, 23100},
+    {0x4c, 17, 33, 23760},
+    {0x4d, 29, 33, 24321},
+    {0x4e, 23, 33, 25278},
+    {0x4f, 25, 33, 26037},
+    {0x50, 19, 33, 26862},
+    {0x51, 25, 33, 27489},
+    {0x52, 20, 33, 28314},
+    {0x53, 17, 33, 28974},
+    {0x54, 19, 33, 29535},
+    {0x55, 22, 33, 30162},
+    {0x56, 21, 33, 30888},
+    {0x57, 31, 33, 31581},
+    {0x58, 20, 33, 32604},
+    {0x59, 19, 33, 33264},
+    {0x5a, 18, 33, 33891},
+    {0x5b, 11, 33, 34485},
+    {0x5c, 13, 33, 34848},
+    {0x5d, 11, 33, 35277},
+    {0x5e, 18, 33, 35640},
+    {0x5f, 16, 33, 36234},
+    {0x60, 12, 33, 36762},
+    {0x61, 17, 33, 37158},
+    {0x62, 19, 33, 37719},
+    {0x63, 15, 33, 38346},
+    {0x64, 19, 33, 38841},
+    {0x65, 18, 33, 39468},
+    {0x66, 12, 33, 40062},
+    {0x67, 19, 33, 40458},
+    {0x68, 19, 33, 41085},
+    {0x69, 9, 33, 41712},
+    {0x6a, 9, 33, 42009},
+    {0x6b, 17, 33, 42306},
+    {0x6c, 10, 33, 42867},
+    {0x6d, 29, 33, 43197},
+    {0x6e, 18, 33, 44154},
+    {0x6f, 19, 33, 44748},
+    {0x70, 19, 33, 45375},
+    {0x71, 19, 33, 46002},
+    {0x72, 12, 33, 46629},
+    {0x73, 14, 33, 47025},
+    {0x74, 13, 33, 47487},
+    {0x75, 18, 33, 47916},
+    {0x76, 17, 33, 48510},
+    {0x77, 25, 33, 49071},
+    {0x78, 16, 33, 49896},
+    {0x79, 16, 33, 50424},
+    {0x7a, 15, 33, 50952},
+    {0x7b, 11, 33, 51447},
+    {0x7c, 9, 33, 51810},
+    {0x7d, 11, 33, 52107},
+    {0x7e, 18, 33, 52470},
+    {0xb0, 11, 33, 53064},
+    {0xb9, 14, 33, 53427},
+    {0xbb, 13, 33, 53889},
+    {0xbe, 15, 33, 54318},
+    {0xe1, 17, 33, 54813},
+    {0xe8, 15, 33, 55374},
+    {0xe9, 18, 33, 55869},
+    {0xec, 18, 33, 56463},
+    {0xed, 9, 33, 57057},
+    {0xef, 22, 33, 57354},
+    {0xf2, 18, 33, 58080},
+    {0xf8, 12, 33, 58674},
+    {0xf9, 18, 33, 59070},
+    {0xfa, 18, 33, 59664},
+    {0xfd, 16, 33, 60258}
+};
+
+static const uint8_t twr_font_ubuntu_33_index[222] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0x61, 0xff, 0xff, 0x62, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x65, 0xff, 0xff, 0x66, 0x67, 0xff, 0x68,
+    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6b, 0x6c, 0xff, 0xff, 0x6d
+};
+
+const twr_font_t twr_font_ubuntu_33 = { 110, NULL, 0x20, 222, twr_font_ubuntu_33_index, twr_font_ubuntu_33_glyphs, twr_font_ubuntu_33_bitmaps };
@@ -1,5 +1,23 @@
 #include <twr_gfx.h>
 
+// Number of glyph positions of aligned string kept between measuring and drawing
+#define _TWR_GFX_ALIGNED_LENGTH_MAX 32
+
+static int _twr_gfx_find_char(const twr_font_t *font, uint16_t code);
+static int _twr_gfx_draw_glyph(twr_gfx_t *self, int left, int top, int position, uint32_t color);
+static inline void _twr_gfx_get_glyph_size(const twr_font_t *font, int position, int *width, int *height);
+static int _twr_gfx_measure_string(twr_gfx_t *self, int x, int top, const char *str, twr_gfx_align_t align, twr_gfx_box_t *box, int16_t *positions, int *length);
+static void _twr_gfx_get_bitmap(const twr_font_t *font, int position, twr_gfx_bitmap_t *bitmap);
+static inline bool _twr_gfx_bitmap_is_drawn(const twr_gfx_bitmap_t *bitmap, int x, int y);
+static void _twr_gfx_fill(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color);
+static void _twr_gfx_rotate_rectangle(twr_gfx_t *self, int *x0, int *y0, int *x1, int *y1);
+static inline bool _twr_gfx_is_inside(twr_gfx_t *self, int x0, int y0, int x1, int y1);
+static void _twr_gfx_pixel_0(twr_gfx_t *self, int x, int y, uint32_t color);
+static void _twr_gfx_pixel_90(twr_gfx_t *self, int x, int y, uint32_t color);
+static void _twr_gfx_pixel_180(twr_gfx_t *self, int x, int y, uint32_t color);
+static void _twr_gfx_pixel_270(twr_gfx_t *self, int x, int y, uint32_t color);
+static bool _twr_gfx_draw_char_rotated(twr_gfx_t *self, int left, int top, const twr_gfx_bitmap_t *bitmap, uint32_t color);
+
 void twr_gfx_init(twr_gfx_t *self, void *display, const twr_gfx_driver_t *driver)
 {
     memset(self, 0, sizeof(*self));
@@ -7,6 +25,8 @@ void twr_gfx_init(twr_gfx_t *self, void *display, const twr_gfx_driver_t *driver
     self->_driver = driver;
 
     self->_caps = driver->get_caps(self->_display);
+
+    twr_gfx_set_rotation(self, TWR_GFX_ROTATION_0);
 }
 
 bool twr_gfx_display_is_ready(twr_gfx_t *self)
@@ -32,55 +52,51 @@ void twr_gfx_set_font(twr_gfx_t *self, const twr_font_t *font)
 void twr_gfx_set_rotation(twr_gfx_t *self, twr_gfx_rotation_t rotation)
 {
     self->_rotation = rotation;
-}
 
-twr_gfx_rotation_t twr_gfx_get_rotation(twr_gfx_t *self)
-{
-    return self->_rotation;
-}
-
-void twr_gfx_draw_pixel(twr_gfx_t *self, int x, int y, uint32_t color)
-{
-    if (x >= self->_caps.width || y >= self->_caps.height || x < 0 || y < 0)
-    {
-        return;
-    }
-
-    int tmp;
-
-    switch (self->_rotation)
+    // Rotation is resolved once here instead of for every pixel
+    switch (rotation)
     {
         case TWR_GFX_ROTATION_90:
         {
-            tmp = x;
-            x = self->_caps.height - 1 - y;
-            y = tmp;
+            self->_pixel = _twr_gfx_pixel_90;
             break;
         }
         case TWR_GFX_ROTATION_180:
         {
-            x = self->_caps.width - 1 - x;
-            y = self->_caps.height - 1 - y;
+            self->_pixel = _twr_gfx_pixel_180;
             break;
         }
         case TWR_GFX_ROTATION_270:
         {
-            tmp = y;
-            y = self->_caps.width - 1 - x;
-            x = tmp;
+            self->_pixel = _twr_gfx_pixel_270;
             break;
         }
         case TWR_GFX_ROTATION_0:
         {
+            self->_pixel = _twr_gfx_pixel_0;
             break;
         }
         default:
         {
+            self->_pixel = _twr_gfx_pixel_0;
             break;
         }
     }
+}
 
-    self->_driver->draw_pixel(self->_display, x, y, color);
+twr_gfx_rotation_t twr_gfx_get_rotation(twr_gfx_t *self)
+{
+    return self->_rotation;
+}
+
+void twr_gfx_draw_pixel(twr_gfx_t *self, int x, int y, uint32_t color)
+{
+    if (x >= self->_caps.width || y >= self->_caps.height || x < 0 || y < 0)
+    {
+        return;
+    }
+
+    self->_pixel(self, x, y, color);
 }
 
 int twr_gfx_draw_char(twr_gfx_t *self, int left, int top, uint8_t ch, uint32_t color)
@@ -90,46 +106,41 @@ int twr_gfx_draw_char(twr_gfx_t *self, int left, int top, uint8_t ch, uint32_t c
         return 0;
     }
 
-    const twr_font_t *font = self->_font;
+    int position = _twr_gfx_find_char(self->_font, ch);
+
+    if (position < 0)
+    {
+        return 0;
+    }
 
-    int w = 0;
-    uint8_t h = 0;
-    uint16_t i;
-    uint16_t x;
-    uint16_t y;
-    uint8_t bytes;
+    return _twr_gfx_draw_glyph(self, left, top, position, color);
+}
 
-    for (i = 0; i < font->length; i++)
+int twr_gfx_calc_char_width(twr_gfx_t *self, uint8_t ch)
+{
+    if (!self->_font)
     {
-        if (font->chars[i].code == ch)
-        {
-            w = font->chars[i].image->width;
-            h = font->chars[i].image->heigth;
+        return 0;
+    }
 
-            bytes = (w + 7) / 8;
+    const twr_font_t *font = self->_font;
 
-            for (y = 0; y < h; y++)
-            {
-                for (x = 0; x < w; x++)
-                {
-                    uint32_t byteIndex = x / 8;
-                    byteIndex += y * bytes;
-
-                    uint8_t bitMask = 1 << (7 - (x % 8));
-
-                    if ((font->chars[i].image->image[byteIndex] & bitMask) == 0)
-                    {
-                        twr_gfx_draw_pixel(self, left + x, top + y, color);
-                    }
-                }
-            }
-        }
+    int position = _twr_gfx_find_char(font, ch);
+
+    if (position < 0)
+    {
+        return 0;
     }
 
-    return w;
+    int width;
+    int height;
+
+    _twr_gfx_get_glyph_size(font, position, &width, &height);
+
+    return width;
 }
 
-int twr_gfx_calc_char_width(twr_gfx_t *self, uint8_t ch)
+int twr_gfx_calc_char_height(twr_gfx_t *self, uint8_t ch)
 {
     if (!self->_font)
     {
@@ -138,15 +149,19 @@ int twr_gfx_calc_char_width(twr_gfx_t *self, uint8_t ch)
 
     const twr_font_t *font = self->_font;
 
-    for (int i = 0; i < font->length; i++)
+    int position = _twr_gfx_find_char(font, ch);
+
+    if (position < 0)
     {
-        if (font->chars[i].code == ch)
-        {
-            return font->chars[i].image->width;
-        }
+        return 0;
     }
 
-    return 0;
+    int width;
+    int height;
+
+    _twr_gfx_get_glyph_size(font, position, &width, &height);
+
+    return height;
 }
 
 int twr_gfx_draw_string(twr_gfx_t *self, int left, int top, char *str, uint32_t color)
@@ -170,6 +185,40 @@ int twr_gfx_calc_string_width(twr_gfx_t *self,  char *str)
     return width;
 }
 
+int twr_gfx_draw_string_aligned(twr_gfx_t *self, int x, int top, char *str, twr_gfx_align_t align, uint32_t color, twr_gfx_box_t *box)
+{
+    // Glyphs found while measuring are drawn without another lookup
+    int16_t positions[_TWR_GFX_ALIGNED_LENGTH_MAX];
+    int length;
+    twr_gfx_box_t measured;
+
+    int left = _twr_gfx_measure_string(self, x, top, str, align, &measured, positions, &length);
+
+    if (box != NULL)
+    {
+        *box = measured;
+    }
+
+    for (int i = 0; self->_font != NULL && str[i]; i++)
+    {
+        int position = i < length ? positions[i] : _twr_gfx_find_char(self->_font, (uint8_t) str[i]);
+
+        if (position >= 0)
+        {
+            left += _twr_gfx_draw_glyph(self, left, top, position, color);
+        }
+    }
+
+    return left;
+}
+
+int twr_gfx_calc_string_box(twr_gfx_t *self, int x, int top, char *str, twr_gfx_align_t align, twr_gfx_box_t *box)
+{
+    int left = _twr_gfx_measure_string(self, x, top, str, align, box, NULL, NULL);
+
+    return left + box->width;
+}
+
 int twr_gfx_printf(twr_gfx_t *self, int left, int top, uint32_t color, char *format, ...)
 {
     va_list ap;
@@ -198,10 +247,7 @@ void twr_gfx_draw_line(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t
             x1 = tmp;
         }
 
-        for (; x0 <= x1; x0++)
-        {
-            twr_gfx_draw_pixel(self, x0, y0, color);
-        }
+        _twr_gfx_fill(self, x0, y0, x1, y1, color);
 
         return;
     }
@@ -214,14 +260,14 @@ void twr_gfx_draw_line(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t
             y1 = tmp;
         }
 
-        for (; y0 <= y1; y0++)
-        {
-            twr_gfx_draw_pixel(self, x0, y0, color);
-        }
+        _twr_gfx_fill(self, x0, y0, x1, y1, color);
 
         return;
     }
 
+    // Line with both ends on display lies on display whole
+    void (*pixel)(twr_gfx_t *, int, int, uint32_t) = _twr_gfx_is_inside(self, x0, y0, x0, y0) && _twr_gfx_is_inside(self, x1, y1, x1, y1) ? self->_pixel : twr_gfx_draw_pixel;
+
     int16_t step = abs(y1 - y0) > abs(x1 - x0);
 
     if (step)
@@ -258,11 +304,11 @@ void twr_gfx_draw_line(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t
     {
         if (step)
         {
-            twr_gfx_draw_pixel(self, y0, x0, color);
+            pixel(self, y0, x0, color);
         }
         else
         {
-            twr_gfx_draw_pixel(self, x0, y0, color);
+            pixel(self, x0, y0, color);
         }
 
         err -= dy;
@@ -285,18 +331,13 @@ void twr_gfx_draw_rectangle(twr_gfx_t *self, int x0, int y0, int x1, int y1, uin
 
 void twr_gfx_draw_fill_rectangle(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color)
 {
-    int y;
-    for (; x0 <= x1; x0++)
-    {
-        for (y = y0; y <= y1; y++)
-        {
-            twr_gfx_draw_pixel(self, x0, y, color);
-        }
-    }
+    _twr_gfx_fill(self, x0, y0, x1, y1, color);
 }
 
 void twr_gfx_draw_fill_rectangle_dithering(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color)
 {
+    void (*pixel)(twr_gfx_t *, int, int, uint32_t) = _twr_gfx_is_inside(self, x0, y0, x1, y1) ? self->_pixel : twr_gfx_draw_pixel;
+
     int y;
     for (; x0 <= x1; x0++)
     {
@@ -305,7 +346,7 @@ void twr_gfx_draw_fill_rectangle_dithering(twr_gfx_t *self, int x0, int y0, int
             uint8_t dx = x0 % 4;
             uint8_t dy = y % 4;
             uint32_t d_color = color & (1 << (dx + 4*dy));
-            twr_gfx_draw_pixel(self, x0, y, d_color);
+            pixel(self, x0, y, d_color);
         }
     }
 }
@@ -318,17 +359,19 @@ void twr_gfx_draw_circle(twr_gfx_t *self, int x0, int y0, int radius, uint32_t c
     int dy = 1;
     int err = dx - (radius << 1);
 
+    void (*pixel)(twr_gfx_t *, int, int, uint32_t) = _twr_gfx_is_inside(self, x0 - radius, y0 - radius, x0 + radius, y0 + radius) ? self->_pixel : twr_gfx_draw_pixel;
+
     while (x >= y)
     {
 
-        twr_gfx_draw_pixel(self, x0 - y, y0 + x, color);
-        twr_gfx_draw_pixel(self, x0 - x, y0 + y, color);
-        twr_gfx_draw_pixel(self, x0 - x, y0 - y, color);
-        twr_gfx_draw_pixel(self, x0 - y, y0 - x, color);
-        twr_gfx_draw_pixel(self, x0 + y, y0 - x, color);
-        twr_gfx_draw_pixel(self, x0 + x, y0 - y, color);
-        twr_gfx_draw_pixel(self, x0 + x, y0 + y, color);
-        twr_gfx_draw_pixel(self, x0 + y, y0 + x, color);
+        pixel(self, x0 - y, y0 + x, color);
+        pixel(self, x0 - x, y0 + y, color);
+        pixel(self, x0 - x, y0 - y, color);
+        pixel(self, x0 - y, y0 - x, color);
+        pixel(self, x0 + y, y0 - x, color);
+        pixel(self, x0 + x, y0 - y, color);
+        pixel(self, x0 + x, y0 + y, color);
+        pixel(self, x0 + y, y0 + x, color);
 
         if (err <= 0)
         {
@@ -383,30 +426,32 @@ void twr_gfx_draw_round_corner(twr_gfx_t *self, int x0, int y0, int radius, twr_
     int dy = 1;
     int err = dx - (radius << 1);
 
+    void (*pixel)(twr_gfx_t *, int, int, uint32_t) = _twr_gfx_is_inside(self, x0 - radius, y0 - radius, x0 + radius, y0 + radius) ? self->_pixel : twr_gfx_draw_pixel;
+
     while (x >= y)
     {
         if (corner & TWR_GFX_ROUND_CORNER_RIGHT_TOP)
         {
-            twr_gfx_draw_pixel(self, x0 + y, y0 - x, color);
-            twr_gfx_draw_pixel(self, x0 + x, y0 - y, color);
+            pixel(self, x0 + y, y0 - x, color);
+            pixel(self, x0 + x, y0 - y, color);
         }
 
         if (corner & TWR_GFX_ROUND_CORNER_RIGHT_BOTTOM)
         {
-            twr_gfx_draw_pixel(self, x0 + x, y0 + y, color);
-            twr_gfx_draw_pixel(self, x0 + y, y0 + x, color);
+            pixel(self, x0 + x, y0 + y, color);
+            pixel(self, x0 + y, y0 + x, color);
         }
 
         if (corner & TWR_GFX_ROUND_CORNER_LEFT_BOTTOM)
         {
-            twr_gfx_draw_pixel(self, x0 - y, y0 + x, color);
-            twr_gfx_draw_pixel(self, x0 - x, y0 + y, color);
+            pixel(self, x0 - y, y0 + x, color);
+            pixel(self, x0 - x, y0 + y, color);
         }
 
         if (corner & TWR_GFX_ROUND_CORNER_LEFT_TOP)
         {
-            twr_gfx_draw_pixel(self, x0 - x, y0 - y, color);
-            twr_gfx_draw_pixel(self, x0 - y, y0 - x, color);
+            pixel(self, x0 - x, y0 - y, color);
+            pixel(self, x0 - y, y0 - x, color);
         }
 
         if (err <= 0)
@@ -473,7 +518,412 @@ void twr_gfx_draw_fill_round_corner(twr_gfx_t *self, int x0, int y0, int radius,
     }
 }
 
+bool twr_gfx_scroll(twr_gfx_t *self, int x0, int y0, int x1, int y1, int dx)
+{
+    if (self->_driver->scroll == NULL || !_twr_gfx_is_inside(self, x0, y0, x1, y1))
+    {
+        return false;
+    }
+
+    _twr_gfx_rotate_rectangle(self, &x0, &y0, &x1, &y1);
+
+    // Horizontal direction of rotated display
+    switch (self->_rotation)
+    {
+        case TWR_GFX_ROTATION_90:
+        {
+            self->_driver->scroll(self->_display, x0, y0, x1, y1, 0, dx);
+            break;
+        }
+        case TWR_GFX_ROTATION_180:
+        {
+            self->_driver->scroll(self->_display, x0, y0, x1, y1, -dx, 0);
+            break;
+        }
+        case TWR_GFX_ROTATION_270:
+        {
+            self->_driver->scroll(self->_display, x0, y0, x1, y1, 0, -dx);
+            break;
+        }
+        case TWR_GFX_ROTATION_0:
+        {
+            self->_driver->scroll(self->_display, x0, y0, x1, y1, dx, 0);
+            break;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool twr_gfx_update(twr_gfx_t *self)
 {
     return self->_driver->update(self->_display);
 }
+
+static int _twr_gfx_find_char(const twr_font_t *font, uint16_t code)
+{
+    if (font->index != NULL)
+    {
+        uint16_t n = code - font->index_first;
+
+        if (code < font->index_first || n >= font->index_length || font->index[n] == TWR_FONT_INDEX_NONE)
+        {
+            return -1;
+        }
+
+        return font->index[n];
+    }
+
+    // Fonts without index table are searched by bisection of chars sorted by code
+    int low = 0;
+    int high = font->length - 1;
+
+    while (low <= high)
+    {
+        int middle = (low + high) / 2;
+
+        uint16_t middle_code = font->chars != NULL ? font->chars[middle].code : font->glyphs[middle].code;
+
+        if (middle_code < code)
+        {
+            low = middle + 1;
+        }
+        else if (middle_code > code)
+        {
+            high = middle - 1;
+        }
+        else
+        {
+            return middle;
+        }
+    }
+
+    return -1;
+}
+
+static int _twr_gfx_draw_glyph(twr_gfx_t *self, int left, int top, int position, uint32_t color)
+{
+    twr_gfx_bitmap_t bitmap;
+
+    _twr_gfx_get_bitmap(self->_font, position, &bitmap);
+
+    int w = bitmap.width;
+    int h = bitmap.height;
+
+    bool inside = _twr_gfx_is_inside(self, left, top, left + w - 1, top + h - 1);
+
+    // Glyph fully on display is passed to driver straight from font data
+    if (inside && self->_driver->draw_bitmap != NULL)
+    {
+        if (self->_rotation == TWR_GFX_ROTATION_0)
+        {
+            self->_driver->draw_bitmap(self->_display, left, top, &bitmap, false, color);
+
+            return w;
+        }
+
+        if (self->_rotation == TWR_GFX_ROTATION_180)
+        {
+            self->_driver->draw_bitmap(self->_display, self->_caps.width - left - w, self->_caps.height - top - h, &bitmap, true, color);
+
+            return w;
+        }
+
+        if (_twr_gfx_draw_char_rotated(self, left, top, &bitmap, color))
+        {
+            return w;
+        }
+    }
+
+    // Clipping is done per glyph, pixels of glyph fully on display are not checked
+    void (*pixel)(twr_gfx_t *, int, int, uint32_t) = inside ? self->_pixel : twr_gfx_draw_pixel;
+
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            if (_twr_gfx_bitmap_is_drawn(&bitmap, x, y))
+            {
+                pixel(self, left + x, top + y, color);
+            }
+        }
+    }
+
+    return w;
+}
+
+static inline void _twr_gfx_get_glyph_size(const twr_font_t *font, int position, int *width, int *height)
+{
+    if (font->chars != NULL)
+    {
+        *width = font->chars[position].image->width;
+        *height = font->chars[position].image->heigth;
+    }
+    else
+    {
+        *width = font->glyphs[position].width;
+        *height = font->glyphs[position].height;
+    }
+}
+
+static int _twr_gfx_measure_string(twr_gfx_t *self, int x, int top, const char *str, twr_gfx_align_t align, twr_gfx_box_t *box, int16_t *positions, int *length)
+{
+    int count = 0;
+    int width = 0;
+    int height = 0;
+
+    for (const char *s = str; self->_font != NULL && *s; s++)
+    {
+        int position = _twr_gfx_find_char(self->_font, (uint8_t) *s);
+
+        // Positions of the first glyphs are kept for drawing if requested
+        if (positions != NULL && count < _TWR_GFX_ALIGNED_LENGTH_MAX)
+        {
+            positions[count++] = position;
+        }
+
+        if (position >= 0)
+        {
+            int w;
+            int h;
+
+            _twr_gfx_get_glyph_size(self->_font, position, &w, &h);
+
+            width += w;
+
+            if (h > height)
+            {
+                height = h;
+            }
+        }
+    }
+
+    if (length != NULL)
+    {
+        *length = count;
+    }
+
+    int left = x;
+
+    if (align == TWR_GFX_ALIGN_CENTER)
+    {
+        left -= width / 2;
+    }
+    else if (align == TWR_GFX_ALIGN_RIGHT)
+    {
+        left -= width;
+    }
+
+    box->left = left;
+    box->top = top;
+    box->width = width;
+    box->height = height;
+
+    return left;
+}
+
+static void _twr_gfx_get_bitmap(const twr_font_t *font, int position, twr_gfx_bitmap_t *bitmap)
+{
+    if (font->chars != NULL)
+    {
+        const twr_font_image_t *image = font->chars[position].image;
+
+        // Rows of font image are padded to whole bytes
+        bitmap->data = image->image;
+        bitmap->offset = 0;
+        bitmap->stride = ((image->width + 7) / 8) * 8;
+        bitmap->width = image->width;
+        bitmap->height = image->heigth;
+        bitmap->inverted = true;
+
+        return;
+    }
+
+    const twr_font_glyph_t *glyph = &font->glyphs[position];
+
+    bitmap->data = font->bitmaps;
+    bitmap->offset = glyph->offset;
+    bitmap->stride = glyph->width;
+    bitmap->width = glyph->width;
+    bitmap->height = glyph->height;
+    bitmap->inverted = false;
+}
+
+static inline bool _twr_gfx_bitmap_is_drawn(const twr_gfx_bitmap_t *bitmap, int x, int y)
+{
+    uint32_t bit = bitmap->offset + y * bitmap->stride + x;
+
+    return ((bitmap->data[bit / 8] >> (7 - (bit % 8))) & 1) != bitmap->inverted;
+}
+
+static void _twr_gfx_fill(twr_gfx_t *self, int x0, int y0, int x1, int y1, uint32_t color)
+{
+    // Clip to display the same way as draw_pixel does
+    if (x0 < 0)
+    {
+        x0 = 0;
+    }
+
+    if (y0 < 0)
+    {
+        y0 = 0;
+    }
+
+    if (x1 >= self->_caps.width)
+    {
+        x1 = self->_caps.width - 1;
+    }
+
+    if (y1 >= self->_caps.height)
+    {
+        y1 = self->_caps.height - 1;
+    }
+
+    if (x0 > x1 || y0 > y1)
+    {
+        return;
+    }
+
+    if (self->_driver->fill_rectangle == NULL)
+    {
+        for (int y = y0; y <= y1; y++)
+        {
+            for (int x = x0; x <= x1; x++)
+            {
+                self->_pixel(self, x, y, color);
+            }
+        }
+
+        return;
+    }
+
+    _twr_gfx_rotate_rectangle(self, &x0, &y0, &x1, &y1);
+
+    self->_driver->fill_rectangle(self->_display, x0, y0, x1, y1, color);
+}
+
+static void _twr_gfx_rotate_rectangle(twr_gfx_t *self, int *x0, int *y0, int *x1, int *y1)
+{
+    int tmp;
+
+    // Rotated rectangle is still rectangle, only its corners are transformed
+    switch (self->_rotation)
+    {
+        case TWR_GFX_ROTATION_90:
+        {
+            tmp = *x0;
+            *x0 = self->_caps.height - 1 - *y1;
+            *y1 = *x1;
+            *x1 = self->_caps.height - 1 - *y0;
+            *y0 = tmp;
+            break;
+        }
+        case TWR_GFX_ROTATION_180:
+        {
+            tmp = *x0;
+            *x0 = self->_caps.width - 1 - *x1;
+            *x1 = self->_caps.width - 1 - tmp;
+            tmp = *y0;
+            *y0 = self->_caps.height - 1 - *y1;
+            *y1 = self->_caps.height - 1 - tmp;
+            break;
+        }
+        case TWR_GFX_ROTATION_270:
+        {
+            tmp = *x0;
+            *x0 = *y0;
+            *y0 = self->_caps.width - 1 - *x1;
+            *x1 = *y1;
+            *y1 = self->_caps.width - 1 - tmp;
+            break;
+        }
+        case TWR_GFX_ROTATION_0:
+        {
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+static inline bool _twr_gfx_is_inside(twr_gfx_t *self, int x0, int y0, int x1, int y1)
+{
+    return x0 >= 0 && y0 >= 0 && x1 < self->_caps.width && y1 < self->_caps.height;
+}
+
+static void _twr_gfx_pixel_0(twr_gfx_t *self, int x, int y, uint32_t color)
+{
+    self->_driver->draw_pixel(self->_display, x, y, color);
+}
+
+static void _twr_gfx_pixel_90(twr_gfx_t *self, int x, int y, uint32_t color)
+{
+    self->_driver->draw_pixel(self->_display, self->_caps.height - 1 - y, x, color);
+}
+
+static void _twr_gfx_pixel_180(twr_gfx_t *self, int x, int y, uint32_t color)
+{
+    self->_driver->draw_pixel(self->_display, self->_caps.width - 1 - x, self->_caps.height - 1 - y, color);
+}
+
+static void _twr_gfx_pixel_270(twr_gfx_t *self, int x, int y, uint32_t color)
+{
+    self->_driver->draw_pixel(self->_display, y, self->_caps.width - 1 - x, color);
+}
+
+static bool _twr_gfx_draw_char_rotated(twr_gfx_t *self, int left, int top, const twr_gfx_bitmap_t *bitmap, uint32_t color)
+{
+    int w = bitmap->width;
+    int h = bitmap->height;
+
+    // Column of glyph turned by 90 degrees is one row of display, 270 degrees is the same row mirrored
+    uint8_t data[(TWR_FONT_GLYPH_MAX + 7) / 8];
+
+    if (h > TWR_FONT_GLYPH_MAX)
+    {
+        return false;
+    }
+
+    twr_gfx_bitmap_t row = { .data = data, .offset = 0, .stride = h, .width = h, .height = 1, .inverted = false };
+
+    for (int x = 0; x < w; x++)
+    {
+        memset(data, 0, (h + 7) / 8);
+
+        bool empty = true;
+
+        for (int y = 0; y < h; y++)
+        {
+            if (_twr_gfx_bitmap_is_drawn(bitmap, x, y))
+            {
+                int c = h - 1 - y;
+
+                data[c / 8] |= 0x80 >> (c % 8);
+
+                empty = false;
+            }
+        }
+
+        if (empty)
+        {
+            continue;
+        }
+
+        if (self->_rotation == TWR_GFX_ROTATION_90)
+        {
+            self->_driver->draw_bitmap(self->_display, self->_caps.height - top - h, left + x, &row, false, color);
+        }
+        else
+        {
+            self->_driver->draw_bitmap(self->_display, top, self->_caps.width - left - 1 - x, &row, true, color);
+        }
+    }
+
+    return true;
+}
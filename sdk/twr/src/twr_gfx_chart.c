@@ -0,0 +1,174 @@
+#include <twr_gfx_chart.h>
+
+// Sample of data stream of any type
+typedef union
+{
+    float _float;
+    int _int;
+    int16_t _int16;
+
+} _twr_gfx_chart_sample_t;
+
+static int32_t _twr_gfx_chart_convert(twr_data_stream_t *stream, const _twr_gfx_chart_sample_t *sample);
+static void _twr_gfx_chart_draw_samples(twr_gfx_chart_t *self, twr_gfx_t *gfx, twr_data_stream_t *stream, int first, int count, uint32_t color);
+
+void twr_gfx_chart_init(twr_gfx_chart_t *self, int left, int top, int width, int height)
+{
+    memset(self, 0, sizeof(*self));
+
+    self->_box.left = left;
+    self->_box.top = top;
+    self->_box.width = width;
+    self->_box.height = height;
+
+    self->_counter = -1;
+}
+
+void twr_gfx_chart_invalidate(twr_gfx_chart_t *self)
+{
+    self->_counter = -1;
+}
+
+void twr_gfx_chart_draw(twr_gfx_chart_t *self, twr_gfx_t *gfx, twr_data_stream_t *stream, uint32_t color)
+{
+    int left = self->_box.left;
+    int top = self->_box.top;
+    int right = left + self->_box.width - 1;
+    int bottom = top + self->_box.height - 1;
+
+    int counter = twr_data_stream_get_counter(stream);
+    int length = twr_data_stream_get_length(stream);
+
+    _twr_gfx_chart_sample_t min;
+    _twr_gfx_chart_sample_t max;
+
+    if (length == 0 || !twr_data_stream_get_min(stream, &min) || !twr_data_stream_get_max(stream, &max))
+    {
+        if (self->_counter != counter)
+        {
+            twr_gfx_draw_fill_rectangle(gfx, left, top, right, bottom, !color);
+        }
+
+        // Empty range, the next draw with samples is whole
+        self->_counter = counter;
+        self->_min = 0;
+        self->_max = -1;
+
+        return;
+    }
+
+    int32_t min_value = _twr_gfx_chart_convert(stream, &min);
+    int32_t max_value = _twr_gfx_chart_convert(stream, &max);
+
+    int count = length < self->_box.width ? length : self->_box.width;
+
+    int added = counter - self->_counter;
+
+    if (self->_counter >= 0 && min_value == self->_min && max_value == self->_max && added >= 0 && added < count)
+    {
+        if (added == 0)
+        {
+            return;
+        }
+
+        // Drawn columns keep their scale, they are moved in framebuffer instead of being drawn again
+        if (twr_gfx_scroll(gfx, left, top, right, bottom, -added))
+        {
+            twr_gfx_draw_fill_rectangle(gfx, right - added + 1, top, right, bottom, !color);
+
+            _twr_gfx_chart_draw_samples(self, gfx, stream, -added, added, color);
+
+            // Samples dropped from stream are erased and the oldest sample loses span to them
+            if (length <= self->_box.width)
+            {
+                int x = right + 1 - length - added;
+
+                twr_gfx_draw_fill_rectangle(gfx, x < left ? left : x, top, right + 1 - length, bottom, !color);
+
+                _twr_gfx_chart_draw_samples(self, gfx, stream, -length, 1, color);
+            }
+
+            self->_counter = counter;
+
+            return;
+        }
+    }
+
+    self->_counter = counter;
+    self->_min = min_value;
+    self->_max = max_value;
+
+    twr_gfx_draw_fill_rectangle(gfx, left, top, right, bottom, !color);
+
+    _twr_gfx_chart_draw_samples(self, gfx, stream, -count, count, color);
+}
+
+static int32_t _twr_gfx_chart_convert(twr_data_stream_t *stream, const _twr_gfx_chart_sample_t *sample)
+{
+    switch (twr_data_stream_get_type(stream))
+    {
+        case TWR_DATA_STREAM_TYPE_FLOAT:
+        {
+            return (int32_t) (sample->_float * TWR_GFX_CHART_FLOAT_SCALE);
+        }
+        case TWR_DATA_STREAM_TYPE_INT:
+        {
+            return sample->_int;
+        }
+        case TWR_DATA_STREAM_TYPE_INT16:
+        {
+            return sample->_int16;
+        }
+        default:
+        {
+            return 0;
+        }
+    }
+}
+
+static void _twr_gfx_chart_draw_samples(twr_gfx_chart_t *self, twr_gfx_t *gfx, twr_data_stream_t *stream, int first, int count, uint32_t color)
+{
+    int right = self->_box.left + self->_box.width - 1;
+    int bottom = self->_box.top + self->_box.height - 1;
+    int height = self->_box.height;
+
+    uint32_t range = (uint32_t) self->_max - (uint32_t) self->_min;
+    int shift = 0;
+
+    // Range is reduced so that scaling to chart height fits 32 bit integer
+    while ((range >> shift) > UINT32_MAX / height)
+    {
+        shift++;
+    }
+
+    range >>= shift;
+
+    _twr_gfx_chart_sample_t sample;
+
+    int previous = -1;
+
+    // Span of the first column starts at preceding sample if stream still has it
+    for (int n = first - 1; n < first + count; n++)
+    {
+        if (!twr_data_stream_get_nth(stream, n, &sample))
+        {
+            continue;
+        }
+
+        uint32_t value = (uint32_t) (_twr_gfx_chart_convert(stream, &sample) - self->_min) >> shift;
+
+        int y = bottom - (range != 0 ? (int) ((value * (height - 1) + range / 2) / range) : (height - 1) / 2);
+
+        if (n >= first)
+        {
+            if (previous < 0)
+            {
+                previous = y;
+            }
+
+            twr_gfx_draw_fill_rectangle(gfx, right + 1 + n, y < previous ? y : previous, right + 1 + n, y > previous ? y : previous, color);
+        }
+
+        previous = y;
+    }
+}
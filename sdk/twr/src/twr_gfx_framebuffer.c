@@ -0,0 +1,200 @@
+#include <twr_gfx_framebuffer.h>
+#include <twr_gfx_line.h>
+
+#define _TWR_GFX_FRAMEBUFFER_BYTES(self) (((self)->_buffer->width + 7) / 8)
+
+#define _TWR_GFX_FRAMEBUFFER_LINE(self, y) (&(self)->_buffer->buffer[(y) * _TWR_GFX_FRAMEBUFFER_BYTES(self)])
+
+static inline void _twr_gfx_framebuffer_set_dirty(twr_gfx_framebuffer_t *self, int y);
+static void _twr_gfx_framebuffer_copy_line(twr_gfx_framebuffer_t *self, int y, int source, int x0, int x1, int dx);
+
+void twr_gfx_framebuffer_init(twr_gfx_framebuffer_t *self, const twr_gfx_framebuffer_buffer_t *buffer)
+{
+    memset(self, 0, sizeof(*self));
+
+    self->_buffer = buffer;
+
+    memset(buffer->buffer, 0, (buffer->width + 7) / 8 * buffer->height);
+    memset(buffer->dirty, 0, (buffer->height + 7) / 8);
+}
+
+twr_gfx_caps_t twr_gfx_framebuffer_get_caps(twr_gfx_framebuffer_t *self)
+{
+    twr_gfx_caps_t caps = { .width = self->_buffer->width, .height = self->_buffer->height };
+
+    return caps;
+}
+
+bool twr_gfx_framebuffer_is_ready(twr_gfx_framebuffer_t *self)
+{
+    (void) self;
+
+    return true;
+}
+
+void twr_gfx_framebuffer_clear(twr_gfx_framebuffer_t *self)
+{
+    twr_gfx_framebuffer_fill_rectangle(self, 0, 0, self->_buffer->width - 1, self->_buffer->height - 1, 0);
+}
+
+void twr_gfx_framebuffer_draw_pixel(twr_gfx_framebuffer_t *self, int x, int y, uint32_t color)
+{
+    self->_stats.pixels++;
+
+    if (twr_gfx_line_draw_mask(_TWR_GFX_FRAMEBUFFER_LINE(self, y), _TWR_GFX_FRAMEBUFFER_BYTES(self), x, 0x80, color != 0))
+    {
+        _twr_gfx_framebuffer_set_dirty(self, y);
+    }
+}
+
+uint32_t twr_gfx_framebuffer_get_pixel(twr_gfx_framebuffer_t *self, int x, int y)
+{
+    return (_TWR_GFX_FRAMEBUFFER_LINE(self, y)[x / 8] >> (7 - (x % 8))) & 1;
+}
+
+void twr_gfx_framebuffer_draw_bitmap(twr_gfx_framebuffer_t *self, int left, int top, const twr_gfx_bitmap_t *bitmap, bool mirror, uint32_t color)
+{
+    self->_stats.bitmaps++;
+
+    for (int row = 0; row < bitmap->height; row++)
+    {
+        int y = mirror ? top + bitmap->height - 1 - row : top + row;
+
+        if (twr_gfx_line_draw_bitmap_row(_TWR_GFX_FRAMEBUFFER_LINE(self, y), _TWR_GFX_FRAMEBUFFER_BYTES(self), left, bitmap, row, mirror, color != 0))
+        {
+            _twr_gfx_framebuffer_set_dirty(self, y);
+        }
+    }
+}
+
+void twr_gfx_framebuffer_fill_rectangle(twr_gfx_framebuffer_t *self, int x0, int y0, int x1, int y1, uint32_t color)
+{
+    self->_stats.fills++;
+
+    for (int y = y0; y <= y1; y++)
+    {
+        if (twr_gfx_line_fill(_TWR_GFX_FRAMEBUFFER_LINE(self, y), x0, x1, color != 0))
+        {
+            _twr_gfx_framebuffer_set_dirty(self, y);
+        }
+    }
+}
+
+void twr_gfx_framebuffer_scroll(twr_gfx_framebuffer_t *self, int x0, int y0, int x1, int y1, int dx, int dy)
+{
+    self->_stats.scrolls++;
+
+    if (dy > 0)
+    {
+        for (int y = y1; y >= y0 + dy; y--)
+        {
+            _twr_gfx_framebuffer_copy_line(self, y, y - dy, x0, x1, 0);
+        }
+    }
+    else if (dy < 0)
+    {
+        for (int y = y0; y <= y1 + dy; y++)
+        {
+            _twr_gfx_framebuffer_copy_line(self, y, y - dy, x0, x1, 0);
+        }
+    }
+    else if (dx != 0)
+    {
+        for (int y = y0; y <= y1; y++)
+        {
+            _twr_gfx_framebuffer_copy_line(self, y, y, dx > 0 ? x0 + dx : x0, dx > 0 ? x1 : x1 + dx, dx);
+        }
+    }
+}
+
+bool twr_gfx_framebuffer_update(twr_gfx_framebuffer_t *self)
+{
+    self->_stats.updates++;
+
+    bool run = false;
+
+    for (int y = 0; y < self->_buffer->height; y++)
+    {
+        if ((self->_buffer->dirty[y / 8] >> (y % 8)) & 1)
+        {
+            self->_stats.lines++;
+
+            // Address, data and dummy byte of line
+            self->_stats.spi_bytes += (self->_buffer->width + 7) / 8 + 2;
+
+            // Mode and trailing dummy byte of run of lines
+            if (!run)
+            {
+                self->_stats.spi_bytes += 2;
+            }
+
+            run = true;
+        }
+        else
+        {
+            run = false;
+        }
+    }
+
+    memset(self->_buffer->dirty, 0, (self->_buffer->height + 7) / 8);
+
+    return true;
+}
+
+void twr_gfx_framebuffer_get_stats(twr_gfx_framebuffer_t *self, twr_gfx_framebuffer_stats_t *stats)
+{
+    *stats = self->_stats;
+}
+
+void twr_gfx_framebuffer_reset_stats(twr_gfx_framebuffer_t *self)
+{
+    memset(&self->_stats, 0, sizeof(self->_stats));
+}
+
+size_t twr_gfx_framebuffer_get_pbm(twr_gfx_framebuffer_t *self, uint8_t *image, size_t size)
+{
+    size_t length = (self->_buffer->width + 7) / 8 * self->_buffer->height;
+
+    int header = snprintf((char *) image, size, "P4\n%d %d\n", self->_buffer->width, self->_buffer->height);
+
+    if (header < 0 || (size_t) header + length > size)
+    {
+        return 0;
+    }
+
+    // Framebuffer rows are stored in PBM format already
+    memcpy(image + header, self->_buffer->buffer, length);
+
+    return header + length;
+}
+
+const twr_gfx_driver_t *twr_gfx_framebuffer_get_driver(void)
+{
+    static const twr_gfx_driver_t driver =
+    {
+        .is_ready = (bool (*)(void *)) twr_gfx_framebuffer_is_ready,
+        .clear = (void (*)(void *)) twr_gfx_framebuffer_clear,
+        .draw_pixel = (void (*)(void *, int, int, uint32_t)) twr_gfx_framebuffer_draw_pixel,
+        .get_pixel = (uint32_t (*)(void *, int, int)) twr_gfx_framebuffer_get_pixel,
+        .update = (bool (*)(void *)) twr_gfx_framebuffer_update,
+        .get_caps = (twr_gfx_caps_t (*)(void *)) twr_gfx_framebuffer_get_caps,
+        .draw_bitmap = (void (*)(void *, int, int, const twr_gfx_bitmap_t *, bool, uint32_t)) twr_gfx_framebuffer_draw_bitmap,
+        .fill_rectangle = (void (*)(void *, int, int, int, int, uint32_t)) twr_gfx_framebuffer_fill_rectangle,
+        .scroll = (void (*)(void *, int, int, int, int, int, int)) twr_gfx_framebuffer_scroll
+    };
+
+    return &driver;
+}
+
+static void _twr_gfx_framebuffer_copy_line(twr_gfx_framebuffer_t *self, int y, int source, int x0, int x1, int dx)
+{
+    if (twr_gfx_line_copy(_TWR_GFX_FRAMEBUFFER_LINE(self, y), _TWR_GFX_FRAMEBUFFER_LINE(self, source), _TWR_GFX_FRAMEBUFFER_BYTES(self), x0, x1, dx))
+    {
+        _twr_gfx_framebuffer_set_dirty(self, y);
+    }
+}
+
+static inline void _twr_gfx_framebuffer_set_dirty(twr_gfx_framebuffer_t *self, int y)
+{
+    self->_buffer->dirty[y / 8] |= 1 << (y % 8);
+}
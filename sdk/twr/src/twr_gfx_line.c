@@ -0,0 +1,180 @@
+#include <twr_gfx_line.h>
+
+// Nibbles with reversed bit order
+static const uint8_t _twr_gfx_line_reverse_nibble[16] =
+{
+    0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf
+};
+
+static inline bool _twr_gfx_line_write(uint8_t *line, int col, uint8_t mask, uint8_t value);
+
+uint8_t twr_gfx_line_reverse(uint8_t b)
+{
+    return (_twr_gfx_line_reverse_nibble[b & 0x0f] << 4) | _twr_gfx_line_reverse_nibble[b >> 4];
+}
+
+bool twr_gfx_line_draw_mask(uint8_t *line, int bytes, int x, uint8_t mask, bool set)
+{
+    // Mask starting left of line has only zero bits there
+    if (x < 0)
+    {
+        mask <<= -x;
+        x = 0;
+    }
+
+    int col = x / 8;
+
+    int shift = x % 8;
+
+    uint8_t fill = set ? 0xff : 0x00;
+
+    bool changed = false;
+
+    if (col < bytes)
+    {
+        changed |= _twr_gfx_line_write(line, col, mask >> shift, fill);
+    }
+
+    if (shift != 0 && col + 1 < bytes)
+    {
+        changed |= _twr_gfx_line_write(line, col + 1, mask << (8 - shift), fill);
+    }
+
+    return changed;
+}
+
+bool twr_gfx_line_fill(uint8_t *line, int x0, int x1, bool set)
+{
+    int first = x0 / 8;
+    int last = x1 / 8;
+
+    // Masks of bits covered in edge bytes
+    uint8_t first_mask = 0xff >> (x0 % 8);
+    uint8_t last_mask = 0xff << (7 - (x1 % 8));
+
+    uint8_t fill = set ? 0xff : 0x00;
+
+    if (first == last)
+    {
+        return _twr_gfx_line_write(line, first, first_mask & last_mask, fill);
+    }
+
+    uint8_t changed = 0;
+
+    for (int col = first + 1; col < last; col++)
+    {
+        changed |= line[col] ^ fill;
+    }
+
+    memset(&line[first + 1], fill, last - first - 1);
+
+    bool first_changed = _twr_gfx_line_write(line, first, first_mask, fill);
+    bool last_changed = _twr_gfx_line_write(line, last, last_mask, fill);
+
+    return changed != 0 || first_changed || last_changed;
+}
+
+bool twr_gfx_line_copy(uint8_t *line, const uint8_t *source, int bytes, int x0, int x1, int dx)
+{
+    if (x0 > x1)
+    {
+        return false;
+    }
+
+    int first = x0 / 8;
+    int last = x1 / 8;
+
+    bool changed = false;
+
+    // Bytes are copied in direction of shift so that source bits are read before they are overwritten
+    for (int i = 0; i <= last - first; i++)
+    {
+        int col = dx > 0 ? last - i : first + i;
+
+        uint8_t mask = 0xff;
+
+        if (col == first)
+        {
+            mask &= 0xff >> (x0 % 8);
+        }
+
+        if (col == last)
+        {
+            mask &= 0xff << (7 - (x1 % 8));
+        }
+
+        // Source pixels of byte start dx pixels to the left, it is at most one byte before line start
+        int bit = col * 8 - dx;
+        int src_col = (bit + 8) / 8 - 1;
+
+        uint16_t window = (src_col >= 0 ? source[src_col] << 8 : 0) | (src_col + 1 < bytes ? source[src_col + 1] : 0);
+
+        changed |= _twr_gfx_line_write(line, col, mask, window >> (8 - (bit - src_col * 8)));
+    }
+
+    return changed;
+}
+
+bool twr_gfx_line_draw_bitmap_row(uint8_t *line, int bytes, int left, const twr_gfx_bitmap_t *bitmap, int row, bool mirror, bool set)
+{
+    int width = bitmap->width;
+
+    uint32_t offset = bitmap->offset + row * bitmap->stride;
+
+    uint8_t invert = bitmap->inverted ? 0xff : 0x00;
+
+    bool changed = false;
+
+    for (int x = 0; x < width; x += 8, offset += 8)
+    {
+        const uint8_t *data = &bitmap->data[offset / 8];
+
+        int shift = offset % 8;
+
+        // Set bits of mask are pixels to draw, next byte is read only if pixels of row continue into it
+        uint8_t mask = data[0] << shift;
+
+        if (shift != 0 && width - x > 8 - shift)
+        {
+            mask |= data[1] >> (8 - shift);
+        }
+
+        mask ^= invert;
+
+        // Bits past the end of row are excluded
+        if (width - x < 8)
+        {
+            mask &= 0xff << (8 - (width - x));
+        }
+
+        if (mask == 0)
+        {
+            continue;
+        }
+
+        if (mirror)
+        {
+            changed |= twr_gfx_line_draw_mask(line, bytes, left + width - x - 8, twr_gfx_line_reverse(mask), set);
+        }
+        else
+        {
+            changed |= twr_gfx_line_draw_mask(line, bytes, left + x, mask, set);
+        }
+    }
+
+    return changed;
+}
+
+static inline bool _twr_gfx_line_write(uint8_t *line, int col, uint8_t mask, uint8_t value)
+{
+    uint8_t result = (line[col] & ~mask) | (value & mask);
+
+    if (result == line[col])
+    {
+        return false;
+    }
+
+    line[col] = result;
+
+    return true;
+}
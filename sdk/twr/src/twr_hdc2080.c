@@ -49,7 +49,7 @@ void twr_hdc2080_set_update_interval(twr_hdc2080_t *self, twr_tick_t interval)
     }
     else
     {
-        twr_scheduler_plan_relative(self->_task_id_interval, self->_update_interval);
+        twr_scheduler_plan_relative_with_slack(self->_task_id_interval, self->_update_interval, TWR_SCHEDULER_UPDATE_SLACK(self->_update_interval));
 
         twr_hdc2080_measure(self);
     }
@@ -132,7 +132,7 @@ static void _twr_hdc2080_task_interval(void *param)
 
     twr_hdc2080_measure(self);
 
-    twr_scheduler_plan_current_relative(self->_update_interval);
+    twr_scheduler_plan_current_relative_with_slack(self->_update_interval, TWR_SCHEDULER_UPDATE_SLACK(self->_update_interval));
 }
 
 static void _twr_hdc2080_task_measure(void *param)
@@ -49,7 +49,7 @@ void twr_lp8_set_update_interval(twr_lp8_t *self, twr_tick_t interval)
     }
     else
     {
-        twr_scheduler_plan_relative(self->_task_id_interval, self->_update_interval);
+        twr_scheduler_plan_relative_with_slack(self->_task_id_interval, self->_update_interval, TWR_SCHEDULER_UPDATE_SLACK(self->_update_interval));
 
         twr_lp8_measure(self);
     }
@@ -109,7 +109,7 @@ static void _twr_lp8_task_interval(void *param)
 
     twr_lp8_measure(self);
 
-    twr_scheduler_plan_current_relative(self->_update_interval);
+    twr_scheduler_plan_current_relative_with_slack(self->_update_interval, TWR_SCHEDULER_UPDATE_SLACK(self->_update_interval));
 }
 
 static void _twr_lp8_error(twr_lp8_t *self, twr_lp8_error_t error)
@@ -1,14 +1,30 @@
 #include <twr_ls013b7dh03.h>
+#include <twr_gfx_line.h>
 #include <twr_spi.h>
 
 #define _TWR_LS013B7DH03_VCOM_PERIOD 15000
 
 #define _TWR_LS013B7DH03_LINE_INCREMENT (TWR_LS013B7DH03_WIDTH / 8 + 2)
 
+#define _TWR_LS013B7DH03_LINE(self, y) (&(self)->_framebuffer[2 + (y) * _TWR_LS013B7DH03_LINE_INCREMENT])
+
+// Clean lines between dirty ones are sent too if it is cheaper than starting new frame
+#define _TWR_LS013B7DH03_MAX_LINE_GAP 1
+
+#define _TWR_LS013B7DH03_DIRTY_SET(self, line) ((self)->_dirty[(line) / 32] |= 1UL << ((line) % 32))
+#define _TWR_LS013B7DH03_DIRTY_GET(self, line) (((self)->_dirty[(line) / 32] >> ((line) % 32)) & 1)
+#define _TWR_LS013B7DH03_DIRTY_CLEAR(self, line) ((self)->_dirty[(line) / 32] &= ~(1UL << ((line) % 32)))
+
+#define _TWR_LS013B7DH03_SEND_GET(self, line) (((self)->_send[(line) / 32] >> ((line) % 32)) & 1)
+#define _TWR_LS013B7DH03_SEND_CLEAR(self, line) ((self)->_send[(line) / 32] &= ~(1UL << ((line) % 32)))
+
 static void _twr_ls013b7dh03_task(void *param);
 static bool _twr_ls013b7dh03_spi_transfer(twr_ls013b7dh03_t *self, uint8_t *buffer, size_t length);
+static void _twr_ls013b7dh03_update_start(twr_ls013b7dh03_t *self);
+static bool _twr_ls013b7dh03_update_next(twr_ls013b7dh03_t *self);
+static void _twr_ls013b7dh03_update_abort(twr_ls013b7dh03_t *self);
 static void _twr_ls013b7dh03_spi_event_handler(twr_spi_event_t event, void *event_param);
-static inline uint8_t _twr_ls013b7dh03_reverse(uint8_t b);
+static void _twr_ls013b7dh03_copy_line(twr_ls013b7dh03_t *self, int y, int source, int x0, int x1, int dx);
 
 void twr_ls013b7dh03_init(twr_ls013b7dh03_t *self, bool (*pin_cs_set)(bool state))
 {
@@ -16,6 +32,14 @@ void twr_ls013b7dh03_init(twr_ls013b7dh03_t *self, bool (*pin_cs_set)(bool state
 
     self->_vcom = 0;
     self->_pin_cs_set = pin_cs_set;
+    self->_transfer = NULL;
+    self->_transfer_busy = false;
+    self->_update_pending = false;
+
+    memset(self->_send, 0, sizeof(self->_send));
+
+    // All dirty bits are set, first update sends whole framebuffer
+    self->_update_line = TWR_LS013B7DH03_HEIGHT;
 
     twr_spi_init(TWR_SPI_SPEED_1_MHZ, TWR_SPI_MODE_0);
 
@@ -25,7 +49,7 @@ void twr_ls013b7dh03_init(twr_ls013b7dh03_t *self, bool (*pin_cs_set)(bool state
     for (line = 0x01, offs = 1; line <= TWR_LS013B7DH03_HEIGHT; line++, offs += _TWR_LS013B7DH03_LINE_INCREMENT) // 128; 18
     {
         // Fill the gate line addresses on the exact place in the buffer
-        self->_framebuffer[offs] = _twr_ls013b7dh03_reverse(line);
+        self->_framebuffer[offs] = twr_gfx_line_reverse(line);
     }
 
     self->_pin_cs_set(1);
@@ -33,6 +57,17 @@ void twr_ls013b7dh03_init(twr_ls013b7dh03_t *self, bool (*pin_cs_set)(bool state
     self->_task_id = twr_scheduler_register(_twr_ls013b7dh03_task, self, _TWR_LS013B7DH03_VCOM_PERIOD);
 }
 
+void twr_ls013b7dh03_set_transfer_buffer(twr_ls013b7dh03_t *self, uint8_t *buffer)
+{
+    if (buffer != NULL)
+    {
+        // Address bytes of lines are taken over together with content
+        memcpy(buffer, self->_framebuffer, TWR_LS013B7DH03_FRAMEBUFFER_SIZE);
+    }
+
+    self->_transfer = buffer;
+}
+
 twr_gfx_caps_t twr_ls013b7dh03_get_caps(twr_ls013b7dh03_t *self)
 {
     (void) self;
@@ -44,21 +79,28 @@ twr_gfx_caps_t twr_ls013b7dh03_get_caps(twr_ls013b7dh03_t *self)
 
 bool twr_ls013b7dh03_is_ready(twr_ls013b7dh03_t *self)
 {
-    (void) self;
+    // Transfer does not read framebuffer, update requested meanwhile is queued
+    if (self->_transfer != NULL)
+    {
+        return true;
+    }
 
-    return twr_spi_is_ready();
+    return twr_spi_is_ready() && self->_update_line >= TWR_LS013B7DH03_HEIGHT;
 }
 
 void twr_ls013b7dh03_clear(twr_ls013b7dh03_t *self)
 {
-    uint8_t line;
-    uint32_t offs;
-    uint8_t col;
-    for (line = 0x01, offs = 2; line <= TWR_LS013B7DH03_HEIGHT; line++, offs += _TWR_LS013B7DH03_LINE_INCREMENT)
+    twr_ls013b7dh03_fill_rectangle(self, 0, 0, TWR_LS013B7DH03_WIDTH - 1, TWR_LS013B7DH03_HEIGHT - 1, 0);
+}
+
+void twr_ls013b7dh03_fill_rectangle(twr_ls013b7dh03_t *self, int x0, int y0, int x1, int y1, uint32_t color)
+{
+    for (int y = y0; y <= y1; y++)
     {
-        for (col = 0; col < (TWR_LS013B7DH03_WIDTH / 8); col++)
+        // Black is stored as cleared bit
+        if (twr_gfx_line_fill(_TWR_LS013B7DH03_LINE(self, y), x0, x1, color == 0))
         {
-            self->_framebuffer[offs + col] = 0xff;
+            _TWR_LS013B7DH03_DIRTY_SET(self, y);
         }
     }
 }
@@ -74,13 +116,22 @@ void twr_ls013b7dh03_draw_pixel(twr_ls013b7dh03_t *self, int x, int y, uint32_t
 
     uint8_t bitMask = 1 << (7 - (x % 8));
 
+    uint8_t value = self->_framebuffer[byteIndex];
+
     if (color == 0)
     {
-        self->_framebuffer[byteIndex] |= bitMask;
+        value |= bitMask;
     }
     else
     {
-        self->_framebuffer[byteIndex] &= ~bitMask;
+        value &= ~bitMask;
+    }
+
+    if (value != self->_framebuffer[byteIndex])
+    {
+        self->_framebuffer[byteIndex] = value;
+
+        _TWR_LS013B7DH03_DIRTY_SET(self, y);
     }
 }
 
@@ -96,6 +147,44 @@ uint32_t twr_ls013b7dh03_get_pixel(twr_ls013b7dh03_t *self, int x, int y)
     return (self->_framebuffer[byteIndex] >> (7 - (x % 8))) & 1 ? 0 : 1;
 }
 
+void twr_ls013b7dh03_draw_bitmap(twr_ls013b7dh03_t *self, int left, int top, const twr_gfx_bitmap_t *bitmap, bool mirror, uint32_t color)
+{
+    for (int row = 0; row < bitmap->height; row++)
+    {
+        int y = mirror ? top + bitmap->height - 1 - row : top + row;
+
+        if (twr_gfx_line_draw_bitmap_row(_TWR_LS013B7DH03_LINE(self, y), TWR_LS013B7DH03_WIDTH / 8, left, bitmap, row, mirror, color == 0))
+        {
+            _TWR_LS013B7DH03_DIRTY_SET(self, y);
+        }
+    }
+}
+
+void twr_ls013b7dh03_scroll(twr_ls013b7dh03_t *self, int x0, int y0, int x1, int y1, int dx, int dy)
+{
+    if (dy > 0)
+    {
+        for (int y = y1; y >= y0 + dy; y--)
+        {
+            _twr_ls013b7dh03_copy_line(self, y, y - dy, x0, x1, 0);
+        }
+    }
+    else if (dy < 0)
+    {
+        for (int y = y0; y <= y1 + dy; y++)
+        {
+            _twr_ls013b7dh03_copy_line(self, y, y - dy, x0, x1, 0);
+        }
+    }
+    else if (dx != 0)
+    {
+        for (int y = y0; y <= y1; y++)
+        {
+            _twr_ls013b7dh03_copy_line(self, y, y, dx > 0 ? x0 + dx : x0, dx > 0 ? x1 : x1 + dx, dx);
+        }
+    }
+}
+
 /*
 
 Framebuffer format for updating multiple lines, ideal for later DMA TX:
@@ -104,33 +193,29 @@ Framebuffer format for updating multiple lines, ideal for later DMA TX:
 ||        1B        ||   1B |  16B |  1B   ||   1B |  16B |  1B   |
 ||  M0 M1 M2  DUMMY || ADDR | DATA | DUMMY || ADDR | DATA | DUMMY |
 
+Run of dirty lines is sent as a slice of framebuffer, mode byte is written over the dummy byte
+of the preceding line and the address byte of the following line serves as trailing dummy.
+With second framebuffer the dirty lines are copied to it at the start of update and sent from there.
+
 */
 bool twr_ls013b7dh03_update(twr_ls013b7dh03_t *self)
 {
-    if (twr_spi_is_ready())
+    if (self->_transfer != NULL && (self->_update_line < TWR_LS013B7DH03_HEIGHT || self->_transfer_busy))
     {
-        if (!self->_pin_cs_set(0))
-        {
-            return false;
-        }
-
-        self->_framebuffer[0] = 0x80 | self->_vcom;
-
-        if (!twr_spi_async_transfer(self->_framebuffer, NULL, TWR_LS013B7DH03_FRAMEBUFFER_SIZE, _twr_ls013b7dh03_spi_event_handler, self))
-        {
-            self->_pin_cs_set(1);
-
-            return false;
-        }
-
-        twr_scheduler_plan_relative(self->_task_id, _TWR_LS013B7DH03_VCOM_PERIOD);
-
-        self->_vcom ^= 0x40;
+        // Lines drawn meanwhile are sent right after transfer in progress
+        self->_update_pending = true;
 
         return true;
     }
 
-    return false;
+    if (!twr_spi_is_ready() || self->_update_line < TWR_LS013B7DH03_HEIGHT)
+    {
+        return false;
+    }
+
+    _twr_ls013b7dh03_update_start(self);
+
+    return _twr_ls013b7dh03_update_next(self);
 }
 
 const twr_gfx_driver_t *twr_ls013b7dh03_get_driver(void)
@@ -142,7 +227,10 @@ const twr_gfx_driver_t *twr_ls013b7dh03_get_driver(void)
         .draw_pixel = (void (*)(void *, int, int, uint32_t)) twr_ls013b7dh03_draw_pixel,
         .get_pixel = (uint32_t (*)(void *, int, int)) twr_ls013b7dh03_get_pixel,
         .update = (bool (*)(void *)) twr_ls013b7dh03_update,
-        .get_caps = (twr_gfx_caps_t (*)(void *)) twr_ls013b7dh03_get_caps
+        .get_caps = (twr_gfx_caps_t (*)(void *)) twr_ls013b7dh03_get_caps,
+        .draw_bitmap = (void (*)(void *, int, int, const twr_gfx_bitmap_t *, bool, uint32_t)) twr_ls013b7dh03_draw_bitmap,
+        .fill_rectangle = (void (*)(void *, int, int, int, int, uint32_t)) twr_ls013b7dh03_fill_rectangle,
+        .scroll = (void (*)(void *, int, int, int, int, int, int)) twr_ls013b7dh03_scroll
     };
 
     return &driver;
@@ -152,13 +240,140 @@ bool twr_ls013b7dh03_clear_memory_command(twr_ls013b7dh03_t *self)
 {
     uint8_t spi_data[2] = { 0x20, 0x00 };
 
-    return _twr_ls013b7dh03_spi_transfer(self, spi_data, sizeof(spi_data));
+    if (!_twr_ls013b7dh03_spi_transfer(self, spi_data, sizeof(spi_data)))
+    {
+        return false;
+    }
+
+    // Display memory no longer matches framebuffer
+    memset(self->_dirty, 0xff, sizeof(self->_dirty));
+
+    return true;
+}
+
+static void _twr_ls013b7dh03_update_start(twr_ls013b7dh03_t *self)
+{
+    if (self->_transfer != NULL)
+    {
+        for (int line = 0; line < TWR_LS013B7DH03_HEIGHT; line++)
+        {
+            if (_TWR_LS013B7DH03_DIRTY_GET(self, line))
+            {
+                size_t offset = 2 + line * _TWR_LS013B7DH03_LINE_INCREMENT;
+
+                memcpy(&self->_transfer[offset], &self->_framebuffer[offset], TWR_LS013B7DH03_WIDTH / 8);
+            }
+        }
+    }
+
+    // Lines drawn from now on belong to next update
+    memcpy(self->_send, self->_dirty, sizeof(self->_send));
+    memset(self->_dirty, 0, sizeof(self->_dirty));
+
+    self->_update_line = 0;
+}
+
+static bool _twr_ls013b7dh03_update_next(twr_ls013b7dh03_t *self)
+{
+    int first = self->_update_line;
+
+    while (first < TWR_LS013B7DH03_HEIGHT && !_TWR_LS013B7DH03_SEND_GET(self, first))
+    {
+        first++;
+    }
+
+    if (first >= TWR_LS013B7DH03_HEIGHT)
+    {
+        self->_update_line = TWR_LS013B7DH03_HEIGHT;
+
+        if (self->_update_pending)
+        {
+            self->_update_pending = false;
+
+            _twr_ls013b7dh03_update_start(self);
+
+            return _twr_ls013b7dh03_update_next(self);
+        }
+
+        return true;
+    }
+
+    int last = first;
+
+    for (int line = first + 1; line < TWR_LS013B7DH03_HEIGHT && line - last <= _TWR_LS013B7DH03_MAX_LINE_GAP + 1; line++)
+    {
+        if (_TWR_LS013B7DH03_SEND_GET(self, line))
+        {
+            last = line;
+        }
+    }
+
+    uint8_t *frame = &(self->_transfer != NULL ? self->_transfer : self->_framebuffer)[first * _TWR_LS013B7DH03_LINE_INCREMENT];
+
+    size_t length = (last - first + 1) * _TWR_LS013B7DH03_LINE_INCREMENT + 2;
+
+    if (!self->_pin_cs_set(0))
+    {
+        _twr_ls013b7dh03_update_abort(self);
+
+        return false;
+    }
+
+    *frame = 0x80 | self->_vcom;
+
+    self->_transfer_busy = true;
+
+    if (!twr_spi_async_transfer(frame, NULL, length, _twr_ls013b7dh03_spi_event_handler, self))
+    {
+        self->_transfer_busy = false;
+
+        self->_pin_cs_set(1);
+
+        _twr_ls013b7dh03_update_abort(self);
+
+        return false;
+    }
+
+    for (int line = first; line <= last; line++)
+    {
+        _TWR_LS013B7DH03_SEND_CLEAR(self, line);
+    }
+
+    self->_update_line = last + 1;
+
+    self->_vcom ^= 0x40;
+
+    // Every frame toggles VCOM, the periodic toggle is postponed
+    twr_scheduler_plan_relative(self->_task_id, _TWR_LS013B7DH03_VCOM_PERIOD);
+
+    return true;
+}
+
+static void _twr_ls013b7dh03_update_abort(twr_ls013b7dh03_t *self)
+{
+    // Lines not sent stay dirty for next update
+    for (size_t i = 0; i < sizeof(self->_send) / sizeof(self->_send[0]); i++)
+    {
+        self->_dirty[i] |= self->_send[i];
+        self->_send[i] = 0;
+    }
+
+    self->_update_line = TWR_LS013B7DH03_HEIGHT;
+    self->_update_pending = false;
 }
 
 static void _twr_ls013b7dh03_task(void *param)
 {
     twr_ls013b7dh03_t *self = (twr_ls013b7dh03_t *) param;
 
+    if (self->_update_line < TWR_LS013B7DH03_HEIGHT || self->_update_pending)
+    {
+        // Next run of dirty lines, SPI does not accept new transfer from within its event handler
+        _twr_ls013b7dh03_update_next(self);
+
+        return;
+    }
+
     uint8_t spi_data[2] = {self->_vcom, 0x00};
 
     if (_twr_ls013b7dh03_spi_transfer(self, spi_data, sizeof(spi_data)))
@@ -195,14 +410,20 @@ static void _twr_ls013b7dh03_spi_event_handler(twr_spi_event_t event, void *even
     if (event == TWR_SPI_EVENT_DONE)
     {
         self->_pin_cs_set(1);
+
+        self->_transfer_busy = false;
+
+        if (self->_update_line < TWR_LS013B7DH03_HEIGHT || self->_update_pending)
+        {
+            twr_scheduler_plan_now(self->_task_id);
+        }
     }
 }
 
-static inline uint8_t _twr_ls013b7dh03_reverse(uint8_t b)
+static void _twr_ls013b7dh03_copy_line(twr_ls013b7dh03_t *self, int y, int source, int x0, int x1, int dx)
 {
-   b = (b & 0xf0) >> 4 | (b & 0x0f) << 4;
-   b = (b & 0xcc) >> 2 | (b & 0x33) << 2;
-   b = (b & 0xaa) >> 1 | (b & 0x55) << 1;
-
-   return b;
+    if (twr_gfx_line_copy(_TWR_LS013B7DH03_LINE(self, y), _TWR_LS013B7DH03_LINE(self, source), TWR_LS013B7DH03_WIDTH / 8, x0, x1, dx))
+    {
+        _TWR_LS013B7DH03_DIRTY_SET(self, y);
+    }
 }
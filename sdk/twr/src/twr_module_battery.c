@@ -211,7 +211,7 @@ start:
             }
             else
             {
-                _twr_module_battery.next_update_start = twr_tick_get() + _twr_module_battery.update_interval;
+                _twr_module_battery.next_update_start = twr_scheduler_get_coalesced_tick(twr_tick_get() + _twr_module_battery.update_interval, TWR_SCHEDULER_UPDATE_SLACK(_twr_module_battery.update_interval));
             }
 
             _twr_module_battery.format = TWR_MODULE_BATTERY_FORMAT_UNKNOWN;
@@ -289,7 +289,7 @@ start:
             }
             else
             {
-                _twr_module_battery.next_update_start = twr_tick_get() + _twr_module_battery.update_interval;
+                _twr_module_battery.next_update_start = twr_scheduler_get_coalesced_tick(twr_tick_get() + _twr_module_battery.update_interval, TWR_SCHEDULER_UPDATE_SLACK(_twr_module_battery.update_interval));
             }
 
             _twr_module_battery_measurement(ENABLE);
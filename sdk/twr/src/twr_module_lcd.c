@@ -3,6 +3,7 @@
 #include <twr_tca9534a.h>
 #include <twr_scheduler.h>
 #include <twr_ls013b7dh03.h>
+#include <twr_exti.h>
 
 enum
 {
@@ -30,6 +31,11 @@ typedef struct twr_module_lcd_t
     twr_button_t button_left;
     twr_button_t button_right;
 
+    void (*render_handler)(void *);
+    void *render_param;
+    twr_scheduler_task_id_t render_task_id;
+    bool render_pending;
+
 } twr_module_lcd_t;
 
 twr_module_lcd_t _twr_module_lcd;
@@ -61,6 +67,10 @@ static void _twr_module_lcd_button_init(twr_button_t *self);
 
 static int _twr_module_lcd_button_get_input(twr_button_t *self);
 
+static void _twr_module_lcd_button_exti_handler(twr_exti_line_t line, void *param);
+
+static void _twr_module_lcd_render_task(void *param);
+
 void twr_module_lcd_init()
 {
 	_twr_module_lcd_tca9534a_init();
@@ -70,6 +80,8 @@ void twr_module_lcd_init()
 	twr_gfx_init(&_twr_module_lcd.gfx, &_twr_module_lcd.ls013b7dh03, twr_ls013b7dh03_get_driver());
 
 	twr_gfx_clear(&_twr_module_lcd.gfx);
+
+	_twr_module_lcd.render_task_id = twr_scheduler_register(_twr_module_lcd_render_task, NULL, TWR_TICK_INFINITY);
 }
 
 twr_gfx_t *twr_module_lcd_get_gfx()
@@ -176,6 +188,36 @@ bool twr_module_lcd_update(void)
     return twr_gfx_update(&_twr_module_lcd.gfx);
 }
 
+void twr_module_lcd_set_transfer_buffer(uint8_t *buffer)
+{
+    twr_ls013b7dh03_set_transfer_buffer(&_twr_module_lcd.ls013b7dh03, buffer);
+}
+
+void twr_module_lcd_set_render_handler(void (*render_handler)(void *), void *render_param)
+{
+    _twr_module_lcd.render_handler = render_handler;
+    _twr_module_lcd.render_param = render_param;
+
+    // Invalidation requested while there was no handler is rendered now
+    if (_twr_module_lcd.render_pending && render_handler != NULL)
+    {
+        twr_scheduler_plan_relative(_twr_module_lcd.render_task_id, TWR_MODULE_LCD_INVALIDATE_DELAY);
+    }
+}
+
+void twr_module_lcd_invalidate(void)
+{
+    // Later requests are served by render already planned
+    if (_twr_module_lcd.render_pending)
+    {
+        return;
+    }
+
+    _twr_module_lcd.render_pending = true;
+
+    twr_scheduler_plan_relative(_twr_module_lcd.render_task_id, TWR_MODULE_LCD_INVALIDATE_DELAY);
+}
+
 void twr_module_lcd_set_font(const twr_font_t *font)
 {
     twr_gfx_set_font(&_twr_module_lcd.gfx, font);
@@ -254,6 +296,12 @@ void twr_module_lcd_set_event_handler(void (*event_handler)(twr_module_lcd_event
     twr_button_init_virtual(&_twr_module_lcd.button_left, 0, lcdButtonDriver, 0);
     twr_button_init_virtual(&_twr_module_lcd.button_right, 1, lcdButtonDriver, 0);
 
+    // Both buttons also drive BUTTON line, they are scanned only after its edge until released
+    twr_button_set_scan_on_demand(&_twr_module_lcd.button_left, true);
+    twr_button_set_scan_on_demand(&_twr_module_lcd.button_right, true);
+
+    twr_exti_register_deferred(TWR_EXTI_LINE_BUTTON, TWR_EXTI_EDGE_RISING_AND_FALLING, _twr_module_lcd_button_exti_handler, NULL);
+
     twr_button_set_event_handler(&_twr_module_lcd.button_left, _twr_module_lcd_button_event_handler, (int*)0);
     twr_button_set_event_handler(&_twr_module_lcd.button_right, _twr_module_lcd_button_event_handler, (int*)1);
 }
@@ -407,3 +455,43 @@ static int _twr_module_lcd_button_get_input(twr_button_t *self)
 
     return state;
 }
+
+static void _twr_module_lcd_button_exti_handler(twr_exti_line_t line, void *param)
+{
+    (void) line;
+    (void) param;
+
+    twr_button_scan(&_twr_module_lcd.button_left);
+    twr_button_scan(&_twr_module_lcd.button_right);
+}
+
+static void _twr_module_lcd_render_task(void *param)
+{
+    (void) param;
+
+    // Pending render without handler is planned again by twr_module_lcd_set_render_handler
+    if (!_twr_module_lcd.render_pending || _twr_module_lcd.render_handler == NULL)
+    {
+        return;
+    }
+
+    // Framebuffer must not change while previous frame is being sent from it, unless transfer buffer is set
+    if (!twr_module_lcd_is_ready())
+    {
+        twr_scheduler_plan_current_relative(TWR_MODULE_LCD_INVALIDATE_DELAY);
+
+        return;
+    }
+
+    _twr_module_lcd.render_pending = false;
+
+    _twr_module_lcd.render_handler(_twr_module_lcd.render_param);
+
+    if (!twr_module_lcd_update())
+    {
+        // Render is repeated with update, content changed meanwhile is included
+        _twr_module_lcd.render_pending = true;
+
+        twr_scheduler_plan_current_relative(TWR_MODULE_LCD_INVALIDATE_DELAY);
+    }
+}
@@ -48,7 +48,7 @@ void twr_mpl3115a2_set_update_interval(twr_mpl3115a2_t *self, twr_tick_t interva
     }
     else
     {
-        twr_scheduler_plan_relative(self->_task_id_interval, self->_update_interval);
+        twr_scheduler_plan_relative_with_slack(self->_task_id_interval, self->_update_interval, TWR_SCHEDULER_UPDATE_SLACK(self->_update_interval));
 
         twr_mpl3115a2_measure(self);
     }
@@ -102,7 +102,7 @@ static void _twr_mpl3115a2_task_interval(void *param)
 
     twr_mpl3115a2_measure(self);
 
-    twr_scheduler_plan_current_relative(self->_update_interval);
+    twr_scheduler_plan_current_relative_with_slack(self->_update_interval, TWR_SCHEDULER_UPDATE_SLACK(self->_update_interval));
 }
 
 static void _twr_mpl3115a2_task_measure(void *param)
@@ -1,29 +1,105 @@
 #include <twr_scheduler.h>
-#include <twr_system.h>
 #include <twr_error.h>
+#include <twr_irq.h>
 
-static struct
+#if TWR_SCHEDULER_TICKLESS || TWR_SCHEDULER_PROFILER
+#include <twr_system.h>
+#endif
+
+// Task is not present in the deadline heap
+#define _TWR_SCHEDULER_INDEX_NONE 0xff
+
+// Task became due during the current spin and waits for insertion into the heap
+#define _TWR_SCHEDULER_INDEX_PENDING 0xfe
+
+#if TWR_SCHEDULER_MAX_TASKS > _TWR_SCHEDULER_INDEX_PENDING
+#error "TWR_SCHEDULER_MAX_TASKS must fit heap bookkeeping of uint8_t"
+#endif
+
+#if (TWR_SCHEDULER_EVENT_QUEUE_LENGTH & (TWR_SCHEDULER_EVENT_QUEUE_LENGTH - 1)) != 0
+#error "TWR_SCHEDULER_EVENT_QUEUE_LENGTH must be power of two"
+#endif
+
+typedef struct
+{
+    void (*handler)(void *, uint32_t);
+    void *param;
+    uint32_t event;
+
+} _twr_scheduler_event_t;
+
+typedef struct
 {
+    twr_tick_t tick_execution;
+    void (*task)(void *);
+    void *param;
+
+#if TWR_SCHEDULER_PROFILER
+
     struct
     {
-        twr_tick_t tick_execution;
-        void (*task)(void *);
-        void *param;
+        uint32_t invocations;
+        uint64_t time_total;
+        uint32_t time_max;
+        uint64_t lateness_total;
+        uint32_t lateness_max;
+
+    } profile;
+
+#endif
+
+} _twr_scheduler_task_t;
+
+static struct
+{
+    _twr_scheduler_task_t pool[TWR_SCHEDULER_MAX_TASKS];
+
+    // Lowest task ID which may be free
+    twr_scheduler_task_id_t free_task_id;
+
+    // Position of every task in the heap, _TWR_SCHEDULER_INDEX_NONE or _TWR_SCHEDULER_INDEX_PENDING
+    uint8_t heap_index[TWR_SCHEDULER_MAX_TASKS];
+
+    // Binary min-heap of planned task IDs ordered by tick execution
+    uint8_t heap[TWR_SCHEDULER_MAX_TASKS];
+    size_t heap_length;
+
+    // Tasks planned to the current spin from within the spin, they run in the next one
+    uint8_t pending[TWR_SCHEDULER_MAX_TASKS];
+    size_t pending_length;
 
-    } pool[TWR_SCHEDULER_MAX_TASKS];
+    bool dispatching;
+
+    // Interrupt events, head is advanced by interrupt handlers and tail only by the scheduler
+    volatile _twr_scheduler_event_t event[TWR_SCHEDULER_EVENT_QUEUE_LENGTH];
+    volatile uint32_t event_head;
+    volatile uint32_t event_tail;
+    twr_scheduler_event_stats_t event_stats;
 
     twr_tick_t tick_spin;
     twr_scheduler_task_id_t current_task_id;
-    twr_scheduler_task_id_t max_task_id;
 
 } _twr_scheduler;
 
 void application_idle();
 void application_error(twr_error_t code);
 
+static void _twr_scheduler_idle(void);
+static void _twr_scheduler_event_dispatch(void);
+static void _twr_scheduler_execute(twr_scheduler_task_id_t task_id, twr_tick_t tick_execution);
+static void _twr_scheduler_set(twr_scheduler_task_id_t task_id, twr_tick_t tick);
+static void _twr_scheduler_heap_insert(twr_scheduler_task_id_t task_id);
+static void _twr_scheduler_heap_remove(twr_scheduler_task_id_t task_id);
+static void _twr_scheduler_heap_sift_up(size_t index);
+static void _twr_scheduler_heap_sift_down(size_t index);
+static void _twr_scheduler_pending_remove(twr_scheduler_task_id_t task_id);
+static void _twr_scheduler_pending_flush(void);
+
 void twr_scheduler_init(void)
 {
     memset(&_twr_scheduler, 0, sizeof(_twr_scheduler));
+
+    memset(_twr_scheduler.heap_index, _TWR_SCHEDULER_INDEX_NONE, sizeof(_twr_scheduler.heap_index));
 }
 
 void twr_scheduler_run(void)
@@ -34,36 +110,76 @@ void twr_scheduler_run(void)
     {
         _twr_scheduler.tick_spin = twr_tick_get();
 
-        for (*task_id = 0; *task_id <= _twr_scheduler.max_task_id; (*task_id)++)
+        // Event handlers do not run on behalf of any task
+        *task_id = TWR_SCHEDULER_TASK_ID_NONE;
+
+        _twr_scheduler_event_dispatch();
+
+        _twr_scheduler.dispatching = true;
+
+        while (true)
         {
-            if (_twr_scheduler.pool[*task_id].task != NULL)
+            twr_irq_disable();
+
+            if (_twr_scheduler.heap_length == 0)
             {
-                if (_twr_scheduler.tick_spin >= _twr_scheduler.pool[*task_id].tick_execution)
-                {
-                    _twr_scheduler.pool[*task_id].tick_execution = TWR_TICK_INFINITY;
+                twr_irq_enable();
 
-                    _twr_scheduler.pool[*task_id].task(_twr_scheduler.pool[*task_id].param);
-                }
+                break;
             }
+
+            *task_id = _twr_scheduler.heap[0];
+
+            _twr_scheduler_task_t *task = &_twr_scheduler.pool[*task_id];
+
+            twr_tick_t tick_execution = task->tick_execution;
+
+            if (tick_execution > _twr_scheduler.tick_spin)
+            {
+                twr_irq_enable();
+
+                break;
+            }
+
+            _twr_scheduler_heap_remove(*task_id);
+
+            task->tick_execution = TWR_TICK_INFINITY;
+
+            twr_irq_enable();
+
+            _twr_scheduler_execute(*task_id, tick_execution);
         }
-        application_idle();
+
+        twr_irq_disable();
+
+        _twr_scheduler.dispatching = false;
+
+        _twr_scheduler_pending_flush();
+
+        twr_irq_enable();
+
+        _twr_scheduler_idle();
     }
 }
 
 twr_scheduler_task_id_t twr_scheduler_register(void (*task)(void *), void *param, twr_tick_t tick)
 {
-    for (twr_scheduler_task_id_t i = 0; i < TWR_SCHEDULER_MAX_TASKS; i++)
+    for (twr_scheduler_task_id_t i = _twr_scheduler.free_task_id; i < TWR_SCHEDULER_MAX_TASKS; i++)
     {
         if (_twr_scheduler.pool[i].task == NULL)
         {
-            _twr_scheduler.pool[i].tick_execution = tick;
             _twr_scheduler.pool[i].task = task;
             _twr_scheduler.pool[i].param = param;
 
-            if (_twr_scheduler.max_task_id < i)
-            {
-                _twr_scheduler.max_task_id = i;
-            }
+#if TWR_SCHEDULER_PROFILER
+
+            memset(&_twr_scheduler.pool[i].profile, 0, sizeof(_twr_scheduler.pool[i].profile));
+
+#endif
+
+            _twr_scheduler_set(i, tick);
+
+            _twr_scheduler.free_task_id = i + 1;
 
             return i;
         }
@@ -76,21 +192,103 @@ twr_scheduler_task_id_t twr_scheduler_register(void (*task)(void *), void *param
 
 void twr_scheduler_unregister(twr_scheduler_task_id_t task_id)
 {
+    // Current task ID of event handler
+    if (task_id >= TWR_SCHEDULER_MAX_TASKS)
+    {
+        return;
+    }
+
+    _twr_scheduler_set(task_id, TWR_TICK_INFINITY);
+
     _twr_scheduler.pool[task_id].task = NULL;
 
-    if (_twr_scheduler.max_task_id == task_id)
+    if (_twr_scheduler.free_task_id > task_id)
     {
-        do
-        {
-            if (_twr_scheduler.max_task_id == 0)
-            {
-                break;
-            }
+        _twr_scheduler.free_task_id = task_id;
+    }
+}
+
+#if TWR_SCHEDULER_PROFILER
+
+bool twr_scheduler_get_profile(twr_scheduler_task_id_t task_id, twr_scheduler_profile_t *profile)
+{
+    if (task_id >= TWR_SCHEDULER_MAX_TASKS || _twr_scheduler.pool[task_id].task == NULL)
+    {
+        return false;
+    }
+
+    _twr_scheduler_task_t *task = &_twr_scheduler.pool[task_id];
 
-            _twr_scheduler.max_task_id--;
+    profile->task = task->task;
+    profile->invocations = task->profile.invocations;
+    profile->time_total = task->profile.time_total;
+    profile->time_max = task->profile.time_max;
+    profile->lateness_total = task->profile.lateness_total;
+    profile->lateness_max = task->profile.lateness_max;
 
-        } while (_twr_scheduler.pool[_twr_scheduler.max_task_id].task == NULL);
+    return true;
+}
+
+void twr_scheduler_reset_profile(void)
+{
+    for (twr_scheduler_task_id_t i = 0; i < TWR_SCHEDULER_MAX_TASKS; i++)
+    {
+        memset(&_twr_scheduler.pool[i].profile, 0, sizeof(_twr_scheduler.pool[i].profile));
+    }
+}
+
+#endif
+
+bool twr_scheduler_post_event_irq(void (*handler)(void *, uint32_t), void *param, uint32_t event)
+{
+    // Interrupts of different priority post to the same queue and Cortex-M0+ has no exclusive access instructions,
+    // so the slot is claimed with interrupts masked for a few instructions, the scheduler side reads without masking
+    twr_irq_disable();
+
+    uint32_t head = _twr_scheduler.event_head;
+    uint32_t length = head - _twr_scheduler.event_tail;
+
+    if (length >= TWR_SCHEDULER_EVENT_QUEUE_LENGTH)
+    {
+        _twr_scheduler.event_stats.dropped++;
+
+        twr_irq_enable();
+
+        return false;
+    }
+
+    volatile _twr_scheduler_event_t *slot = &_twr_scheduler.event[head & (TWR_SCHEDULER_EVENT_QUEUE_LENGTH - 1)];
+
+    slot->handler = handler;
+    slot->param = param;
+    slot->event = event;
+
+    _twr_scheduler.event_head = head + 1;
+
+    _twr_scheduler.event_stats.posted++;
+
+    if (_twr_scheduler.event_stats.peak <= length)
+    {
+        _twr_scheduler.event_stats.peak = length + 1;
     }
+
+    twr_irq_enable();
+
+    return true;
+}
+
+void twr_scheduler_get_event_stats(twr_scheduler_event_stats_t *stats)
+{
+    twr_irq_disable();
+
+    *stats = _twr_scheduler.event_stats;
+
+    twr_irq_enable();
+}
+
+size_t twr_scheduler_get_task_count(void)
+{
+    return TWR_SCHEDULER_MAX_TASKS;
 }
 
 twr_scheduler_task_id_t twr_scheduler_get_current_task_id(void)
@@ -103,42 +301,384 @@ twr_tick_t twr_scheduler_get_spin_tick(void)
     return _twr_scheduler.tick_spin;
 }
 
+twr_tick_t twr_scheduler_get_next_tick(void)
+{
+    twr_tick_t tick = TWR_TICK_INFINITY;
+
+    twr_irq_disable();
+
+    if (_twr_scheduler.heap_length != 0)
+    {
+        tick = _twr_scheduler.pool[_twr_scheduler.heap[0]].tick_execution;
+    }
+
+    twr_irq_enable();
+
+    return tick;
+}
+
 void twr_scheduler_plan_now(twr_scheduler_task_id_t task_id)
 {
-    _twr_scheduler.pool[task_id].tick_execution = 0;
+    _twr_scheduler_set(task_id, 0);
 }
 
 void twr_scheduler_plan_absolute(twr_scheduler_task_id_t task_id, twr_tick_t tick)
 {
-    _twr_scheduler.pool[task_id].tick_execution = tick;
+    _twr_scheduler_set(task_id, tick);
 }
 
 void twr_scheduler_plan_relative(twr_scheduler_task_id_t task_id, twr_tick_t tick)
 {
-    _twr_scheduler.pool[task_id].tick_execution = _twr_scheduler.tick_spin + tick;
+    _twr_scheduler_set(task_id, _twr_scheduler.tick_spin + tick);
+}
+
+void twr_scheduler_plan_relative_with_slack(twr_scheduler_task_id_t task_id, twr_tick_t tick, twr_tick_t slack)
+{
+    _twr_scheduler_set(task_id, twr_scheduler_get_coalesced_tick(_twr_scheduler.tick_spin + tick, slack));
 }
 
 void twr_scheduler_plan_from_now(twr_scheduler_task_id_t task_id, twr_tick_t tick)
 {
-    _twr_scheduler.pool[task_id].tick_execution = twr_tick_get() + tick;
+    _twr_scheduler_set(task_id, twr_tick_get() + tick);
 }
 
 void twr_scheduler_plan_current_now(void)
 {
-    _twr_scheduler.pool[_twr_scheduler.current_task_id].tick_execution = 0;
+    _twr_scheduler_set(_twr_scheduler.current_task_id, 0);
 }
 
 void twr_scheduler_plan_current_absolute(twr_tick_t tick)
 {
-    _twr_scheduler.pool[_twr_scheduler.current_task_id].tick_execution = tick;
+    _twr_scheduler_set(_twr_scheduler.current_task_id, tick);
 }
 
 void twr_scheduler_plan_current_relative(twr_tick_t tick)
 {
-    _twr_scheduler.pool[_twr_scheduler.current_task_id].tick_execution = _twr_scheduler.tick_spin + tick;
+    _twr_scheduler_set(_twr_scheduler.current_task_id, _twr_scheduler.tick_spin + tick);
 }
 
 void twr_scheduler_plan_current_from_now(twr_tick_t tick)
 {
-    _twr_scheduler.pool[_twr_scheduler.current_task_id].tick_execution = twr_tick_get() + tick;
+    _twr_scheduler_set(_twr_scheduler.current_task_id, twr_tick_get() + tick);
+}
+
+void twr_scheduler_plan_current_relative_with_slack(twr_tick_t tick, twr_tick_t slack)
+{
+    _twr_scheduler_set(_twr_scheduler.current_task_id, twr_scheduler_get_coalesced_tick(_twr_scheduler.tick_spin + tick, slack));
+}
+
+twr_tick_t twr_scheduler_get_coalesced_tick(twr_tick_t tick, twr_tick_t slack)
+{
+    if (slack == 0 || tick == TWR_TICK_INFINITY)
+    {
+        return tick;
+    }
+
+    twr_tick_t tick_latest = tick + slack;
+
+    if (tick_latest < tick || tick_latest == TWR_TICK_INFINITY)
+    {
+        tick_latest = TWR_TICK_INFINITY - 1;
+    }
+
+    // Clear lowest set bits while staying within the window
+    while ((tick_latest & (tick_latest - 1)) >= tick)
+    {
+        tick_latest &= tick_latest - 1;
+
+        if (tick_latest == 0)
+        {
+            break;
+        }
+    }
+
+    return tick_latest;
+}
+
+static void _twr_scheduler_execute(twr_scheduler_task_id_t task_id, twr_tick_t tick_execution)
+{
+    _twr_scheduler_task_t *task = &_twr_scheduler.pool[task_id];
+
+#if TWR_SCHEDULER_PROFILER
+
+    // SysTick runs anyway as millisecond tick, twr_timer is left to the drivers that use it for delays
+    uint32_t time_start = twr_system_get_microseconds();
+
+    task->task(task->param);
+
+    uint32_t time = twr_system_get_microseconds() - time_start;
+
+    // Task planned by twr_scheduler_plan_now has no deadline to be late from
+    uint32_t lateness = tick_execution != 0 ? _twr_scheduler.tick_spin - tick_execution : 0;
+
+    task->profile.invocations++;
+    task->profile.time_total += time;
+    task->profile.lateness_total += lateness;
+
+    if (task->profile.time_max < time)
+    {
+        task->profile.time_max = time;
+    }
+
+    if (task->profile.lateness_max < lateness)
+    {
+        task->profile.lateness_max = lateness;
+    }
+
+#else
+
+    (void) tick_execution;
+
+    task->task(task->param);
+
+#endif
+}
+
+static void _twr_scheduler_event_dispatch(void)
+{
+    // Events posted by handlers or interrupts meanwhile are left for the next spin
+    uint32_t head = _twr_scheduler.event_head;
+    uint32_t tail = _twr_scheduler.event_tail;
+
+    while (tail != head)
+    {
+        volatile _twr_scheduler_event_t *slot = &_twr_scheduler.event[tail & (TWR_SCHEDULER_EVENT_QUEUE_LENGTH - 1)];
+
+        void (*handler)(void *, uint32_t) = slot->handler;
+        void *param = slot->param;
+        uint32_t event = slot->event;
+
+        // Slot is released before the handler runs so that interrupts may reuse it
+        _twr_scheduler.event_tail = ++tail;
+
+        handler(param, event);
+    }
+}
+
+static void _twr_scheduler_idle(void)
+{
+    twr_tick_t tick_next = twr_scheduler_get_next_tick();
+    twr_tick_t tick_now = twr_tick_get();
+
+    if (tick_next <= tick_now || _twr_scheduler.event_head != _twr_scheduler.event_tail)
+    {
+        return;
+    }
+
+#if TWR_SCHEDULER_TICKLESS
+
+    twr_system_tickless_set(tick_next - tick_now);
+
+#endif
+
+    application_idle();
+
+#if TWR_SCHEDULER_TICKLESS
+
+    twr_system_tickless_sync();
+
+    // Tasks may rely on the tick advancing while they run, restore the periodic tick
+    if (twr_scheduler_get_next_tick() <= twr_tick_get() || _twr_scheduler.event_head != _twr_scheduler.event_tail)
+    {
+        twr_system_tickless_set(0);
+    }
+
+#endif
+}
+
+static void _twr_scheduler_set(twr_scheduler_task_id_t task_id, twr_tick_t tick)
+{
+    // Current task is planned from an event handler
+    if (task_id == TWR_SCHEDULER_TASK_ID_NONE)
+    {
+        return;
+    }
+
+    _twr_scheduler_task_t *task = &_twr_scheduler.pool[task_id];
+
+    // Stale task ID must not get into the heap, dispatch would call unregistered task
+    if (task->task == NULL)
+    {
+        return;
+    }
+
+    // Planning functions are also called from interrupt handlers
+    twr_irq_disable();
+
+    task->tick_execution = tick;
+
+    uint8_t heap_index = _twr_scheduler.heap_index[task_id];
+
+    if (heap_index == _TWR_SCHEDULER_INDEX_PENDING)
+    {
+        // Heap position is resolved once the spin finishes
+        if (tick == TWR_TICK_INFINITY)
+        {
+            _twr_scheduler_pending_remove(task_id);
+        }
+    }
+    else if (tick == TWR_TICK_INFINITY)
+    {
+        if (heap_index != _TWR_SCHEDULER_INDEX_NONE)
+        {
+            _twr_scheduler_heap_remove(task_id);
+        }
+    }
+    else if (_twr_scheduler.dispatching && tick <= _twr_scheduler.tick_spin)
+    {
+        // Keep the spin bounded, task planned to the past from within the spin runs in the next one
+        if (heap_index != _TWR_SCHEDULER_INDEX_NONE)
+        {
+            _twr_scheduler_heap_remove(task_id);
+        }
+
+        _twr_scheduler.heap_index[task_id] = _TWR_SCHEDULER_INDEX_PENDING;
+
+        _twr_scheduler.pending[_twr_scheduler.pending_length++] = task_id;
+    }
+    else if (heap_index == _TWR_SCHEDULER_INDEX_NONE)
+    {
+        _twr_scheduler_heap_insert(task_id);
+    }
+    else
+    {
+        _twr_scheduler_heap_sift_up(heap_index);
+
+        _twr_scheduler_heap_sift_down(_twr_scheduler.heap_index[task_id]);
+    }
+
+    twr_irq_enable();
+}
+
+static void _twr_scheduler_heap_insert(twr_scheduler_task_id_t task_id)
+{
+    size_t index = _twr_scheduler.heap_length++;
+
+    _twr_scheduler.heap[index] = task_id;
+    _twr_scheduler.heap_index[task_id] = index;
+
+    _twr_scheduler_heap_sift_up(index);
+}
+
+static void _twr_scheduler_heap_remove(twr_scheduler_task_id_t task_id)
+{
+    size_t index = _twr_scheduler.heap_index[task_id];
+
+    _twr_scheduler.heap_index[task_id] = _TWR_SCHEDULER_INDEX_NONE;
+
+    size_t last = --_twr_scheduler.heap_length;
+
+    if (index == last)
+    {
+        return;
+    }
+
+    twr_scheduler_task_id_t last_task_id = _twr_scheduler.heap[last];
+
+    _twr_scheduler.heap[index] = last_task_id;
+    _twr_scheduler.heap_index[last_task_id] = index;
+
+    _twr_scheduler_heap_sift_up(index);
+
+    _twr_scheduler_heap_sift_down(_twr_scheduler.heap_index[last_task_id]);
+}
+
+static void _twr_scheduler_heap_sift_up(size_t index)
+{
+    twr_scheduler_task_id_t task_id = _twr_scheduler.heap[index];
+
+    twr_tick_t tick = _twr_scheduler.pool[task_id].tick_execution;
+
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+
+        twr_scheduler_task_id_t parent_task_id = _twr_scheduler.heap[parent];
+
+        if (_twr_scheduler.pool[parent_task_id].tick_execution <= tick)
+        {
+            break;
+        }
+
+        _twr_scheduler.heap[index] = parent_task_id;
+        _twr_scheduler.heap_index[parent_task_id] = index;
+
+        index = parent;
+    }
+
+    _twr_scheduler.heap[index] = task_id;
+    _twr_scheduler.heap_index[task_id] = index;
+}
+
+static void _twr_scheduler_heap_sift_down(size_t index)
+{
+    twr_scheduler_task_id_t task_id = _twr_scheduler.heap[index];
+
+    twr_tick_t tick = _twr_scheduler.pool[task_id].tick_execution;
+
+    while (true)
+    {
+        size_t child = index * 2 + 1;
+
+        if (child >= _twr_scheduler.heap_length)
+        {
+            break;
+        }
+
+        twr_scheduler_task_id_t child_task_id = _twr_scheduler.heap[child];
+
+        if (child + 1 < _twr_scheduler.heap_length)
+        {
+            twr_scheduler_task_id_t sibling_task_id = _twr_scheduler.heap[child + 1];
+
+            if (_twr_scheduler.pool[sibling_task_id].tick_execution < _twr_scheduler.pool[child_task_id].tick_execution)
+            {
+                child++;
+
+                child_task_id = sibling_task_id;
+            }
+        }
+
+        if (tick <= _twr_scheduler.pool[child_task_id].tick_execution)
+        {
+            break;
+        }
+
+        _twr_scheduler.heap[index] = child_task_id;
+        _twr_scheduler.heap_index[child_task_id] = index;
+
+        index = child;
+    }
+
+    _twr_scheduler.heap[index] = task_id;
+    _twr_scheduler.heap_index[task_id] = index;
+}
+
+static void _twr_scheduler_pending_remove(twr_scheduler_task_id_t task_id)
+{
+    _twr_scheduler.heap_index[task_id] = _TWR_SCHEDULER_INDEX_NONE;
+
+    for (size_t i = 0; i < _twr_scheduler.pending_length; i++)
+    {
+        if (_twr_scheduler.pending[i] == task_id)
+        {
+            _twr_scheduler.pending[i] = _twr_scheduler.pending[--_twr_scheduler.pending_length];
+
+            return;
+        }
+    }
+}
+
+static void _twr_scheduler_pending_flush(void)
+{
+    for (size_t i = 0; i < _twr_scheduler.pending_length; i++)
+    {
+        twr_scheduler_task_id_t task_id = _twr_scheduler.pending[i];
+
+        _twr_scheduler.heap_index[task_id] = _TWR_SCHEDULER_INDEX_NONE;
+
+        _twr_scheduler_heap_insert(task_id);
+    }
+
+    _twr_scheduler.pending_length = 0;
 }
@@ -51,7 +51,7 @@ void twr_sht20_set_update_interval(twr_sht20_t *self, twr_tick_t interval)
     }
     else
     {
-        twr_scheduler_plan_relative(self->_task_id_interval, self->_update_interval);
+        twr_scheduler_plan_relative_with_slack(self->_task_id_interval, self->_update_interval, TWR_SCHEDULER_UPDATE_SLACK(self->_update_interval));
 
         twr_sht20_measure(self);
     }
@@ -171,7 +171,7 @@ static void _twr_sht20_task_interval(void *param)
 
     twr_sht20_measure(self);
 
-    twr_scheduler_plan_current_relative(self->_update_interval);
+    twr_scheduler_plan_current_relative_with_slack(self->_update_interval, TWR_SCHEDULER_UPDATE_SLACK(self->_update_interval));
 }
 
 static void _twr_sht20_task_measure(void *param)
@@ -50,7 +50,7 @@ void twr_sht30_set_update_interval(twr_sht30_t *self, twr_tick_t interval)
     }
     else
     {
-        twr_scheduler_plan_relative(self->_task_id_interval, self->_update_interval);
+        twr_scheduler_plan_relative_with_slack(self->_task_id_interval, self->_update_interval, TWR_SCHEDULER_UPDATE_SLACK(self->_update_interval));
 
         twr_sht30_measure(self);
     }
@@ -170,7 +170,7 @@ static void _twr_sht30_task_interval(void *param)
 
     twr_sht30_measure(self);
 
-    twr_scheduler_plan_current_relative(self->_update_interval);
+    twr_scheduler_plan_current_relative_with_slack(self->_update_interval, TWR_SCHEDULER_UPDATE_SLACK(self->_update_interval));
 }
 
 static void _twr_sht30_task_measure(void *param)
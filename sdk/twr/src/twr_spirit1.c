@@ -326,7 +326,7 @@ static void _twr_spirit1_enter_state_tx(void)
 
     SpiritSpiWriteLinearFifo(_twr_spirit1.tx_length, _twr_spirit1.tx_buffer);
 
-    twr_exti_register(TWR_EXTI_LINE_PA7, TWR_EXTI_EDGE_FALLING, _twr_spirit1_interrupt, NULL);
+    twr_exti_register_deferred(TWR_EXTI_LINE_PA7, TWR_EXTI_EDGE_FALLING, _twr_spirit1_interrupt, NULL);
 
     SpiritCmdStrobeTx();
 }
@@ -400,7 +400,7 @@ static void _twr_spirit1_enter_state_rx(void)
     /* IRQ registers blanking */
     SpiritIrqClearStatus();
 
-    twr_exti_register(TWR_EXTI_LINE_PA7, TWR_EXTI_EDGE_FALLING, _twr_spirit1_interrupt, NULL);
+    twr_exti_register_deferred(TWR_EXTI_LINE_PA7, TWR_EXTI_EDGE_FALLING, _twr_spirit1_interrupt, NULL);
 
     /* RX command */
     SpiritCmdStrobeRx();
@@ -5,6 +5,7 @@
 #include <twr_timer.h>
 #include <stm32l0xx.h>
 #include <stm32l0xx_hal_conf.h>
+#include <stm32l0xx_hal.h>
 #include <twr_rtc.h>
 #include <twr_sleep.h>
 
@@ -23,6 +24,12 @@ static int _twr_system_pll_enable_semaphore;
 
 static int _twr_system_deep_sleep_disable_semaphore;
 
+#if TWR_SCHEDULER_TICKLESS
+
+void _twr_system_tickless_irq(void);
+
+#endif
+
 static void _twr_system_init_flash(void);
 
 static void _twr_system_init_debug(void);
@@ -454,6 +461,26 @@ void twr_system_reset(void)
     NVIC_SystemReset();
 }
 
+uint32_t twr_system_get_microseconds(void)
+{
+    uint32_t tick;
+    uint32_t load;
+    uint32_t value;
+
+    // Counter reload is read again if the millisecond interrupt came in between
+    do
+    {
+        tick = HAL_GetTick();
+
+        load = SysTick->LOAD;
+
+        value = SysTick->VAL;
+
+    } while (tick != HAL_GetTick());
+
+    return tick * 1000 + (load - value) * 1000 / (load + 1);
+}
+
 bool twr_system_get_vbus_sense(void)
 {
     static bool init = false;
@@ -505,7 +532,15 @@ void RTC_IRQHandler(void)
         // Clear wake-up timer flag
         RTC->ISR &= ~RTC_ISR_WUTF;
 
+#if TWR_SCHEDULER_TICKLESS
+
+        _twr_system_tickless_irq();
+
+#else
+
         twr_tick_increment_irq(TWR_SCHEDULER_INTERVAL_MS);
+
+#endif
     }
 
     // Clear EXTI interrupt flag
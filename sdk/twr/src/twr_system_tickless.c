@@ -0,0 +1,224 @@
+#include <twr_system.h>
+#include <twr_scheduler.h>
+#include <twr_irq.h>
+#include <twr_rtc.h>
+#include <twr_sleep.h>
+#include <stm32l0xx.h>
+#include <stm32l0xx_hal_conf.h>
+
+#if TWR_SCHEDULER_TICKLESS
+
+// Wake-up timer counts RTCCLK / 16, the same as set up by twr_system_init
+#define _TWR_SYSTEM_WAKEUP_TIMER_CLOCK (LSE_VALUE / 16)
+
+// Wake-up timer reload value of a single scheduler interval
+#define _TWR_SYSTEM_WAKEUP_TIMER_RELOAD (_TWR_SYSTEM_WAKEUP_TIMER_CLOCK * TWR_SCHEDULER_INTERVAL_MS / 1000)
+
+// Wake-up timer counts of the given number of scheduler intervals
+#define _TWR_SYSTEM_WAKEUP_TIMER_COUNTS(intervals) ((uint32_t) ((uint64_t) _TWR_SYSTEM_WAKEUP_TIMER_CLOCK * TWR_SCHEDULER_INTERVAL_MS * (intervals) / 1000))
+
+// Longest tickless sleep that fits the 16-bit wake-up timer reload register
+#define _TWR_SYSTEM_TICKLESS_MAX_INTERVALS (0x10000 / _TWR_SYSTEM_WAKEUP_TIMER_CLOCK * 1000 / TWR_SCHEDULER_INTERVAL_MS)
+
+#define _TWR_SYSTEM_WAKEUP_TIMER_COUNTS_PER_DAY (86400 * _TWR_SYSTEM_WAKEUP_TIMER_CLOCK)
+
+static struct
+{
+    // Number of intervals to arm on the next wake-up timer expiration
+    volatile uint32_t request;
+
+    // Number of intervals the wake-up timer is armed for
+    volatile uint32_t armed;
+
+    // Number of armed intervals already added to the tick counter
+    volatile uint32_t credited;
+
+    // First period is shorter than armed, timer is re-armed on its expiration
+    volatile bool shortened;
+
+    // RTC time in wake-up timer counts when the armed period started
+    uint32_t start;
+
+} _twr_system_tickless = { .armed = 1 };
+
+static void _twr_system_wakeup_timer_set(uint32_t intervals, uint32_t remainder);
+
+static uint32_t _twr_system_tickless_credit(void);
+
+static uint32_t _twr_system_rtc_get_subseconds(void);
+
+// Called by RTC_IRQHandler on wake-up timer expiration
+
+void _twr_system_tickless_irq(void)
+{
+    twr_tick_increment_irq((_twr_system_tickless.armed - _twr_system_tickless.credited) * TWR_SCHEDULER_INTERVAL_MS);
+
+    _twr_system_tickless.credited = 0;
+
+    uint32_t intervals = _twr_system_tickless.request > 1 ? _twr_system_tickless.request : 1;
+
+    // Capped sleep goes on until the scheduler shortens it to the rest of the timeout without extra wake-up
+    if (_twr_system_tickless.request == 0 && _twr_system_tickless.armed == _TWR_SYSTEM_TICKLESS_MAX_INTERVALS)
+    {
+        intervals = _TWR_SYSTEM_TICKLESS_MAX_INTERVALS;
+    }
+
+    _twr_system_tickless.request = 0;
+
+    // Long sleep is armed right after the expiration so that no partial interval is lost
+    if (intervals != _twr_system_tickless.armed || _twr_system_tickless.shortened)
+    {
+        _twr_system_wakeup_timer_set(intervals, 0);
+    }
+    else if (intervals > 1)
+    {
+        // Timer reloaded itself with the same period
+        _twr_system_tickless.start = _twr_system_rtc_get_subseconds() * (_TWR_SYSTEM_WAKEUP_TIMER_CLOCK / TWR_RTC_PREDIV_S);
+    }
+}
+
+void twr_system_tickless_set(twr_tick_t timeout)
+{
+    uint32_t intervals = 1;
+
+    if (sleep_manager.disable_sleep_semaphore == 0)
+    {
+        if (timeout >= (twr_tick_t) _TWR_SYSTEM_TICKLESS_MAX_INTERVALS * TWR_SCHEDULER_INTERVAL_MS)
+        {
+            intervals = _TWR_SYSTEM_TICKLESS_MAX_INTERVALS;
+        }
+        else if (timeout >= 2 * TWR_SCHEDULER_INTERVAL_MS)
+        {
+            intervals = timeout / TWR_SCHEDULER_INTERVAL_MS;
+        }
+    }
+
+    twr_irq_disable();
+
+    if (_twr_system_tickless.armed == 1 || (RTC->ISR & RTC_ISR_WUTF) != 0)
+    {
+        // Armed by the interrupt handler on the next expiration
+        _twr_system_tickless.request = intervals;
+    }
+    else if (intervals < _twr_system_tickless.armed - _twr_system_tickless.credited)
+    {
+        // Deadline moved closer during a long sleep, restart the timer with the shorter period
+        uint32_t remainder = _twr_system_tickless_credit();
+
+        // Part of the interval already slept is carried over so that the tick does not fall behind the RTC
+        _twr_system_wakeup_timer_set(intervals, remainder);
+    }
+
+    twr_irq_enable();
+}
+
+void twr_system_tickless_sync(void)
+{
+    twr_irq_disable();
+
+    _twr_system_tickless.request = 0;
+
+    // Woken up by another interrupt before the wake-up timer expired
+    if (_twr_system_tickless.armed > 1 && (RTC->ISR & RTC_ISR_WUTF) == 0)
+    {
+        _twr_system_tickless_credit();
+    }
+
+    twr_irq_enable();
+}
+
+static void _twr_system_wakeup_timer_set(uint32_t intervals, uint32_t remainder)
+{
+    uint32_t reload = intervals == 1 ? _TWR_SYSTEM_WAKEUP_TIMER_RELOAD : _TWR_SYSTEM_WAKEUP_TIMER_COUNTS(intervals) - 1;
+
+    // Timer expires at least one count after it is enabled
+    if (remainder > reload)
+    {
+        remainder = reload;
+    }
+
+    twr_rtc_enable_write();
+
+    // Disable timer
+    RTC->CR &= ~RTC_CR_WUTE;
+
+    // Wait until timer configuration update is allowed...
+    while ((RTC->ISR & RTC_ISR_WUTWF) == 0)
+    {
+        continue;
+    }
+
+    RTC->WUTR = reload - remainder;
+
+    // Clear timer flag
+    RTC->ISR &= ~RTC_ISR_WUTF;
+
+    // Enable timer
+    RTC->CR |= RTC_CR_WUTE;
+
+    twr_rtc_disable_write();
+
+    _twr_system_tickless.armed = intervals;
+    _twr_system_tickless.credited = 0;
+    _twr_system_tickless.shortened = remainder != 0;
+
+    if (intervals > 1)
+    {
+        uint32_t time = _twr_system_rtc_get_subseconds() * (_TWR_SYSTEM_WAKEUP_TIMER_CLOCK / TWR_RTC_PREDIV_S);
+
+        _twr_system_tickless.start = (time + _TWR_SYSTEM_WAKEUP_TIMER_COUNTS_PER_DAY - remainder) % _TWR_SYSTEM_WAKEUP_TIMER_COUNTS_PER_DAY;
+    }
+}
+
+static uint32_t _twr_system_tickless_credit(void)
+{
+    uint32_t time = _twr_system_rtc_get_subseconds() * (_TWR_SYSTEM_WAKEUP_TIMER_CLOCK / TWR_RTC_PREDIV_S);
+
+    time = (time + _TWR_SYSTEM_WAKEUP_TIMER_COUNTS_PER_DAY - _twr_system_tickless.start) % _TWR_SYSTEM_WAKEUP_TIMER_COUNTS_PER_DAY;
+
+    uint32_t elapsed = (uint64_t) time * 1000 / TWR_SCHEDULER_INTERVAL_MS / _TWR_SYSTEM_WAKEUP_TIMER_CLOCK;
+
+    // The remaining interval is always added by the interrupt handler
+    if (elapsed >= _twr_system_tickless.armed)
+    {
+        elapsed = _twr_system_tickless.armed - 1;
+
+        time = _TWR_SYSTEM_WAKEUP_TIMER_COUNTS(elapsed);
+    }
+
+    if (elapsed > _twr_system_tickless.credited)
+    {
+        twr_tick_increment_irq((elapsed - _twr_system_tickless.credited) * TWR_SCHEDULER_INTERVAL_MS);
+
+        _twr_system_tickless.credited = elapsed;
+    }
+
+    // Part of the current interval that has already passed
+    return time - _TWR_SYSTEM_WAKEUP_TIMER_COUNTS(elapsed);
+}
+
+static uint32_t _twr_system_rtc_get_subseconds(void)
+{
+    // Shadow registers are not updated in deep sleep, wait for their synchronization
+    twr_rtc_enable_write();
+
+    RTC->ISR &= ~RTC_ISR_RSF;
+
+    twr_rtc_disable_write();
+
+    twr_rtc_wait();
+
+    uint32_t ssr = RTC->SSR & RTC_SSR_SS;
+    uint32_t tr = RTC->TR;
+
+    // Reading of RTC_TR locks the shadow registers until RTC_DR is read
+    (void) RTC->DR;
+
+    uint32_t seconds = (((tr & RTC_TR_HT) >> RTC_TR_HT_Pos) * 10 + ((tr & RTC_TR_HU) >> RTC_TR_HU_Pos)) * 3600;
+    seconds += (((tr & RTC_TR_MNT) >> RTC_TR_MNT_Pos) * 10 + ((tr & RTC_TR_MNU) >> RTC_TR_MNU_Pos)) * 60;
+    seconds += ((tr & RTC_TR_ST) >> RTC_TR_ST_Pos) * 10 + ((tr & RTC_TR_SU) >> RTC_TR_SU_Pos);
+
+    return seconds * TWR_RTC_PREDIV_S + (TWR_RTC_PREDIV_S - 1 - ssr);
+}
+
+#endif
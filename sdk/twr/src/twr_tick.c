@@ -1,6 +1,5 @@
 #include <twr_tick.h>
 #include <twr_irq.h>
-#include <stm32l0xx.h>
 
 static volatile twr_tick_t _twr_tick_counter = 0;
 
@@ -17,6 +17,7 @@ typedef struct
     twr_scheduler_task_id_t async_read_task_id;
     bool async_write_in_progress;
     bool async_read_in_progress;
+    volatile bool async_read_event_posted;
     twr_tick_t async_timeout;
     USART_TypeDef *usart;
 
@@ -46,7 +47,9 @@ static uint32_t _twr_uart_brr_t[] =
     [TWR_UART_BAUDRATE_921600] = 0x22
 };
 
+static void _twr_uart_async_write_event(void *param, uint32_t event);
 static void _twr_uart_async_write_task(void *param);
+static void _twr_uart_async_read_event(void *param, uint32_t event);
 static void _twr_uart_async_read_task(void *param);
 static void _twr_uart_2_dma_read_task(void *param);
 static void _twr_uart_irq_handler(twr_uart_channel_t channel);
@@ -55,6 +58,8 @@ void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr
 {
     memset(&_twr_uart[channel], 0, sizeof(_twr_uart[channel]));
 
+    _twr_uart[channel].async_write_task_id = TWR_SCHEDULER_TASK_ID_NONE;
+
     switch(channel)
     {
         case TWR_UART_UART0:
@@ -241,8 +246,26 @@ void twr_uart_deinit(twr_uart_channel_t channel)
     // Disable UART
     _twr_uart[channel].usart->CR1 &= ~USART_CR1_UE_Msk;
 
-    if (_twr_uart[channel].async_write_task_id != 0) {
+    // Pending write done event is ignored, clock requested for the write is released here
+    if (_twr_uart[channel].async_write_in_progress)
+    {
+        _twr_uart[channel].async_write_in_progress = false;
+
+        if (_twr_uart[channel].usart == LPUART1)
+        {
+            twr_system_hsi16_disable();
+        }
+        else
+        {
+            twr_system_pll_disable();
+        }
+    }
+
+    if (_twr_uart[channel].async_write_task_id != TWR_SCHEDULER_TASK_ID_NONE)
+    {
         twr_scheduler_unregister(_twr_uart[channel].async_write_task_id);
+
+        _twr_uart[channel].async_write_task_id = TWR_SCHEDULER_TASK_ID_NONE;
     }
 
     switch(channel)
@@ -413,6 +436,11 @@ void twr_uart_set_async_fifo(twr_uart_channel_t channel, twr_fifo_t *write_fifo,
 {
     _twr_uart[channel].write_fifo = write_fifo;
     _twr_uart[channel].read_fifo = read_fifo;
+
+    if (write_fifo != NULL && _twr_uart[channel].async_write_task_id == TWR_SCHEDULER_TASK_ID_NONE)
+    {
+        _twr_uart[channel].async_write_task_id = twr_scheduler_register(_twr_uart_async_write_task, (void *) channel, TWR_TICK_INFINITY);
+    }
 }
 
 size_t twr_uart_async_write(twr_uart_channel_t channel, const void *buffer, size_t length)
@@ -433,8 +461,6 @@ size_t twr_uart_async_write(twr_uart_channel_t channel, const void *buffer, size
     {
         if (!_twr_uart[channel].async_write_in_progress)
         {
-            _twr_uart[channel].async_write_task_id = twr_scheduler_register(_twr_uart_async_write_task, (void *) channel, TWR_TICK_INFINITY);
-
             if (_twr_uart[channel].usart == LPUART1)
             {
                 twr_system_hsi16_enable();
@@ -443,10 +469,9 @@ size_t twr_uart_async_write(twr_uart_channel_t channel, const void *buffer, size
             {
                 twr_system_pll_enable();
             }
-        }
-        else
-        {
-            twr_scheduler_plan_absolute(_twr_uart[channel].async_write_task_id, TWR_TICK_INFINITY);
+
+            // Completion is checked by the task only if its interrupt event gets lost
+            twr_scheduler_plan_relative(_twr_uart[channel].async_write_task_id, TWR_UART_ASYNC_WRITE_CHECK_PERIOD);
         }
 
         twr_irq_disable();
@@ -570,14 +595,22 @@ size_t twr_uart_async_read(twr_uart_channel_t channel, void *buffer, size_t leng
     return bytes_read;
 }
 
-static void _twr_uart_async_write_task(void *param)
+static void _twr_uart_async_write_event(void *param, uint32_t event)
 {
+    (void) event;
+
     twr_uart_channel_t channel = (twr_uart_channel_t) param;
     twr_uart_t *uart = &_twr_uart[channel];
 
+    // Data written after the transmission completed enabled transmit interrupt again, its completion posts new event
+    if (!uart->async_write_in_progress || (uart->usart->CR1 & (USART_CR1_TXEIE | USART_CR1_TCIE)) != 0)
+    {
+        return;
+    }
+
     uart->async_write_in_progress = false;
 
-    twr_scheduler_unregister(uart->async_write_task_id);
+    twr_scheduler_plan_absolute(uart->async_write_task_id, TWR_TICK_INFINITY);
 
     if (uart->usart == LPUART1)
     {
@@ -594,6 +627,33 @@ static void _twr_uart_async_write_task(void *param)
     }
 }
 
+static void _twr_uart_async_write_task(void *param)
+{
+    twr_uart_channel_t channel = (twr_uart_channel_t) param;
+
+    _twr_uart_async_write_event(param, 0);
+
+    if (_twr_uart[channel].async_write_in_progress)
+    {
+        twr_scheduler_plan_current_relative(TWR_UART_ASYNC_WRITE_CHECK_PERIOD);
+    }
+}
+
+static void _twr_uart_async_read_event(void *param, uint32_t event)
+{
+    (void) event;
+
+    twr_uart_channel_t channel = (twr_uart_channel_t) param;
+    twr_uart_t *uart = &_twr_uart[channel];
+
+    uart->async_read_event_posted = false;
+
+    if (uart->async_read_in_progress)
+    {
+        twr_scheduler_plan_now(uart->async_read_task_id);
+    }
+}
+
 static void _twr_uart_async_read_task(void *param)
 {
     twr_uart_channel_t channel = (twr_uart_channel_t) param;
@@ -647,7 +707,11 @@ static void _twr_uart_irq_handler(twr_uart_channel_t channel)
 
         twr_fifo_irq_write(_twr_uart[channel].read_fifo, &character, 1);
 
-        twr_scheduler_plan_now(_twr_uart[channel].async_read_task_id);
+        // Single event per burst of characters, the read task drains whole FIFO
+        if (!_twr_uart[channel].async_read_event_posted)
+        {
+            _twr_uart[channel].async_read_event_posted = twr_scheduler_post_event_irq(_twr_uart_async_read_event, (void *) channel, 0);
+        }
     }
 
     // If it is transmit interrupt...
@@ -677,7 +741,7 @@ static void _twr_uart_irq_handler(twr_uart_channel_t channel)
         // Disable transmission complete interrupt
         usart->CR1 &= ~USART_CR1_TCIE;
 
-        twr_scheduler_plan_now(_twr_uart[channel].async_write_task_id);
+        twr_scheduler_post_event_irq(_twr_uart_async_write_event, (void *) channel, 0);
     }
 }
 
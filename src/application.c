@@ -11,6 +11,7 @@ TOWER configuration:
 */
 #include <application.h>
 #include <twr_at_lora.h>
+#include <twr_at_scheduler.h>
 
 #define SEND_DATA_INTERVAL (10 * 60 * 1000)
 #define HUMIDITY_UPDATE_INTERVAL (1 * 60 * 1000)
@@ -23,7 +24,27 @@ TOWER configuration:
 #define CO2_CALIBRATION_INTERVAL (1 * 60 * 1000)
 #define CO2_UPDATE_SERVICE_INTERVAL (1 * 60 * 1000)
 
-#define MAX_PAGE_INDEX 3
+#define TEMPERATURE_SCALE 10
+#define HUMIDITY_SCALE 2
+
+#define ROLLUP_HOUR_FOLD (60 * 60 * 1000 / SEND_DATA_INTERVAL)
+#define ROLLUP_HOUR_RECORDS 24
+#define ROLLUP_DAY_RECORDS 7
+
+#define LCD_CHART_LEFT 10
+#define LCD_CHART_TOP 75
+#define LCD_CHART_WIDTH 108
+#define LCD_CHART_HEIGHT 32
+
+// Histories keep one sample per sensor update, charts of LCD_CHART_WIDTH samples last 108 minutes for temperature,
+// 3.6 hours for CO2 and 9 hours for pressure and battery voltage
+#define PRESSURE_HISTORY_SCALE 10
+#define VOLTAGE_HISTORY_SCALE 100
+
+// Hourly rollup records of the last day are charted as bars from minimum to maximum, the newest one is rightmost
+#define LCD_ROLLUP_BAR_PITCH (LCD_CHART_WIDTH / ROLLUP_HOUR_RECORDS)
+
+#define MAX_PAGE_INDEX 5
 
 #define PAGE_INDEX_MENU -1
 
@@ -72,8 +93,22 @@ static struct
     float_t battery_voltage;
     float_t battery_pct;
 
+    // Averages of the last day and week of rollups
+    float_t temperature_day;
+    float_t temperature_week;
+    float_t co2_day;
+    float_t co2_week;
+
 } values;
 
+twr_data_stream_t sm_temperature_history;
+twr_data_stream_t sm_co2_history;
+twr_data_stream_t sm_pressure_history;
+twr_data_stream_t sm_voltage_history;
+
+twr_data_stream_rollup_t rollup_temperature;
+twr_data_stream_rollup_t rollup_co2;
+
 static const struct
 {
     char *name0;
@@ -85,30 +120,91 @@ static const struct
     float_t *value1;
     char *unit1;
 
+    // History of the first value charted below the second one
+    twr_data_stream_t *history;
+
+    // Rollup charted by hourly bars instead of history
+    twr_data_stream_rollup_t *rollup;
+
 } pages[] = {
-    {"Temperature   ", "%.1f", &values.temperature, " \xb0"
-                                                    "C",
-     "Humidity      ", "%.0f", &values.humidity, " %"},
-    {"CO2           ", "%.0f", &values.co2, " ppm",
-     "TVOC          ", "%.0f", &values.tvoc, " ppb"},
-    {"Air pressure  ", "%.0f", &values.pressure, " hPa",
-     "", "%.0f", 0, ""},
-    {"Battery       ", "%.2f", &values.battery_voltage, "V",
-     "Battery       ", "%.0f", &values.battery_pct, " %"},
+    {"Temperature", "%.1f", &values.temperature, " \xb0"
+                                                 "C",
+     "Humidity", "%.0f", &values.humidity, " %", &sm_temperature_history},
+    {"CO2", "%.0f", &values.co2, " ppm",
+     "TVOC", "%.0f", &values.tvoc, " ppb", &sm_co2_history},
+    {"Air pressure", "%.0f", &values.pressure, " hPa",
+     "", "%.0f", 0, "", &sm_pressure_history},
+    {"Battery", "%.2f", &values.battery_voltage, "V",
+     "Battery", "%.0f", &values.battery_pct, " %", &sm_voltage_history},
+    {"Temperature 24h", "%.1f", &values.temperature_day, " \xb0"
+                                                         "C",
+     "7 days", "%.1f", &values.temperature_week, " \xb0"
+                                                 "C", NULL, &rollup_temperature},
+    {"CO2 24h", "%.0f", &values.co2_day, " ppm",
+     "7 days", "%.0f", &values.co2_week, " ppm", NULL, &rollup_co2},
 };
 
 static int page_index = 0;
 static int menu_item = 0;
+
+// Retained text field, it is redrawn only when its text, font or position changes
+typedef struct
+{
+    int x;
+    int top;
+    twr_gfx_align_t align;
+    const twr_font_t *font;
+    char text[20];
+    bool dirty;
+
+    // Bounding box of text currently on display
+    twr_gfx_box_t box;
+
+    // Bounding box of text to be drawn
+    twr_gfx_box_t box_new;
+
+} lcd_field_t;
+
+enum
+{
+    LCD_FIELD_NAME0 = 0,
+    LCD_FIELD_VALUE0 = 1,
+    LCD_FIELD_UNIT0 = 2,
+    LCD_FIELD_NAME1 = 3,
+    LCD_FIELD_VALUE1 = 4,
+    LCD_FIELD_UNIT1 = 5,
+    LCD_FIELD_PAGE = 6,
+    LCD_FIELD_COUNT = 7
+};
+
+static lcd_field_t lcd_fields[LCD_FIELD_COUNT];
+
+// Frame is sent from this copy, so the next page can be rendered during transfer
+static uint8_t lcd_transfer_buffer[TWR_LS013B7DH03_FRAMEBUFFER_SIZE];
+static twr_gfx_chart_t lcd_chart;
+
+// Stream of chart currently on display
+static twr_data_stream_t *lcd_chart_stream;
+
+// Rollup of bars currently on display, bars are drawn again after each feed of the rollup
+static twr_data_stream_rollup_t *lcd_rollup;
+static bool lcd_rollup_changed;
+
 bool active_mode = true;
 int calibration_counter;
 
 TWR_DATA_STREAM_FLOAT_BUFFER(sm_voltage_buffer, SEND_DATA_INTERVAL / BATTERY_UPDATE_INTERVAL)
 TWR_DATA_STREAM_FLOAT_BUFFER(sm_percentage_buffer, SEND_DATA_INTERVAL / BATTERY_UPDATE_INTERVAL)
-TWR_DATA_STREAM_FLOAT_BUFFER(sm_temperature_buffer, (SEND_DATA_INTERVAL / HUMIDITY_UPDATE_INTERVAL))
-TWR_DATA_STREAM_FLOAT_BUFFER(sm_humidity_buffer, (SEND_DATA_INTERVAL / HUMIDITY_UPDATE_INTERVAL))
-TWR_DATA_STREAM_FLOAT_BUFFER(sm_pressure_buffer, (SEND_DATA_INTERVAL / PRESSURE_UPDATE_INTERVAL))
-TWR_DATA_STREAM_FLOAT_BUFFER(sm_co2_buffer, (SEND_DATA_INTERVAL / CO2_UPDATE_INTERVAL))
+// Fixed-point scales match the uplink payload encoding
+TWR_DATA_STREAM_INT16_BUFFER(sm_temperature_buffer, (SEND_DATA_INTERVAL / HUMIDITY_UPDATE_INTERVAL), TEMPERATURE_SCALE)
+TWR_DATA_STREAM_INT16_BUFFER(sm_humidity_buffer, (SEND_DATA_INTERVAL / HUMIDITY_UPDATE_INTERVAL), HUMIDITY_SCALE)
+TWR_DATA_STREAM_INT16_BUFFER(sm_pressure_buffer, (SEND_DATA_INTERVAL / PRESSURE_UPDATE_INTERVAL), 1)
+TWR_DATA_STREAM_INT16_BUFFER(sm_co2_buffer, (SEND_DATA_INTERVAL / CO2_UPDATE_INTERVAL), 1)
 TWR_DATA_STREAM_FLOAT_BUFFER(sm_voc_buffer, (SEND_DATA_INTERVAL / TVOC_UPDATE_INTERVAL))
+TWR_DATA_STREAM_INT16_BUFFER(sm_temperature_history_buffer, LCD_CHART_WIDTH, TEMPERATURE_SCALE)
+TWR_DATA_STREAM_INT16_BUFFER(sm_co2_history_buffer, LCD_CHART_WIDTH, 1)
+TWR_DATA_STREAM_INT16_BUFFER(sm_pressure_history_buffer, LCD_CHART_WIDTH, PRESSURE_HISTORY_SCALE)
+TWR_DATA_STREAM_INT16_BUFFER(sm_voltage_history_buffer, LCD_CHART_WIDTH, VOLTAGE_HISTORY_SCALE)
 
 twr_data_stream_t sm_voltage;
 twr_data_stream_t sm_percentage;
@@ -118,6 +214,14 @@ twr_data_stream_t sm_co2;
 twr_data_stream_t sm_voc;
 twr_data_stream_t sm_pressure;
 
+TWR_DATA_STREAM_ROLLUP_LEVEL(rollup_temperature_hour, ROLLUP_HOUR_FOLD, ROLLUP_HOUR_RECORDS)
+TWR_DATA_STREAM_ROLLUP_LEVEL(rollup_temperature_day, ROLLUP_HOUR_RECORDS, ROLLUP_DAY_RECORDS)
+TWR_DATA_STREAM_ROLLUP_LEVEL(rollup_co2_hour, ROLLUP_HOUR_FOLD, ROLLUP_HOUR_RECORDS)
+TWR_DATA_STREAM_ROLLUP_LEVEL(rollup_co2_day, ROLLUP_HOUR_RECORDS, ROLLUP_DAY_RECORDS)
+
+twr_data_stream_rollup_level_t *rollup_temperature_levels[] = { &rollup_temperature_hour, &rollup_temperature_day };
+twr_data_stream_rollup_level_t *rollup_co2_levels[] = { &rollup_co2_hour, &rollup_co2_day };
+
 twr_scheduler_task_id_t calibration_task_id;
 
 enum
@@ -171,60 +275,184 @@ void calibration_task(void *param)
     twr_scheduler_plan_current_relative(CO2_CALIBRATION_INTERVAL);
 }
 
+static int lcd_field_set(int index, int x, int top, twr_gfx_align_t align, const twr_font_t *font, const char *text)
+{
+    lcd_field_t *field = &lcd_fields[index];
+
+    if (field->x != x || field->top != top || field->align != align || field->font != font || strncmp(field->text, text, sizeof(field->text) - 1) != 0)
+    {
+        field->x = x;
+        field->top = top;
+        field->align = align;
+        field->font = font;
+        strncpy(field->text, text, sizeof(field->text) - 1);
+        field->dirty = true;
+    }
+
+    twr_gfx_set_font(pgfx, font);
+
+    // Right edge of text, fields following on the same line start there
+    return twr_gfx_calc_string_box(pgfx, x, top, field->text, align, &field->box_new);
+}
+
+static bool lcd_field_box_overlaps(const twr_gfx_box_t *a, const twr_gfx_box_t *b)
+{
+    return a->left < b->left + b->width && b->left < a->left + a->width &&
+           a->top < b->top + b->height && b->top < a->top + a->height;
+}
+
+static void lcd_fields_draw()
+{
+    // Erase old text of changed fields first so that it does not overwrite new text of neighbours
+    for (int i = 0; i < LCD_FIELD_COUNT; i++)
+    {
+        lcd_field_t *field = &lcd_fields[i];
+
+        if (field->dirty && field->box.width > 0)
+        {
+            twr_gfx_draw_fill_rectangle(pgfx, field->box.left, field->box.top, field->box.left + field->box.width - 1, field->box.top + field->box.height - 1, false);
+        }
+    }
+
+    // Unchanged field partially erased with old box of changed one or overlapped by its new text has to be drawn again
+    for (int i = 0; i < LCD_FIELD_COUNT; i++)
+    {
+        for (int j = 0; j < LCD_FIELD_COUNT && !lcd_fields[i].dirty; j++)
+        {
+            lcd_field_t *changed = &lcd_fields[j];
+
+            if (changed->dirty && (lcd_field_box_overlaps(&lcd_fields[i].box, &changed->box) || lcd_field_box_overlaps(&lcd_fields[i].box, &changed->box_new)))
+            {
+                lcd_fields[i].dirty = true;
+            }
+        }
+    }
+
+    for (int i = 0; i < LCD_FIELD_COUNT; i++)
+    {
+        lcd_field_t *field = &lcd_fields[i];
+
+        if (!field->dirty)
+        {
+            continue;
+        }
+
+        twr_gfx_set_font(pgfx, field->font);
+
+        twr_gfx_draw_string_aligned(pgfx, field->x, field->top, field->text, field->align, true, &field->box);
+        field->dirty = false;
+    }
+}
+
+static int lcd_rollup_get_y(float value, const twr_data_stream_rollup_record_t *total)
+{
+    int bottom = LCD_CHART_TOP + LCD_CHART_HEIGHT - 1;
+
+    if (total->max <= total->min)
+    {
+        return bottom - (LCD_CHART_HEIGHT - 1) / 2;
+    }
+
+    return bottom - lroundf((value - total->min) * (LCD_CHART_HEIGHT - 1) / (total->max - total->min));
+}
+
+static void lcd_rollup_draw(twr_data_stream_rollup_t *rollup)
+{
+    twr_gfx_draw_fill_rectangle(pgfx, LCD_CHART_LEFT, LCD_CHART_TOP, LCD_CHART_LEFT + LCD_CHART_WIDTH - 1, LCD_CHART_TOP + LCD_CHART_HEIGHT - 1, false);
+
+    twr_data_stream_rollup_record_t total;
+    twr_data_stream_rollup_record_t record;
+
+    // Bars are scaled to range of the whole day
+    if (!twr_data_stream_rollup_get_total(rollup, 0, &total))
+    {
+        return;
+    }
+
+    for (int n = 0; twr_data_stream_rollup_get_record(rollup, 0, n, &record); n++)
+    {
+        int x = LCD_CHART_LEFT + LCD_CHART_WIDTH - (n + 1) * LCD_ROLLUP_BAR_PITCH;
+
+        twr_gfx_draw_fill_rectangle(pgfx, x, lcd_rollup_get_y(record.max, &total), x + LCD_ROLLUP_BAR_PITCH - 2, lcd_rollup_get_y(record.min, &total), true);
+    }
+}
+
 static void lcd_page_render()
 {
     int w;
     char str[32];
+    bool page = (page_index <= MAX_PAGE_INDEX) && (page_index != PAGE_INDEX_MENU);
 
     twr_system_pll_enable();
 
-    twr_gfx_clear(pgfx);
+    lcd_field_set(LCD_FIELD_NAME0, 10, 5, TWR_GFX_ALIGN_LEFT, &twr_font_ubuntu_15, page ? pages[page_index].name0 : "");
 
-    if ((page_index <= MAX_PAGE_INDEX) && (page_index != PAGE_INDEX_MENU))
+    snprintf(str, sizeof(str), page ? pages[page_index].format0 : "", page ? *pages[page_index].value0 : 0);
+    w = lcd_field_set(LCD_FIELD_VALUE0, 25, 25, TWR_GFX_ALIGN_LEFT, &twr_font_ubuntu_28, str);
+    lcd_field_set(LCD_FIELD_UNIT0, w, 35, TWR_GFX_ALIGN_LEFT, &twr_font_ubuntu_15, page ? pages[page_index].unit0 : "");
+
+    lcd_field_set(LCD_FIELD_NAME1, 10, 55, TWR_GFX_ALIGN_LEFT, &twr_font_ubuntu_15, page ? pages[page_index].name1 : "");
+
+    // Second value is on the line of its name, right aligned with the chart below it
+    lcd_field_set(LCD_FIELD_UNIT1, LCD_CHART_LEFT + LCD_CHART_WIDTH, 55, TWR_GFX_ALIGN_RIGHT, &twr_font_ubuntu_15, page ? pages[page_index].unit1 : "");
+
+    // Page with single value has no second value
+    bool value1 = page && pages[page_index].value1 != NULL;
+    snprintf(str, sizeof(str), value1 ? pages[page_index].format1 : "", value1 ? *pages[page_index].value1 : 0);
+    lcd_field_set(LCD_FIELD_VALUE1, lcd_fields[LCD_FIELD_UNIT1].box_new.left, 55, TWR_GFX_ALIGN_RIGHT, &twr_font_ubuntu_15, str);
+
+    snprintf(str, sizeof(str), "%d/%d", page_index + 1, MAX_PAGE_INDEX + 1);
+    lcd_field_set(LCD_FIELD_PAGE, 64, 115, TWR_GFX_ALIGN_CENTER, &twr_font_ubuntu_13, str);
+
+    twr_data_stream_t *history = page ? pages[page_index].history : NULL;
+    twr_data_stream_rollup_t *rollup = page ? pages[page_index].rollup : NULL;
+
+    // Chart of previous page is erased before fields are drawn over its area
+    if (history != lcd_chart_stream || rollup != lcd_rollup)
     {
-        twr_gfx_set_font(pgfx, &twr_font_ubuntu_15);
-        twr_gfx_draw_string(pgfx, 10, 5, pages[page_index].name0, true);
+        if (lcd_chart_stream != NULL || lcd_rollup != NULL)
+        {
+            twr_gfx_draw_fill_rectangle(pgfx, LCD_CHART_LEFT, LCD_CHART_TOP, LCD_CHART_LEFT + LCD_CHART_WIDTH - 1, LCD_CHART_TOP + LCD_CHART_HEIGHT - 1, false);
+        }
+
+        twr_gfx_chart_invalidate(&lcd_chart);
 
-        twr_gfx_set_font(pgfx, &twr_font_ubuntu_28);
-        snprintf(str, sizeof(str), pages[page_index].format0, *pages[page_index].value0);
-        w = twr_gfx_draw_string(pgfx, 25, 25, str, true);
-        twr_gfx_set_font(pgfx, &twr_font_ubuntu_15);
-        w = twr_gfx_draw_string(pgfx, w, 35, pages[page_index].unit0, true);
+        lcd_chart_stream = history;
+        lcd_rollup = rollup;
+        lcd_rollup_changed = true;
+    }
 
-        twr_gfx_set_font(pgfx, &twr_font_ubuntu_15);
-        twr_gfx_draw_string(pgfx, 10, 55, pages[page_index].name1, true);
+    lcd_fields_draw();
 
-        twr_gfx_set_font(pgfx, &twr_font_ubuntu_28);
-        snprintf(str, sizeof(str), pages[page_index].format1, *pages[page_index].value1);
-        w = twr_gfx_draw_string(pgfx, 25, 75, str, true);
-        twr_gfx_set_font(pgfx, &twr_font_ubuntu_15);
-        twr_gfx_draw_string(pgfx, w, 85, pages[page_index].unit1, true);
+    if (history != NULL)
+    {
+        twr_gfx_chart_draw(&lcd_chart, pgfx, history, true);
     }
 
-    snprintf(str, sizeof(str), "%d/%d", page_index + 1, MAX_PAGE_INDEX + 1);
-    twr_gfx_set_font(pgfx, &twr_font_ubuntu_13);
-    twr_gfx_draw_string(pgfx, 55, 115, str, true);
+    if (rollup != NULL && lcd_rollup_changed)
+    {
+        lcd_rollup_draw(rollup);
+    }
+
+    lcd_rollup_changed = false;
 
     twr_system_pll_disable();
 }
 
-void lcd_draw()
+static void lcd_render_handler(void *param)
 {
-    if (!twr_gfx_display_is_ready(pgfx))
-    {
-        return;
-    }
+    (void)param;
 
     if (active_mode)
     {
         lcd_page_render();
     }
-    else
-    {
-        twr_scheduler_plan_current_relative(500);
-    }
+}
 
-    twr_gfx_update(pgfx);
+void lcd_draw()
+{
+    // Redraw requests of the same wake-up are served by single render
+    twr_module_lcd_invalidate();
 }
 
 /* void button_event_handler(twr_button_t *self, twr_button_event_t event, void *event_param)
@@ -356,7 +584,8 @@ void tag_humidity_event_handler(twr_tag_humidity_t *self, twr_tag_humidity_event
     {
         if (twr_tag_humidity_get_humidity_percentage(self, &humidity))
         {
-            twr_data_stream_feed(&sm_humidity, &humidity);
+            int16_t humidity_i16 = lroundf(humidity * HUMIDITY_SCALE);
+            twr_data_stream_feed(&sm_humidity, &humidity_i16);
             values.humidity = humidity;
             lcd_draw();
             twr_log_debug("HUMIDITY TAG: Humidity: %.0f %%", humidity);
@@ -368,7 +597,9 @@ void tag_humidity_event_handler(twr_tag_humidity_t *self, twr_tag_humidity_event
 
         if (twr_tag_humidity_get_temperature_celsius(self, &temperature))
         {
-            twr_data_stream_feed(&sm_temperature, &temperature);
+            int16_t temperature_i16 = lroundf(temperature * TEMPERATURE_SCALE);
+            twr_data_stream_feed(&sm_temperature, &temperature_i16);
+            twr_data_stream_feed(&sm_temperature_history, &temperature_i16);
             values.temperature = temperature;
             lcd_draw();
             twr_log_debug("HUMIDITY TAG: Temperature: %.1f °C", temperature);
@@ -410,7 +641,10 @@ void tag_barometer_event_handler(twr_tag_barometer_t *self, twr_tag_barometer_ev
         if (twr_tag_barometer_get_pressure_pascal(self, &pressure))
         {
             pressure /= 100; // Pa to hPa
-            twr_data_stream_feed(&sm_pressure, &pressure);
+            int16_t pressure_i16 = lroundf(pressure);
+            twr_data_stream_feed(&sm_pressure, &pressure_i16);
+            int16_t pressure_history_i16 = lroundf(pressure * PRESSURE_HISTORY_SCALE);
+            twr_data_stream_feed(&sm_pressure_history, &pressure_history_i16);
             values.pressure = pressure;
             lcd_draw();
             twr_log_debug("BAROMETER TAG: Air pressure: %.0f hPa", pressure);
@@ -431,6 +665,8 @@ void battery_event_handler(twr_module_battery_event_t event, void *event_param)
         if (twr_module_battery_get_voltage(&value))
         {
             twr_data_stream_feed(&sm_voltage, &value);
+            int16_t voltage_history_i16 = lroundf(value * VOLTAGE_HISTORY_SCALE);
+            twr_data_stream_feed(&sm_voltage_history, &voltage_history_i16);
             twr_log_debug("BATTERY MODULE: Voltage %.2f V", value);
             values.battery_voltage = value;
             lcd_draw();
@@ -461,7 +697,11 @@ void co2_module_event_handler(twr_module_co2_event_t event, void *event_param)
         float value = NAN;
         if (twr_module_co2_get_concentration_ppm(&value))
         {
-            twr_data_stream_feed(&sm_co2, &value);
+            // Stream range ends at 32767 ppm instead of former uplink clamp of 65534 ppm, the LP8 driver rejects
+            // readings above 10000 ppm so valid values are not affected
+            int16_t co2_i16 = value < INT16_MAX ? lroundf(value) : INT16_MAX;
+            twr_data_stream_feed(&sm_co2, &co2_i16);
+            twr_data_stream_feed(&sm_co2_history, &co2_i16);
             values.co2 = value;
             lcd_draw();
             twr_log_debug("CO2 MODULE: CO2: %.1f ppm", value);
@@ -541,6 +781,56 @@ void lora_callback(twr_cmwx1zzabz_t *self, twr_cmwx1zzabz_event_t event, void *e
     }
 }
 
+// Runs on its own period, application_task is also planned by AT$SEND and buttons
+void rollup_task(void *param)
+{
+    (void) param;
+
+    int16_t value;
+
+    if (twr_data_stream_get_average(&sm_temperature, &value))
+    {
+        twr_data_stream_rollup_feed(&rollup_temperature, (float) value / TEMPERATURE_SCALE);
+    }
+
+    if (twr_data_stream_get_average(&sm_co2, &value))
+    {
+        twr_data_stream_rollup_feed(&rollup_co2, value);
+    }
+
+    twr_data_stream_rollup_record_t record;
+
+    if (twr_data_stream_rollup_get_total(&rollup_temperature, 0, &record))
+    {
+        values.temperature_day = record.average;
+    }
+
+    if (twr_data_stream_rollup_get_total(&rollup_temperature, 1, &record))
+    {
+        values.temperature_week = record.average;
+    }
+
+    if (twr_data_stream_rollup_get_total(&rollup_co2, 0, &record))
+    {
+        values.co2_day = record.average;
+    }
+
+    if (twr_data_stream_rollup_get_total(&rollup_co2, 1, &record))
+    {
+        values.co2_week = record.average;
+    }
+
+    // Bars follow the rollup after each feed, page without them is not rendered for it
+    lcd_rollup_changed = true;
+
+    if (lcd_rollup != NULL)
+    {
+        lcd_draw();
+    }
+
+    twr_scheduler_plan_current_relative(SEND_DATA_INTERVAL);
+}
+
 bool at_send(void)
 {
     twr_scheduler_plan_now(0);
@@ -550,8 +840,6 @@ bool at_send(void)
 
 bool at_status(void)
 {
-    float value_avg = NAN;
-
     static const struct
     {
         twr_data_stream_t *stream;
@@ -569,11 +857,14 @@ bool at_status(void)
 
     for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
     {
-        value_avg = NAN;
+        twr_data_stream_summary_t summary;
 
-        if (twr_data_stream_get_average(values[i].stream, &value_avg))
+        if (twr_data_stream_get_summary(values[i].stream, &summary))
         {
-            twr_atci_printfln("%s: %.*f", values[i].name, values[i].precision, value_avg);
+            int p = values[i].precision;
+
+            twr_atci_printfln("%s: %.*f (min %.*f, max %.*f, sd %.*f)", values[i].name, p, summary.mean,
+                              p, summary.min, p, summary.max, p + 1, sqrtf(summary.variance));
         }
         else
         {
@@ -581,6 +872,37 @@ bool at_status(void)
         }
     }
 
+    static const struct
+    {
+        twr_data_stream_rollup_t *rollup;
+        const char *name;
+        int precision;
+    } histories[] = {
+        {&rollup_temperature, "Temperature", 1},
+        {&rollup_co2, "CO2", 0},
+    };
+
+    for (size_t i = 0; i < sizeof(histories) / sizeof(histories[0]); i++)
+    {
+        static const char *periods[] = { "24h", "7d" };
+
+        for (int level = 0; level < 2; level++)
+        {
+            twr_data_stream_rollup_record_t record;
+
+            if (twr_data_stream_rollup_get_total(histories[i].rollup, level, &record))
+            {
+                twr_atci_printfln("%s %s min/avg/max: %.*f/%.*f/%.*f", histories[i].name, periods[level],
+                                  histories[i].precision, record.min, histories[i].precision, record.average,
+                                  histories[i].precision, record.max);
+            }
+            else
+            {
+                twr_atci_printfln("%s %s min/avg/max: -", histories[i].name, periods[level]);
+            }
+        }
+    }
+
     /* int orientation;
 
     if (twr_data_stream_get_median(&sm_orientation, &orientation))
@@ -608,6 +930,14 @@ void application_init(void)
     twr_data_stream_init(&sm_pressure, 1, &sm_pressure_buffer);
     twr_data_stream_init(&sm_co2, 1, &sm_co2_buffer);
     twr_data_stream_init(&sm_voc, 1, &sm_voc_buffer);
+    twr_data_stream_init(&sm_temperature_history, 1, &sm_temperature_history_buffer);
+    twr_data_stream_init(&sm_co2_history, 1, &sm_co2_history_buffer);
+    twr_data_stream_init(&sm_pressure_history, 1, &sm_pressure_history_buffer);
+    twr_data_stream_init(&sm_voltage_history, 1, &sm_voltage_history_buffer);
+
+    twr_data_stream_rollup_init(&rollup_temperature, rollup_temperature_levels, 2);
+    twr_data_stream_rollup_init(&rollup_co2, rollup_co2_levels, 2);
+    twr_scheduler_register(rollup_task, NULL, SEND_DATA_INTERVAL);
 
     // Initialize LED
     const twr_led_driver_t *driver = twr_module_lcd_get_led_driver();
@@ -627,6 +957,9 @@ void application_init(void)
     // Initialize LCD module
     twr_module_lcd_init();
     twr_module_lcd_set_event_handler(lcd_event_handler, NULL);
+    twr_module_lcd_set_render_handler(lcd_render_handler, NULL);
+    twr_module_lcd_set_transfer_buffer(lcd_transfer_buffer);
+    twr_gfx_chart_init(&lcd_chart, LCD_CHART_LEFT, LCD_CHART_TOP, LCD_CHART_WIDTH, LCD_CHART_HEIGHT);
     twr_module_lcd_set_button_hold_time(1000);
     pgfx = twr_module_lcd_get_gfx();
 
@@ -682,6 +1015,9 @@ void application_init(void)
         TWR_AT_LORA_COMMANDS,
         {"$SEND", at_send, NULL, NULL, NULL, "Immediately send packet"},
         {"$STATUS", at_status, NULL, NULL, NULL, "Show status"},
+#if TWR_SCHEDULER_PROFILER
+        TWR_AT_SCHEDULER_COMMANDS,
+#endif
         TWR_ATCI_COMMAND_CLAC,
         TWR_ATCI_COMMAND_HELP};
     twr_atci_init(commands, TWR_ATCI_COMMANDS_LENGTH(commands));
@@ -721,31 +1057,22 @@ void application_task(void)
         buffer[2] = percentage_avg;
     }
 
-    float temperature_avg = NAN;
-    twr_data_stream_get_average(&sm_temperature, &temperature_avg);
-    if (!isnan(temperature_avg))
+    int16_t temperature_avg;
+    if (twr_data_stream_get_average(&sm_temperature, &temperature_avg))
     {
-        int16_t temperature_i16 = (int16_t)(temperature_avg * 10.f);
-
-        buffer[3] = temperature_i16 >> 8;
-        buffer[4] = temperature_i16;
+        buffer[3] = temperature_avg >> 8;
+        buffer[4] = temperature_avg;
     }
 
-    float humidity_avg = NAN;
-    twr_data_stream_get_average(&sm_humidity, &humidity_avg);
-    if (!isnan(humidity_avg))
+    int16_t humidity_avg;
+    if (twr_data_stream_get_average(&sm_humidity, &humidity_avg))
     {
-        buffer[5] = humidity_avg * 2;
+        buffer[5] = humidity_avg;
     }
 
-    float co2_avg = NAN;
-    twr_data_stream_get_average(&sm_co2, &co2_avg);
-    if (!isnan(co2_avg))
+    int16_t co2_avg;
+    if (twr_data_stream_get_average(&sm_co2, &co2_avg))
     {
-        if (co2_avg > 65534)
-        {
-            co2_avg = 65534;
-        }
         uint16_t value = (uint16_t)co2_avg;
         buffer[6] = value >> 8;
         buffer[7] = value;
@@ -760,9 +1087,8 @@ void application_task(void)
         buffer[9] = value;
     }
 
-    float pressure_avg = NAN;
-    twr_data_stream_get_average(&sm_pressure, &pressure_avg);
-    if (!isnan(pressure_avg))
+    int16_t pressure_avg;
+    if (twr_data_stream_get_average(&sm_pressure, &pressure_avg))
     {
         uint16_t value = (uint16_t)pressure_avg;
         buffer[10] = value >> 8;
@@ -0,0 +1,237 @@
+#include <twr_data_stream.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Cost of data stream statistics against the former implementations that walked the whole window on every query,
+// one query follows every feed as the application reads the stream after each measurement
+
+#define BENCH_SAMPLES 20000
+#define BENCH_WINDOW_MAX 1440
+
+static float samples[BENCH_SAMPLES];
+static volatile float sink;
+
+static double bench_time(void)
+{
+    struct timespec now;
+
+    timespec_get(&now, TIME_UTC);
+
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Former average: sum of the whole window on every query
+
+static double bench_average(int window)
+{
+    static float feed[BENCH_WINDOW_MAX];
+    static float sorted[BENCH_WINDOW_MAX];
+
+    twr_data_stream_buffer_t buffer = { .feed = feed, .sorted = sorted, .number_of_samples = window, .type = TWR_DATA_STREAM_TYPE_FLOAT };
+    twr_data_stream_t stream;
+
+    twr_data_stream_init(&stream, 1, &buffer);
+
+    double time_start = bench_time();
+
+    for (int i = 0; i < BENCH_SAMPLES; i++)
+    {
+        float average;
+
+        twr_data_stream_feed(&stream, &samples[i]);
+
+        twr_data_stream_get_average(&stream, &average);
+
+        sink += average;
+    }
+
+    return bench_time() - time_start;
+}
+
+static double bench_average_reference(int window)
+{
+    static float feed[BENCH_WINDOW_MAX];
+
+    int length = 0;
+
+    double time_start = bench_time();
+
+    for (int i = 0; i < BENCH_SAMPLES; i++)
+    {
+        feed[i % window] = samples[i];
+
+        if (length < window)
+        {
+            length++;
+        }
+
+        float sum = 0;
+
+        for (int j = 0; j < length; j++)
+        {
+            sum += feed[j];
+        }
+
+        sink += sum / length;
+    }
+
+    return bench_time() - time_start;
+}
+
+// Former median: window copied out of the ring buffer and sorted by qsort on every query
+
+static int compare_float(const void *a, const void *b)
+{
+    float x = *(const float *) a;
+    float y = *(const float *) b;
+
+    return (x > y) - (x < y);
+}
+
+static float reference_median(const float *feed, int length)
+{
+    static float sort[BENCH_WINDOW_MAX];
+
+    memcpy(sort, feed, length * sizeof(float));
+
+    qsort(sort, length, sizeof(float), compare_float);
+
+    return length % 2 == 0 ? (sort[length / 2 - 1] + sort[length / 2]) / 2 : sort[length / 2];
+}
+
+static double bench_median(int window)
+{
+    static float feed[BENCH_WINDOW_MAX];
+    static float sorted[BENCH_WINDOW_MAX];
+
+    twr_data_stream_buffer_t buffer = { .feed = feed, .sorted = sorted, .number_of_samples = window, .type = TWR_DATA_STREAM_TYPE_FLOAT };
+    twr_data_stream_t stream;
+
+    twr_data_stream_init(&stream, 1, &buffer);
+
+    double time_start = bench_time();
+
+    for (int i = 0; i < BENCH_SAMPLES; i++)
+    {
+        float median;
+
+        twr_data_stream_feed(&stream, &samples[i]);
+
+        twr_data_stream_get_median(&stream, &median);
+
+        sink += median;
+    }
+
+    return bench_time() - time_start;
+}
+
+static double bench_median_reference(int window)
+{
+    static float feed[BENCH_WINDOW_MAX];
+
+    int length = 0;
+
+    double time_start = bench_time();
+
+    for (int i = 0; i < BENCH_SAMPLES; i++)
+    {
+        feed[i % window] = samples[i];
+
+        if (length < window)
+        {
+            length++;
+        }
+
+        sink += reference_median(feed, length);
+    }
+
+    return bench_time() - time_start;
+}
+
+// Same stream as float and as int16 fixed-point with scale of 10, both read average and median after every feed
+
+static double bench_type(int window, twr_data_stream_type_t type)
+{
+    static float feed[BENCH_WINDOW_MAX];
+    static float sorted[BENCH_WINDOW_MAX];
+
+    twr_data_stream_buffer_t buffer = { .feed = feed, .sorted = sorted, .number_of_samples = window, .type = type, .scale = 10 };
+    twr_data_stream_t stream;
+
+    twr_data_stream_init(&stream, 1, &buffer);
+
+    double time_start = bench_time();
+
+    for (int i = 0; i < BENCH_SAMPLES; i++)
+    {
+        if (type == TWR_DATA_STREAM_TYPE_INT16)
+        {
+            int16_t value = samples[i] * 10;
+            int16_t average;
+            int16_t median;
+
+            twr_data_stream_feed(&stream, &value);
+
+            twr_data_stream_get_average(&stream, &average);
+            twr_data_stream_get_median(&stream, &median);
+
+            sink += average + median;
+        }
+        else
+        {
+            float average;
+            float median;
+
+            twr_data_stream_feed(&stream, &samples[i]);
+
+            twr_data_stream_get_average(&stream, &average);
+            twr_data_stream_get_median(&stream, &median);
+
+            sink += average + median;
+        }
+    }
+
+    return bench_time() - time_start;
+}
+
+int main(void)
+{
+    static const int windows[] = { 60, 360, 1440 };
+
+    srand(1);
+
+    for (int i = 0; i < BENCH_SAMPLES; i++)
+    {
+        samples[i] = (float) (rand() % 200000 - 100000) / 100;
+    }
+
+    printf("feed and average of %d samples\n", BENCH_SAMPLES);
+    printf("window    running sum ms     re-sum ms\n");
+
+    for (size_t i = 0; i < sizeof(windows) / sizeof(windows[0]); i++)
+    {
+        printf("%6d %17.1f %13.1f\n", windows[i], bench_average(windows[i]) * 1e3, bench_average_reference(windows[i]) * 1e3);
+    }
+
+    printf("\nfeed and median of %d samples\n", BENCH_SAMPLES);
+    printf("window  sorted window ms      qsort ms\n");
+
+    for (size_t i = 0; i < sizeof(windows) / sizeof(windows[0]); i++)
+    {
+        printf("%6d %17.1f %13.1f\n", windows[i], bench_median(windows[i]) * 1e3, bench_median_reference(windows[i]) * 1e3);
+    }
+
+    printf("\nfeed, average and median of %d samples\n", BENCH_SAMPLES);
+    printf("window          int16 ms      float ms  int16 bytes  float bytes\n");
+
+    for (size_t i = 0; i < sizeof(windows) / sizeof(windows[0]); i++)
+    {
+        printf("%6d %17.1f %13.1f %12zu %12zu\n", windows[i],
+                bench_type(windows[i], TWR_DATA_STREAM_TYPE_INT16) * 1e3, bench_type(windows[i], TWR_DATA_STREAM_TYPE_FLOAT) * 1e3,
+                2 * windows[i] * sizeof(int16_t), 2 * windows[i] * sizeof(float));
+    }
+
+    return 0;
+}
@@ -0,0 +1,231 @@
+#include <stub/application.h>
+#include <stub/twr_spi.h>
+#include <sim_modem.h>
+#include <twr_gfx_framebuffer.h>
+#include <twr_ls013b7dh03.h>
+#include <twr_module_lcd.h>
+#include <twr_scheduler.h>
+#include <stdio.h>
+#include <time.h>
+
+// Rendering cost of every page of the application and of every bundled font at all four rotations, each is measured
+// through the full driver and through its copy without the byte level hooks, which makes gfx draw pixel by pixel,
+// pages are measured also without the glyph blit alone
+
+#define BENCH_PAGES 6
+#define BENCH_PAGE_PASSES 500
+#define BENCH_GLYPH_PASSES 200
+
+#define BENCH_HOUR (60 * 60 * 1000)
+
+void application_init(void);
+void application_task(void *param);
+void lcd_event_handler(twr_module_lcd_event_t event, void *event_param);
+
+extern twr_gfx_t *pgfx;
+
+static const char bench_chars[] = "0123456789.%ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+static const struct
+{
+    const twr_font_t *font;
+    const char *name;
+
+} bench_fonts[] =
+{
+    { &twr_font_ubuntu_11, "ubuntu_11" },
+    { &twr_font_ubuntu_13, "ubuntu_13" },
+    { &twr_font_ubuntu_15, "ubuntu_15" },
+    { &twr_font_ubuntu_24, "ubuntu_24" },
+    { &twr_font_ubuntu_28, "ubuntu_28" },
+    { &twr_font_ubuntu_33, "ubuntu_33" }
+};
+
+static double bench_time(void)
+{
+    struct timespec now;
+
+    timespec_get(&now, TIME_UTC);
+
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Copy of driver without glyph blit, text is drawn pixel by pixel while fills and scroll stay by bytes
+
+static twr_gfx_driver_t bench_no_bitmap_driver(const twr_gfx_driver_t *driver)
+{
+    twr_gfx_driver_t no_bitmap = *driver;
+
+    no_bitmap.draw_bitmap = NULL;
+
+    return no_bitmap;
+}
+
+// Copy of driver with the mandatory callbacks only
+
+static twr_gfx_driver_t bench_pixel_driver(const twr_gfx_driver_t *driver)
+{
+    twr_gfx_driver_t pixel = bench_no_bitmap_driver(driver);
+
+    pixel.fill_rectangle = NULL;
+    pixel.scroll = NULL;
+
+    return pixel;
+}
+
+static void bench_idle(void)
+{
+    spi_stub_complete();
+}
+
+// Render of each page after the previous one, every pass goes through all pages, result is in microseconds per page
+
+static void bench_pages(twr_gfx_rotation_t rotation, double *time)
+{
+    twr_gfx_set_rotation(pgfx, rotation);
+
+    twr_gfx_clear(pgfx);
+
+    for (int page = 0; page < BENCH_PAGES; page++)
+    {
+        time[page] = 0;
+    }
+
+    for (int pass = 0; pass < BENCH_PAGE_PASSES; pass++)
+    {
+        for (int page = 0; page < BENCH_PAGES; page++)
+        {
+            // Next page, render is deferred to the task of LCD module
+            lcd_event_handler(TWR_MODULE_LCD_EVENT_RIGHT_CLICK, NULL);
+
+            double time_start = bench_time();
+
+            application_run_until(twr_tick_get() + TWR_MODULE_LCD_INVALIDATE_DELAY);
+
+            time[(page + 1) % BENCH_PAGES] += bench_time() - time_start;
+        }
+    }
+
+    for (int page = 0; page < BENCH_PAGES; page++)
+    {
+        time[page] *= 1e6 / BENCH_PAGE_PASSES;
+    }
+}
+
+// Every char of the font drawn at the same place, result is in nanoseconds per glyph
+
+static double bench_font(twr_gfx_t *gfx, const twr_font_t *font, twr_gfx_rotation_t rotation)
+{
+    twr_gfx_set_rotation(gfx, rotation);
+    twr_gfx_set_font(gfx, font);
+
+    int glyphs = 0;
+
+    double time_start = bench_time();
+
+    for (int pass = 0; pass < BENCH_GLYPH_PASSES; pass++)
+    {
+        for (const char *ch = bench_chars; *ch != '\0'; ch++)
+        {
+            glyphs += twr_gfx_draw_char(gfx, 20, 20, *ch, pass & 1) != 0;
+        }
+    }
+
+    return (bench_time() - time_start) * 1e9 / glyphs;
+}
+
+int main(void)
+{
+    static const char *rotations[] = { "0", "90", "180", "270" };
+
+    application_set_idle_handler(bench_idle);
+
+    sim_modem_init(TWR_UART_UART1, NULL);
+
+    twr_scheduler_init();
+
+    twr_scheduler_register(application_task, NULL, 0);
+
+    application_init();
+
+    // Values and pressure chart of half a day
+    application_run_until(12 * BENCH_HOUR);
+
+    const twr_gfx_driver_t *driver = pgfx->_driver;
+    twr_gfx_driver_t no_bitmap_driver = bench_no_bitmap_driver(driver);
+    twr_gfx_driver_t pixel_driver = bench_pixel_driver(driver);
+
+    printf("page render us (byte ops / without glyph blit / pixel by pixel)\n");
+    printf("rotation");
+
+    for (int page = 0; page < BENCH_PAGES; page++)
+    {
+        printf("%19s %d", "page", page + 1);
+    }
+
+    printf("\n");
+
+    for (twr_gfx_rotation_t rotation = TWR_GFX_ROTATION_0; rotation <= TWR_GFX_ROTATION_270; rotation++)
+    {
+        double time[BENCH_PAGES];
+        double time_no_bitmap[BENCH_PAGES];
+        double time_pixel[BENCH_PAGES];
+
+        pgfx->_driver = driver;
+
+        bench_pages(rotation, time);
+
+        pgfx->_driver = &no_bitmap_driver;
+
+        bench_pages(rotation, time_no_bitmap);
+
+        pgfx->_driver = &pixel_driver;
+
+        bench_pages(rotation, time_pixel);
+
+        pgfx->_driver = driver;
+
+        printf("%8s", rotations[rotation]);
+
+        for (int page = 0; page < BENCH_PAGES; page++)
+        {
+            printf(" %6.1f/%6.1f/%6.1f", time[page], time_no_bitmap[page], time_pixel[page]);
+        }
+
+        printf("\n");
+    }
+
+    TWR_GFX_FRAMEBUFFER(framebuffer, TWR_LS013B7DH03_WIDTH, TWR_LS013B7DH03_HEIGHT)
+    twr_gfx_framebuffer_t display;
+    twr_gfx_t gfx;
+
+    twr_gfx_framebuffer_init(&display, &framebuffer);
+
+    const twr_gfx_driver_t *framebuffer_driver = twr_gfx_framebuffer_get_driver();
+    twr_gfx_driver_t framebuffer_pixel_driver = bench_pixel_driver(framebuffer_driver);
+
+    printf("\nglyph ns (byte ops / pixel by pixel)\n");
+    printf("font        rotation 0         90          180          270\n");
+
+    for (size_t i = 0; i < sizeof(bench_fonts) / sizeof(bench_fonts[0]); i++)
+    {
+        printf("%-10s", bench_fonts[i].name);
+
+        for (twr_gfx_rotation_t rotation = TWR_GFX_ROTATION_0; rotation <= TWR_GFX_ROTATION_270; rotation++)
+        {
+            twr_gfx_init(&gfx, &display, framebuffer_driver);
+
+            double time = bench_font(&gfx, bench_fonts[i].font, rotation);
+
+            twr_gfx_init(&gfx, &display, &framebuffer_pixel_driver);
+
+            double time_pixel = bench_font(&gfx, bench_fonts[i].font, rotation);
+
+            printf(" %5.0f/%5.0f", time, time_pixel);
+        }
+
+        printf("\n");
+    }
+
+    return 0;
+}
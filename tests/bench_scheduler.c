@@ -0,0 +1,156 @@
+#include <stub/application.h>
+#include <twr_scheduler.h>
+#include <stdio.h>
+#include <time.h>
+
+// Dispatch cost of the deadline heap against the linear pool scan of the former twr_scheduler_run, both run the same
+// periodic tasks on virtual clock and every spin also looks up the next deadline as tickless idle needs it
+
+#define BENCH_DISPATCHES 2000000
+
+typedef struct
+{
+    twr_tick_t tick_execution;
+    void (*task)(void *);
+    void *param;
+
+} bench_slot_t;
+
+static twr_tick_t periods[TWR_SCHEDULER_MAX_TASKS];
+static bench_slot_t slots[TWR_SCHEDULER_MAX_TASKS];
+static size_t slot_current;
+static twr_tick_t tick_spin;
+static uint32_t dispatches;
+
+static double bench_time(void)
+{
+    struct timespec now;
+
+    timespec_get(&now, TIME_UTC);
+
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void task_heap(void *param)
+{
+    dispatches++;
+
+    twr_scheduler_plan_current_relative(*(twr_tick_t *) param);
+}
+
+static void task_linear(void *param)
+{
+    dispatches++;
+
+    slots[slot_current].tick_execution = tick_spin + *(twr_tick_t *) param;
+}
+
+static twr_tick_t bench_duration(int count)
+{
+    double rate = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        rate += 1. / periods[i];
+    }
+
+    return BENCH_DISPATCHES / rate;
+}
+
+static double bench_heap(int count)
+{
+    twr_scheduler_init();
+
+    for (int i = 0; i < count; i++)
+    {
+        twr_scheduler_register(task_heap, &periods[i], twr_tick_get() + periods[i]);
+    }
+
+    twr_tick_t tick_end = twr_tick_get() + bench_duration(count);
+
+    dispatches = 0;
+
+    double time_start = bench_time();
+
+    application_run_until(tick_end);
+
+    double time = bench_time() - time_start;
+
+    for (twr_scheduler_task_id_t i = 0; i < (twr_scheduler_task_id_t) count; i++)
+    {
+        twr_scheduler_unregister(i);
+    }
+
+    return time * 1e9 / dispatches;
+}
+
+static double bench_linear(int count)
+{
+    tick_spin = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        slots[i].tick_execution = periods[i];
+        slots[i].task = task_linear;
+        slots[i].param = &periods[i];
+    }
+
+    twr_tick_t tick_end = bench_duration(count);
+
+    dispatches = 0;
+
+    double time_start = bench_time();
+
+    while (tick_spin <= tick_end)
+    {
+        for (slot_current = 0; slot_current < (size_t) count; slot_current++)
+        {
+            if (slots[slot_current].task != NULL && tick_spin >= slots[slot_current].tick_execution)
+            {
+                slots[slot_current].tick_execution = TWR_TICK_INFINITY;
+
+                slots[slot_current].task(slots[slot_current].param);
+            }
+        }
+
+        twr_tick_t tick_next = TWR_TICK_INFINITY;
+
+        for (int i = 0; i < count; i++)
+        {
+            if (slots[i].task != NULL && tick_next > slots[i].tick_execution)
+            {
+                tick_next = slots[i].tick_execution;
+            }
+        }
+
+        tick_spin = tick_next;
+    }
+
+    double time = bench_time() - time_start;
+
+    return time * 1e9 / dispatches;
+}
+
+int main(void)
+{
+    static const int counts[] = { 8, 32, 128 };
+
+    srand(1);
+
+    for (int i = 0; i < TWR_SCHEDULER_MAX_TASKS; i++)
+    {
+        periods[i] = 100 + rand() % 60000;
+    }
+
+    printf("tasks  heap ns/dispatch  linear ns/dispatch\n");
+
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+    {
+        double heap = bench_heap(counts[i]);
+        double linear = bench_linear(counts[i]);
+
+        printf("%5d %18.1f %19.1f\n", counts[i], heap, linear);
+    }
+
+    return 0;
+}
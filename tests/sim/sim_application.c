@@ -0,0 +1,318 @@
+#include <test.h>
+#include <stub/application.h>
+#include <stub/twr_spi.h>
+#include <stub/twr_uart.h>
+#include <sim_modem.h>
+#include <twr_atci.h>
+#include <twr_scheduler.h>
+#include <twr_ls013b7dh03.h>
+
+// Application runs on virtual clock with emulated modem and sensors, report of every task invocation,
+// uplink payload, LCD frame and console line goes to trace file given as the second argument
+
+#define SIM_DAY (24 * 60 * 60 * 1000)
+
+// Uplink is sent 10 s after start and then every 10 minutes
+#define SIM_UPLINKS_PER_DAY (SIM_DAY / (10 * 60 * 1000))
+
+// Sensor measurements, uplinks and LCD frames wake up the device about 7000 times a day, buttons and USB sense only on edges
+#define SIM_WAKE_UPS_PER_DAY_MAX 10000
+
+void application_init(void);
+void application_task(void *param);
+void rollup_task(void *param);
+void calibration_task(void *param);
+
+static struct
+{
+    FILE *trace;
+    bool console_echo;
+
+    char console_line[256];
+    size_t console_length;
+
+    uint32_t invocations[TWR_SCHEDULER_MAX_TASKS];
+    uint32_t wake_ups;
+
+    uint32_t uplinks;
+    uint8_t uplink_last[16];
+    size_t uplink_last_length;
+    bool uplink_payload_valid;
+
+    uint32_t frames;
+    uint32_t lines;
+    size_t spi_bytes;
+
+} sim;
+
+static const char *sim_task_name(void (*task)(void *))
+{
+    static const struct
+    {
+        void (*task)(void *);
+        const char *name;
+
+    } names[] =
+    {
+        { application_task, "application_task" },
+        { rollup_task, "rollup_task" },
+        { calibration_task, "calibration_task" }
+    };
+
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+    {
+        if (names[i].task == task)
+        {
+            return names[i].name;
+        }
+    }
+
+    // Driver task, executable is not position independent so that addr2line resolves the address
+    static char address[24];
+
+    snprintf(address, sizeof(address), "%p", (void *) (uintptr_t) task);
+
+    return address;
+}
+
+static const char *sim_time(twr_tick_t tick)
+{
+    static char time[32];
+
+    snprintf(time, sizeof(time), "%u %02u:%02u:%02u.%03u", (unsigned) (tick / SIM_DAY), (unsigned) (tick / 3600000 % 24),
+             (unsigned) (tick / 60000 % 60), (unsigned) (tick / 1000 % 60), (unsigned) (tick % 1000));
+
+    return time;
+}
+
+// Scheduler is idle, tasks run since the last idle are reported and LCD transfer in flight finishes
+
+static void sim_idle(void)
+{
+    sim.wake_ups++;
+
+    for (twr_scheduler_task_id_t i = 0; sim.trace != NULL && i < twr_scheduler_get_task_count(); i++)
+    {
+        twr_scheduler_profile_t profile;
+
+        if (!twr_scheduler_get_profile(i, &profile) || profile.invocations == sim.invocations[i])
+        {
+            continue;
+        }
+
+        fprintf(sim.trace, "%s task %u %s x%u\n", sim_time(twr_tick_get()), (unsigned) i, sim_task_name(profile.task),
+                (unsigned) (profile.invocations - sim.invocations[i]));
+
+        sim.invocations[i] = profile.invocations;
+    }
+
+    spi_stub_complete();
+}
+
+static void sim_uplink(uint8_t port, const uint8_t *payload, size_t length)
+{
+    sim.uplinks++;
+
+    if (length > sizeof(sim.uplink_last))
+    {
+        length = sizeof(sim.uplink_last);
+    }
+
+    memcpy(sim.uplink_last, payload, length);
+    sim.uplink_last_length = length;
+
+    // Every value is known from the second uplink on and stays within range of the modelled room
+    if (sim.uplinks > 1)
+    {
+        int16_t temperature = (int16_t) (payload[3] << 8 | payload[4]);
+        uint16_t co2 = payload[6] << 8 | payload[7];
+        uint16_t voc = payload[8] << 8 | payload[9];
+        uint16_t pressure = payload[10] << 8 | payload[11];
+
+        if (length != 12 || payload[1] == 0xff || payload[2] == 0xff || temperature < 180 || temperature > 240 ||
+            payload[5] == 0xff || co2 < 400 || co2 > 1400 || voc > 250 || pressure < 1000 || pressure > 1030)
+        {
+            sim.uplink_payload_valid = false;
+        }
+    }
+
+    if (sim.trace != NULL)
+    {
+        fprintf(sim.trace, "%s uplink port %u", sim_time(twr_tick_get()), port);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            fprintf(sim.trace, " %02x", payload[i]);
+        }
+
+        fprintf(sim.trace, "\n");
+    }
+}
+
+static void sim_display_receive(const uint8_t *data, size_t length)
+{
+    sim.spi_bytes += length;
+
+    // VCOM toggle and clear command carry no lines
+    if ((data[0] & 0x80) == 0 || length < 4)
+    {
+        return;
+    }
+
+    uint32_t lines = (length - 2) / (TWR_LS013B7DH03_WIDTH / 8 + 2);
+
+    sim.frames++;
+    sim.lines += lines;
+
+    if (sim.trace != NULL)
+    {
+        // Address of the first line is sent with reversed bit order
+        uint8_t address = 0;
+
+        for (int i = 0; i < 8; i++)
+        {
+            address |= ((data[1] >> i) & 1) << (7 - i);
+        }
+
+        fprintf(sim.trace, "%s frame lines %u-%u\n", sim_time(twr_tick_get()), address, address + lines - 1);
+    }
+}
+
+static void sim_console_receive(twr_uart_channel_t channel, const uint8_t *data, size_t length)
+{
+    (void) channel;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        if (data[i] == '\r')
+        {
+            continue;
+        }
+
+        if (data[i] != '\n' && sim.console_length < sizeof(sim.console_line) - 1)
+        {
+            sim.console_line[sim.console_length++] = data[i];
+
+            continue;
+        }
+
+        sim.console_line[sim.console_length] = '\0';
+
+        if (sim.trace != NULL)
+        {
+            fprintf(sim.trace, "%s console %s\n", sim_time(twr_tick_get()), sim.console_line);
+        }
+
+        if (sim.console_echo && sim.console_length != 0)
+        {
+            printf("  %s\n", sim.console_line);
+        }
+
+        sim.console_length = 0;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int days = argc > 1 ? atoi(argv[1]) : 7;
+
+    if (argc > 2)
+    {
+        sim.trace = fopen(argv[2], "w");
+
+        if (sim.trace == NULL)
+        {
+            perror(argv[2]);
+
+            return 1;
+        }
+    }
+
+    sim.uplink_payload_valid = true;
+
+    spi_stub_set_handler(sim_display_receive);
+    uart_stub_set_handler(TWR_ATCI_UART, sim_console_receive);
+    sim_modem_init(TWR_UART_UART1, sim_uplink);
+    application_set_idle_handler(sim_idle);
+
+    // Same start as by main of the SDK
+    twr_scheduler_init();
+
+    twr_scheduler_register(application_task, NULL, 0);
+
+    application_init();
+
+    printf("day  uplinks   frames    lines  SPI bytes  wake-ups  last payload\n");
+
+    uint32_t uplinks = 0;
+    uint32_t frames = 0;
+    uint32_t lines = 0;
+    size_t spi_bytes = 0;
+    uint32_t wake_ups = 0;
+    uint32_t wake_ups_day_max = 0;
+
+    for (int day = 1; day <= days; day++)
+    {
+        application_run_until((twr_tick_t) day * SIM_DAY);
+
+        printf("%3d %8u %8u %8u %10lu %9u ", day, (unsigned) (sim.uplinks - uplinks), (unsigned) (sim.frames - frames),
+               (unsigned) (sim.lines - lines), (unsigned long) (sim.spi_bytes - spi_bytes), (unsigned) (sim.wake_ups - wake_ups));
+
+        for (size_t i = 0; i < sim.uplink_last_length; i++)
+        {
+            printf(" %02x", sim.uplink_last[i]);
+        }
+
+        printf("\n");
+
+        if (wake_ups_day_max < sim.wake_ups - wake_ups)
+        {
+            wake_ups_day_max = sim.wake_ups - wake_ups;
+        }
+
+        uplinks = sim.uplinks;
+        frames = sim.frames;
+        lines = sim.lines;
+        spi_bytes = sim.spi_bytes;
+        wake_ups = sim.wake_ups;
+    }
+
+    printf("\ntask  function            invocations  max late ms\n");
+
+    for (twr_scheduler_task_id_t i = 0; i < twr_scheduler_get_task_count(); i++)
+    {
+        twr_scheduler_profile_t profile;
+
+        if (twr_scheduler_get_profile(i, &profile))
+        {
+            printf("%4u  %-18s %12lu %12lu\n", (unsigned) i, sim_task_name(profile.task), (unsigned long) profile.invocations,
+                   (unsigned long) profile.lateness_max);
+        }
+    }
+
+    // Status of the week as printed on the AT console
+    printf("\nAT$STATUS\n");
+
+    sim.console_echo = true;
+
+    uart_stub_receive(TWR_ATCI_UART, "AT$STATUS\r\n", strlen("AT$STATUS\r\n"));
+
+    application_run_until(twr_tick_get() + 1000);
+
+    sim.console_echo = false;
+
+    if (sim.trace != NULL)
+    {
+        fclose(sim.trace);
+    }
+
+    TEST_CHECK(sim.uplinks == (uint32_t) days * SIM_UPLINKS_PER_DAY);
+    TEST_CHECK(sim.uplink_payload_valid);
+
+    // Display follows the sensors, unchanged content is not sent
+    TEST_CHECK(sim.frames >= (uint32_t) days * 24);
+
+    TEST_CHECK(wake_ups_day_max <= SIM_WAKE_UPS_PER_DAY_MAX);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,472 @@
+#include <twr_tag_humidity.h>
+#include <twr_tag_voc_lp.h>
+#include <twr_tag_barometer.h>
+#include <twr_module_co2.h>
+#include <twr_module_battery.h>
+#include <math.h>
+
+// Sensor drivers replaced at their API, one instance each, values follow daily cycle of occupied room from tick 0 at midnight
+
+#define _SIM_DAY (24 * 60 * 60 * 1000.)
+#define _SIM_PI 3.14159265f
+
+typedef struct
+{
+    twr_scheduler_task_id_t task_id_interval;
+    twr_scheduler_task_id_t task_id_measure;
+    twr_tick_t update_interval;
+    twr_tick_t measurement_time;
+    bool measurement_active;
+    bool valid;
+    twr_tick_t tick_measured;
+    void (*update)(void);
+
+} _sim_sensor_t;
+
+static struct
+{
+    _sim_sensor_t sensor;
+    twr_tag_humidity_t *self;
+    void (*event_handler)(twr_tag_humidity_t *, twr_tag_humidity_event_t, void *);
+    void *event_param;
+
+} _sim_humidity;
+
+static struct
+{
+    _sim_sensor_t sensor;
+    twr_tag_voc_lp_t *self;
+    void (*event_handler)(twr_tag_voc_lp_t *, twr_tag_voc_lp_event_t, void *);
+    void *event_param;
+
+} _sim_voc;
+
+static struct
+{
+    _sim_sensor_t sensor;
+    twr_tag_barometer_t *self;
+    void (*event_handler)(twr_tag_barometer_t *, twr_tag_barometer_event_t, void *);
+    void *event_param;
+
+} _sim_barometer;
+
+static struct
+{
+    _sim_sensor_t sensor;
+    void (*event_handler)(twr_module_co2_event_t, void *);
+    void *event_param;
+
+} _sim_co2;
+
+static struct
+{
+    _sim_sensor_t sensor;
+    void (*event_handler)(twr_module_battery_event_t, void *);
+    void *event_param;
+    float level_low_threshold;
+    float level_critical_threshold;
+
+} _sim_battery;
+
+static void _sim_sensor_init(_sim_sensor_t *sensor, twr_tick_t measurement_time, void (*update)(void));
+static void _sim_sensor_set_update_interval(_sim_sensor_t *sensor, twr_tick_t interval);
+static bool _sim_sensor_measure(_sim_sensor_t *sensor);
+static void _sim_sensor_task_interval(void *param);
+static void _sim_sensor_task_measure(void *param);
+static float _sim_daily(twr_tick_t tick);
+static float _sim_occupancy(twr_tick_t tick);
+static void _sim_humidity_update(void);
+static void _sim_voc_update(void);
+static void _sim_barometer_update(void);
+static void _sim_co2_update(void);
+static void _sim_battery_update(void);
+
+void twr_tag_humidity_init(twr_tag_humidity_t *self, twr_tag_humidity_revision_t revision, twr_i2c_channel_t i2c_channel, twr_tag_humidity_i2c_address_t i2c_address)
+{
+    (void) revision;
+    (void) i2c_channel;
+    (void) i2c_address;
+
+    memset(self, 0, sizeof(*self));
+
+    _sim_humidity.self = self;
+
+    _sim_sensor_init(&_sim_humidity.sensor, 20, _sim_humidity_update);
+}
+
+void twr_tag_humidity_set_event_handler(twr_tag_humidity_t *self, void (*event_handler)(twr_tag_humidity_t *, twr_tag_humidity_event_t, void *), void *event_param)
+{
+    (void) self;
+
+    _sim_humidity.event_handler = event_handler;
+    _sim_humidity.event_param = event_param;
+}
+
+void twr_tag_humidity_set_update_interval(twr_tag_humidity_t *self, twr_tick_t interval)
+{
+    (void) self;
+
+    _sim_sensor_set_update_interval(&_sim_humidity.sensor, interval);
+}
+
+bool twr_tag_humidity_measure(twr_tag_humidity_t *self)
+{
+    (void) self;
+
+    return _sim_sensor_measure(&_sim_humidity.sensor);
+}
+
+bool twr_tag_humidity_get_temperature_celsius(twr_tag_humidity_t *self, float *celsius)
+{
+    (void) self;
+
+    if (!_sim_humidity.sensor.valid)
+    {
+        return false;
+    }
+
+    *celsius = 21.f + 2.5f * _sim_daily(_sim_humidity.sensor.tick_measured);
+
+    return true;
+}
+
+bool twr_tag_humidity_get_humidity_percentage(twr_tag_humidity_t *self, float *percentage)
+{
+    (void) self;
+
+    if (!_sim_humidity.sensor.valid)
+    {
+        return false;
+    }
+
+    *percentage = 45.f - 8.f * _sim_daily(_sim_humidity.sensor.tick_measured);
+
+    return true;
+}
+
+void twr_tag_voc_lp_init(twr_tag_voc_lp_t *self, twr_i2c_channel_t i2c_channel)
+{
+    (void) i2c_channel;
+
+    memset(self, 0, sizeof(*self));
+
+    _sim_voc.self = self;
+
+    _sim_sensor_init(&_sim_voc.sensor, 50, _sim_voc_update);
+}
+
+void twr_tag_voc_lp_set_event_handler(twr_tag_voc_lp_t *self, void (*event_handler)(twr_tag_voc_lp_t *, twr_tag_voc_lp_event_t, void *), void *event_param)
+{
+    (void) self;
+
+    _sim_voc.event_handler = event_handler;
+    _sim_voc.event_param = event_param;
+}
+
+void twr_tag_voc_lp_set_update_interval(twr_tag_voc_lp_t *self, twr_tick_t interval)
+{
+    (void) self;
+
+    _sim_sensor_set_update_interval(&_sim_voc.sensor, interval);
+}
+
+bool twr_tag_voc_lp_measure(twr_tag_voc_lp_t *self)
+{
+    (void) self;
+
+    return _sim_sensor_measure(&_sim_voc.sensor);
+}
+
+bool twr_tag_voc_lp_get_tvoc_ppb(twr_tag_voc_lp_t *self, uint16_t *ppb)
+{
+    (void) self;
+
+    if (!_sim_voc.sensor.valid)
+    {
+        return false;
+    }
+
+    *ppb = lroundf(60.f + 140.f * _sim_occupancy(_sim_voc.sensor.tick_measured));
+
+    return true;
+}
+
+void twr_tag_barometer_init(twr_tag_barometer_t *self, twr_i2c_channel_t i2c_channel)
+{
+    (void) i2c_channel;
+
+    memset(self, 0, sizeof(*self));
+
+    _sim_barometer.self = self;
+
+    _sim_sensor_init(&_sim_barometer.sensor, 1500, _sim_barometer_update);
+}
+
+void twr_tag_barometer_set_event_handler(twr_tag_barometer_t *self, void (*event_handler)(twr_tag_barometer_t *, twr_tag_barometer_event_t, void *), void *event_param)
+{
+    (void) self;
+
+    _sim_barometer.event_handler = event_handler;
+    _sim_barometer.event_param = event_param;
+}
+
+void twr_tag_barometer_set_update_interval(twr_tag_barometer_t *self, twr_tick_t interval)
+{
+    (void) self;
+
+    _sim_sensor_set_update_interval(&_sim_barometer.sensor, interval);
+}
+
+bool twr_tag_barometer_measure(twr_tag_barometer_t *self)
+{
+    (void) self;
+
+    return _sim_sensor_measure(&_sim_barometer.sensor);
+}
+
+bool twr_tag_barometer_get_pressure_pascal(twr_tag_barometer_t *self, float *pascal)
+{
+    (void) self;
+
+    if (!_sim_barometer.sensor.valid)
+    {
+        return false;
+    }
+
+    // Weather fronts pass every few days
+    *pascal = 101325.f + 900.f * sinf(2 * _SIM_PI * _sim_barometer.sensor.tick_measured / (3.5 * _SIM_DAY));
+
+    return true;
+}
+
+void twr_module_co2_init(void)
+{
+    _sim_sensor_init(&_sim_co2.sensor, 3000, _sim_co2_update);
+}
+
+void twr_module_co2_set_event_handler(void (*event_handler)(twr_module_co2_event_t, void *), void *event_param)
+{
+    _sim_co2.event_handler = event_handler;
+    _sim_co2.event_param = event_param;
+}
+
+void twr_module_co2_set_update_interval(twr_tick_t interval)
+{
+    _sim_sensor_set_update_interval(&_sim_co2.sensor, interval);
+}
+
+bool twr_module_co2_measure(void)
+{
+    return _sim_sensor_measure(&_sim_co2.sensor);
+}
+
+bool twr_module_co2_get_concentration_ppm(float *ppm)
+{
+    if (!_sim_co2.sensor.valid)
+    {
+        return false;
+    }
+
+    *ppm = 420.f + 900.f * _sim_occupancy(_sim_co2.sensor.tick_measured);
+
+    return true;
+}
+
+void twr_module_co2_calibration(twr_lp8_calibration_t calibration)
+{
+    (void) calibration;
+}
+
+void twr_module_battery_init(void)
+{
+    _sim_sensor_init(&_sim_battery.sensor, 20, _sim_battery_update);
+}
+
+void twr_module_battery_set_event_handler(void (*event_handler)(twr_module_battery_event_t, void *), void *event_param)
+{
+    _sim_battery.event_handler = event_handler;
+    _sim_battery.event_param = event_param;
+}
+
+void twr_module_battery_set_update_interval(twr_tick_t interval)
+{
+    _sim_sensor_set_update_interval(&_sim_battery.sensor, interval);
+}
+
+void twr_module_battery_set_threshold_levels(float level_low_threshold, float level_critical_threshold)
+{
+    _sim_battery.level_low_threshold = level_low_threshold;
+    _sim_battery.level_critical_threshold = level_critical_threshold;
+}
+
+bool twr_module_battery_measure(void)
+{
+    return _sim_sensor_measure(&_sim_battery.sensor);
+}
+
+bool twr_module_battery_get_voltage(float *voltage)
+{
+    if (!_sim_battery.sensor.valid)
+    {
+        return false;
+    }
+
+    // Four cells of mini battery module discharge slowly
+    *voltage = 6.2f - 0.02f * _sim_battery.sensor.tick_measured / _SIM_DAY;
+
+    return true;
+}
+
+bool twr_module_battery_get_charge_level(int *percentage)
+{
+    float voltage;
+
+    if (!twr_module_battery_get_voltage(&voltage))
+    {
+        return false;
+    }
+
+    *percentage = lroundf((voltage - 4.8f) / (6.4f - 4.8f) * 100.f);
+
+    return true;
+}
+
+static void _sim_sensor_init(_sim_sensor_t *sensor, twr_tick_t measurement_time, void (*update)(void))
+{
+    memset(sensor, 0, sizeof(*sensor));
+
+    sensor->measurement_time = measurement_time;
+    sensor->update = update;
+
+    sensor->task_id_interval = twr_scheduler_register(_sim_sensor_task_interval, sensor, TWR_TICK_INFINITY);
+    sensor->task_id_measure = twr_scheduler_register(_sim_sensor_task_measure, sensor, TWR_TICK_INFINITY);
+}
+
+// Periodic update is planned with the same slack as by the real drivers
+
+static void _sim_sensor_set_update_interval(_sim_sensor_t *sensor, twr_tick_t interval)
+{
+    sensor->update_interval = interval;
+
+    if (sensor->update_interval == TWR_TICK_INFINITY)
+    {
+        twr_scheduler_plan_absolute(sensor->task_id_interval, TWR_TICK_INFINITY);
+    }
+    else
+    {
+        twr_scheduler_plan_relative_with_slack(sensor->task_id_interval, sensor->update_interval, TWR_SCHEDULER_UPDATE_SLACK(sensor->update_interval));
+
+        _sim_sensor_measure(sensor);
+    }
+}
+
+static bool _sim_sensor_measure(_sim_sensor_t *sensor)
+{
+    if (sensor->measurement_active)
+    {
+        return false;
+    }
+
+    sensor->measurement_active = true;
+
+    twr_scheduler_plan_relative(sensor->task_id_measure, sensor->measurement_time);
+
+    return true;
+}
+
+static void _sim_sensor_task_interval(void *param)
+{
+    _sim_sensor_t *sensor = param;
+
+    _sim_sensor_measure(sensor);
+
+    twr_scheduler_plan_current_relative_with_slack(sensor->update_interval, TWR_SCHEDULER_UPDATE_SLACK(sensor->update_interval));
+}
+
+static void _sim_sensor_task_measure(void *param)
+{
+    _sim_sensor_t *sensor = param;
+
+    sensor->measurement_active = false;
+    sensor->valid = true;
+    sensor->tick_measured = twr_tick_get();
+
+    sensor->update();
+}
+
+// Daily cycle between -1 at 3:00 and 1 at 15:00
+
+static float _sim_daily(twr_tick_t tick)
+{
+    return sinf(2 * _SIM_PI * (tick / _SIM_DAY - 0.375));
+}
+
+// Room is occupied from 8:00 to 18:00 on working days, air quality follows
+
+static float _sim_occupancy(twr_tick_t tick)
+{
+    int day = tick / _SIM_DAY;
+    float hour = (tick / _SIM_DAY - day) * 24;
+
+    if (day % 7 >= 5 || hour < 8 || hour >= 18)
+    {
+        return 0;
+    }
+
+    return sinf(_SIM_PI * (hour - 8) / 10);
+}
+
+static void _sim_humidity_update(void)
+{
+    if (_sim_humidity.event_handler != NULL)
+    {
+        _sim_humidity.event_handler(_sim_humidity.self, TWR_TAG_HUMIDITY_EVENT_UPDATE, _sim_humidity.event_param);
+    }
+}
+
+static void _sim_voc_update(void)
+{
+    if (_sim_voc.event_handler != NULL)
+    {
+        _sim_voc.event_handler(_sim_voc.self, TWR_TAG_VOC_LP_EVENT_UPDATE, _sim_voc.event_param);
+    }
+}
+
+static void _sim_barometer_update(void)
+{
+    if (_sim_barometer.event_handler != NULL)
+    {
+        _sim_barometer.event_handler(_sim_barometer.self, TWR_TAG_BAROMETER_EVENT_UPDATE, _sim_barometer.event_param);
+    }
+}
+
+static void _sim_co2_update(void)
+{
+    if (_sim_co2.event_handler != NULL)
+    {
+        _sim_co2.event_handler(TWR_MODULE_CO2_EVENT_UPDATE, _sim_co2.event_param);
+    }
+}
+
+static void _sim_battery_update(void)
+{
+    if (_sim_battery.event_handler == NULL)
+    {
+        return;
+    }
+
+    _sim_battery.event_handler(TWR_MODULE_BATTERY_EVENT_UPDATE, _sim_battery.event_param);
+
+    float voltage;
+
+    twr_module_battery_get_voltage(&voltage);
+
+    if (voltage < _sim_battery.level_critical_threshold)
+    {
+        _sim_battery.event_handler(TWR_MODULE_BATTERY_EVENT_LEVEL_CRITICAL, _sim_battery.event_param);
+    }
+    else if (voltage < _sim_battery.level_low_threshold)
+    {
+        _sim_battery.event_handler(TWR_MODULE_BATTERY_EVENT_LEVEL_LOW, _sim_battery.event_param);
+    }
+}
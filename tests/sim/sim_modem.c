@@ -0,0 +1,140 @@
+#include <sim_modem.h>
+#include <stub/twr_uart.h>
+
+// Modem answers every command at once, driver writes each command including binary payload by single write
+
+static struct
+{
+    const char *name;
+    char value[40];
+
+} _sim_modem_config[] =
+{
+    { "DEVADDR", "01234567" },
+    { "DEVEUI", "0123456789abcdef" },
+    { "APPEUI", "0000000000000000" },
+    { "NWKSKEY", "00000000000000000000000000000000" },
+    { "APPSKEY", "00000000000000000000000000000000" },
+    { "APPKEY", "00000000000000000000000000000000" },
+    { "BAND", "5" },
+    { "MODE", "1" },
+    { "CLASS", "0" },
+    { "RX2", "869525000,0" },
+    { "NWK", "1" },
+    { "ADR", "1" },
+    { "DR", "0" },
+    { "REP", "1" },
+    { "RTYNUM", "8" }
+};
+
+static void (*_sim_modem_uplink_handler)(uint8_t port, const uint8_t *payload, size_t length);
+
+static void _sim_modem_receive(twr_uart_channel_t channel, const uint8_t *data, size_t length);
+static void _sim_modem_reply(twr_uart_channel_t channel, const char *format, const char *value);
+
+void sim_modem_init(twr_uart_channel_t channel, void (*uplink_handler)(uint8_t port, const uint8_t *payload, size_t length))
+{
+    _sim_modem_uplink_handler = uplink_handler;
+
+    uart_stub_set_handler(channel, _sim_modem_receive);
+}
+
+static void _sim_modem_receive(twr_uart_channel_t channel, const uint8_t *data, size_t length)
+{
+    const uint8_t *end = memchr(data, '\r', length);
+
+    if (end == NULL || length < 3 || memcmp(data, "AT", 2) != 0)
+    {
+        _sim_modem_reply(channel, "+ERR=-1\r", NULL);
+
+        return;
+    }
+
+    char command[64];
+    size_t command_length = end - data;
+
+    if (command_length >= sizeof(command))
+    {
+        command_length = sizeof(command) - 1;
+    }
+
+    memcpy(command, data, command_length);
+    command[command_length] = '\0';
+
+    int port;
+    int payload_length;
+
+    // Binary payload follows command of unconfirmed and confirmed uplink
+    if (sscanf(command, "AT+PUTX %d,%d", &port, &payload_length) == 2 || sscanf(command, "AT+PCTX %d,%d", &port, &payload_length) == 2)
+    {
+        const uint8_t *payload = end + 1;
+
+        if (payload + payload_length >= data + length || payload[payload_length] != '\r')
+        {
+            _sim_modem_reply(channel, "+ERR=-2\r", NULL);
+
+            return;
+        }
+
+        if (_sim_modem_uplink_handler != NULL)
+        {
+            _sim_modem_uplink_handler(port, payload, payload_length);
+        }
+
+        _sim_modem_reply(channel, "+OK\r", NULL);
+
+        return;
+    }
+
+    if (strcmp(command, "AT+VER?") == 0)
+    {
+        _sim_modem_reply(channel, "+OK=1.1.06,Aug 24 2020 16:11:57\r", NULL);
+
+        return;
+    }
+
+    if (strcmp(command, "AT+JOIN") == 0)
+    {
+        _sim_modem_reply(channel, "+OK\r+EVENT=1,1\r", NULL);
+
+        return;
+    }
+
+    for (size_t i = 0; strncmp(command, "AT+", 3) == 0 && i < sizeof(_sim_modem_config) / sizeof(_sim_modem_config[0]); i++)
+    {
+        size_t name_length = strlen(_sim_modem_config[i].name);
+
+        if (strncmp(&command[3], _sim_modem_config[i].name, name_length) != 0)
+        {
+            continue;
+        }
+
+        if (strcmp(&command[3 + name_length], "?") == 0)
+        {
+            _sim_modem_reply(channel, "+OK=%s\r", _sim_modem_config[i].value);
+
+            return;
+        }
+
+        if (command[3 + name_length] == '=')
+        {
+            strncpy(_sim_modem_config[i].value, &command[4 + name_length], sizeof(_sim_modem_config[i].value) - 1);
+
+            _sim_modem_reply(channel, "+OK\r", NULL);
+
+            return;
+        }
+    }
+
+    // Reboot, data format, duty cycle and other settings are accepted without effect
+    _sim_modem_reply(channel, "+OK\r", NULL);
+}
+
+static void _sim_modem_reply(twr_uart_channel_t channel, const char *format, const char *value)
+{
+    char reply[64];
+
+    int length = snprintf(reply, sizeof(reply), format, value);
+
+    uart_stub_receive(channel, reply, length);
+}
@@ -0,0 +1,12 @@
+#ifndef _SIM_MODEM_H
+#define _SIM_MODEM_H
+
+#include <twr_uart.h>
+
+//! @brief Attach emulated LoRa modem answering AT commands of CMWX1ZZABZ driver to UART channel
+//! @param[in] channel UART channel of driver
+//! @param[in] uplink_handler Function called with port and payload of every message sent to network
+
+void sim_modem_init(twr_uart_channel_t channel, void (*uplink_handler)(uint8_t port, const uint8_t *payload, size_t length));
+
+#endif // _SIM_MODEM_H
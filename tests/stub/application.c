@@ -0,0 +1,63 @@
+#include <stub/application.h>
+#include <twr_scheduler.h>
+#include <twr_error.h>
+#include <setjmp.h>
+
+// Virtual clock, application_idle jumps straight to the next planned task
+
+static jmp_buf *_application_exit;
+static twr_tick_t _application_tick_end;
+static void (*_application_idle_handler)(void);
+
+void application_run_until(twr_tick_t tick)
+{
+    jmp_buf exit_point;
+
+    _application_exit = &exit_point;
+    _application_tick_end = tick;
+
+    if (setjmp(exit_point) == 0)
+    {
+        twr_scheduler_run();
+    }
+
+    _application_exit = NULL;
+}
+
+void application_set_idle_handler(void (*handler)(void))
+{
+    _application_idle_handler = handler;
+}
+
+void application_idle(void)
+{
+    if (_application_idle_handler != NULL)
+    {
+        _application_idle_handler();
+    }
+
+    twr_tick_t tick_now = twr_tick_get();
+    twr_tick_t tick_next = twr_scheduler_get_next_tick();
+
+    if (tick_next > _application_tick_end)
+    {
+        if (tick_now < _application_tick_end)
+        {
+            twr_tick_increment_irq(_application_tick_end - tick_now);
+        }
+
+        longjmp(*_application_exit, 1);
+    }
+
+    if (tick_next > tick_now)
+    {
+        twr_tick_increment_irq(tick_next - tick_now);
+    }
+}
+
+void application_error(twr_error_t code)
+{
+    printf("application_error: %d\n", (int) code);
+
+    exit(1);
+}
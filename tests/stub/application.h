@@ -0,0 +1,16 @@
+#ifndef _STUB_APPLICATION_H
+#define _STUB_APPLICATION_H
+
+#include <twr_tick.h>
+
+//! @brief Run scheduler on virtual clock until no task is planned up to the tick, clock is left at the tick
+//! @param[in] tick Absolute tick
+
+void application_run_until(twr_tick_t tick);
+
+//! @brief Set handler called whenever scheduler goes idle, before clock is advanced to the next planned task
+//! @param[in] handler Function called in idle (it may plan tasks or finish transfers) or NULL
+
+void application_set_idle_handler(void (*handler)(void));
+
+#endif // _STUB_APPLICATION_H
@@ -0,0 +1,13 @@
+#ifndef _STUB_RTC_STM32L0XX_H
+#define _STUB_RTC_STM32L0XX_H
+
+#include_next <stm32l0xx.h>
+
+// Every RTC register access goes through the model so that it can follow the wake-up timer and the calendar
+
+RTC_TypeDef *rtc_model_access(void);
+
+#undef RTC
+#define RTC (rtc_model_access())
+
+#endif // _STUB_RTC_STM32L0XX_H
@@ -0,0 +1,75 @@
+#include <stub/twr_exti.h>
+#include <twr_scheduler.h>
+
+// Lines are triggered by tests only, edge setting is not modelled
+
+static struct
+{
+    twr_exti_line_t line;
+    void (*callback)(twr_exti_line_t, void *);
+    void *param;
+    bool deferred;
+    bool enabled;
+
+} _exti_stub[16];
+
+static void _exti_stub_event(void *param, uint32_t pin);
+
+void exti_stub_trigger(twr_exti_line_t line)
+{
+    uint8_t pin = (uint8_t) line & 15;
+
+    if (!_exti_stub[pin].enabled || _exti_stub[pin].line != line)
+    {
+        return;
+    }
+
+    if (_exti_stub[pin].deferred)
+    {
+        twr_scheduler_post_event_irq(_exti_stub_event, NULL, pin);
+    }
+    else
+    {
+        _exti_stub[pin].callback(line, _exti_stub[pin].param);
+    }
+}
+
+void twr_exti_register(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param)
+{
+    (void) edge;
+
+    uint8_t pin = (uint8_t) line & 15;
+
+    _exti_stub[pin].line = line;
+    _exti_stub[pin].callback = callback;
+    _exti_stub[pin].param = param;
+    _exti_stub[pin].deferred = false;
+    _exti_stub[pin].enabled = true;
+}
+
+void twr_exti_register_deferred(twr_exti_line_t line, twr_exti_edge_t edge, void (*callback)(twr_exti_line_t, void *), void *param)
+{
+    twr_exti_register(line, edge, callback, param);
+
+    _exti_stub[(uint8_t) line & 15].deferred = true;
+}
+
+void twr_exti_unregister(twr_exti_line_t line)
+{
+    uint8_t pin = (uint8_t) line & 15;
+
+    if (_exti_stub[pin].line == line)
+    {
+        _exti_stub[pin].enabled = false;
+    }
+}
+
+static void _exti_stub_event(void *param, uint32_t pin)
+{
+    (void) param;
+
+    if (_exti_stub[pin].enabled)
+    {
+        _exti_stub[pin].callback(_exti_stub[pin].line, _exti_stub[pin].param);
+    }
+}
@@ -0,0 +1,11 @@
+#ifndef _STUB_TWR_EXTI_H
+#define _STUB_TWR_EXTI_H
+
+#include <twr_exti.h>
+
+//! @brief Trigger registered EXTI line, callback of deferred line is called by scheduler
+//! @param[in] line EXTI line
+
+void exti_stub_trigger(twr_exti_line_t line);
+
+#endif // _STUB_TWR_EXTI_H
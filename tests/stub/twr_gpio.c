@@ -0,0 +1,56 @@
+#include <twr_gpio.h>
+
+// Pins keep their mode, pull and output, input reads the output level
+
+static struct
+{
+    twr_gpio_mode_t mode;
+    twr_gpio_pull_t pull;
+    int output;
+
+} _gpio_stub[TWR_GPIO_SDA0 + 1];
+
+void twr_gpio_init(twr_gpio_channel_t channel)
+{
+    (void) channel;
+}
+
+void twr_gpio_set_pull(twr_gpio_channel_t channel, twr_gpio_pull_t pull)
+{
+    _gpio_stub[channel].pull = pull;
+}
+
+twr_gpio_pull_t twr_gpio_get_pull(twr_gpio_channel_t channel)
+{
+    return _gpio_stub[channel].pull;
+}
+
+void twr_gpio_set_mode(twr_gpio_channel_t channel, twr_gpio_mode_t mode)
+{
+    _gpio_stub[channel].mode = mode;
+}
+
+twr_gpio_mode_t twr_gpio_get_mode(twr_gpio_channel_t channel)
+{
+    return _gpio_stub[channel].mode;
+}
+
+int twr_gpio_get_input(twr_gpio_channel_t channel)
+{
+    return _gpio_stub[channel].output;
+}
+
+void twr_gpio_set_output(twr_gpio_channel_t channel, int state)
+{
+    _gpio_stub[channel].output = state != 0;
+}
+
+int twr_gpio_get_output(twr_gpio_channel_t channel)
+{
+    return _gpio_stub[channel].output;
+}
+
+void twr_gpio_toggle_output(twr_gpio_channel_t channel)
+{
+    _gpio_stub[channel].output = !_gpio_stub[channel].output;
+}
@@ -0,0 +1,15 @@
+#include <twr_irq.h>
+
+// Host has no interrupts, only nesting is tracked so that unbalanced calls are detected
+
+int _twr_irq_disable;
+
+void twr_irq_disable(void)
+{
+    _twr_irq_disable++;
+}
+
+void twr_irq_enable(void)
+{
+    _twr_irq_disable--;
+}
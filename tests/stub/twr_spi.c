@@ -0,0 +1,111 @@
+#include <stub/twr_spi.h>
+
+// Synchronous transfer finishes immediately, asynchronous one waits for spi_stub_complete()
+
+static struct
+{
+    void (*handler)(const uint8_t *data, size_t length);
+
+    const uint8_t *source;
+    size_t length;
+
+    // Copy of data at transfer start, source must not change while it is sent
+    uint8_t copy[4096];
+
+    void (*event_handler)(twr_spi_event_t event, void *event_param);
+    void *event_param;
+
+    size_t bytes;
+
+} _spi_stub;
+
+void spi_stub_set_handler(void (*handler)(const uint8_t *data, size_t length))
+{
+    _spi_stub.handler = handler;
+}
+
+bool spi_stub_is_busy(void)
+{
+    return _spi_stub.source != NULL;
+}
+
+bool spi_stub_complete(void)
+{
+    if (_spi_stub.source == NULL)
+    {
+        return false;
+    }
+
+    if (memcmp(_spi_stub.source, _spi_stub.copy, _spi_stub.length) != 0)
+    {
+        printf("spi_stub_complete: source changed during transfer\n");
+
+        exit(1);
+    }
+
+    if (_spi_stub.handler != NULL)
+    {
+        _spi_stub.handler(_spi_stub.copy, _spi_stub.length);
+    }
+
+    _spi_stub.bytes += _spi_stub.length;
+    _spi_stub.source = NULL;
+
+    _spi_stub.event_handler(TWR_SPI_EVENT_DONE, _spi_stub.event_param);
+
+    return true;
+}
+
+size_t spi_stub_get_bytes(void)
+{
+    return _spi_stub.bytes;
+}
+
+void twr_spi_init(twr_spi_speed_t speed, twr_spi_mode_t mode)
+{
+    (void) speed;
+    (void) mode;
+}
+
+bool twr_spi_is_ready(void)
+{
+    return _spi_stub.source == NULL;
+}
+
+bool twr_spi_transfer(const void *source, void *destination, size_t length)
+{
+    (void) destination;
+
+    if (_spi_stub.source != NULL)
+    {
+        return false;
+    }
+
+    if (_spi_stub.handler != NULL)
+    {
+        _spi_stub.handler(source, length);
+    }
+
+    _spi_stub.bytes += length;
+
+    return true;
+}
+
+bool twr_spi_async_transfer(const void *source, void *destination, size_t length, void (*event_handler)(twr_spi_event_t event, void *event_param), void (*event_param))
+{
+    (void) destination;
+
+    if (_spi_stub.source != NULL || length > sizeof(_spi_stub.copy))
+    {
+        return false;
+    }
+
+    _spi_stub.source = source;
+    _spi_stub.length = length;
+    _spi_stub.event_handler = event_handler;
+    _spi_stub.event_param = event_param;
+
+    memcpy(_spi_stub.copy, source, length);
+
+    return true;
+}
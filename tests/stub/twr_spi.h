@@ -0,0 +1,25 @@
+#ifndef _STUB_TWR_SPI_H
+#define _STUB_TWR_SPI_H
+
+#include <twr_spi.h>
+
+//! @brief Set handler receiving data of each finished transfer
+//! @param[in] handler Function called with transferred data or NULL
+
+void spi_stub_set_handler(void (*handler)(const uint8_t *data, size_t length));
+
+//! @brief Check if asynchronous transfer is in progress
+//! @return true If transfer is in progress
+
+bool spi_stub_is_busy(void);
+
+//! @brief Finish asynchronous transfer in progress, its event handler is called
+//! @return true If transfer was in progress
+
+bool spi_stub_complete(void);
+
+//! @brief Get number of bytes of all finished transfers
+
+size_t spi_stub_get_bytes(void);
+
+#endif // _STUB_TWR_SPI_H
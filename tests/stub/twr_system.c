@@ -0,0 +1,39 @@
+#include <stub/twr_system.h>
+
+// USB is connected so that AT interface is active, PLL requests are only counted like by the semaphore of the driver,
+// microsecond counter follows the tick plus time spent by system_stub_spend
+
+static int _system_stub_pll_enable_semaphore;
+static uint32_t _system_stub_microseconds_spent;
+
+void system_stub_spend(uint32_t microseconds)
+{
+    _system_stub_microseconds_spent += microseconds;
+}
+
+void twr_system_pll_enable(void)
+{
+    _system_stub_pll_enable_semaphore++;
+}
+
+void twr_system_pll_disable(void)
+{
+    _system_stub_pll_enable_semaphore--;
+}
+
+void twr_system_reset(void)
+{
+    printf("twr_system_reset\n");
+
+    exit(1);
+}
+
+bool twr_system_get_vbus_sense(void)
+{
+    return true;
+}
+
+uint32_t twr_system_get_microseconds(void)
+{
+    return twr_tick_get() * 1000 + _system_stub_microseconds_spent;
+}
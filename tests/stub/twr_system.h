@@ -0,0 +1,11 @@
+#ifndef _STUB_TWR_SYSTEM_H
+#define _STUB_TWR_SYSTEM_H
+
+#include <twr_system.h>
+
+//! @brief Spend time in the running code, microsecond counter advances while tick stays
+//! @param[in] microseconds Time spent
+
+void system_stub_spend(uint32_t microseconds);
+
+#endif // _STUB_TWR_SYSTEM_H
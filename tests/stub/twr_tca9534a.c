@@ -0,0 +1,104 @@
+#include <stub/twr_tca9534a.h>
+
+// Expander is always present, output pins read back the port written, input pins read level set by test
+
+static uint8_t _tca9534a_stub_input;
+
+static uint8_t _tca9534a_stub_port(twr_tca9534a_t *self);
+
+void tca9534a_stub_set_input(twr_tca9534a_pin_t pin, int state)
+{
+    if (state == 0)
+    {
+        _tca9534a_stub_input &= ~(1 << (uint8_t) pin);
+    }
+    else
+    {
+        _tca9534a_stub_input |= 1 << (uint8_t) pin;
+    }
+}
+
+bool twr_tca9534a_init(twr_tca9534a_t *self, twr_i2c_channel_t i2c_channel, uint8_t i2c_address)
+{
+    self->_i2c_channel = i2c_channel;
+    self->_i2c_address = i2c_address;
+    self->_direction = 0xff;
+    self->_output_port = 0xff;
+
+    return true;
+}
+
+bool twr_tca9534a_read_port(twr_tca9534a_t *self, uint8_t *state)
+{
+    *state = _tca9534a_stub_port(self);
+
+    return true;
+}
+
+bool twr_tca9534a_write_port(twr_tca9534a_t *self, uint8_t state)
+{
+    self->_output_port = state;
+
+    return true;
+}
+
+bool twr_tca9534a_read_pin(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, int *state)
+{
+    *state = (_tca9534a_stub_port(self) >> (uint8_t) pin) & 1;
+
+    return true;
+}
+
+bool twr_tca9534a_write_pin(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, int state)
+{
+    if (state == 0)
+    {
+        self->_output_port &= ~(1 << (uint8_t) pin);
+    }
+    else
+    {
+        self->_output_port |= 1 << (uint8_t) pin;
+    }
+
+    return true;
+}
+
+bool twr_tca9534a_get_port_direction(twr_tca9534a_t *self, uint8_t *direction)
+{
+    *direction = self->_direction;
+
+    return true;
+}
+
+bool twr_tca9534a_set_port_direction(twr_tca9534a_t *self, uint8_t direction)
+{
+    self->_direction = direction;
+
+    return true;
+}
+
+bool twr_tca9534a_get_pin_direction(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, twr_tca9534a_pin_direction_t *direction)
+{
+    *direction = (self->_direction >> (uint8_t) pin) & 1 ? TWR_TCA9534A_PIN_DIRECTION_INPUT : TWR_TCA9534A_PIN_DIRECTION_OUTPUT;
+
+    return true;
+}
+
+bool twr_tca9534a_set_pin_direction(twr_tca9534a_t *self, twr_tca9534a_pin_t pin, twr_tca9534a_pin_direction_t direction)
+{
+    if (direction == TWR_TCA9534A_PIN_DIRECTION_OUTPUT)
+    {
+        self->_direction &= ~(1 << (uint8_t) pin);
+    }
+    else
+    {
+        self->_direction |= 1 << (uint8_t) pin;
+    }
+
+    return true;
+}
+
+static uint8_t _tca9534a_stub_port(twr_tca9534a_t *self)
+{
+    return (self->_output_port & ~self->_direction) | (_tca9534a_stub_input & self->_direction);
+}
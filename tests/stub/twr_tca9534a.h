@@ -0,0 +1,12 @@
+#ifndef _STUB_TWR_TCA9534A_H
+#define _STUB_TWR_TCA9534A_H
+
+#include <twr_tca9534a.h>
+
+//! @brief Set level read from pin configured as input (all inputs read 0 until set)
+//! @param[in] pin Pin of every expander instance
+//! @param[in] state Input level
+
+void tca9534a_stub_set_input(twr_tca9534a_pin_t pin, int state);
+
+#endif // _STUB_TWR_TCA9534A_H
@@ -0,0 +1,20 @@
+#include <twr_timer.h>
+
+// Busy-wait delays take no time on the virtual clock
+
+void twr_timer_init(void)
+{
+}
+
+void twr_timer_start(void)
+{
+}
+
+void twr_timer_delay(uint16_t microseconds)
+{
+    (void) microseconds;
+}
+
+void twr_timer_stop(void)
+{
+}
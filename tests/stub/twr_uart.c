@@ -0,0 +1,133 @@
+#include <stub/twr_uart.h>
+#include <twr_scheduler.h>
+
+// Written data are handed over at once, received data wait in read FIFO until driver reads them (no read timeout)
+
+static struct
+{
+    bool initialized;
+    bool async_read_active;
+    twr_fifo_t *read_fifo;
+    void (*event_handler)(twr_uart_channel_t, twr_uart_event_t, void *);
+    void *event_param;
+    void (*handler)(twr_uart_channel_t, const uint8_t *, size_t);
+
+} _uart_stub[TWR_UART_UART2 + 1];
+
+static void _uart_stub_event(void *param, uint32_t event);
+
+void uart_stub_set_handler(twr_uart_channel_t channel, void (*handler)(twr_uart_channel_t channel, const uint8_t *data, size_t length))
+{
+    _uart_stub[channel].handler = handler;
+}
+
+size_t uart_stub_receive(twr_uart_channel_t channel, const void *data, size_t length)
+{
+    if (!_uart_stub[channel].async_read_active || _uart_stub[channel].read_fifo == NULL)
+    {
+        return 0;
+    }
+
+    length = twr_fifo_irq_write(_uart_stub[channel].read_fifo, data, length);
+
+    twr_scheduler_post_event_irq(_uart_stub_event, (void *) (uintptr_t) channel, TWR_UART_EVENT_ASYNC_READ_DATA);
+
+    return length;
+}
+
+void twr_uart_init(twr_uart_channel_t channel, twr_uart_baudrate_t baudrate, twr_uart_setting_t setting)
+{
+    (void) baudrate;
+    (void) setting;
+
+    _uart_stub[channel].initialized = true;
+}
+
+void twr_uart_deinit(twr_uart_channel_t channel)
+{
+    _uart_stub[channel].initialized = false;
+    _uart_stub[channel].async_read_active = false;
+    _uart_stub[channel].read_fifo = NULL;
+    _uart_stub[channel].event_handler = NULL;
+}
+
+size_t twr_uart_write(twr_uart_channel_t channel, const void *buffer, size_t length)
+{
+    if (!_uart_stub[channel].initialized)
+    {
+        return 0;
+    }
+
+    if (_uart_stub[channel].handler != NULL)
+    {
+        _uart_stub[channel].handler(channel, buffer, length);
+    }
+
+    return length;
+}
+
+void twr_uart_set_event_handler(twr_uart_channel_t channel, void (*event_handler)(twr_uart_channel_t, twr_uart_event_t, void *), void *event_param)
+{
+    _uart_stub[channel].event_handler = event_handler;
+    _uart_stub[channel].event_param = event_param;
+}
+
+void twr_uart_set_async_fifo(twr_uart_channel_t channel, twr_fifo_t *write_fifo, twr_fifo_t *read_fifo)
+{
+    (void) write_fifo;
+
+    _uart_stub[channel].read_fifo = read_fifo;
+}
+
+size_t twr_uart_async_write(twr_uart_channel_t channel, const void *buffer, size_t length)
+{
+    length = twr_uart_write(channel, buffer, length);
+
+    if (length != 0)
+    {
+        twr_scheduler_post_event_irq(_uart_stub_event, (void *) (uintptr_t) channel, TWR_UART_EVENT_ASYNC_WRITE_DONE);
+    }
+
+    return length;
+}
+
+bool twr_uart_async_read_start(twr_uart_channel_t channel, twr_tick_t timeout)
+{
+    (void) timeout;
+
+    if (!_uart_stub[channel].initialized || _uart_stub[channel].read_fifo == NULL)
+    {
+        return false;
+    }
+
+    _uart_stub[channel].async_read_active = true;
+
+    return true;
+}
+
+bool twr_uart_async_read_cancel(twr_uart_channel_t channel)
+{
+    _uart_stub[channel].async_read_active = false;
+
+    return true;
+}
+
+size_t twr_uart_async_read(twr_uart_channel_t channel, void *buffer, size_t length)
+{
+    if (!_uart_stub[channel].async_read_active)
+    {
+        return 0;
+    }
+
+    return twr_fifo_read(_uart_stub[channel].read_fifo, buffer, length);
+}
+
+static void _uart_stub_event(void *param, uint32_t event)
+{
+    twr_uart_channel_t channel = (twr_uart_channel_t) (uintptr_t) param;
+
+    if (_uart_stub[channel].event_handler != NULL)
+    {
+        _uart_stub[channel].event_handler(channel, (twr_uart_event_t) event, _uart_stub[channel].event_param);
+    }
+}
@@ -0,0 +1,20 @@
+#ifndef _STUB_TWR_UART_H
+#define _STUB_TWR_UART_H
+
+#include <twr_uart.h>
+
+//! @brief Set handler receiving data written to channel
+//! @param[in] channel UART channel
+//! @param[in] handler Function called with written data or NULL
+
+void uart_stub_set_handler(twr_uart_channel_t channel, void (*handler)(twr_uart_channel_t channel, const uint8_t *data, size_t length));
+
+//! @brief Receive data on channel, they are stored to read FIFO and read data event is posted to scheduler
+//! @param[in] channel UART channel
+//! @param[in] data Received data
+//! @param[in] length Number of bytes
+//! @return Number of bytes stored (zero if asynchronous reading is not started)
+
+size_t uart_stub_receive(twr_uart_channel_t channel, const void *data, size_t length);
+
+#endif // _STUB_TWR_UART_H
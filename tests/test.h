@@ -0,0 +1,22 @@
+#ifndef _TEST_H
+#define _TEST_H
+
+#include <stdio.h>
+
+// Failed check is reported and the test goes on, main returns TEST_RESULT()
+
+static int _test_failures;
+
+#define TEST_CHECK(condition) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            _test_failures++; \
+        } \
+    } while (0)
+
+#define TEST_RESULT() (_test_failures == 0 ? 0 : 1)
+
+#endif // _TEST_H
@@ -0,0 +1,422 @@
+#include <test.h>
+#include <twr_data_stream.h>
+#include <stdlib.h>
+
+#define WINDOW 24
+
+// Reference window kept as plain history, statistics are computed from scratch on each check
+
+static double history[WINDOW * 100];
+static int history_length;
+
+static float random_float(void)
+{
+    return (float) (rand() % 200000 - 100000) / 100;
+}
+
+static int reference_length(void)
+{
+    return history_length < WINDOW ? history_length : WINDOW;
+}
+
+static double reference_sum(void)
+{
+    double sum = 0;
+
+    for (int i = history_length - reference_length(); i < history_length; i++)
+    {
+        sum += history[i];
+    }
+
+    return sum;
+}
+
+static void test_average_float(void)
+{
+    TWR_DATA_STREAM_FLOAT_BUFFER(buffer, WINDOW)
+    twr_data_stream_t stream;
+
+    srand(1);
+
+    twr_data_stream_init(&stream, 1, &buffer);
+
+    history_length = 0;
+
+    float average;
+
+    TEST_CHECK(!twr_data_stream_get_average(&stream, &average));
+
+    // Window turns over many times, the running sum must not drift from the window content
+    for (int i = 0; i < WINDOW * 100; i++)
+    {
+        float value = random_float() + 1000000;
+
+        twr_data_stream_feed(&stream, &value);
+
+        history[history_length++] = value;
+
+        TEST_CHECK(twr_data_stream_get_average(&stream, &average));
+
+        double expected = reference_sum() / reference_length();
+
+        TEST_CHECK(fabs(average - expected) <= fabs(expected) * 1e-6);
+    }
+
+    TEST_CHECK(twr_data_stream_get_length(&stream) == WINDOW);
+    TEST_CHECK(twr_data_stream_get_counter(&stream) == WINDOW * 100);
+
+    // Invalid sample resets the stream and its sum
+    float nan = NAN;
+
+    twr_data_stream_feed(&stream, &nan);
+
+    TEST_CHECK(!twr_data_stream_get_average(&stream, &average));
+
+    float value = 5;
+
+    twr_data_stream_feed(&stream, &value);
+
+    TEST_CHECK(twr_data_stream_get_average(&stream, &average) && average == 5);
+}
+
+static void test_average_int(void)
+{
+    TWR_DATA_STREAM_INT_BUFFER(buffer, WINDOW)
+    twr_data_stream_t stream;
+
+    srand(2);
+
+    twr_data_stream_init(&stream, WINDOW / 2, &buffer);
+
+    history_length = 0;
+
+    int average;
+
+    for (int i = 0; i < WINDOW * 100; i++)
+    {
+        // Values near the int limits, their window sum overflows 32 bits
+        int value = rand() % 2 == 0 ? INT32_MAX - rand() % 1000 : INT32_MIN + rand() % 1000;
+
+        twr_data_stream_feed(&stream, &value);
+
+        history[history_length++] = value;
+
+        bool valid = twr_data_stream_get_average(&stream, &average);
+
+        TEST_CHECK(valid == (history_length >= WINDOW / 2));
+
+        if (valid)
+        {
+            int64_t sum = 0;
+
+            for (int j = history_length - reference_length(); j < history_length; j++)
+            {
+                sum += (int64_t) history[j];
+            }
+
+            TEST_CHECK(average == sum / reference_length());
+        }
+    }
+
+    twr_data_stream_reset(&stream);
+
+    TEST_CHECK(!twr_data_stream_get_average(&stream, &average));
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static double reference_median(void)
+{
+    static double sort[WINDOW];
+
+    int length = reference_length();
+
+    memcpy(sort, &history[history_length - length], length * sizeof(double));
+
+    qsort(sort, length, sizeof(double), compare_double);
+
+    return length % 2 == 0 ? (sort[length / 2 - 1] + sort[length / 2]) / 2 : sort[length / 2];
+}
+
+static void test_median_float(void)
+{
+    TWR_DATA_STREAM_FLOAT_BUFFER(buffer, WINDOW)
+    twr_data_stream_t stream;
+
+    srand(3);
+
+    twr_data_stream_init(&stream, 1, &buffer);
+
+    history_length = 0;
+
+    float median;
+
+    for (int i = 0; i < WINDOW * 100; i++)
+    {
+        // Values less than 1 apart and repeated values must keep their order
+        float value = (float) (rand() % 50) / 16;
+
+        twr_data_stream_feed(&stream, &value);
+
+        history[history_length++] = value;
+
+        TEST_CHECK(twr_data_stream_get_median(&stream, &median));
+        TEST_CHECK(median == (float) reference_median());
+    }
+}
+
+static void test_median_int(void)
+{
+    TWR_DATA_STREAM_INT_BUFFER(buffer, WINDOW)
+    twr_data_stream_t stream;
+
+    srand(4);
+
+    twr_data_stream_init(&stream, 1, &buffer);
+
+    history_length = 0;
+
+    int median;
+    int min;
+    int max;
+
+    for (int i = 0; i < WINDOW * 100; i++)
+    {
+        int value = rand() % 100 - 50;
+
+        twr_data_stream_feed(&stream, &value);
+
+        history[history_length++] = value;
+
+        TEST_CHECK(twr_data_stream_get_median(&stream, &median));
+
+        // Median of even window is average of the middle samples rounded towards zero
+        TEST_CHECK(median == (int) reference_median());
+
+        int expected_min = value;
+        int expected_max = value;
+
+        for (int j = history_length - reference_length(); j < history_length; j++)
+        {
+            expected_min = history[j] < expected_min ? history[j] : expected_min;
+            expected_max = history[j] > expected_max ? history[j] : expected_max;
+        }
+
+        TEST_CHECK(twr_data_stream_get_min(&stream, &min) && min == expected_min);
+        TEST_CHECK(twr_data_stream_get_max(&stream, &max) && max == expected_max);
+    }
+}
+
+static void test_int16(void)
+{
+    TWR_DATA_STREAM_INT16_BUFFER(buffer, WINDOW, 10)
+    TWR_DATA_STREAM_FLOAT_BUFFER(buffer_float, WINDOW)
+    twr_data_stream_t stream;
+    twr_data_stream_t stream_float;
+
+    // Half of the float stream RAM
+    TEST_CHECK(sizeof(buffer_feed) + sizeof(buffer_sorted) == (sizeof(buffer_float_feed) + sizeof(buffer_float_sorted)) / 2);
+
+    srand(5);
+
+    twr_data_stream_init(&stream, 1, &buffer);
+    twr_data_stream_init(&stream_float, 1, &buffer_float);
+
+    TEST_CHECK(twr_data_stream_get_type(&stream) == TWR_DATA_STREAM_TYPE_INT16);
+    TEST_CHECK(twr_data_stream_get_scale(&stream) == 10);
+    TEST_CHECK(twr_data_stream_get_scale(&stream_float) == 1);
+
+    history_length = 0;
+
+    int16_t average;
+    int16_t median;
+    int16_t min;
+    int16_t max;
+    float average_float;
+    float median_float;
+
+    for (int i = 0; i < WINDOW * 100; i++)
+    {
+        // Temperature multiplied by 10, the window sum does not fit int16
+        int16_t value = i < WINDOW * 50 ? rand() % 1000 - 400 : INT16_MAX - rand() % 100;
+        float value_float = value;
+
+        twr_data_stream_feed(&stream, &value);
+        twr_data_stream_feed(&stream_float, &value_float);
+
+        history[history_length++] = value;
+
+        TEST_CHECK(twr_data_stream_get_average(&stream, &average));
+        TEST_CHECK(twr_data_stream_get_average(&stream_float, &average_float));
+
+        // Fixed-point average is rounded to nearest, halves away from zero
+        TEST_CHECK(average == (int16_t) lround(reference_sum() / reference_length()));
+        TEST_CHECK(fabsf(average - average_float) <= 0.5f);
+
+        TEST_CHECK(twr_data_stream_get_median(&stream, &median));
+        TEST_CHECK(twr_data_stream_get_median(&stream_float, &median_float));
+        TEST_CHECK(median == (int16_t) median_float);
+
+        TEST_CHECK(twr_data_stream_get_min(&stream, &min) && twr_data_stream_get_max(&stream, &max));
+        TEST_CHECK(min <= median && median <= max);
+    }
+
+    twr_data_stream_reset(&stream);
+
+    TEST_CHECK(!twr_data_stream_get_average(&stream, &average));
+}
+
+static void check_summary(twr_data_stream_t *stream, double scale)
+{
+    twr_data_stream_summary_t summary;
+
+    TEST_CHECK(twr_data_stream_get_summary(stream, &summary));
+
+    int length = reference_length();
+    double mean = reference_sum() / length;
+    double variance = 0;
+    double min = history[history_length - 1];
+    double max = min;
+
+    for (int i = history_length - length; i < history_length; i++)
+    {
+        variance += (history[i] - mean) * (history[i] - mean);
+        min = history[i] < min ? history[i] : min;
+        max = history[i] > max ? history[i] : max;
+    }
+
+    variance /= length;
+
+    TEST_CHECK(summary.count == length);
+    TEST_CHECK(fabs(summary.mean - mean / scale) < 1e-3);
+    TEST_CHECK(fabs(summary.variance - variance / scale / scale) <= variance / scale / scale * 1e-4 + 1e-3);
+    TEST_CHECK(summary.min == (float) (min / scale) && summary.max == (float) (max / scale));
+    TEST_CHECK(fabs(summary.median - reference_median() / scale) < 1e-3);
+    TEST_CHECK(summary.first == (float) (history[history_length - length] / scale));
+    TEST_CHECK(summary.last == (float) (history[history_length - 1] / scale));
+}
+
+static void test_summary(void)
+{
+    TWR_DATA_STREAM_FLOAT_BUFFER(buffer_float, WINDOW)
+    TWR_DATA_STREAM_INT_BUFFER(buffer_int, WINDOW)
+    TWR_DATA_STREAM_INT16_BUFFER(buffer_int16, WINDOW, 2)
+    twr_data_stream_t stream_float;
+    twr_data_stream_t stream_int;
+    twr_data_stream_t stream_int16;
+
+    srand(6);
+
+    twr_data_stream_init(&stream_float, 3, &buffer_float);
+    twr_data_stream_init(&stream_int, 3, &buffer_int);
+    twr_data_stream_init(&stream_int16, 3, &buffer_int16);
+
+    history_length = 0;
+
+    twr_data_stream_summary_t summary;
+
+    TEST_CHECK(!twr_data_stream_get_summary(&stream_float, &summary));
+
+    for (int i = 0; i < WINDOW * 10; i++)
+    {
+        // Humidity multiplied by 2, odd values of even window give median with half
+        int16_t value = rand() % 200;
+        int value_int = value;
+        float value_float = value;
+
+        twr_data_stream_feed(&stream_float, &value_float);
+        twr_data_stream_feed(&stream_int, &value_int);
+        twr_data_stream_feed(&stream_int16, &value);
+
+        history[history_length++] = value;
+
+        if (history_length < 3)
+        {
+            TEST_CHECK(!twr_data_stream_get_summary(&stream_int16, &summary));
+
+            continue;
+        }
+
+        check_summary(&stream_float, 1);
+        check_summary(&stream_int, 1);
+        check_summary(&stream_int16, 2);
+    }
+}
+
+static void test_rollup(void)
+{
+    TWR_DATA_STREAM_ROLLUP_LEVEL(hour, 10, 24)
+    TWR_DATA_STREAM_ROLLUP_LEVEL(day, 24, 7)
+
+    twr_data_stream_rollup_level_t *levels[] = { &hour, &day };
+    twr_data_stream_rollup_t rollup;
+    twr_data_stream_rollup_record_t record;
+
+    twr_data_stream_rollup_init(&rollup, levels, 2);
+
+    TEST_CHECK(!twr_data_stream_rollup_get_record(&rollup, 0, 0, &record));
+    TEST_CHECK(!twr_data_stream_rollup_get_total(&rollup, 1, &record));
+
+    // Nine days of samples, value is the sample index
+    for (int i = 0; i < 10 * 24 * 9; i++)
+    {
+        twr_data_stream_rollup_feed(&rollup, i);
+
+        if (i == 5)
+        {
+            // Ignored values do not count into the period
+            twr_data_stream_rollup_feed(&rollup, NAN);
+            twr_data_stream_rollup_feed(&rollup, INFINITY);
+        }
+    }
+
+    TEST_CHECK(twr_data_stream_rollup_get_length(&rollup, 0) == 24);
+    TEST_CHECK(twr_data_stream_rollup_get_length(&rollup, 1) == 7);
+    TEST_CHECK(twr_data_stream_rollup_get_length(&rollup, 2) == 0);
+
+    // Newest hour covers the last ten samples
+    TEST_CHECK(twr_data_stream_rollup_get_record(&rollup, 0, 0, &record));
+    TEST_CHECK(record.min == 2150 && record.max == 2159 && record.average == 2154.5f);
+
+    TEST_CHECK(twr_data_stream_rollup_get_record(&rollup, 0, 23, &record));
+    TEST_CHECK(record.min == 1920 && record.max == 1929 && record.average == 1924.5f);
+
+    TEST_CHECK(!twr_data_stream_rollup_get_record(&rollup, 0, 24, &record));
+
+    // Oldest kept day is the third one, the first two were overwritten
+    TEST_CHECK(twr_data_stream_rollup_get_record(&rollup, 1, 6, &record));
+    TEST_CHECK(record.min == 480 && record.max == 719 && record.average == 599.5f);
+
+    TEST_CHECK(twr_data_stream_rollup_get_total(&rollup, 1, &record));
+    TEST_CHECK(record.min == 480 && record.max == 2159 && record.average == 1319.5f);
+
+    twr_data_stream_rollup_reset(&rollup);
+
+    TEST_CHECK(twr_data_stream_rollup_get_length(&rollup, 0) == 0);
+    TEST_CHECK(twr_data_stream_rollup_get_length(&rollup, 1) == 0);
+}
+
+int main(void)
+{
+    test_average_float();
+
+    test_average_int();
+
+    test_median_float();
+
+    test_median_int();
+
+    test_int16();
+
+    test_summary();
+
+    test_rollup();
+
+    return TEST_RESULT();
+}
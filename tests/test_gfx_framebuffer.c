@@ -0,0 +1,336 @@
+#include <test.h>
+#include <twr_gfx_framebuffer.h>
+#include <twr_ls013b7dh03.h>
+
+#define WIDTH TWR_LS013B7DH03_WIDTH
+#define HEIGHT TWR_LS013B7DH03_HEIGHT
+
+// Reference display with the mandatory callbacks only, gfx draws everything pixel by pixel then
+
+static uint8_t reference[HEIGHT][WIDTH];
+
+static bool reference_is_ready(void *self)
+{
+    (void) self;
+
+    return true;
+}
+
+static void reference_clear(void *self)
+{
+    (void) self;
+
+    memset(reference, 0, sizeof(reference));
+}
+
+static void reference_draw_pixel(void *self, int x, int y, uint32_t color)
+{
+    (void) self;
+
+    reference[y][x] = color != 0;
+}
+
+static uint32_t reference_get_pixel(void *self, int x, int y)
+{
+    (void) self;
+
+    return reference[y][x];
+}
+
+static bool reference_update(void *self)
+{
+    (void) self;
+
+    return true;
+}
+
+static twr_gfx_caps_t reference_get_caps(void *self)
+{
+    (void) self;
+
+    twr_gfx_caps_t caps = { .width = WIDTH, .height = HEIGHT };
+
+    return caps;
+}
+
+static const twr_gfx_driver_t reference_driver =
+{
+    .is_ready = reference_is_ready,
+    .clear = reference_clear,
+    .draw_pixel = reference_draw_pixel,
+    .get_pixel = reference_get_pixel,
+    .update = reference_update,
+    .get_caps = reference_get_caps
+};
+
+static bool pin_cs_set(bool state)
+{
+    (void) state;
+
+    return true;
+}
+
+TWR_GFX_FRAMEBUFFER(framebuffer_buffer, WIDTH, HEIGHT)
+
+static twr_gfx_framebuffer_t framebuffer;
+static twr_ls013b7dh03_t lcd;
+
+static bool displays_match(void)
+{
+    for (int y = 0; y < HEIGHT; y++)
+    {
+        for (int x = 0; x < WIDTH; x++)
+        {
+            if (twr_gfx_framebuffer_get_pixel(&framebuffer, x, y) != reference[y][x] || twr_ls013b7dh03_get_pixel(&lcd, x, y) != reference[y][x])
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static void draw_random(twr_gfx_t *gfx, uint32_t seed)
+{
+    static const twr_font_t *fonts[] = { &twr_font_ubuntu_11, &twr_font_ubuntu_15, &twr_font_ubuntu_28 };
+
+    srand(seed);
+
+    int x0 = rand() % 170 - 20;
+    int y0 = rand() % 170 - 20;
+    int x1 = rand() % 170 - 20;
+    int y1 = rand() % 170 - 20;
+    uint32_t color = rand() % 2;
+
+    twr_gfx_set_rotation(gfx, rand() % 4);
+    twr_gfx_set_font(gfx, fonts[rand() % 3]);
+
+    switch (rand() % 8)
+    {
+        case 0:
+        {
+            twr_gfx_draw_line(gfx, x0, y0, x1, y1, color);
+
+            break;
+        }
+        case 1:
+        {
+            twr_gfx_draw_fill_rectangle(gfx, x0, y0, x1, y1, color);
+
+            break;
+        }
+        case 2:
+        {
+            twr_gfx_draw_fill_rectangle_dithering(gfx, x0, y0, x1, y1, rand());
+
+            break;
+        }
+        case 3:
+        {
+            twr_gfx_draw_circle(gfx, x0, y0, x1 % 30 + 1, color);
+
+            break;
+        }
+        case 4:
+        {
+            twr_gfx_draw_fill_circle(gfx, x0, y0, x1 % 30 + 1, color);
+
+            break;
+        }
+        case 5:
+        {
+            twr_gfx_draw_fill_round_corner(gfx, x0, y0, x1 % 30 + 1, y1 & 15, color);
+
+            break;
+        }
+        case 6:
+        {
+            twr_gfx_draw_rectangle(gfx, x0, y0, x1, y1, color);
+
+            break;
+        }
+        default:
+        {
+            twr_gfx_printf(gfx, x0, y0, color, "%d.%d", x1, y1 & 7);
+
+            break;
+        }
+    }
+}
+
+static void test_drawing(void)
+{
+    twr_gfx_t gfx_framebuffer;
+    twr_gfx_t gfx_lcd;
+    twr_gfx_t gfx_reference;
+
+    twr_gfx_framebuffer_init(&framebuffer, &framebuffer_buffer);
+    twr_ls013b7dh03_init(&lcd, pin_cs_set);
+
+    twr_gfx_init(&gfx_framebuffer, &framebuffer, twr_gfx_framebuffer_get_driver());
+    twr_gfx_init(&gfx_lcd, &lcd, twr_ls013b7dh03_get_driver());
+    twr_gfx_init(&gfx_reference, NULL, &reference_driver);
+
+    twr_gfx_clear(&gfx_lcd);
+    twr_gfx_clear(&gfx_reference);
+
+    // Fill and bitmap callbacks of both drivers give the pixels of per-pixel drawing
+    for (uint32_t i = 0; i < 3000; i++)
+    {
+        draw_random(&gfx_framebuffer, i);
+        draw_random(&gfx_lcd, i);
+        draw_random(&gfx_reference, i);
+
+        if (i % 30 == 0)
+        {
+            TEST_CHECK(displays_match());
+        }
+    }
+
+    TEST_CHECK(displays_match());
+}
+
+static void scroll_reference(int x0, int y0, int x1, int y1, int dx, int dy)
+{
+    static uint8_t copy[HEIGHT][WIDTH];
+
+    memcpy(copy, reference, sizeof(copy));
+
+    for (int y = y0; y <= y1; y++)
+    {
+        for (int x = x0; x <= x1; x++)
+        {
+            // Pixels without source within rectangle keep their state
+            if (x - dx >= x0 && x - dx <= x1 && y - dy >= y0 && y - dy <= y1)
+            {
+                reference[y][x] = copy[y - dy][x - dx];
+            }
+        }
+    }
+}
+
+static void test_scroll(void)
+{
+    srand(9);
+
+    for (int i = 0; i < 3000; i++)
+    {
+        // Random content, scroll keeps mixed pixels in edge bytes
+        if (i % 100 == 0)
+        {
+            for (int y = 0; y < HEIGHT; y++)
+            {
+                for (int x = 0; x < WIDTH; x++)
+                {
+                    uint32_t color = rand() % 2;
+
+                    reference[y][x] = color;
+
+                    twr_gfx_framebuffer_draw_pixel(&framebuffer, x, y, color);
+                    twr_ls013b7dh03_draw_pixel(&lcd, x, y, color);
+                }
+            }
+        }
+
+        int x0 = rand() % WIDTH;
+        int y0 = rand() % HEIGHT;
+        int x1 = x0 + rand() % (WIDTH - x0);
+        int y1 = y0 + rand() % (HEIGHT - y0);
+        int dx = 0;
+        int dy = 0;
+
+        if (rand() % 2 == 0)
+        {
+            dx = rand() % (x1 - x0 + 1) * (rand() % 2 == 0 ? 1 : -1);
+        }
+        else
+        {
+            dy = rand() % (y1 - y0 + 1) * (rand() % 2 == 0 ? 1 : -1);
+        }
+
+        uint8_t before[HEIGHT][WIDTH];
+
+        memcpy(before, reference, sizeof(before));
+
+        twr_gfx_framebuffer_update(&framebuffer);
+
+        scroll_reference(x0, y0, x1, y1, dx, dy);
+
+        twr_gfx_framebuffer_scroll(&framebuffer, x0, y0, x1, y1, dx, dy);
+        twr_ls013b7dh03_scroll(&lcd, x0, y0, x1, y1, dx, dy);
+
+        TEST_CHECK(displays_match());
+
+        // Only lines whose content changed are dirty
+        for (int y = 0; y < HEIGHT; y++)
+        {
+            bool changed = memcmp(before[y], reference[y], WIDTH) != 0;
+
+            TEST_CHECK(changed == ((framebuffer_buffer.dirty[y / 8] >> (y % 8)) & 1));
+        }
+    }
+}
+
+static void test_stats(void)
+{
+    twr_gfx_framebuffer_stats_t stats;
+
+    twr_gfx_framebuffer_init(&framebuffer, &framebuffer_buffer);
+
+    twr_gfx_t gfx;
+
+    twr_gfx_init(&gfx, &framebuffer, twr_gfx_framebuffer_get_driver());
+
+    twr_gfx_draw_pixel(&gfx, 3, 10, 1);
+    twr_gfx_draw_pixel(&gfx, 3, 11, 1);
+    twr_gfx_draw_pixel(&gfx, 3, 11, 1);
+    twr_gfx_draw_fill_rectangle(&gfx, 0, 40, 127, 40, 1);
+
+    TEST_CHECK(twr_gfx_update(&gfx));
+
+    twr_gfx_framebuffer_get_stats(&framebuffer, &stats);
+
+    TEST_CHECK(stats.pixels == 3 && stats.fills == 1 && stats.updates == 1);
+
+    // Two runs of lines, each line with address and dummy byte, each run with mode and trailing byte
+    TEST_CHECK(stats.lines == 3);
+    TEST_CHECK(stats.spi_bytes == 3 * (WIDTH / 8 + 2) + 2 * 2);
+
+    // Nothing changed since last update
+    TEST_CHECK(twr_gfx_update(&gfx));
+
+    twr_gfx_framebuffer_get_stats(&framebuffer, &stats);
+
+    TEST_CHECK(stats.updates == 2 && stats.lines == 3);
+
+    twr_gfx_framebuffer_reset_stats(&framebuffer);
+    twr_gfx_framebuffer_get_stats(&framebuffer, &stats);
+
+    TEST_CHECK(stats.updates == 0 && stats.spi_bytes == 0);
+
+    static uint8_t image[16 + WIDTH / 8 * HEIGHT];
+
+    size_t length = twr_gfx_framebuffer_get_pbm(&framebuffer, image, sizeof(image));
+
+    TEST_CHECK(length == strlen("P4\n128 128\n") + WIDTH / 8 * HEIGHT);
+    TEST_CHECK(memcmp(image, "P4\n128 128\n", strlen("P4\n128 128\n")) == 0);
+
+    // Black pixel is set bit of PBM
+    TEST_CHECK(image[length - WIDTH / 8 * HEIGHT + 10 * WIDTH / 8] == 0x10);
+
+    TEST_CHECK(twr_gfx_framebuffer_get_pbm(&framebuffer, image, length - 1) == 0);
+}
+
+int main(void)
+{
+    twr_scheduler_init();
+
+    test_drawing();
+
+    test_scroll();
+
+    test_stats();
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,334 @@
+#include <test.h>
+#include <stub/application.h>
+#include <stub/twr_spi.h>
+#include <twr_ls013b7dh03.h>
+#include <twr_gfx.h>
+
+#define LINE_BYTES (TWR_LS013B7DH03_WIDTH / 8)
+#define LINE_INCREMENT (LINE_BYTES + 2)
+
+// Display memory as written by the received frames
+
+static struct
+{
+    uint8_t memory[TWR_LS013B7DH03_HEIGHT][LINE_BYTES];
+
+    int frames;
+    int lines;
+
+} display;
+
+static twr_ls013b7dh03_t lcd;
+
+static uint8_t reverse(uint8_t value)
+{
+    uint8_t result = 0;
+
+    for (int i = 0; i < 8; i++)
+    {
+        if ((value >> i) & 1)
+        {
+            result |= 0x80 >> i;
+        }
+    }
+
+    return result;
+}
+
+static void display_receive(const uint8_t *data, size_t length)
+{
+    // Clear memory command
+    if ((data[0] & 0xa0) == 0x20)
+    {
+        memset(display.memory, 0xff, sizeof(display.memory));
+
+        return;
+    }
+
+    // VCOM toggle without data
+    if ((data[0] & 0x80) == 0)
+    {
+        return;
+    }
+
+    TEST_CHECK(length >= LINE_INCREMENT + 2 && (length - 2) % LINE_INCREMENT == 0);
+
+    int count = (length - 2) / LINE_INCREMENT;
+    int first = reverse(data[1]) - 1;
+
+    for (int i = 0; i < count; i++)
+    {
+        const uint8_t *line = &data[1 + i * LINE_INCREMENT];
+
+        // Lines of frame are consecutive
+        TEST_CHECK(reverse(line[0]) - 1 == first + i);
+
+        memcpy(display.memory[first + i], &line[1], LINE_BYTES);
+    }
+
+    display.frames++;
+    display.lines += count;
+}
+
+static bool pin_cs_set(bool state)
+{
+    (void) state;
+
+    return true;
+}
+
+// Send everything requested, driver starts next run of lines from its task
+
+static void flush(void)
+{
+    do
+    {
+        application_run_until(twr_tick_get());
+    }
+    while (spi_stub_complete());
+}
+
+static bool display_matches(void)
+{
+    for (int y = 0; y < TWR_LS013B7DH03_HEIGHT; y++)
+    {
+        if (memcmp(display.memory[y], &lcd._framebuffer[2 + y * LINE_INCREMENT], LINE_BYTES) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void setup(uint8_t *transfer)
+{
+    twr_scheduler_init();
+
+    memset(&display, 0, sizeof(display));
+
+    spi_stub_set_handler(display_receive);
+
+    twr_ls013b7dh03_init(&lcd, pin_cs_set);
+
+    twr_ls013b7dh03_set_transfer_buffer(&lcd, transfer);
+}
+
+static void test_dirty_runs(void)
+{
+    setup(NULL);
+
+    // First update sends whole framebuffer in one frame
+    TEST_CHECK(twr_ls013b7dh03_update(&lcd));
+
+    flush();
+
+    TEST_CHECK(display.frames == 1 && display.lines == TWR_LS013B7DH03_HEIGHT);
+    TEST_CHECK(display_matches());
+
+    // Nothing changed, nothing is sent
+    display.frames = 0;
+    display.lines = 0;
+
+    twr_ls013b7dh03_draw_pixel(&lcd, 5, 5, 0);
+    twr_ls013b7dh03_fill_rectangle(&lcd, 0, 0, 127, 127, 0);
+
+    TEST_CHECK(twr_ls013b7dh03_update(&lcd));
+
+    flush();
+
+    TEST_CHECK(display.frames == 0);
+
+    // Run with single clean line in between is merged, farther line goes in its own frame
+    size_t bytes = spi_stub_get_bytes();
+
+    twr_ls013b7dh03_draw_pixel(&lcd, 0, 10, 1);
+    twr_ls013b7dh03_draw_pixel(&lcd, 127, 12, 1);
+    twr_ls013b7dh03_fill_rectangle(&lcd, 60, 40, 70, 40, 1);
+
+    TEST_CHECK(twr_ls013b7dh03_update(&lcd));
+
+    // Second run is sent after the first one
+    TEST_CHECK(!twr_ls013b7dh03_is_ready(&lcd));
+
+    flush();
+
+    TEST_CHECK(twr_ls013b7dh03_is_ready(&lcd));
+    TEST_CHECK(display.frames == 2 && display.lines == 4);
+    TEST_CHECK(spi_stub_get_bytes() - bytes == 4 * LINE_INCREMENT + 2 * 2);
+    TEST_CHECK(display_matches());
+
+    // Display memory is lost by clear command, everything is sent again
+    TEST_CHECK(twr_ls013b7dh03_clear_memory_command(&lcd));
+    TEST_CHECK(twr_ls013b7dh03_update(&lcd));
+
+    flush();
+
+    TEST_CHECK(display.lines == 4 + TWR_LS013B7DH03_HEIGHT);
+    TEST_CHECK(display_matches());
+}
+
+static void draw_random(void)
+{
+    int x0 = rand() % TWR_LS013B7DH03_WIDTH;
+    int y0 = rand() % TWR_LS013B7DH03_HEIGHT;
+    int x1 = x0 + rand() % (TWR_LS013B7DH03_WIDTH - x0);
+    int y1 = y0 + rand() % 4 * (rand() % 2);
+
+    if (y1 >= TWR_LS013B7DH03_HEIGHT)
+    {
+        y1 = TWR_LS013B7DH03_HEIGHT - 1;
+    }
+
+    if (rand() % 2 == 0)
+    {
+        twr_ls013b7dh03_fill_rectangle(&lcd, x0, y0, x1, y1, rand() % 2);
+    }
+    else
+    {
+        twr_ls013b7dh03_draw_pixel(&lcd, x0, y0, rand() % 2);
+    }
+}
+
+static void test_random(uint8_t *transfer)
+{
+    srand(7);
+
+    setup(transfer);
+
+    int skipped = 0;
+
+    // Drawing, updates, transfer completions and driver task runs come in random order
+    for (int i = 0; i < 20000; i++)
+    {
+        switch (rand() % 8)
+        {
+            case 0:
+            case 1:
+            case 2:
+            case 3:
+            {
+                if (twr_ls013b7dh03_is_ready(&lcd))
+                {
+                    draw_random();
+                }
+                else
+                {
+                    skipped++;
+                }
+
+                break;
+            }
+            case 4:
+            case 5:
+            {
+                twr_ls013b7dh03_update(&lcd);
+
+                break;
+            }
+            case 6:
+            {
+                spi_stub_complete();
+
+                break;
+            }
+            default:
+            {
+                application_run_until(twr_tick_get() + rand() % 20);
+
+                break;
+            }
+        }
+    }
+
+    flush();
+
+    while (!twr_ls013b7dh03_update(&lcd))
+    {
+        flush();
+    }
+
+    flush();
+
+    TEST_CHECK(display_matches());
+
+    // Framebuffer is never busy with second buffer
+    TEST_CHECK(transfer == NULL || skipped == 0);
+}
+
+static void test_glyph_blit(void)
+{
+    static twr_ls013b7dh03_t reference;
+    static twr_gfx_driver_t reference_driver;
+
+    const twr_font_t *fonts[] = { &twr_font_ubuntu_11, &twr_font_ubuntu_13, &twr_font_ubuntu_15, &twr_font_ubuntu_24, &twr_font_ubuntu_28, &twr_font_ubuntu_33 };
+
+    srand(8);
+
+    setup(NULL);
+
+    twr_ls013b7dh03_init(&reference, pin_cs_set);
+
+    // Same driver without bitmap callback draws glyphs pixel by pixel
+    reference_driver = *twr_ls013b7dh03_get_driver();
+    reference_driver.draw_bitmap = NULL;
+
+    twr_gfx_t gfx;
+    twr_gfx_t gfx_reference;
+
+    twr_gfx_init(&gfx, &lcd, twr_ls013b7dh03_get_driver());
+    twr_gfx_init(&gfx_reference, &reference, &reference_driver);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        twr_gfx_rotation_t rotation = rand() % 4;
+        const twr_font_t *font = fonts[rand() % 6];
+
+        // Positions partly off the display too
+        int left = rand() % 168 - 20;
+        int top = rand() % 168 - 20;
+        uint8_t ch = 0x20 + rand() % 224;
+        uint32_t color = rand() % 2;
+
+        twr_gfx_set_rotation(&gfx, rotation);
+        twr_gfx_set_rotation(&gfx_reference, rotation);
+        twr_gfx_set_font(&gfx, font);
+        twr_gfx_set_font(&gfx_reference, font);
+
+        int width = twr_gfx_draw_char(&gfx, left, top, ch, color);
+
+        TEST_CHECK(width == twr_gfx_draw_char(&gfx_reference, left, top, ch, color));
+
+        if (i % 50 == 0)
+        {
+            TEST_CHECK(memcmp(lcd._framebuffer, reference._framebuffer, sizeof(lcd._framebuffer)) == 0);
+
+            // Line is dirty only if its content changed
+            TEST_CHECK(memcmp(lcd._dirty, reference._dirty, sizeof(lcd._dirty)) == 0);
+
+            memset(lcd._dirty, 0, sizeof(lcd._dirty));
+            memset(reference._dirty, 0, sizeof(reference._dirty));
+        }
+
+        if (i % 500 == 0)
+        {
+            twr_gfx_clear(&gfx);
+            twr_gfx_clear(&gfx_reference);
+        }
+    }
+}
+
+int main(void)
+{
+    static uint8_t transfer[TWR_LS013B7DH03_FRAMEBUFFER_SIZE];
+
+    test_dirty_runs();
+
+    test_random(NULL);
+
+    test_random(transfer);
+
+    test_glyph_blit();
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,255 @@
+#include <test.h>
+#include <stub/application.h>
+#include <stub/twr_spi.h>
+#include <stub/twr_exti.h>
+#include <stub/twr_tca9534a.h>
+#include <twr_module_lcd.h>
+
+static int renders;
+static int frames;
+
+static void render(void *param)
+{
+    (void) param;
+
+    // Framebuffer is not drawn while frame is sent from it
+    TEST_CHECK(!spi_stub_is_busy());
+
+    static uint32_t color;
+
+    renders++;
+
+    // Every render changes one line
+    color = !color;
+
+    twr_gfx_draw_fill_rectangle(twr_module_lcd_get_gfx(), 0, 0, 127, 0, color);
+}
+
+static void display_receive(const uint8_t *data, size_t length)
+{
+    (void) length;
+
+    // Write command, VCOM toggles are not counted
+    if ((data[0] & 0x80) != 0)
+    {
+        frames++;
+    }
+}
+
+// Sensor handler requesting redraw the given number of times, invalidation is planned from the scheduler spin
+
+static twr_scheduler_task_id_t sensor_task_id;
+static int sensor_requests;
+
+static void sensor_task(void *param)
+{
+    (void) param;
+
+    for (int i = 0; i < sensor_requests; i++)
+    {
+        twr_module_lcd_invalidate();
+    }
+}
+
+static void sensor_request(int requests)
+{
+    sensor_requests = requests;
+
+    twr_scheduler_plan_now(sensor_task_id);
+
+    application_run_until(twr_tick_get());
+}
+
+// Run for the duration, SPI transfer finishes within a few milliseconds
+
+static void run(twr_tick_t duration)
+{
+    twr_tick_t tick_end = twr_tick_get() + duration;
+
+    while (twr_tick_get() < tick_end)
+    {
+        application_run_until(twr_tick_get() + 5);
+
+        spi_stub_complete();
+    }
+}
+
+static void test_handler_late(void)
+{
+    sensor_request(1);
+
+    run(1000);
+
+    TEST_CHECK(renders == 0 && frames == 0);
+
+    // Invalidation requested before handler was set is not lost
+    twr_module_lcd_set_render_handler(render, NULL);
+
+    run(1000);
+
+    TEST_CHECK(renders == 1 && frames == 1);
+}
+
+static void test_burst(void)
+{
+    renders = 0;
+    frames = 0;
+
+    sensor_request(5);
+
+    // Render waits for requests following at the same wake-up
+    application_run_until(twr_tick_get() + TWR_MODULE_LCD_INVALIDATE_DELAY - 1);
+
+    TEST_CHECK(renders == 0);
+
+    run(1000);
+    TEST_CHECK(renders == 1 && frames == 1);
+}
+
+static void test_stream(void)
+{
+    renders = 0;
+
+    // Requests keep coming faster than the delay, planned render is not postponed by them
+    for (int i = 0; i < 10; i++)
+    {
+        sensor_request(1);
+
+        run(TWR_MODULE_LCD_INVALIDATE_DELAY / 2);
+    }
+
+    TEST_CHECK(renders >= 3);
+
+    run(1000);
+}
+
+static void test_busy(void)
+{
+    renders = 0;
+    frames = 0;
+
+    sensor_request(1);
+
+    // Frame stays in flight
+    application_run_until(twr_tick_get() + TWR_MODULE_LCD_INVALIDATE_DELAY);
+
+    TEST_CHECK(renders == 1 && spi_stub_is_busy());
+
+    sensor_request(1);
+
+    application_run_until(twr_tick_get() + 10 * TWR_MODULE_LCD_INVALIDATE_DELAY);
+
+    TEST_CHECK(renders == 1);
+
+    // Request made during transfer is rendered after it
+    run(1000);
+
+    TEST_CHECK(renders == 2 && frames == 2);
+}
+
+static void test_hour(void)
+{
+    renders = 0;
+    frames = 0;
+
+    // Sensor handlers request redraw twice per measurement
+    for (int i = 0; i < 720; i++)
+    {
+        sensor_request(2);
+
+        run(5000);
+    }
+
+    TEST_CHECK(renders == 720 && frames == 720);
+
+    printf("renders per hour: %d\n", renders);
+}
+
+static int button_events[0x40];
+
+static void button_event_handler(twr_module_lcd_event_t event, void *event_param)
+{
+    (void) event_param;
+
+    button_events[event]++;
+}
+
+static void button_set(twr_tca9534a_pin_t pin, int state)
+{
+    // Pressed button also drives BUTTON line of the core
+    twr_gpio_set_output(TWR_GPIO_BUTTON, state);
+
+    tca9534a_stub_set_input(pin, state);
+
+    exti_stub_trigger(TWR_EXTI_LINE_BUTTON);
+}
+
+static void test_buttons(void)
+{
+    twr_module_lcd_set_event_handler(button_event_handler, NULL);
+
+    run(1000);
+
+    // Released buttons are not scanned
+    TEST_CHECK(twr_scheduler_get_next_tick() == TWR_TICK_INFINITY);
+
+    button_set(TWR_TCA9534A_PIN_P3, 1);
+
+    run(200);
+
+    TEST_CHECK(button_events[TWR_MODULE_LCD_EVENT_LEFT_PRESS] == 1);
+
+    // Pressed button is scanned until it is released
+    TEST_CHECK(twr_scheduler_get_next_tick() != TWR_TICK_INFINITY);
+
+    button_set(TWR_TCA9534A_PIN_P3, 0);
+
+    run(200);
+
+    TEST_CHECK(button_events[TWR_MODULE_LCD_EVENT_LEFT_RELEASE] == 1);
+    TEST_CHECK(button_events[TWR_MODULE_LCD_EVENT_LEFT_CLICK] == 1);
+    TEST_CHECK(button_events[TWR_MODULE_LCD_EVENT_RIGHT_PRESS] == 0);
+
+    TEST_CHECK(twr_scheduler_get_next_tick() == TWR_TICK_INFINITY);
+
+    // Hold is recognized while scanning continues
+    button_set(TWR_TCA9534A_PIN_P1, 1);
+
+    run(3000);
+
+    TEST_CHECK(button_events[TWR_MODULE_LCD_EVENT_RIGHT_HOLD] == 1);
+
+    button_set(TWR_TCA9534A_PIN_P1, 0);
+
+    run(200);
+
+    TEST_CHECK(button_events[TWR_MODULE_LCD_EVENT_RIGHT_RELEASE] == 1);
+    TEST_CHECK(button_events[TWR_MODULE_LCD_EVENT_RIGHT_CLICK] == 0);
+
+    TEST_CHECK(twr_scheduler_get_next_tick() == TWR_TICK_INFINITY);
+}
+
+int main(void)
+{
+    twr_scheduler_init();
+
+    spi_stub_set_handler(display_receive);
+
+    twr_module_lcd_init();
+
+    sensor_task_id = twr_scheduler_register(sensor_task, NULL, TWR_TICK_INFINITY);
+
+    test_handler_late();
+
+    test_burst();
+
+    test_stream();
+
+    test_busy();
+
+    test_hour();
+
+    test_buttons();
+
+    return TEST_RESULT();
+}
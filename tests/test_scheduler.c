@@ -0,0 +1,425 @@
+#include <test.h>
+#include <stub/application.h>
+#include <stub/twr_system.h>
+#include <twr_scheduler.h>
+
+#define TASK_COUNT 24
+
+typedef struct
+{
+    twr_tick_t tick_planned;
+    twr_tick_t period;
+    twr_tick_t tick_last;
+    int invocations;
+
+} task_t;
+
+static task_t tasks[TASK_COUNT];
+
+static int order[TASK_COUNT];
+static int order_length;
+
+static void task_once(void *param)
+{
+    task_t *task = param;
+
+    task->invocations++;
+    task->tick_last = twr_tick_get();
+
+    order[order_length++] = task - tasks;
+}
+
+static void task_periodic(void *param)
+{
+    task_t *task = param;
+
+    // Period is kept from the spin tick, lateness would show up as missed invocations
+    TEST_CHECK(twr_scheduler_get_spin_tick() == task->tick_planned);
+
+    task->invocations++;
+    task->tick_planned += task->period;
+
+    twr_scheduler_plan_current_absolute(task->tick_planned);
+}
+
+static void test_heap_order(void)
+{
+    twr_scheduler_init();
+
+    memset(tasks, 0, sizeof(tasks));
+    order_length = 0;
+
+    twr_tick_t tick_start = twr_tick_get();
+
+    srand(1);
+
+    for (int i = 0; i < TASK_COUNT; i++)
+    {
+        tasks[i].tick_planned = tick_start + 1 + rand() % 5000;
+
+        twr_scheduler_register(task_once, &tasks[i], tasks[i].tick_planned);
+    }
+
+    // Part of the tasks is moved later or earlier, some are removed
+    for (twr_scheduler_task_id_t i = 0; i < TASK_COUNT; i += 3)
+    {
+        tasks[i].tick_planned = tick_start + 1 + rand() % 5000;
+
+        twr_scheduler_plan_absolute(i, tasks[i].tick_planned);
+    }
+
+    twr_scheduler_unregister(7);
+    twr_scheduler_unregister(11);
+
+    application_run_until(tick_start + 10000);
+
+    TEST_CHECK(order_length == TASK_COUNT - 2);
+
+    for (int i = 0; i < order_length; i++)
+    {
+        task_t *task = &tasks[order[i]];
+
+        TEST_CHECK(task->invocations == 1);
+        TEST_CHECK(task->tick_last == task->tick_planned);
+
+        if (i > 0)
+        {
+            TEST_CHECK(tasks[order[i - 1]].tick_planned <= task->tick_planned);
+        }
+    }
+
+    TEST_CHECK(tasks[7].invocations == 0);
+    TEST_CHECK(tasks[11].invocations == 0);
+
+    TEST_CHECK(twr_scheduler_get_next_tick() == TWR_TICK_INFINITY);
+}
+
+static void test_periodic(void)
+{
+    twr_scheduler_init();
+
+    memset(tasks, 0, sizeof(tasks));
+
+    twr_tick_t tick_start = twr_tick_get();
+
+    static const twr_tick_t periods[] = { 10, 30, 70, 100, 1000, 3700, 60000 };
+
+    int count = sizeof(periods) / sizeof(periods[0]);
+
+    for (int i = 0; i < count; i++)
+    {
+        tasks[i].period = periods[i];
+        tasks[i].tick_planned = tick_start + periods[i];
+
+        twr_scheduler_register(task_periodic, &tasks[i], tasks[i].tick_planned);
+    }
+
+    application_run_until(tick_start + 100000);
+
+    for (int i = 0; i < count; i++)
+    {
+        TEST_CHECK(tasks[i].invocations == (int) (100000 / periods[i]));
+    }
+
+    for (twr_scheduler_task_id_t i = 0; i < (twr_scheduler_task_id_t) count; i++)
+    {
+        twr_scheduler_unregister(i);
+    }
+}
+
+static twr_scheduler_task_id_t task_id_spin;
+static int spin_invocations;
+
+static void task_spin(void *param)
+{
+    (void) param;
+
+    spin_invocations++;
+
+    // Execution takes one tick
+    twr_tick_increment_irq(1);
+
+    // Task planned to the past from within the spin runs in the next spin, not in the same one
+    twr_scheduler_plan_current_now();
+}
+
+static void task_stop(void *param)
+{
+    (void) param;
+
+    twr_scheduler_unregister(task_id_spin);
+}
+
+static void test_spin_bounded(void)
+{
+    twr_scheduler_init();
+
+    twr_tick_t tick_start = twr_tick_get();
+
+    spin_invocations = 0;
+
+    task_id_spin = twr_scheduler_register(task_spin, NULL, 0);
+
+    twr_scheduler_register(task_stop, NULL, tick_start + 5);
+
+    application_run_until(tick_start + 10);
+
+    // One invocation per spin, task planned to tick 0 runs before the stop task in the last spin
+    TEST_CHECK(spin_invocations == 6);
+}
+
+static void test_plan_unregistered(void)
+{
+    twr_scheduler_init();
+
+    memset(tasks, 0, sizeof(tasks));
+
+    twr_tick_t tick_start = twr_tick_get();
+
+    twr_scheduler_task_id_t task_id = twr_scheduler_register(task_once, &tasks[0], TWR_TICK_INFINITY);
+
+    twr_scheduler_unregister(task_id);
+
+    // Stale and never registered task IDs are ignored
+    twr_scheduler_plan_now(task_id);
+    twr_scheduler_plan_relative(TWR_SCHEDULER_MAX_TASKS - 1, 10);
+
+    TEST_CHECK(twr_scheduler_get_next_tick() == TWR_TICK_INFINITY);
+
+    application_run_until(tick_start + 100);
+
+    TEST_CHECK(tasks[0].invocations == 0);
+}
+
+static twr_scheduler_task_id_t task_id_event;
+static twr_scheduler_task_id_t event_task_id_current;
+static int event_invocations;
+static int event_task_invocations;
+
+static void event_handler(void *param, uint32_t event)
+{
+    (void) param;
+
+    TEST_CHECK(event == 42);
+
+    event_invocations++;
+    event_task_id_current = twr_scheduler_get_current_task_id();
+
+    // Must not replan the task that ran last
+    twr_scheduler_plan_current_now();
+
+    twr_scheduler_plan_now(task_id_event);
+}
+
+static void task_post(void *param)
+{
+    (void) param;
+
+    TEST_CHECK(twr_scheduler_post_event_irq(event_handler, NULL, 42));
+}
+
+static void task_event(void *param)
+{
+    (void) param;
+
+    event_task_invocations++;
+}
+
+static void test_event(void)
+{
+    twr_scheduler_init();
+
+    twr_tick_t tick_start = twr_tick_get();
+
+    event_invocations = 0;
+    event_task_invocations = 0;
+
+    twr_scheduler_task_id_t task_id_post = twr_scheduler_register(task_post, NULL, tick_start + 10);
+
+    task_id_event = twr_scheduler_register(task_event, NULL, TWR_TICK_INFINITY);
+
+    application_run_until(tick_start + 100);
+
+    TEST_CHECK(event_invocations == 1);
+    TEST_CHECK(event_task_invocations == 1);
+    TEST_CHECK(event_task_id_current == TWR_SCHEDULER_TASK_ID_NONE);
+
+    twr_scheduler_unregister(task_id_post);
+    twr_scheduler_unregister(task_id_event);
+}
+
+static void test_coalesced_tick(void)
+{
+    TEST_CHECK(twr_scheduler_get_coalesced_tick(5, 2) == 6);
+    TEST_CHECK(twr_scheduler_get_coalesced_tick(7, 2) == 8);
+    TEST_CHECK(twr_scheduler_get_coalesced_tick(1000, 0) == 1000);
+    TEST_CHECK(twr_scheduler_get_coalesced_tick(1000, 100) == 1024);
+
+    srand(2);
+
+    for (int i = 0; i < 100000; i++)
+    {
+        twr_tick_t tick = 1 + rand() % 1000000;
+        twr_tick_t slack = rand() % 5000;
+
+        twr_tick_t tick_coalesced = twr_scheduler_get_coalesced_tick(tick, slack);
+
+        TEST_CHECK(tick_coalesced >= tick && tick_coalesced <= tick + slack);
+
+        // No tick in the window is aligned to a larger power of two
+        twr_tick_t align = tick_coalesced & -tick_coalesced;
+
+        TEST_CHECK((tick + slack) / (align * 2) * (align * 2) < tick);
+    }
+
+    // Overflow of the window is clipped below infinity
+    TEST_CHECK(twr_scheduler_get_coalesced_tick(TWR_TICK_INFINITY - 10, 100) < TWR_TICK_INFINITY);
+}
+
+// Update intervals of the application sensors (humidity, CO2, VOC, pressure, battery), started at staggered ticks
+
+static const twr_tick_t sensor_intervals[] = { 60000, 120000, 300000, 300000, 300000 };
+
+static twr_tick_t sensor_slack_divider;
+static twr_tick_t sensor_tick_wake_up;
+static int sensor_wake_ups;
+static int sensor_measurements;
+
+static void task_sensor(void *param)
+{
+    twr_tick_t interval = *(const twr_tick_t *) param;
+
+    if (sensor_tick_wake_up != twr_scheduler_get_spin_tick())
+    {
+        sensor_tick_wake_up = twr_scheduler_get_spin_tick();
+
+        sensor_wake_ups++;
+    }
+
+    sensor_measurements++;
+
+    if (sensor_slack_divider == 0)
+    {
+        twr_scheduler_plan_current_relative(interval);
+    }
+    else
+    {
+        twr_scheduler_plan_current_relative_with_slack(interval, interval / sensor_slack_divider);
+    }
+}
+
+// Slack is the interval divided by the divider, no slack for zero
+
+static int sensor_day(twr_tick_t slack_divider)
+{
+    twr_scheduler_init();
+
+    twr_tick_t tick_start = twr_tick_get();
+
+    sensor_slack_divider = slack_divider;
+    sensor_tick_wake_up = TWR_TICK_INFINITY;
+    sensor_wake_ups = 0;
+    sensor_measurements = 0;
+
+    for (size_t i = 0; i < sizeof(sensor_intervals) / sizeof(sensor_intervals[0]); i++)
+    {
+        twr_scheduler_register(task_sensor, (void *) &sensor_intervals[i], tick_start + 1000 + i * 1500);
+    }
+
+    application_run_until(tick_start + 24 * 60 * 60 * 1000);
+
+    printf("slack of 1/%u interval: %d wake-ups, %d measurements per day\n", (unsigned) slack_divider, sensor_wake_ups, sensor_measurements);
+
+    for (twr_scheduler_task_id_t i = 0; i < sizeof(sensor_intervals) / sizeof(sensor_intervals[0]); i++)
+    {
+        twr_scheduler_unregister(i);
+    }
+
+    return sensor_wake_ups;
+}
+
+static void test_coalesced_wake_ups(void)
+{
+    int wake_ups = sensor_day(0);
+
+    // Every measurement wakes up the device on its own
+    TEST_CHECK(wake_ups == sensor_measurements && wake_ups == 3024);
+
+    // Default TWR_SCHEDULER_UPDATE_SLACK of one eighth of the interval
+    int wake_ups_coalesced = sensor_day(8);
+
+    TEST_CHECK(wake_ups_coalesced * 2 < wake_ups);
+}
+
+static void task_burn(void *param)
+{
+    // Callback takes 1.5 ms, less than the tick resolution of the scheduler
+    system_stub_spend(*(uint32_t *) param);
+
+    twr_scheduler_plan_current_relative(100);
+}
+
+static void task_idle(void *param)
+{
+    (void) param;
+
+    twr_scheduler_plan_current_relative(100);
+}
+
+static void test_profile(void)
+{
+    twr_scheduler_init();
+
+    static uint32_t burn = 1500;
+
+    twr_tick_t tick_start = twr_tick_get();
+
+    twr_scheduler_task_id_t task_id_burn = twr_scheduler_register(task_burn, &burn, tick_start + 100);
+    twr_scheduler_task_id_t task_id_idle = twr_scheduler_register(task_idle, NULL, tick_start + 100);
+
+    application_run_until(tick_start + 1000);
+
+    twr_scheduler_profile_t profile;
+
+    TEST_CHECK(twr_scheduler_get_profile(task_id_burn, &profile));
+    TEST_CHECK(profile.task == task_burn);
+    TEST_CHECK(profile.invocations == 10);
+    TEST_CHECK(profile.time_total == 15000);
+    TEST_CHECK(profile.time_max == 1500);
+    TEST_CHECK(profile.lateness_max == 0);
+
+    TEST_CHECK(twr_scheduler_get_profile(task_id_idle, &profile));
+    TEST_CHECK(profile.invocations == 10);
+    TEST_CHECK(profile.time_total == 0);
+
+    twr_scheduler_reset_profile();
+
+    TEST_CHECK(twr_scheduler_get_profile(task_id_burn, &profile));
+    TEST_CHECK(profile.invocations == 0 && profile.time_total == 0 && profile.time_max == 0);
+
+    twr_scheduler_unregister(task_id_burn);
+    twr_scheduler_unregister(task_id_idle);
+
+    TEST_CHECK(!twr_scheduler_get_profile(task_id_burn, &profile));
+}
+
+int main(void)
+{
+    test_heap_order();
+
+    test_periodic();
+
+    test_spin_bounded();
+
+    test_plan_unregistered();
+
+    test_coalesced_tick();
+
+    test_event();
+
+    test_coalesced_wake_ups();
+
+    test_profile();
+
+    return TEST_RESULT();
+}
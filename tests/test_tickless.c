@@ -0,0 +1,255 @@
+#include <test.h>
+#include <twr_scheduler.h>
+#include <twr_system.h>
+#include <twr_rtc.h>
+#include <twr_sleep.h>
+#include <twr_error.h>
+#include <setjmp.h>
+
+// Wake-up timer clock, time of the model is kept in its counts
+#define COUNTS_PER_SECOND (LSE_VALUE / 16)
+#define COUNTS_PER_SUBSECOND (COUNTS_PER_SECOND / TWR_RTC_PREDIV_S)
+
+twr_sleep_manager_t sleep_manager;
+
+int _twr_rtc_writable_semaphore;
+
+void _twr_system_tickless_irq(void);
+
+static struct
+{
+    RTC_TypeDef rtc;
+
+    uint64_t now;
+
+    bool wut_enabled;
+    uint64_t wut_expiry;
+    uint32_t wut_period;
+
+    // Time of the next interrupt other than the wake-up timer
+    uint64_t external;
+    uint32_t external_mean;
+    twr_scheduler_task_id_t external_task_id;
+
+    int wake_ups;
+
+} model;
+
+static jmp_buf exit_point;
+static twr_tick_t tick_end;
+
+static uint32_t bcd(uint32_t value)
+{
+    return ((value / 10) << 4) | (value % 10);
+}
+
+RTC_TypeDef *rtc_model_access(void)
+{
+    // Timer starts counting when it is enabled
+    if ((model.rtc.CR & RTC_CR_WUTE) == 0)
+    {
+        model.wut_enabled = false;
+    }
+    else if (!model.wut_enabled)
+    {
+        model.wut_enabled = true;
+        model.wut_period = (model.rtc.WUTR & 0xffff) + 1;
+        model.wut_expiry = model.now + model.wut_period;
+    }
+
+    uint64_t subseconds = model.now / COUNTS_PER_SUBSECOND;
+    uint32_t seconds = (subseconds / TWR_RTC_PREDIV_S) % 86400;
+
+    model.rtc.SSR = TWR_RTC_PREDIV_S - 1 - subseconds % TWR_RTC_PREDIV_S;
+    model.rtc.TR = (bcd(seconds / 3600) << RTC_TR_HU_Pos) | (bcd(seconds / 60 % 60) << RTC_TR_MNU_Pos) | (bcd(seconds % 60) << RTC_TR_SU_Pos);
+    model.rtc.ISR |= RTC_ISR_WUTWF | RTC_ISR_RSF;
+
+    return &model.rtc;
+}
+
+static void model_init(uint32_t external_mean)
+{
+    // Time goes on across the tests like the tick does
+    uint64_t now = model.now;
+
+    memset(&model, 0, sizeof(model));
+
+    model.now = now;
+
+    // Periodic tick as set up by twr_system_init
+    model.rtc.WUTR = COUNTS_PER_SECOND * TWR_SCHEDULER_INTERVAL_MS / 1000;
+    model.rtc.CR = RTC_CR_WUTE;
+
+    model.external_mean = external_mean;
+    model.external = external_mean != 0 ? now + (uint64_t) rand() % (2 * external_mean) : UINT64_MAX;
+
+    rtc_model_access();
+}
+
+static uint32_t model_get_ms(void)
+{
+    return model.now * 1000 / COUNTS_PER_SECOND;
+}
+
+// Advance time to the tick, wake-up timer interrupts are served on the way
+static bool model_advance(uint64_t until)
+{
+    rtc_model_access();
+
+    if (model.wut_enabled && model.wut_expiry <= until)
+    {
+        model.now = model.wut_expiry;
+        model.wut_expiry += model.wut_period;
+
+        model.rtc.ISR &= ~RTC_ISR_WUTF;
+
+        _twr_system_tickless_irq();
+
+        return true;
+    }
+
+    model.now = until;
+
+    return false;
+}
+
+void application_idle(void)
+{
+    if (twr_tick_get() >= tick_end)
+    {
+        longjmp(exit_point, 1);
+    }
+
+    // Core sleeps until the wake-up timer or other interrupt
+    if (!model_advance(model.external))
+    {
+        model.external += 1 + (uint64_t) rand() % (2 * model.external_mean);
+
+        // Interrupt handler hands the work over to a task, the scheduler restarts the sleep
+        twr_scheduler_plan_now(model.external_task_id);
+    }
+
+    model.wake_ups++;
+}
+
+void application_error(twr_error_t code)
+{
+    printf("application_error: %d\n", (int) code);
+
+    exit(1);
+}
+
+static void run_until(twr_tick_t tick)
+{
+    tick_end = tick;
+
+    if (setjmp(exit_point) == 0)
+    {
+        twr_scheduler_run();
+    }
+}
+
+static int task_invocations;
+static int32_t task_lag_min;
+static int32_t task_lag_max;
+
+static void task_minute(void *param)
+{
+    (void) param;
+
+    // Difference of the RTC and the tick at the planned time
+    int32_t lag = (int32_t) (model_get_ms() - twr_tick_get());
+
+    if (task_lag_min > lag)
+    {
+        task_lag_min = lag;
+    }
+
+    if (task_lag_max < lag)
+    {
+        task_lag_max = lag;
+    }
+
+    task_invocations++;
+
+    // Execution takes a few milliseconds
+    model_advance(model.now + COUNTS_PER_SECOND * 3 / 1000);
+
+    twr_scheduler_plan_current_relative(60000);
+}
+
+static int external_invocations;
+
+static void task_external(void *param)
+{
+    (void) param;
+
+    external_invocations++;
+}
+
+static void test_early_wake_up(void)
+{
+    srand(3);
+
+    twr_scheduler_init();
+
+    model_init(COUNTS_PER_SECOND * 7);
+
+    task_invocations = 0;
+    task_lag_min = INT32_MAX;
+    task_lag_max = INT32_MIN;
+    external_invocations = 0;
+
+    twr_scheduler_register(task_minute, NULL, 60000);
+
+    model.external_task_id = twr_scheduler_register(task_external, NULL, TWR_TICK_INFINITY);
+
+    run_until(3600 * 1000);
+
+    TEST_CHECK(task_invocations == 60);
+    TEST_CHECK(external_invocations > 400);
+
+    // Hundreds of restarted sleeps would lose seconds if the partial interval were dropped on re-arm
+    TEST_CHECK(task_lag_min > -20);
+    TEST_CHECK(task_lag_max < 100);
+
+    printf("early wake-ups: %d, lag %ld to %ld ms\n", external_invocations, (long) task_lag_min, (long) task_lag_max);
+}
+
+static void task_once(void *param)
+{
+    (void) param;
+
+    task_invocations++;
+}
+
+static void test_long_sleep(void)
+{
+    twr_scheduler_init();
+
+    model_init(0);
+
+    twr_tick_t tick_start = twr_tick_get();
+
+    task_invocations = 0;
+
+    twr_scheduler_register(task_once, NULL, tick_start + 100000);
+
+    run_until(tick_start + 100000);
+
+    TEST_CHECK(task_invocations == 1);
+
+    // Periodic tick expiration, three sleeps capped at 32 s and the rest of the timeout
+    TEST_CHECK(model.wake_ups <= 5);
+
+    printf("long sleep wake-ups: %d\n", model.wake_ups);
+}
+
+int main(void)
+{
+    test_early_wake_up();
+
+    test_long_sleep();
+
+    return TEST_RESULT();
+}